@@ -57,6 +57,14 @@
  *
  */
 #define ESP_PANEL_TOUCH_XPT2046_ENABLE_LOCKING          (0)     // 0/1
+/**
+ * Number of the samples of the batch reads.
+ * When this value is not 0, the driver converts Z1, Z2 and this number of X/Y samples in one full-duplex SPI
+ * transaction and takes the median of the samples, instead of a transaction for every conversion. The driver adds its
+ * own device on the SPI host of the touch.
+ *
+ */
+#define ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES           (0)     // 0~16, 0 means disabled
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////// File Version ///////////////////////////////////////////////////////////
@@ -73,5 +81,5 @@
  *
  */
 #define ESP_PANEL_CONF_FILE_VERSION_MAJOR 0
-#define ESP_PANEL_CONF_FILE_VERSION_MINOR 1
-#define ESP_PANEL_CONF_FILE_VERSION_PATCH 2
+#define ESP_PANEL_CONF_FILE_VERSION_MINOR 2
+#define ESP_PANEL_CONF_FILE_VERSION_PATCH 0
@@ -15,8 +15,8 @@
 
 /* File `ESP_Panel_Conf.h` */
 #define ESP_PANEL_CONF_VERSION_MAJOR 0
-#define ESP_PANEL_CONF_VERSION_MINOR 1
-#define ESP_PANEL_CONF_VERSION_PATCH 2
+#define ESP_PANEL_CONF_VERSION_MINOR 2
+#define ESP_PANEL_CONF_VERSION_PATCH 0
 
 /* File `ESP_Panel_Board_Custom.h` */
 #define ESP_PANEL_BOARD_CUSTOM_VERSION_MAJOR 0
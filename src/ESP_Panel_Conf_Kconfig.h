@@ -69,3 +69,10 @@
 #define ESP_PANEL_TOUCH_XPT2046_ENABLE_LOCKING  (1)
 #endif
 #endif
+#ifndef ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES
+#ifdef CONFIG_ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES
+#define ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES CONFIG_ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES
+#else
+#define ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES   (0)
+#endif
+#endif
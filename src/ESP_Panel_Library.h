@@ -12,6 +12,32 @@
 #include "ESP_PanelTypes.h"
 #include "ESP_PanelVersions.h"
 
+/* Utils */
+#include "utils/esp_panel_boot.h"
+#include "utils/esp_panel_color_stream.h"
+#include "utils/esp_panel_draw_bounce.h"
+#include "utils/esp_panel_draw_queue.h"
+#include "utils/esp_panel_draw_split.h"
+#include "utils/esp_panel_init_seq.h"
+#include "utils/esp_panel_pixel.h"
+#include "utils/esp_panel_pixel_convert.h"
+#include "utils/esp_panel_pixel_diff.h"
+#include "utils/esp_panel_pixel_fill.h"
+#include "utils/esp_panel_pixel_region.h"
+#include "utils/esp_panel_pixel_tune.h"
+#include "utils/esp_panel_pixel_worker.h"
+#include "utils/esp_panel_scroll.h"
+#include "utils/esp_panel_spi_bitbang.h"
+#include "utils/esp_panel_spi_pack.h"
+#include "utils/esp_panel_swap_chain.h"
+#include "utils/esp_panel_te_sync.h"
+#include "utils/esp_panel_touch_calib.h"
+#include "utils/esp_panel_touch_filter.h"
+#include "utils/esp_panel_touch_gesture.h"
+#include "utils/esp_panel_touch_ring.h"
+#include "utils/esp_panel_window_cache.h"
+#include "utils/esp_panel_xpt2046_batch.h"
+
 /* Host */
 #include "host/ESP_PanelHost.h"
 
@@ -25,6 +51,7 @@
 
 /* LCD */
 #include "lcd/ESP_PanelLcd.h"
+#include "lcd/ESP_PanelSwapChain.h"
 #include "lcd/EK79007.h"
 #include "lcd/JD9365.h"
 #include "lcd/EK9716B.h"
@@ -6,7 +6,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include "ESP_PanelLog.h"
+#include "esp_heap_caps.h"
 #include "esp_lcd_panel_io.h"
+#include "esp_timer.h"
+#include "utils/esp_panel_color_stream.h"
 #include "ESP_PanelBus.h"
 
 #define FLAGS_DEFAULT(host_init)     \
@@ -15,13 +18,20 @@
         .del_skip_panel_io = 0,      \
     }
 
+// The color transfers waited for by the bus are not longer than a frame, a longer wait means the bus is stuck
+#define COLOR_TRANS_WAIT_TIMEOUT_MS     (1000)
+
 static const char *TAG = "ESP_PanelBus";
 
 ESP_PanelBus::ESP_PanelBus(int host_id, uint8_t bus_type, bool host_need_init):
     flags(FLAGS_DEFAULT(host_need_init)),
     host_id(host_id),
     bus_type(bus_type),
-    handle(NULL)
+    handle(NULL),
+    _color_trans_done_callback(NULL),
+    _color_trans_done_user_ctx(NULL),
+    _color_trans{},
+    _color_stream{}
 {
 }
 
@@ -36,15 +46,159 @@ bool ESP_PanelBus::readRegisterData(uint32_t address, void *data, uint32_t data_
 bool ESP_PanelBus::writeRegisterData(uint32_t address, const void *data, uint32_t data_size)
 {
     ESP_PANEL_CHECK_ERR_RET(esp_lcd_panel_io_tx_param(handle, address, data, data_size), false,
-                            "Read register(0x%" PRIx32 ") failed", address);
+                            "Write register(0x%" PRIx32 ") failed", address);
 
     return true;
 }
 
 bool ESP_PanelBus::writeColorData(uint32_t address, const void *color, uint32_t color_size)
 {
-    ESP_PANEL_CHECK_ERR_RET(esp_lcd_panel_io_tx_param(handle, address, color, color_size), false,
-                            "Read register(0x%" PRIx32 ") failed", address);
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(
+        !esp_panel_color_stream_is_active(_color_stream.handle), false, "Color stream is active"
+    );
+
+    if (_color_trans.sem == NULL) {
+        ESP_PANEL_CHECK_FALSE_RET(registerColorTransDoneHandler(), false, "Register color trans done handler failed");
+    }
+    ESP_PANEL_CHECK_FALSE_RET(waitQueuedColorTrans(), false, "Wait for queued transfers failed");
+
+    /* The finish event of this transfer is taken by the bus, not passed to the callback */
+    xSemaphoreTake(_color_trans.sem, 0);
+    __atomic_store_n(&_color_trans.is_data_pending, true, __ATOMIC_RELEASE);
+    if (esp_lcd_panel_io_tx_color(handle, address, color, color_size) != ESP_OK) {
+        __atomic_store_n(&_color_trans.is_data_pending, false, __ATOMIC_RELEASE);
+        ESP_LOGE(TAG, "Write color(0x%" PRIx32 ") failed", address);
+        return false;
+    }
+    while (__atomic_load_n(&_color_trans.is_data_pending, __ATOMIC_ACQUIRE)) {
+        if (xSemaphoreTake(_color_trans.sem, pdMS_TO_TICKS(COLOR_TRANS_WAIT_TIMEOUT_MS)) != pdTRUE) {
+            __atomic_store_n(&_color_trans.is_data_pending, false, __ATOMIC_RELEASE);
+            ESP_LOGE(TAG, "Wait for color(0x%" PRIx32 ") timeout", address);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ESP_PanelBus::registerColorTransDoneCallback(
+    esp_lcd_panel_io_color_trans_done_cb_t callback, void *user_ctx, const esp_panel_draw_queue_t *queue
+)
+{
+    /* Only clear the callback, the handler is kept for the transfers of the bus */
+    if (callback == NULL) {
+        _color_trans_done_callback = NULL;
+        _color_trans_done_user_ctx = NULL;
+        _color_trans.queue = NULL;
+        return true;
+    }
+
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Not begun");
+
+    _color_trans_done_callback = callback;
+    _color_trans_done_user_ctx = user_ctx;
+    _color_trans.queue = queue;
+    ESP_PANEL_CHECK_FALSE_RET(registerColorTransDoneHandler(), false, "Register color trans done handler failed");
+
+    return true;
+}
+
+bool ESP_PanelBus::beginColorStream(int cmd, int continue_cmd, size_t buf_size)
+{
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (bus_type != ESP_PANEL_BUS_TYPE_RGB) && (bus_type != ESP_PANEL_BUS_TYPE_MIPI_DSI) &&
+        (bus_type != ESP_PANEL_BUS_TYPE_I2C), false, "Color stream is not supported by the bus type(%d)", bus_type
+    );
+    ESP_PANEL_CHECK_FALSE_RET(buf_size > 0, false, "Invalid buffer size");
+    ESP_PANEL_CHECK_FALSE_RET(
+        !esp_panel_color_stream_is_active(_color_stream.handle), false, "Color stream is already begun"
+    );
+
+    if ((_color_stream.handle != NULL) && (_color_stream.buf_size != buf_size)) {
+        delColorStream();
+    }
+    if (_color_stream.handle == NULL) {
+        for (int i = 0; i < ESP_PANEL_COLOR_STREAM_BUF_NUM; i++) {
+            _color_stream.bufs[i] = (uint8_t *)heap_caps_malloc(buf_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            if (_color_stream.bufs[i] == NULL) {
+                ESP_LOGE(TAG, "Malloc color stream buffer(%d) failed", (int)buf_size);
+                delColorStream();
+                return false;
+            }
+        }
+        _color_stream.buf_size = buf_size;
+        esp_panel_color_stream_config_t config = {
+            .bufs = {_color_stream.bufs[0], _color_stream.bufs[1]},
+            .buf_size = buf_size,
+            .tx_cb = sendColorStream,
+            .wait_cb = waitColorStream,
+            .user_ctx = this,
+        };
+        _color_stream.handle = esp_panel_color_stream_new(&config);
+        if (_color_stream.handle == NULL) {
+            ESP_LOGE(TAG, "Create color stream failed");
+            delColorStream();
+            return false;
+        }
+        ESP_PANEL_CHECK_FALSE_RET(registerColorTransDoneHandler(), false, "Register color trans done handler failed");
+    }
+
+    /* The finish events of the queued transfers (like the LCD drawings) should not be taken as the stream ones */
+    ESP_PANEL_CHECK_FALSE_RET(waitQueuedColorTrans(), false, "Wait for queued transfers failed");
+    xSemaphoreTake(_color_trans.sem, 0);
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_color_stream_begin(_color_stream.handle, cmd, continue_cmd), false, "Begin color stream failed"
+    );
+    _color_stream.start_us = esp_timer_get_time();
+
+    return true;
+}
+
+bool ESP_PanelBus::writeColorStream(const void *data, size_t size)
+{
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_color_stream_is_active(_color_stream.handle), false, "Color stream not begun");
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_color_stream_write(_color_stream.handle, data, size), false, "Write color stream failed"
+    );
+
+    return true;
+}
+
+bool ESP_PanelBus::endColorStream(void)
+{
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_color_stream_is_active(_color_stream.handle), false, "Color stream not begun");
+
+    bool ret = esp_panel_color_stream_end(_color_stream.handle);
+    _color_stream.stream_us += esp_timer_get_time() - _color_stream.start_us;
+    ESP_PANEL_CHECK_FALSE_RET(ret, false, "End color stream failed");
+
+    return true;
+}
+
+bool ESP_PanelBus::getColorStreamStats(ESP_PanelBusColorStreamStats_t &stats, bool clear)
+{
+    stats = {};
+    if (_color_stream.handle == NULL) {
+        return true;
+    }
+
+    esp_panel_color_stream_stats_t stream_stats = {};
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_color_stream_get_stats(_color_stream.handle, &stream_stats, clear), false, "Get stats failed"
+    );
+    stats.bytes = stream_stats.bytes;
+    stats.transfers = stream_stats.transfers;
+    stats.streams = stream_stats.streams;
+    stats.stalls = stream_stats.stalls;
+    stats.stream_us = _color_stream.stream_us;
+    stats.throughput_kbps = (stats.stream_us > 0) ? (stats.bytes * 1000 / stats.stream_us) : 0;
+    if (clear) {
+        _color_stream.stream_us = 0;
+    }
 
     return true;
 }
@@ -53,11 +207,23 @@ bool ESP_PanelBus::del(void)
 {
     ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
 
+    delColorStream();
+    _color_trans_done_callback = NULL;
+    _color_trans_done_user_ctx = NULL;
+    if (_color_trans.sem != NULL) {
+        vSemaphoreDelete(_color_trans.sem);
+    }
+    _color_trans = {};
+
     // RGB bus which needs to initialize the host inside and not skip panel IO can be deleted
     if ((bus_type == ESP_PANEL_BUS_TYPE_RGB) && (!flags.host_need_init || flags.del_skip_panel_io)) {
         ESP_LOGD(TAG, "Use RGB bus without host init or enable skip panel IO, skip delete panel IO");
         goto end;
     }
+    // The panel IO may be deleted already, like the one of a SPI bus taken over by the touch device
+    if (handle == NULL) {
+        goto end;
+    }
 
     ESP_PANEL_CHECK_ERR_RET(esp_lcd_panel_io_del(handle), false, "Delete panel IO failed");
     ESP_LOGD(TAG, "Delete panel IO @%p", handle);
@@ -79,3 +245,104 @@ uint8_t ESP_PanelBus::getType(void)
 
     return bus_type;
 }
+
+IRAM_ATTR bool ESP_PanelBus::onColorTransDone(void *panel_io, void *edata, void *user_ctx)
+{
+    ESP_PanelBus *bus = (ESP_PanelBus *)user_ctx;
+    if (bus == NULL) {
+        return false;
+    }
+
+    BaseType_t need_yield = pdFALSE;
+    /**
+     * The LCD doesn't draw while the color stream or `writeColorData()` is active, so the finished transfer belongs to
+     * the bus
+     */
+    if (esp_panel_color_stream_is_active(bus->_color_stream.handle)) {
+        esp_panel_color_stream_on_done(bus->_color_stream.handle);
+    } else if (__atomic_exchange_n(&bus->_color_trans.is_data_pending, false, __ATOMIC_ACQ_REL)) {
+        /* The transfer of `writeColorData()` */
+    } else if (bus->_color_trans_done_callback != NULL) {
+        need_yield = bus->_color_trans_done_callback(
+                         (esp_lcd_panel_io_handle_t)panel_io, (esp_lcd_panel_io_event_data_t *)edata,
+                         bus->_color_trans_done_user_ctx
+                     ) ? pdTRUE : pdFALSE;
+    }
+    /* Given after the callback, so the waiter sees the updated draw queue */
+    if (bus->_color_trans.sem != NULL) {
+        xSemaphoreGiveFromISR(bus->_color_trans.sem, &need_yield);
+    }
+
+    return (need_yield == pdTRUE);
+}
+
+bool ESP_PanelBus::sendColorStream(void *user_ctx, int cmd, const void *data, size_t size)
+{
+    ESP_PanelBus *bus = (ESP_PanelBus *)user_ctx;
+
+    ESP_PANEL_CHECK_ERR_RET(esp_lcd_panel_io_tx_color(bus->handle, cmd, data, size), false, "Send color failed");
+
+    return true;
+}
+
+bool ESP_PanelBus::waitColorStream(void *user_ctx, uint32_t token)
+{
+    ESP_PanelBus *bus = (ESP_PanelBus *)user_ctx;
+
+    /* The semaphore is given by every finished transfer, so check the token again after taking it */
+    while (!esp_panel_color_stream_is_done(bus->_color_stream.handle, token)) {
+        ESP_PANEL_CHECK_FALSE_RET(
+            xSemaphoreTake(bus->_color_trans.sem, pdMS_TO_TICKS(COLOR_TRANS_WAIT_TIMEOUT_MS)) == pdTRUE, false,
+            "Wait for color stream timeout"
+        );
+    }
+
+    return true;
+}
+
+bool ESP_PanelBus::waitQueuedColorTrans(void)
+{
+    /* Only the transfers of the registered queue are known, like the LCD drawings */
+    if (_color_trans.queue == NULL) {
+        return true;
+    }
+
+    while (esp_panel_draw_queue_get_pending(_color_trans.queue) > 0) {
+        ESP_PANEL_CHECK_FALSE_RET(
+            xSemaphoreTake(_color_trans.sem, pdMS_TO_TICKS(COLOR_TRANS_WAIT_TIMEOUT_MS)) == pdTRUE, false,
+            "Wait for queued transfers timeout"
+        );
+    }
+
+    return true;
+}
+
+bool ESP_PanelBus::registerColorTransDoneHandler(void)
+{
+    if (_color_trans.sem == NULL) {
+        _color_trans.sem = xSemaphoreCreateBinary();
+        ESP_PANEL_CHECK_NULL_RET(_color_trans.sem, false, "Create color trans semaphore failed");
+    }
+
+    esp_lcd_panel_io_callbacks_t io_cb = {
+        .on_color_trans_done = (esp_lcd_panel_io_color_trans_done_cb_t)onColorTransDone,
+    };
+    ESP_PANEL_CHECK_ERR_RET(
+        esp_lcd_panel_io_register_event_callbacks(handle, &io_cb, this), false, "Register panel IO callback failed"
+    );
+
+    return true;
+}
+
+void ESP_PanelBus::delColorStream(void)
+{
+    if (_color_stream.handle != NULL) {
+        esp_panel_color_stream_del(_color_stream.handle);
+    }
+    for (int i = 0; i < ESP_PANEL_COLOR_STREAM_BUF_NUM; i++) {
+        if (_color_stream.bufs[i] != NULL) {
+            heap_caps_free(_color_stream.bufs[i]);
+        }
+    }
+    _color_stream = {};
+}
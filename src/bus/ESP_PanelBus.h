@@ -7,8 +7,15 @@
 #pragma once
 
 #include "esp_lcd_types.h"
+#include "esp_lcd_panel_io.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "utils/esp_panel_color_stream.h"
+#include "utils/esp_panel_draw_queue.h"
 #include "ESP_PanelTypes.h"
 
+#define ESP_PANEL_BUS_COLOR_STREAM_BUFFER_SIZE  (4096)  // Default size of every buffer used by the color stream, in bytes
+
 /**
  * @brief Bus object class
  *
@@ -91,14 +98,102 @@ public:
     /**
      * @brief Write the color data
      *
-     * @param address   The address of the register
-     * @param data      The buffer to store the color data
-     * @param data_size The size of the data (in bytes)
+     * @note  The color data is sent by `esp_lcd_panel_io_tx_color()` (DMA for the SPI and QSPI buses), and this function
+     *        returns after the transfer is finished. The finish is waited for by the color transfer done event, so the
+     *        one set by `esp_lcd_panel_io_register_event_callbacks()` is replaced, like
+     *        `registerColorTransDoneCallback()`
+     * @note  The queued drawings of the LCD are waited for first, and the LCD should not draw until this function
+     *        returns
+     *
+     * @param address    The address of the register
+     * @param color      The buffer of the color data
+     * @param color_size The size of the color data (in bytes)
      *
      * @return true if success, otherwise false
      */
     bool writeColorData(uint32_t address, const void *color, uint32_t color_size);
 
+    /**
+     * @brief Register the callback which is called when a color transfer is finished
+     *
+     * @note  This function should be called after `begin()`, and it replaces the one set by
+     *        `esp_lcd_panel_io_register_event_callbacks()`. The callback is not called for the transfers of the color
+     *        stream and `writeColorData()`
+     *
+     * @param callback The callback function, it is called in the ISR context. `NULL` means to clear the callback
+     * @param user_ctx The user context passed to the callback
+     * @param queue    The queue of the transfers which are finished by the callback, like the drawings of the LCD. The
+     *                 bus waits for them to finish before its own transfers. `NULL` means unknown
+     *
+     * @return true if success, otherwise false
+     */
+    bool registerColorTransDoneCallback(
+        esp_lcd_panel_io_color_trans_done_cb_t callback, void *user_ctx, const esp_panel_draw_queue_t *queue = NULL
+    );
+
+    /**
+     * @brief Begin a stream of color data, the data is written in pieces by `writeColorStream()` and sent by
+     *        `esp_lcd_panel_io_tx_color()`
+     *
+     * @note  This function should be called after `begin()`
+     * @note  The data is copied into two internal DMA buffers in turn, and a buffer is sent once it is full. So the
+     *        pixels can be produced incrementally (like lines of a decoder) while the previous buffer is being sent,
+     *        without building a whole bitmap
+     * @note  The queued drawings of the LCD are waited for first, and the LCD should not draw until
+     *        `endColorStream()` is called
+     * @note  The address window should be set before, like by the CASET (0x2A) and RASET (0x2B) commands
+     *
+     * @param cmd          The command sent before the first buffer, like `0x2C` (RAMWR). For QSPI, it should be
+     *                     encoded in the same way as the LCD driver does
+     * @param continue_cmd The command sent before the following buffers, like `0x3C` (RAMWRC). `-1` means no command
+     * @param buf_size     The size of every buffer in bytes, default is `ESP_PANEL_BUS_COLOR_STREAM_BUFFER_SIZE`
+     *
+     * @return true if success, otherwise false
+     */
+    bool beginColorStream(int cmd, int continue_cmd = -1, size_t buf_size = ESP_PANEL_BUS_COLOR_STREAM_BUFFER_SIZE);
+
+    /**
+     * @brief Write a piece of color data to the stream
+     *
+     * @note  This function only blocks when both buffers are being sent
+     *
+     * @param data The buffer of the color data, it can be reused once this function returns
+     * @param size The size of the color data (in bytes)
+     *
+     * @return true if success, otherwise false
+     */
+    bool writeColorStream(const void *data, size_t size);
+
+    /**
+     * @brief End the stream, the remaining data is sent and all the transfers are waited for
+     *
+     * @return true if success, otherwise false
+     */
+    bool endColorStream(void);
+
+    /**
+     * @brief Counters of the color stream
+     *
+     */
+    typedef struct {
+        uint64_t bytes;             /*!< Number of the sent bytes */
+        uint32_t transfers;         /*!< Number of the sent buffers */
+        uint32_t streams;           /*!< Number of the finished streams */
+        uint32_t stalls;            /*!< Number of the times that writing waits for a buffer still being sent */
+        uint64_t stream_us;         /*!< Total time from `beginColorStream()` to `endColorStream()` */
+        uint32_t throughput_kbps;   /*!< Bytes per millisecond (KB/s) over `stream_us` */
+    } ESP_PanelBusColorStreamStats_t;
+
+    /**
+     * @brief Get the counters of the color stream
+     *
+     * @param stats The counters
+     * @param clear Whether to clear the counters after reading
+     *
+     * @return true if success, otherwise false
+     */
+    bool getColorStreamStats(ESP_PanelBusColorStreamStats_t &stats, bool clear = false);
+
     /**
      * @brief Get the type of bus
      *
@@ -145,4 +240,27 @@ protected:
     int host_id;
     uint8_t bus_type;
     esp_lcd_panel_io_handle_t handle;
+
+private:
+    IRAM_ATTR static bool onColorTransDone(void *panel_io, void *edata, void *user_ctx);
+    static bool sendColorStream(void *user_ctx, int cmd, const void *data, size_t size);
+    static bool waitColorStream(void *user_ctx, uint32_t token);
+    bool waitQueuedColorTrans(void);
+    bool registerColorTransDoneHandler(void);
+    void delColorStream(void);
+
+    esp_lcd_panel_io_color_trans_done_cb_t _color_trans_done_callback;
+    void *_color_trans_done_user_ctx;
+    struct {
+        const esp_panel_draw_queue_t *queue;
+        SemaphoreHandle_t sem;
+        bool is_data_pending;
+    } _color_trans;
+    struct {
+        esp_panel_color_stream_handle_t handle;
+        uint8_t *bufs[ESP_PANEL_COLOR_STREAM_BUF_NUM];
+        size_t buf_size;
+        int64_t start_us;
+        uint64_t stream_us;
+    } _color_stream;
 };
@@ -109,6 +109,23 @@ public:
      */
     bool begin(void) override;
 
+    /**
+     * @brief Get the maximum size of a single transfer of the host
+     *
+     * @note  If the host is initialized by the user, its configuration is unknown, so the default size of the
+     *        library (`ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE`) is assumed
+     *
+     * @return The size in bytes
+     */
+    size_t getMaxTransferSize(void)
+    {
+        if (!flags.host_need_init) {
+            return ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE;
+        }
+        /* The SPI driver uses the size of a single DMA descriptor if it is not set */
+        return (host_config.max_transfer_sz > 0) ? host_config.max_transfer_sz : (4096 - 4);
+    }
+
 private:
     spi_bus_config_t host_config;
     esp_lcd_panel_io_spi_config_t io_config;
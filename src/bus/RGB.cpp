@@ -157,6 +157,13 @@ void ESP_PanelBus_RGB::configSpiLine(bool cs_use_expaneer, bool sck_use_expander
     }
 }
 
+void ESP_PanelBus_RGB::configSpiHost(int host_id, uint32_t freq_hz)
+{
+    spi_config.spi_host_id = host_id;
+    spi_config.expect_clk_speed = freq_hz;
+    spi_config.flags.use_spi_host = 1;
+}
+
 bool ESP_PanelBus_RGB::begin(void)
 {
     ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
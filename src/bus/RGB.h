@@ -375,6 +375,7 @@ public:
     void configRgbBounceBufferSize(uint32_t size_in_pixel);
     void configRgbFlagDispActiveLow(void);
     void configSpiLine(bool cs_use_expaneer, bool sck_use_expander, bool sda_use_expander, ESP_IOExpander *io_expander);
+    void configSpiHost(int host_id, uint32_t freq_hz = PANEL_IO_3WIRE_SPI_HOST_CLK_DEFAULT);
 
     /**
      * @brief Startup the bus.
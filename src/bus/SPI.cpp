@@ -16,20 +16,23 @@ static const char *TAG = "ESP_PanelBus_SPI";
 ESP_PanelBus_SPI::ESP_PanelBus_SPI(int cs_io, int dc_io, int sck_io, int sda_io, int sdo_io):
     ESP_PanelBus((int)ESP_PANEL_HOST_SPI_ID_DEFAULT, ESP_PANEL_BUS_TYPE_SPI, true),
     host_config((spi_bus_config_t)ESP_PANEL_HOST_SPI_CONFIG_DEFAULT(sck_io, sda_io, sdo_io)),
-    io_config((esp_lcd_panel_io_spi_config_t)ESP_PANEL_IO_SPI_CONFIG_DEFAULT(cs_io, dc_io))
+    io_config((esp_lcd_panel_io_spi_config_t)ESP_PANEL_IO_SPI_CONFIG_DEFAULT(cs_io, dc_io)),
+    _is_panel_io_deleted(false)
 {
 }
 
 ESP_PanelBus_SPI::ESP_PanelBus_SPI(int sck_io, int mosi_io, int miso_io, const esp_lcd_panel_io_spi_config_t &io_config):
     ESP_PanelBus((int)ESP_PANEL_HOST_SPI_ID_DEFAULT, ESP_PANEL_BUS_TYPE_SPI, true),
     host_config((spi_bus_config_t)ESP_PANEL_HOST_SPI_CONFIG_DEFAULT(sck_io, mosi_io, miso_io)),
-    io_config(io_config)
+    io_config(io_config),
+    _is_panel_io_deleted(false)
 {
 }
 
 ESP_PanelBus_SPI::ESP_PanelBus_SPI(int cs_io, int dc_io):
     ESP_PanelBus((int)ESP_PANEL_HOST_SPI_ID_DEFAULT, ESP_PANEL_BUS_TYPE_SPI, false),
-    io_config((esp_lcd_panel_io_spi_config_t)ESP_PANEL_IO_SPI_CONFIG_DEFAULT(cs_io, dc_io))
+    io_config((esp_lcd_panel_io_spi_config_t)ESP_PANEL_IO_SPI_CONFIG_DEFAULT(cs_io, dc_io)),
+    _is_panel_io_deleted(false)
 {
 }
 
@@ -37,19 +40,21 @@ ESP_PanelBus_SPI::ESP_PanelBus_SPI(const spi_bus_config_t &host_config, const es
                                    spi_host_device_t host_id):
     ESP_PanelBus((int)host_id, ESP_PANEL_BUS_TYPE_SPI, true),
     host_config(host_config),
-    io_config(io_config)
+    io_config(io_config),
+    _is_panel_io_deleted(false)
 {
 }
 
 ESP_PanelBus_SPI::ESP_PanelBus_SPI(const esp_lcd_panel_io_spi_config_t &io_config, spi_host_device_t host_id):
     ESP_PanelBus((int)host_id, ESP_PANEL_BUS_TYPE_SPI, false),
-    io_config(io_config)
+    io_config(io_config),
+    _is_panel_io_deleted(false)
 {
 }
 
 ESP_PanelBus_SPI::~ESP_PanelBus_SPI()
 {
-    if (handle == NULL) {
+    if ((handle == NULL) && !_is_panel_io_deleted) {
         goto end;
     }
 
@@ -73,6 +78,21 @@ bool ESP_PanelBus_SPI::del(void)
             ESP_LOGD(TAG, "Delete host[%d] driver", host_id);
         }
     }
+    _is_panel_io_deleted = false;
+
+    return true;
+}
+
+bool ESP_PanelBus_SPI::delPanelIO(void)
+{
+    ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
+
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Not begun");
+
+    ESP_PANEL_CHECK_ERR_RET(esp_lcd_panel_io_del(handle), false, "Delete panel IO failed");
+    ESP_LOGD(TAG, "Delete panel IO @%p, keep host[%d]", handle, host_id);
+    handle = NULL;
+    _is_panel_io_deleted = true;
 
     return true;
 }
@@ -118,6 +118,16 @@ public:
      */
     bool del(void) override;
 
+    /**
+     * @brief Delete only the panel IO and keep the host, so its CS line can be taken over by another SPI device
+     *
+     * @note  This is used by the touch devices which drive the SPI host directly, like the batch reads of XPT2046.
+     *        The host is still released by `del()` or the destructor
+     *
+     * @return true if success, otherwise false
+     */
+    bool delPanelIO(void);
+
     /**
      * @brief Here are some functions to configure the SPI bus object. These functions should be called before `begin()`
      *
@@ -135,7 +145,35 @@ public:
      */
     bool begin(void) override;
 
+    /**
+     * @brief Get the maximum size of a single transfer of the host
+     *
+     * @note  If the host is initialized by the user, its configuration is unknown, so the default size of the
+     *        library (`ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE`) is assumed
+     *
+     * @return The size in bytes
+     */
+    size_t getMaxTransferSize(void)
+    {
+        if (!flags.host_need_init) {
+            return ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE;
+        }
+        /* The SPI driver uses the size of a single DMA descriptor if it is not set */
+        return (host_config.max_transfer_sz > 0) ? host_config.max_transfer_sz : (4096 - 4);
+    }
+
+    spi_host_device_t getHostId(void)
+    {
+        return (spi_host_device_t)host_id;
+    }
+
+    const esp_lcd_panel_io_spi_config_t *getIoConfig(void)
+    {
+        return &io_config;
+    }
+
 private:
     spi_bus_config_t host_config;
     esp_lcd_panel_io_spi_config_t io_config;
+    bool _is_panel_io_deleted;
 };
@@ -8,11 +8,15 @@
 
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
+#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_check.h"
 #include "esp_lcd_panel_io_interface.h"
+#include "hal/gpio_ll.h"
 
+#include "utils/esp_panel_spi_bitbang.h"
+#include "utils/esp_panel_spi_pack.h"
 #include "esp_lcd_panel_io_additions.h"
 
 #define LCD_CMD_BYTES_MAX       (sizeof(uint32_t))  // Maximum number of bytes for LCD command
@@ -23,6 +27,7 @@
 #define DATA_NO_DC_BIT          (2)     // No DC bit
 #define WRITE_ORDER_LSB_MASK    (0x01)  // Bit mask for LSB first write order
 #define WRITE_ORDER_MSB_MASK    (0x80)  // Bit mask for MSB first write order
+#define SPI_HOST_BUFFER_SIZE    (64)    // Size of the DMA buffer used by the SPI master peripheral
 
 /**
  * @brief Enumeration of SPI lines
@@ -52,11 +57,18 @@ typedef struct {
     uint32_t lcd_param_bytes: 3;            /*!< Bytes of LCD parameter (1 ~ 4) */
     uint32_t param_dc_bit: 2;               /*!< DC bit of parameter */
     uint32_t write_order_mask: 8;           /*!< Bit mask of write order */
+    esp_panel_spi_bitbang_t bitbang;        /*!< Software SPI which writes the lines at once */
+    uint32_t expander_output;               /*!< Shadow of the output register of IO expander */
+    int spi_host_id;                        /*!< SPI host used by the hardware backend */
+    spi_device_handle_t spi_dev;            /*!< SPI device of the hardware backend, NULL if the lines are simulated */
+    esp_panel_spi_pack_t pack;              /*!< Packer of the DMA buffer of the hardware backend */
+    uint8_t *pack_buf;                      /*!< DMA buffer of the hardware backend */
     struct {
         uint32_t cs_high_active: 1;         /*!< If this flag is enabled, CS line is high active */
         uint32_t sda_scl_idle_high: 1;      /*!< If this flag is enabled, SDA and SCL line are high when idle */
         uint32_t scl_active_rising_edge: 1; /*!< If this flag is enabled, SCL line is active on rising edge */
         uint32_t del_keep_cs_inactive: 1;   /*!< If this flag is enabled, keep CS line inactive even if panel_io is deleted */
+        uint32_t use_expander: 1;           /*!< If this flag is enabled, some lines are on IO expander */
     } flags;
 } esp_lcd_panel_io_3wire_spi_t;
 
@@ -71,11 +83,24 @@ static esp_err_t panel_io_register_event_callbacks(esp_lcd_panel_io_handle_t io,
 static esp_err_t set_line_level(esp_lcd_panel_io_3wire_spi_t *panel_io, spi_line_t line, uint32_t level);
 static esp_err_t reset_line_io(esp_lcd_panel_io_3wire_spi_t *panel_io, spi_line_t line);
 static esp_err_t spi_write_package(esp_lcd_panel_io_3wire_spi_t *panel_io, bool is_cmd, uint32_t data);
+static bool write_gpio_lines(void *user_ctx, uint32_t mask, uint32_t levels);
+static bool write_expander_lines(void *user_ctx, uint32_t mask, uint32_t levels);
+static void delay_us(void *user_ctx, uint32_t delay_us);
+static esp_err_t spi_host_init(esp_lcd_panel_io_3wire_spi_t *panel_io, const esp_lcd_panel_io_3wire_spi_config_t *io_config);
+static void spi_host_deinit(esp_lcd_panel_io_3wire_spi_t *panel_io);
+static esp_err_t spi_host_flush(esp_lcd_panel_io_3wire_spi_t *panel_io);
+
+static const uint32_t line_masks[] = {
+    [CS] = ESP_PANEL_SPI_BITBANG_LINE_CS,
+    [SCL] = ESP_PANEL_SPI_BITBANG_LINE_SCL,
+    [SDA] = ESP_PANEL_SPI_BITBANG_LINE_SDA,
+};
 
 esp_err_t esp_lcd_new_panel_io_3wire_spi(const esp_lcd_panel_io_3wire_spi_config_t *io_config, esp_lcd_panel_io_handle_t *ret_io)
 {
     ESP_RETURN_ON_FALSE(io_config && ret_io, ESP_ERR_INVALID_ARG, TAG, "Invalid argument");
-    ESP_RETURN_ON_FALSE(io_config->expect_clk_speed <= PANEL_IO_3WIRE_SPI_CLK_MAX, ESP_ERR_INVALID_ARG, TAG, "Invalid Clock frequency");
+    ESP_RETURN_ON_FALSE(io_config->expect_clk_speed <= (io_config->flags.use_spi_host ? PANEL_IO_3WIRE_SPI_HOST_CLK_MAX :
+                        PANEL_IO_3WIRE_SPI_CLK_MAX), ESP_ERR_INVALID_ARG, TAG, "Invalid Clock frequency");
     ESP_RETURN_ON_FALSE(io_config->lcd_cmd_bytes > 0 && io_config->lcd_cmd_bytes <= LCD_CMD_BYTES_MAX, ESP_ERR_INVALID_ARG,
                         TAG, "Invalid LCD command bytes");
     ESP_RETURN_ON_FALSE(io_config->lcd_param_bytes > 0 && io_config->lcd_param_bytes <= LCD_PARAM_BYTES_MAX, ESP_ERR_INVALID_ARG,
@@ -97,6 +122,8 @@ esp_err_t esp_lcd_new_panel_io_3wire_spi(const esp_lcd_panel_io_3wire_spi_config
     panel_io->sda_io_num = line_config->sda_gpio_num;
     panel_io->io_expander = line_config->io_expander;
     uint32_t expect_clk_speed = io_config->expect_clk_speed ? io_config->expect_clk_speed : PANEL_IO_3WIRE_SPI_CLK_MAX;
+    // The software delay can't follow the higher clock of the SPI master peripheral
+    expect_clk_speed = (expect_clk_speed > PANEL_IO_3WIRE_SPI_CLK_MAX) ? PANEL_IO_3WIRE_SPI_CLK_MAX : expect_clk_speed;
     panel_io->scl_half_period_us = 1000000 / (expect_clk_speed * 2);
     panel_io->lcd_cmd_bytes = io_config->lcd_cmd_bytes;
     panel_io->lcd_param_bytes = io_config->lcd_param_bytes;
@@ -165,6 +192,34 @@ esp_err_t esp_lcd_new_panel_io_3wire_spi(const esp_lcd_panel_io_3wire_spi_config
     ESP_GOTO_ON_ERROR(set_line_level(panel_io, SCL, sda_scl_idle_level), err, TAG, "Set SCL level failed");
     ESP_GOTO_ON_ERROR(set_line_level(panel_io, SDA, sda_scl_idle_level), err, TAG, "Set SDA level failed");
 
+    panel_io->flags.use_expander = (expander_pin_mask != 0);
+    /**
+     * Native GPIOs are set by writing the output registers directly. The lines on IO expander are packed into one write
+     * of its output register, so the edges happening at the same time take only one transaction
+     */
+    esp_panel_spi_bitbang_config_t bitbang_config = {
+        .half_period_us = panel_io->scl_half_period_us,
+        .write_cb = panel_io->flags.use_expander ? write_expander_lines : write_gpio_lines,
+        .delay_cb = delay_us,
+        .user_ctx = panel_io,
+        .flags = {
+            .cs_high_active = panel_io->flags.cs_high_active,
+            .sda_scl_idle_high = panel_io->flags.sda_scl_idle_high,
+            .scl_active_rising_edge = panel_io->flags.scl_active_rising_edge,
+            .lsb_first = (panel_io->write_order_mask == WRITE_ORDER_LSB_MASK),
+        },
+    };
+    ESP_GOTO_ON_FALSE(esp_panel_spi_bitbang_init(&panel_io->bitbang, &bitbang_config), ESP_ERR_INVALID_ARG, err, TAG,
+                      "Init bitbang failed");
+
+    if (io_config->flags.use_spi_host) {
+        if ((panel_io->scl_io_type == IO_TYPE_GPIO) && (panel_io->sda_io_type == IO_TYPE_GPIO)) {
+            ESP_GOTO_ON_ERROR(spi_host_init(panel_io, io_config), err, TAG, "Init SPI host failed");
+        } else {
+            ESP_LOGW(TAG, "SCL or SDA line is on IO expander, fall back to the software SPI");
+        }
+    }
+
     *ret_io = (esp_lcd_panel_io_handle_t)panel_io;
     return ESP_OK;
 
@@ -186,10 +241,16 @@ err:
 static esp_err_t panel_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
 {
     esp_lcd_panel_io_3wire_spi_t *panel_io = __containerof(io, esp_lcd_panel_io_3wire_spi_t, base);
+    esp_err_t ret = ESP_OK;
+
+    // The SPI master peripheral sends the command and its parameters with CS active
+    if (panel_io->spi_dev) {
+        ESP_RETURN_ON_ERROR(set_line_level(panel_io, CS, panel_io->flags.cs_high_active), TAG, "Set CS level failed");
+    }
 
     // Send command
     if (lcd_cmd >= 0) {
-        ESP_RETURN_ON_ERROR(spi_write_package(panel_io, true, lcd_cmd), TAG, "SPI write package failed");
+        ESP_GOTO_ON_ERROR(spi_write_package(panel_io, true, lcd_cmd), err, TAG, "SPI write package failed");
     }
 
     // Send parameter
@@ -204,17 +265,27 @@ static esp_err_t panel_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const vo
             for (int j = 0; j < param_bytes; j++) {
                 param_data |= ((uint8_t *)param)[i * param_bytes + j] << (j * 8);
             }
-            ESP_RETURN_ON_ERROR(spi_write_package(panel_io, false, param_data), TAG, "SPI write package failed");
+            ESP_GOTO_ON_ERROR(spi_write_package(panel_io, false, param_data), err, TAG, "SPI write package failed");
         }
     }
 
-    return ESP_OK;
+    if (panel_io->spi_dev) {
+        ESP_GOTO_ON_ERROR(spi_host_flush(panel_io), err, TAG, "SPI host flush failed");
+    }
+
+err:
+    if (panel_io->spi_dev) {
+        esp_panel_spi_pack_reset(&panel_io->pack);
+        set_line_level(panel_io, CS, !panel_io->flags.cs_high_active);
+    }
+    return ret;
 }
 
 static esp_err_t panel_io_del(esp_lcd_panel_io_t *io)
 {
     esp_lcd_panel_io_3wire_spi_t *panel_io = __containerof(io, esp_lcd_panel_io_3wire_spi_t, base);
 
+    spi_host_deinit(panel_io);
     if (!panel_io->flags.del_keep_cs_inactive) {
         ESP_RETURN_ON_ERROR(reset_line_io(panel_io, CS), TAG, "Reset CS line failed");
     } else {
@@ -341,15 +412,84 @@ static esp_err_t reset_line_io(esp_lcd_panel_io_3wire_spi_t *panel_io, spi_line_
     }
 }
 
+/**
+ * @brief Set the lines by writing the GPIO output registers directly
+ *
+ * @note  This function is used when all lines are native GPIOs, it skips the checks of `gpio_set_level()`
+ *
+ * @param[in] user_ctx Pointer to panel IO instance
+ * @param[in] mask     Mask of the lines to set
+ * @param[in] levels   Levels of the lines
+ *
+ * @return true if success, otherwise false
+ */
+static bool write_gpio_lines(void *user_ctx, uint32_t mask, uint32_t levels)
+{
+    esp_lcd_panel_io_3wire_spi_t *panel_io = (esp_lcd_panel_io_3wire_spi_t *)user_ctx;
+    gpio_dev_t *hw = GPIO_LL_GET_HW(GPIO_PORT_0);
+
+    if (mask & ESP_PANEL_SPI_BITBANG_LINE_CS) {
+        gpio_ll_set_level(hw, panel_io->cs_io_num, (levels & ESP_PANEL_SPI_BITBANG_LINE_CS) ? 1 : 0);
+    }
+    if (mask & ESP_PANEL_SPI_BITBANG_LINE_SCL) {
+        gpio_ll_set_level(hw, panel_io->scl_io_num, (levels & ESP_PANEL_SPI_BITBANG_LINE_SCL) ? 1 : 0);
+    }
+    if (mask & ESP_PANEL_SPI_BITBANG_LINE_SDA) {
+        gpio_ll_set_level(hw, panel_io->sda_io_num, (levels & ESP_PANEL_SPI_BITBANG_LINE_SDA) ? 1 : 0);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Set the lines, and the ones on IO expander are packed into one write of its output register
+ *
+ * @param[in] user_ctx Pointer to panel IO instance
+ * @param[in] mask     Mask of the lines to set
+ * @param[in] levels   Levels of the lines
+ *
+ * @return true if success, otherwise false
+ */
+static bool write_expander_lines(void *user_ctx, uint32_t mask, uint32_t levels)
+{
+    esp_lcd_panel_io_3wire_spi_t *panel_io = (esp_lcd_panel_io_3wire_spi_t *)user_ctx;
+    esp_io_expander_handle_t expander = panel_io->io_expander;
+    const panel_io_type_t line_types[] = {panel_io->cs_io_type, panel_io->scl_io_type, panel_io->sda_io_type};
+    const int line_ios[] = {panel_io->cs_io_num, panel_io->scl_io_num, panel_io->sda_io_num};
+    uint32_t output = panel_io->expander_output;
+
+    for (int line = CS; line <= SDA; line++) {
+        if (!(mask & line_masks[line])) {
+            continue;
+        }
+        bool level = (levels & line_masks[line]) != 0;
+        if (line_types[line] == IO_TYPE_GPIO) {
+            gpio_ll_set_level(GPIO_LL_GET_HW(GPIO_PORT_0), line_ios[line], level);
+        } else if (level != expander->config.flags.output_high_bit_zero) {
+            output |= line_ios[line];
+        } else {
+            output &= ~line_ios[line];
+        }
+    }
+    if (output != panel_io->expander_output) {
+        ESP_RETURN_ON_FALSE(expander->write_output_reg(expander, output) == ESP_OK, false, TAG,
+                            "Write expander output failed");
+        panel_io->expander_output = output;
+    }
+
+    return true;
+}
+
 /**
  * @brief Delay for given microseconds
  *
  * @note  This function uses `esp_rom_delay_us()` for delays < 1000us and `vTaskDelay()` for longer delays.
  *
+ * @param[in] user_ctx Unused
  * @param[in] delay_us Delay time in microseconds
  *
  */
-static void delay_us(uint32_t delay_us)
+static void delay_us(void *user_ctx, uint32_t delay_us)
 {
     if (delay_us >= 1000) {
         vTaskDelay(pdMS_TO_TICKS(delay_us / 1000));
@@ -359,89 +499,143 @@ static void delay_us(uint32_t delay_us)
 }
 
 /**
- * @brief Write one byte to LCD panel
+ * @brief Write a package of data to LCD panel in big-endian order
  *
  * @param[in] panel_io Pointer to panel IO instance
- * @param[in] dc_bit   DC bit
- * @param[in] data     8-bit data to write
+ * @param[in] is_cmd   True for command, false for data
+ * @param[in] data     Data to write, with
  *
  * @return
  *      - ESP_OK:              Success
  *      - ESP_ERR_INVALID_ARG: Invalid argument
  *      - Others:              Fail
  */
-static esp_err_t spi_write_byte(esp_lcd_panel_io_3wire_spi_t *panel_io, int dc_bit, uint8_t data)
+static esp_err_t spi_write_package(esp_lcd_panel_io_3wire_spi_t *panel_io, bool is_cmd, uint32_t data)
 {
-    uint16_t data_temp = data;
-    uint8_t data_bits = (dc_bit != DATA_NO_DC_BIT) ? 9 : 8;
-    uint16_t write_order_mask = panel_io->write_order_mask;
-    uint32_t scl_active_befor_level = panel_io->flags.scl_active_rising_edge ? 0 : 1;
-    uint32_t scl_active_after_level = !scl_active_befor_level;
-    uint32_t scl_half_period_us = panel_io->scl_half_period_us;
-
-    for (uint8_t i = 0; i < data_bits; i++) {
-        // Send DC bit first
-        if (data_bits == 9 && i == 0) {
-            ESP_RETURN_ON_ERROR(set_line_level(panel_io, SDA, dc_bit), TAG, "Set SDA level failed");
-        } else { // Then send data bit
-            // SDA set to data bit
-            ESP_RETURN_ON_ERROR(set_line_level(panel_io, SDA, data_temp & write_order_mask), TAG, "Set SDA level failed");
-            // Get next bit
-            data_temp = (write_order_mask == WRITE_ORDER_LSB_MASK) ? data_temp >> 1 : data_temp << 1;
+    uint32_t data_bytes = is_cmd ? panel_io->lcd_cmd_bytes : panel_io->lcd_param_bytes;
+    int data_dc_bit = is_cmd ? panel_io->cmd_dc_bit : panel_io->param_dc_bit;
+    int dc_bit = (data_dc_bit == DATA_NO_DC_BIT) ? ESP_PANEL_SPI_BITBANG_NO_DC_BIT : data_dc_bit;
+
+    // The package is packed into the DMA buffer, which is sent when it's full or at the end of `tx_param()`
+    if (panel_io->spi_dev) {
+        if (!esp_panel_spi_pack_push(&panel_io->pack, dc_bit, data, data_bytes)) {
+            ESP_RETURN_ON_ERROR(spi_host_flush(panel_io), TAG, "SPI host flush failed");
+            ESP_RETURN_ON_FALSE(esp_panel_spi_pack_push(&panel_io->pack, dc_bit, data, data_bytes), ESP_ERR_INVALID_SIZE,
+                                TAG, "SPI pack failed");
         }
-        // Generate SCL active edge
-        ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, scl_active_befor_level), TAG, "Set SCL level failed");
-        delay_us(scl_half_period_us);
-        ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, scl_active_after_level), TAG, "Set SCL level failed");
-        delay_us(scl_half_period_us);
+        return ESP_OK;
     }
 
+    // The output register may be changed by other users of IO expander, so reload it (usually cached by the driver)
+    if (panel_io->flags.use_expander) {
+        ESP_RETURN_ON_ERROR(panel_io->io_expander->read_output_reg(panel_io->io_expander, &panel_io->expander_output),
+                            TAG, "Read expander output failed");
+    }
+    ESP_RETURN_ON_FALSE(esp_panel_spi_bitbang_write(&panel_io->bitbang, dc_bit, data, data_bytes), ESP_FAIL, TAG,
+                        "SPI write package failed");
+
     return ESP_OK;
 }
 
 /**
- * @brief Write a package of data to LCD panel in big-endian order
+ * @brief Initialize the SPI master peripheral to drive SCL and SDA lines
  *
- * @param[in] panel_io Pointer to panel IO instance
- * @param[in] is_cmd   True for command, false for data
- * @param[in] data     Data to write, with
+ * @note  CS line is still set by software (GPIO or IO expander), so it's kept active for a whole `tx_param()`
+ *
+ * @param[in] panel_io  Pointer to panel IO instance
+ * @param[in] io_config Panel IO configuration
  *
  * @return
  *      - ESP_OK:              Success
- *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_NO_MEM:      Failed to allocate the DMA buffer
  *      - Others:              Fail
  */
-static esp_err_t spi_write_package(esp_lcd_panel_io_3wire_spi_t *panel_io, bool is_cmd, uint32_t data)
+static esp_err_t spi_host_init(esp_lcd_panel_io_3wire_spi_t *panel_io, const esp_lcd_panel_io_3wire_spi_config_t *io_config)
 {
-    uint32_t data_bytes = is_cmd ? panel_io->lcd_cmd_bytes : panel_io->lcd_param_bytes;
-    uint32_t cs_idle_level = panel_io->flags.cs_high_active ? 0 : 1;
-    uint32_t sda_scl_idle_level = panel_io->flags.sda_scl_idle_high ? 1 : 0;
-    uint32_t scl_active_befor_level = panel_io->flags.scl_active_rising_edge ? 0 : 1;
-    uint32_t time_us = panel_io->scl_half_period_us;
-    // Swap command bytes order due to different endianness
-    uint32_t swap_data = SPI_SWAP_DATA_TX(data, data_bytes * 8);
-    int data_dc_bit = is_cmd ? panel_io->cmd_dc_bit : panel_io->param_dc_bit;
+    esp_err_t ret = ESP_OK;
+    bool is_bus_initialized = false;
+
+    panel_io->pack_buf = heap_caps_calloc(1, SPI_HOST_BUFFER_SIZE, MALLOC_CAP_DMA);
+    ESP_RETURN_ON_FALSE(panel_io->pack_buf, ESP_ERR_NO_MEM, TAG, "No memory for DMA buffer");
+    esp_panel_spi_pack_init(&panel_io->pack, panel_io->pack_buf, SPI_HOST_BUFFER_SIZE,
+                            panel_io->write_order_mask == WRITE_ORDER_LSB_MASK);
+
+    spi_bus_config_t bus_config = {
+        .mosi_io_num = panel_io->sda_io_num,
+        .miso_io_num = -1,
+        .sclk_io_num = panel_io->scl_io_num,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = SPI_HOST_BUFFER_SIZE,
+    };
+    ESP_GOTO_ON_ERROR(spi_bus_initialize((spi_host_device_t)io_config->spi_host_id, &bus_config, SPI_DMA_CH_AUTO), err,
+                      TAG, "SPI bus initialize failed");
+    is_bus_initialized = true;
+
+    // Same as `spi_mode` of the software SPI: bit 0 is CPOL and bit 1 is CPHA
+    spi_device_interface_config_t dev_config = {
+        .mode = ((io_config->spi_mode & 0x1) << 1) | ((io_config->spi_mode >> 1) & 0x1),
+        .clock_speed_hz = io_config->expect_clk_speed ? io_config->expect_clk_speed : PANEL_IO_3WIRE_SPI_HOST_CLK_DEFAULT,
+        .spics_io_num = -1,
+        .flags = SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_3WIRE,
+        .queue_size = 1,
+    };
+    ESP_GOTO_ON_ERROR(spi_bus_add_device((spi_host_device_t)io_config->spi_host_id, &dev_config, &panel_io->spi_dev),
+                      err, TAG, "SPI bus add device failed");
+    panel_io->spi_host_id = io_config->spi_host_id;
 
-    // CS active
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, CS, !cs_idle_level), TAG, "Set CS level failed");
-    delay_us(time_us);
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, scl_active_befor_level), TAG, "Set SCL level failed");
-    // Send data byte by byte
-    for (int i = 0; i < data_bytes; i++) {
-        // Only set DC bit for the first byte
-        if (i == 0) {
-            ESP_RETURN_ON_ERROR(spi_write_byte(panel_io, data_dc_bit, swap_data & 0xff), TAG, "SPI write byte failed");
-        } else {
-            ESP_RETURN_ON_ERROR(spi_write_byte(panel_io, DATA_NO_DC_BIT, swap_data & 0xff), TAG, "SPI write byte failed");
-        }
-        swap_data >>= 8;
+    return ESP_OK;
+
+err:
+    if (is_bus_initialized) {
+        spi_bus_free((spi_host_device_t)io_config->spi_host_id);
     }
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, SCL, sda_scl_idle_level), TAG, "Set SCL level failed");
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, SDA, sda_scl_idle_level), TAG, "Set SDA level failed");
-    delay_us(time_us);
-    // CS inactive
-    ESP_RETURN_ON_ERROR(set_line_level(panel_io, CS, cs_idle_level), TAG, "Set CS level failed");
-    delay_us(time_us);
+    heap_caps_free(panel_io->pack_buf);
+    panel_io->pack_buf = NULL;
+    panel_io->spi_dev = NULL;
+    return ret;
+}
 
-    return ESP_OK;
+/**
+ * @brief Release the SPI master peripheral if it's used
+ *
+ * @param[in] panel_io Pointer to panel IO instance
+ */
+static void spi_host_deinit(esp_lcd_panel_io_3wire_spi_t *panel_io)
+{
+    if (panel_io->spi_dev == NULL) {
+        return;
+    }
+
+    spi_bus_remove_device(panel_io->spi_dev);
+    spi_bus_free((spi_host_device_t)panel_io->spi_host_id);
+    heap_caps_free(panel_io->pack_buf);
+    panel_io->spi_dev = NULL;
+    panel_io->pack_buf = NULL;
+}
+
+/**
+ * @brief Send the packed bits by the SPI master peripheral, then clear the buffer
+ *
+ * @param[in] panel_io Pointer to panel IO instance
+ *
+ * @return
+ *      - ESP_OK:              Success
+ *      - Others:              Fail
+ */
+static esp_err_t spi_host_flush(esp_lcd_panel_io_3wire_spi_t *panel_io)
+{
+    size_t bits = esp_panel_spi_pack_get_bits(&panel_io->pack);
+    if (bits == 0) {
+        return ESP_OK;
+    }
+
+    spi_transaction_t trans = {
+        .length = bits,
+        .tx_buffer = panel_io->pack_buf,
+    };
+    esp_err_t ret = spi_device_polling_transmit(panel_io->spi_dev, &trans);
+    esp_panel_spi_pack_reset(&panel_io->pack);
+
+    return ret;
 }
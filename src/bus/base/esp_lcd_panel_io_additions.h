@@ -17,6 +17,9 @@ extern "C" {
 
 // Maximum SPI clock speed
 #define PANEL_IO_3WIRE_SPI_CLK_MAX      (500 * 1000UL)
+// Maximum and default SPI clock speed when the SPI master peripheral is used
+#define PANEL_IO_3WIRE_SPI_HOST_CLK_MAX         (20 * 1000 * 1000UL)
+#define PANEL_IO_3WIRE_SPI_HOST_CLK_DEFAULT     (5 * 1000 * 1000UL)
 
 /**
  * @brief Panel IO type, use GPIO or IO expander
@@ -55,16 +58,24 @@ typedef struct {
     spi_line_config_t line_config;  /*!< SPI line configuration */
     uint32_t expect_clk_speed;      /*!< Expected SPI clock speed, in Hz (1 ~ 500000
                                      *   If this value is 0, it will be set to `PANEL_IO_3WIRE_SPI_CLK_MAX` by default
-                                     *   The actual frequency may be very different due to the limitation of the software delay */
+                                     *   The actual frequency may be very different due to the limitation of the software delay
+                                     *   If `use_spi_host` is enabled, the range is 1 ~ `PANEL_IO_3WIRE_SPI_HOST_CLK_MAX` and
+                                     *   0 means `PANEL_IO_3WIRE_SPI_HOST_CLK_DEFAULT` */
     uint32_t spi_mode: 2;           /*!< Traditional SPI mode (0 ~ 3) */
     uint32_t lcd_cmd_bytes: 3;      /*!< Bytes of LCD command (1 ~ 4) */
     uint32_t lcd_param_bytes: 3;    /*!< Bytes of LCD parameter (1 ~ 4) */
+    int spi_host_id;                /*!< SPI host (`spi_host_device_t`) used when `use_spi_host` is enabled, the bus is
+                                     *   initialized and freed by the panel IO */
     struct {
         uint32_t use_dc_bit: 1;             /*!< If this flag is enabled, transmit DC bit at the beginning of every command and data */
         uint32_t dc_zero_on_data: 1;        /*!< If this flag is enabled, DC bit = 0 means transfer data, DC bit = 1 means transfer command */
         uint32_t lsb_first: 1;              /*!< If this flag is enabled, transmit LSB bit first */
         uint32_t cs_high_active: 1;         /*!< If this flag is enabled, CS line is high active */
         uint32_t del_keep_cs_inactive: 1;   /*!< If this flag is enabled, keep CS line inactive even if panel_io is deleted */
+        uint32_t use_spi_host: 1;           /*!< If this flag is enabled, SCL and SDA lines are driven by the SPI master
+                                             *   peripheral with DMA, and CS line is kept active during a command and its
+                                             *   parameters. It only works when SCL and SDA lines are GPIOs, otherwise
+                                             *   the lines are still simulated by software */
     } flags;
 } esp_lcd_panel_io_3wire_spi_config_t;
 
@@ -73,6 +84,8 @@ typedef struct {
  *
  * @note  This function uses GPIO or IO expander to simulate SPI interface by software and just supports to write data.
  *        It is only suitable for some applications with low speed SPI interface. (Such as initializing RGB panel)
+ * @note  If `flags.use_spi_host` is enabled and SCL and SDA lines are GPIOs, the packages are packed into a DMA buffer
+ *        and sent by the SPI master peripheral instead
  *
  * @param[in]  io_config Panel IO configuration
  * @param[out] ret_io    Pointer to return the created panel IO instance
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <memory>
 #include "cstring"
 #include "ESP_PanelLog.h"
@@ -14,10 +15,24 @@
 #include "esp_memory_utils.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "driver/gpio.h"
 #include "driver/spi_master.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
 #include "bus/RGB.h"
 #include "bus/DSI.h"
+#include "bus/SPI.h"
+#include "bus/QSPI.h"
 #include "bus/ESP_PanelBus.h"
+#include "utils/esp_panel_draw_bounce.h"
+#include "utils/esp_panel_draw_queue.h"
+#include "utils/esp_panel_draw_split.h"
+#include "utils/esp_panel_pixel.h"
+#include "utils/esp_panel_pixel_convert.h"
+#include "utils/esp_panel_pixel_fill.h"
+#include "utils/esp_panel_scroll.h"
+#include "utils/esp_panel_te_sync.h"
+#include "utils/esp_panel_window_cache.h"
 #include "ESP_PanelLcd.h"
 
 #define VENDOR_CONFIG_DEFAULT()      \
@@ -33,18 +48,33 @@
             .use_mipi_interface = 0, \
         }                            \
     }
+
+// A shorter wait for the TE chunk is done by busy waiting, otherwise the task sleeps until the next TE edge
+#define TE_BUSY_WAIT_US_MAX     (2000)
+
 #define CALLBACK_DATA_DEFAULT() \
     {                           \
         .lcd_ptr = this,        \
         .user_data = NULL,      \
     }
 
+typedef struct {
+    ESP_PanelLcd *lcd_ptr;
+    bool is_last;
+} DrawSplitContext_t;
+
+typedef struct {
+    ESP_PanelLcd *lcd_ptr;
+    uint16_t width;
+} DrawScrollContext_t;
+
 static const char *TAG = "ESP_PanelLcd";
 
 using namespace std;
 
 ESP_PanelLcd::ESP_PanelLcd(ESP_PanelBus *bus, uint8_t color_bits, int rst_io):
     disabled_functions{},
+    supported_functions{},
     x_coord_align(0),
     y_coord_align(0),
     bus(bus),
@@ -57,12 +87,22 @@ ESP_PanelLcd::ESP_PanelLcd(ESP_PanelBus *bus, uint8_t color_bits, int rst_io):
     onDrawBitmapFinishCallback(NULL),
     onRefreshFinishCallback(NULL),
     _draw_bitmap_finish_sem(NULL),
+    _draw_queue{},
+    _max_transfer_size(0),
+    _sw_rotation{},
+    _fill{},
+    _tile_diff{},
+    _te{},
+    _bounce{},
+    _scroll{},
+    _window_cache{},
     _callback_data(CALLBACK_DATA_DEFAULT())
 {
 }
 
 ESP_PanelLcd::ESP_PanelLcd(ESP_PanelBus *bus, const esp_lcd_panel_dev_config_t &panel_config):
     disabled_functions{},
+    supported_functions{},
     x_coord_align(0),
     y_coord_align(0),
     bus(bus),
@@ -75,6 +115,15 @@ ESP_PanelLcd::ESP_PanelLcd(ESP_PanelBus *bus, const esp_lcd_panel_dev_config_t &
     onDrawBitmapFinishCallback(NULL),
     onRefreshFinishCallback(NULL),
     _draw_bitmap_finish_sem(NULL),
+    _draw_queue{},
+    _max_transfer_size(0),
+    _sw_rotation{},
+    _fill{},
+    _tile_diff{},
+    _te{},
+    _bounce{},
+    _scroll{},
+    _window_cache{},
     _callback_data(CALLBACK_DATA_DEFAULT())
 {
     /* Save vendor configuration to local and register the local one into panel configuration */
@@ -162,6 +211,13 @@ bool ESP_PanelLcd::begin(void)
         ESP_PANEL_CHECK_NULL_RET(_draw_bitmap_finish_sem, false, "Create draw bitmap finish semaphore failed");
     }
 
+    /* The large drawings are split by the host limit, so the bands can be queued without waiting for each other */
+    if (bus->getType() == ESP_PANEL_BUS_TYPE_SPI) {
+        _max_transfer_size = static_cast<ESP_PanelBus_SPI *>(bus)->getMaxTransferSize();
+    } else if (bus->getType() == ESP_PANEL_BUS_TYPE_QSPI) {
+        _max_transfer_size = static_cast<ESP_PanelBus_QSPI *>(bus)->getMaxTransferSize();
+    }
+
     /* Register transimit done callback for different interface */
     switch (bus->getType()) {
 #if SOC_LCD_RGB_SUPPORTED
@@ -200,12 +256,11 @@ bool ESP_PanelLcd::begin(void)
     }
 #endif
     default:
-        esp_lcd_panel_io_callbacks_t io_cb = {
-            .on_color_trans_done = (esp_lcd_panel_io_color_trans_done_cb_t)onDrawBitmapFinish,
-        };
-        ESP_PANEL_CHECK_ERR_RET(
-            esp_lcd_panel_io_register_event_callbacks(bus->getPanelIO_Handle(), &io_cb, &_callback_data), false,
-            "Register panel IO callback failed"
+        /* Registered through the bus, so the transfers of its color stream are not taken as drawings */
+        ESP_PANEL_CHECK_FALSE_RET(
+            bus->registerColorTransDoneCallback(
+                (esp_lcd_panel_io_color_trans_done_cb_t)onDrawBitmapFinish, &_callback_data, &_draw_queue
+            ), false, "Register panel IO callback failed"
         );
         break;
     }
@@ -244,11 +299,54 @@ bool ESP_PanelLcd::del(void)
 {
     ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
 
+    /* The line buffer and the packed tiles may still be read by the last drawings */
+    if (checkIsBegun() && !waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), -1)) {
+        ESP_LOGW(TAG, "Wait for the drawings to finish failed");
+    }
+    /* The bus should not wait for the draw queue of the deleted panel */
+    if (checkIsBegun() && (bus->getType() != ESP_PANEL_BUS_TYPE_RGB) &&
+            (bus->getType() != ESP_PANEL_BUS_TYPE_MIPI_DSI)) {
+        bus->registerColorTransDoneCallback(NULL, NULL);
+    }
     ESP_PANEL_CHECK_ERR_RET(esp_lcd_panel_del(handle), false, "Delete panel failed");
     if (_draw_bitmap_finish_sem) {
         vSemaphoreDelete(_draw_bitmap_finish_sem);
         _draw_bitmap_finish_sem = NULL;
     }
+    if (_sw_rotation.buf) {
+        heap_caps_free(_sw_rotation.buf);
+    }
+    _sw_rotation = {};
+    if (_fill.buf) {
+        heap_caps_free(_fill.buf);
+    }
+    _fill = {};
+    if (_tile_diff.handle) {
+        esp_panel_pixel_diff_del(_tile_diff.handle);
+    }
+    if (_tile_diff.buf) {
+        heap_caps_free(_tile_diff.buf);
+    }
+    _tile_diff = {};
+    if (_te.handle != NULL) {
+        gpio_isr_handler_remove((gpio_num_t)_te.io);
+        esp_panel_te_sync_del(_te.handle);
+        vSemaphoreDelete(_te.sem);
+    }
+    _te = {};
+    if (_bounce.handle != NULL) {
+        esp_panel_draw_bounce_del(_bounce.handle);
+    }
+    for (int i = 0; i < ESP_PANEL_DRAW_BOUNCE_BUF_NUM; i++) {
+        if (_bounce.bufs[i] != NULL) {
+            heap_caps_free(_bounce.bufs[i]);
+        }
+    }
+    _bounce = {};
+    _scroll = {};
+    _window_cache = {};
+    _draw_queue = {};
+    _max_transfer_size = 0;
 
     ESP_LOGD(TAG, "LCD panel @%p deleted", handle);
     handle = NULL;
@@ -261,9 +359,12 @@ bool ESP_PanelLcd::drawBitmap(uint16_t x_start, uint16_t y_start, uint16_t width
 {
     ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
 
-    ESP_PANEL_CHECK_ERR_RET(
-        esp_lcd_panel_draw_bitmap(handle, x_start, y_start, x_start + width, y_start + height, color_data),
-        false, "Draw bitmap failed"
+    if ((_sw_rotation.degree != 0) || _sw_rotation.convert_format) {
+        return drawBitmapBySoftware(x_start, y_start, width, height, color_data, -1);
+    }
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        drawBitmapToPanel(x_start, y_start, width, height, color_data), false, "Draw bitmap failed"
     );
 
     return true;
@@ -275,18 +376,391 @@ bool ESP_PanelLcd::drawBitmapWaitUntilFinish(
 {
     ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
 
-    /* For RGB LCD, since `drawBitmap()` uses `memcpy()` instead of DMA operation, doesn't need to wait */
+    if ((_sw_rotation.degree != 0) || _sw_rotation.convert_format) {
+        return drawBitmapBySoftware(x_start, y_start, width, height, color_data, timeout_ms);
+    }
+
     ESP_PANEL_CHECK_FALSE_RET(drawBitmap(x_start, y_start, width, height, color_data), false, "Draw bitmap failed");
 
-    /* For other interfaces which uses DMA operation, wait for the drawing to finish */
-    if (bus->getType() != ESP_PANEL_BUS_TYPE_RGB) {
-        /* Wait for the semaphore to be given by the callback function */
-        BaseType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    /* Wait for this drawing rather than any previous one (like the bands of `fillRect()`) to finish */
+    ESP_PANEL_CHECK_FALSE_RET(
+        waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), timeout_ms), false,
+        "Draw bitmap wait for finish timeout"
+    );
+
+    return true;
+}
+
+bool ESP_PanelLcd::drawBitmapAsync(
+    uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, const uint8_t *color_data, uint32_t &token
+)
+{
+    ESP_PANEL_CHECK_FALSE_RET(drawBitmap(x_start, y_start, width, height, color_data), false, "Draw bitmap failed");
+
+    /* The tile diff may send nothing, then the token only waits for the previous drawings */
+    token = esp_panel_draw_queue_get_submitted(&_draw_queue);
+
+    return true;
+}
+
+bool ESP_PanelLcd::waitDrawBitmapToken(uint32_t token, int timeout_ms)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (int32_t)(esp_panel_draw_queue_get_submitted(&_draw_queue) - token) >= 0, false,
+        "Token(%d) is not submitted", (int)token
+    );
+
+    return waitDrawBitmapFinish(token, timeout_ms);
+}
+
+bool ESP_PanelLcd::waitDrawBitmapQueue(int timeout_ms)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+
+    return waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), timeout_ms);
+}
+
+bool ESP_PanelLcd::checkDrawBitmapTokenDone(uint32_t token)
+{
+    /* For RGB LCD, the drawings are finished by `memcpy()` immediately */
+    if ((bus == NULL) || (bus->getType() == ESP_PANEL_BUS_TYPE_RGB)) {
+        return true;
+    }
+
+    return esp_panel_draw_queue_is_done(&_draw_queue, token);
+}
+
+uint32_t ESP_PanelLcd::getDrawBitmapPendingNum(void)
+{
+    if ((bus == NULL) || (bus->getType() == ESP_PANEL_BUS_TYPE_RGB)) {
+        return 0;
+    }
+
+    return esp_panel_draw_queue_get_pending(&_draw_queue);
+}
+
+bool ESP_PanelLcd::fillRect(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, uint32_t color)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET((width > 0) && (height > 0), false, "Invalid rect size");
+
+    int bits_per_pixel = getColorBits();
+    ESP_PANEL_CHECK_FALSE_RET(bits_per_pixel > 0, false, "Invalid color bits");
+
+    uint8_t bytes_per_pixel = (bits_per_pixel + 7) / 8;
+    uint8_t pixel[4] = {};
+    for (int i = 0; i < bytes_per_pixel; i++) {
+        pixel[i] = color >> (i * 8);
+    }
+    if (_sw_rotation.convert_format) {
+        uint8_t from_pixel[4] = {};
+        memcpy(from_pixel, pixel, sizeof(pixel));
+        ESP_PANEL_CHECK_FALSE_RET(
+            esp_panel_pixel_convert_copy(
+                from_pixel, pixel, 0, 0, 0, 0, 1, 1, 0, _sw_rotation.from_format, _sw_rotation.to_format
+            ), false, "Convert color failed"
+        );
+        bytes_per_pixel = esp_panel_pixel_format_get_bytes(_sw_rotation.to_format);
+    }
+
+    /* A solid rectangle only needs its area to be rotated */
+    uint16_t x_end = x_start + width - 1;
+    uint16_t y_end = y_start + height - 1;
+    ESP_PANEL_CHECK_FALSE_RET(rotateAreaBySoftware(x_start, y_start, x_end, y_end), false, "Rotate area failed");
+    width = x_end - x_start + 1;
+    height = y_end - y_start + 1;
+
+    /* The line buffer holds at least the aligned lines of the rectangle */
+    uint8_t y_align = (y_coord_align > 0) ? y_coord_align : 1;
+    size_t buf_size = max((size_t)width * bytes_per_pixel * y_align, (size_t)ESP_PANEL_LCD_FILL_BUFFER_SIZE);
+    bool is_same_color = (_fill.buf != NULL) && (_fill.bytes_per_pixel == bytes_per_pixel) &&
+                         (memcmp(_fill.pixel, pixel, bytes_per_pixel) == 0);
+    if (!is_same_color || (buf_size > _fill.buf_size)) {
+        /* The bands of the previous filling may still be reading the buffer */
+        ESP_PANEL_CHECK_FALSE_RET(
+            waitDrawBitmapFinish(_fill.draw_count, -1), false, "Wait for the previous filling to finish failed"
+        );
+        if (buf_size > _fill.buf_size) {
+            if (_fill.buf != NULL) {
+                heap_caps_free(_fill.buf);
+                _fill.buf_size = 0;
+            }
+            uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+            if ((bus->getType() != ESP_PANEL_BUS_TYPE_RGB) && (bus->getType() != ESP_PANEL_BUS_TYPE_MIPI_DSI)) {
+                caps |= MALLOC_CAP_DMA;
+            }
+            _fill.buf = (uint8_t *)heap_caps_malloc(buf_size, caps);
+            ESP_PANEL_CHECK_NULL_RET(_fill.buf, false, "Malloc fill buffer(%d) failed", (int)buf_size);
+            _fill.buf_size = buf_size;
+        }
+        esp_panel_pixel_fill_buffer(_fill.buf, _fill.buf_size, pixel, bytes_per_pixel);
+        memcpy(_fill.pixel, pixel, sizeof(pixel));
+        _fill.bytes_per_pixel = bytes_per_pixel;
+    }
+
+    /* The filled tiles are not known by the tile diff */
+    if (_tile_diff.handle != NULL) {
+        esp_panel_pixel_diff_invalidate(_tile_diff.handle, x_start, y_start, width, height);
+    }
+
+    /* Every band sends the same buffer, so they are queued without waiting for each other */
+    _fill.y_end = y_start + height;
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_pixel_fill_rect(
+            _fill.buf, _fill.buf_size, x_start, y_start, width, height, bytes_per_pixel, y_align, drawFillBand, this
+        ), false, "Fill rect failed"
+    );
+    _fill.draw_count = esp_panel_draw_queue_get_submitted(&_draw_queue);
+
+    return true;
+}
+
+bool ESP_PanelLcd::setSoftwareRotation(uint16_t degree, uint16_t lcd_width, uint16_t lcd_height)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (degree == 0) || (degree == 90) || (degree == 180) || (degree == 270), false, "Invalid degree(%d)", degree
+    );
+    ESP_PANEL_CHECK_FALSE_RET((degree == 0) || ((lcd_width > 0) && (lcd_height > 0)), false, "Invalid LCD size");
+
+    /* The buffer is released when disabled, and will be allocated by the next drawing when enabled */
+    if ((degree == 0) && !_sw_rotation.convert_format && (_sw_rotation.buf != NULL)) {
+        heap_caps_free(_sw_rotation.buf);
+        _sw_rotation.buf = NULL;
+        _sw_rotation.buf_size = 0;
+    }
+    _sw_rotation.degree = degree;
+    _sw_rotation.lcd_width = lcd_width;
+    _sw_rotation.lcd_height = lcd_height;
+
+    return true;
+}
+
+bool ESP_PanelLcd::setSoftwarePixelFormat(esp_panel_pixel_format_t from_format, esp_panel_pixel_format_t to_format)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (from_format == ESP_PANEL_PIXEL_FORMAT_RGB565) || (from_format == ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP), false,
+        "Invalid source format(%d)", from_format
+    );
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_pixel_format_get_bytes(to_format) > 0, false, "Invalid output format(%d)", to_format
+    );
+
+    _sw_rotation.convert_format = (from_format != to_format);
+    _sw_rotation.from_format = from_format;
+    _sw_rotation.to_format = to_format;
+    if (!_sw_rotation.convert_format && (_sw_rotation.degree == 0) && (_sw_rotation.buf != NULL)) {
+        heap_caps_free(_sw_rotation.buf);
+        _sw_rotation.buf = NULL;
+        _sw_rotation.buf_size = 0;
+    }
+
+    return true;
+}
+
+bool ESP_PanelLcd::setTileDiff(uint8_t tile_size, uint16_t lcd_width, uint16_t lcd_height)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (bus->getType() != ESP_PANEL_BUS_TYPE_RGB) && (bus->getType() != ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "RGB and MIPI-DSI interfaces don't support tile diff"
+    );
+    ESP_PANEL_CHECK_FALSE_RET((tile_size == 0) || ((lcd_width > 0) && (lcd_height > 0)), false, "Invalid LCD size");
+
+    /* The packed rectangles may still be in flight */
+    if (checkIsBegun()) {
         ESP_PANEL_CHECK_FALSE_RET(
-            xSemaphoreTake(_draw_bitmap_finish_sem, timeout_tick) == pdTRUE, false,
-            "Draw bitmap wait for finish timeout"
+            waitDrawBitmapFinish(_tile_diff.draw_count, -1), false, "Wait for the previous tiles to finish failed"
         );
     }
+    if (_tile_diff.handle != NULL) {
+        esp_panel_pixel_diff_del(_tile_diff.handle);
+    }
+    if (_tile_diff.buf != NULL) {
+        heap_caps_free(_tile_diff.buf);
+    }
+    _tile_diff = {};
+    if (tile_size == 0) {
+        return true;
+    }
+
+    /* Check the configuration here, the tile diff will be created again by the next drawing if the pixel format is
+     * changed */
+    int bytes_per_pixel = getBytesPerPixelToSend();
+    ESP_PANEL_CHECK_FALSE_RET(bytes_per_pixel > 0, false, "Invalid color bits");
+    esp_panel_pixel_diff_config_t diff_config = {
+        .width = lcd_width,
+        .height = lcd_height,
+        .tile_size = tile_size,
+        .bytes_per_pixel = (uint8_t)bytes_per_pixel,
+    };
+    _tile_diff.handle = esp_panel_pixel_diff_new(&diff_config);
+    ESP_PANEL_CHECK_NULL_RET(_tile_diff.handle, false, "Create tile diff failed, invalid tile size(%d)?", tile_size);
+    _tile_diff.tile_size = tile_size;
+    _tile_diff.lcd_width = lcd_width;
+    _tile_diff.lcd_height = lcd_height;
+    _tile_diff.bytes_per_pixel = bytes_per_pixel;
+
+    return true;
+}
+
+bool ESP_PanelLcd::resetTileDiff(void)
+{
+    ESP_PANEL_CHECK_NULL_RET(_tile_diff.handle, false, "Tile diff is not enabled");
+
+    return esp_panel_pixel_diff_invalidate(_tile_diff.handle, 0, 0, 0, 0);
+}
+
+bool ESP_PanelLcd::getTileDiffStats(esp_panel_pixel_diff_stats_t &stats, bool clear)
+{
+    ESP_PANEL_CHECK_NULL_RET(_tile_diff.handle, false, "Tile diff is not enabled");
+
+    return esp_panel_pixel_diff_get_stats(_tile_diff.handle, &stats, clear);
+}
+
+bool ESP_PanelLcd::setTearingEffectSync(int te_io, uint16_t lcd_height, uint16_t vblank_lines)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (bus->getType() != ESP_PANEL_BUS_TYPE_RGB) && (bus->getType() != ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "RGB and MIPI-DSI interfaces don't support TE synchronization"
+    );
+
+    if (_te.handle != NULL) {
+        ESP_PANEL_CHECK_ERR_RET(gpio_isr_handler_remove((gpio_num_t)_te.io), false, "Remove TE ISR handler failed");
+        gpio_intr_disable((gpio_num_t)_te.io);
+        esp_panel_te_sync_del(_te.handle);
+        vSemaphoreDelete(_te.sem);
+        _te = {};
+    }
+    if (te_io < 0) {
+        return true;
+    }
+
+    gpio_config_t io_config = {
+        .pin_bit_mask = BIT64(te_io),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_POSEDGE,
+    };
+    ESP_PANEL_CHECK_ERR_RET(gpio_config(&io_config), false, "Config TE pin(%d) failed", te_io);
+    /* ISR service can be installed from user before, then it returns invalid state */
+    esp_err_t ret = gpio_install_isr_service(0);
+    ESP_PANEL_CHECK_FALSE_RET((ret == ESP_OK) || (ret == ESP_ERR_INVALID_STATE), false, "Install GPIO ISR failed");
+
+    esp_panel_te_sync_config_t sync_config = ESP_PANEL_TE_SYNC_CONFIG_DEFAULT(lcd_height);
+    sync_config.vblank_lines = vblank_lines;
+    sync_config.y_align = y_coord_align;
+    _te.handle = esp_panel_te_sync_new(&sync_config);
+    ESP_PANEL_CHECK_NULL_RET(_te.handle, false, "Create TE synchronization failed");
+    _te.sem = xSemaphoreCreateBinary();
+    if ((_te.sem == NULL) || (gpio_isr_handler_add((gpio_num_t)te_io, onTearingEffect, this) != ESP_OK)) {
+        ESP_LOGE(TAG, "Create semaphore or add TE ISR handler failed");
+        if (_te.sem != NULL) {
+            vSemaphoreDelete(_te.sem);
+        }
+        esp_panel_te_sync_del(_te.handle);
+        _te = {};
+
+        return false;
+    }
+    _te.io = te_io;
+
+    return true;
+}
+
+bool ESP_PanelLcd::getTearingEffectStats(esp_panel_te_sync_stats_t &stats, bool clear)
+{
+    ESP_PANEL_CHECK_NULL_RET(_te.handle, false, "TE synchronization is not enabled");
+
+    return esp_panel_te_sync_get_stats(_te.handle, &stats, clear);
+}
+
+bool ESP_PanelLcd::setBounceBuffer(size_t buf_size)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (bus->getType() != ESP_PANEL_BUS_TYPE_RGB) && (bus->getType() != ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "RGB and MIPI-DSI interfaces don't support bounce buffer"
+    );
+
+    /* The bounce buffers may still be in flight */
+    ESP_PANEL_CHECK_FALSE_RET(
+        waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), -1), false,
+        "Wait for the previous drawings to finish failed"
+    );
+    if (_bounce.handle != NULL) {
+        esp_panel_draw_bounce_del(_bounce.handle);
+    }
+    for (int i = 0; i < ESP_PANEL_DRAW_BOUNCE_BUF_NUM; i++) {
+        if (_bounce.bufs[i] != NULL) {
+            heap_caps_free(_bounce.bufs[i]);
+        }
+    }
+    _bounce = {};
+    if (buf_size == 0) {
+        return true;
+    }
+
+    /* A band is sent by a single transfer, so it doesn't need to be split again */
+    if ((_max_transfer_size > 0) && (buf_size > _max_transfer_size)) {
+        buf_size = _max_transfer_size;
+    }
+    buf_size -= buf_size % ESP_PANEL_DRAW_BOUNCE_BUF_ALIGN;
+    ESP_PANEL_CHECK_FALSE_RET(buf_size > 0, false, "Buffer size is smaller than the cache line");
+
+    esp_panel_draw_bounce_config_t bounce_config = {
+        .bufs = {},
+        .buf_size = buf_size,
+        .draw_cb = drawBounceBand,
+        .wait_cb = waitBounceBand,
+        .get_time_us = esp_timer_get_time,
+        .user_ctx = this,
+    };
+    for (int i = 0; i < ESP_PANEL_DRAW_BOUNCE_BUF_NUM; i++) {
+        _bounce.bufs[i] = (uint8_t *)heap_caps_aligned_alloc(
+                              ESP_PANEL_DRAW_BOUNCE_BUF_ALIGN, buf_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL
+                          );
+        bounce_config.bufs[i] = _bounce.bufs[i];
+        if (_bounce.bufs[i] == NULL) {
+            ESP_LOGE(TAG, "Malloc bounce buffer(%d) failed", (int)buf_size);
+            setBounceBuffer(0);
+            return false;
+        }
+    }
+    _bounce.handle = esp_panel_draw_bounce_new(&bounce_config);
+    if (_bounce.handle == NULL) {
+        ESP_LOGE(TAG, "Create bounce drawing failed");
+        setBounceBuffer(0);
+        return false;
+    }
+
+    return true;
+}
+
+bool ESP_PanelLcd::getBounceStats(esp_panel_draw_bounce_stats_t &stats, bool clear)
+{
+    ESP_PANEL_CHECK_NULL_RET(_bounce.handle, false, "Bounce buffer is not enabled");
+
+    return esp_panel_draw_bounce_get_stats(_bounce.handle, &stats, clear);
+}
+
+bool ESP_PanelLcd::getWindowCacheStats(esp_panel_window_cache_stats_t &stats, bool clear)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
+    ESP_PANEL_CHECK_NULL_RET(vendor_config.window_cache, false, "Window cache is not supported");
+
+    return esp_panel_window_cache_get_stats(vendor_config.window_cache, &stats, clear);
+}
+
+bool ESP_PanelLcd::invalidateWindowCache(void)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
+
+    esp_panel_window_cache_invalidate(vendor_config.window_cache);
 
     return true;
 }
@@ -375,6 +849,53 @@ bool ESP_PanelLcd::invertColor(bool en)
     return true;
 }
 
+bool ESP_PanelLcd::configScrollArea(uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(supported_functions.vertical_scroll, false, "Vertical scroll is not supported");
+    ESP_PANEL_CHECK_FALSE_RET(
+        bus->getType() == ESP_PANEL_BUS_TYPE_SPI, false, "Vertical scroll only works with the SPI interface"
+    );
+    ESP_PANEL_CHECK_FALSE_RET(scroll_lines > 0, false, "Invalid scroll lines");
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_scroll_config_area(
+            &_scroll, _gap_y, top_fixed_lines, scroll_lines, bottom_fixed_lines, sendScrollParam, this
+        ), false, "Config scroll area failed"
+    );
+
+    return true;
+}
+
+bool ESP_PanelLcd::scrollTo(uint16_t line)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkScrollEnabled(), false, "Scroll is not available");
+
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_scroll_to(&_scroll, line, sendScrollParam, this), false, "Scroll failed");
+
+    return true;
+}
+
+bool ESP_PanelLcd::scrollLines(int lines, uint16_t width, const uint8_t *color_data)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkScrollEnabled(), false, "Scroll is not available");
+    ESP_PANEL_CHECK_FALSE_RET((width > 0) || (lines == 0), false, "Invalid width");
+
+    int bytes_per_pixel = getBytesPerPixelToSend();
+    ESP_PANEL_CHECK_FALSE_RET(bytes_per_pixel > 0, false, "Invalid color bits");
+    DrawScrollContext_t context = {
+        .lcd_ptr = this,
+        .width = width,
+    };
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_scroll_lines(
+            &_scroll, lines, color_data, (size_t)width * bytes_per_pixel, sendScrollParam, drawScrollLines, &context
+        ), false, "Scroll lines failed"
+    );
+
+    return true;
+}
+
 bool ESP_PanelLcd::displayOn(void)
 {
     ESP_PANEL_CHECK_FALSE_RET(checkIsInit(), false, "Not initialized");
@@ -478,31 +999,20 @@ bool ESP_PanelLcd::colorBarTest(uint16_t width, uint16_t height)
 
     ESP_LOGD(TAG, "Color bar test, width: %d, height: %d, bits per pixel: %d", width, height, bits_per_piexl);
 
-    int bytes_per_piexl = bits_per_piexl / 8;
     int row_per_bar = height / bits_per_piexl;
     int line_count = 0;
     int res_line_count = 0;
 
-    /* Malloc memory for a single color bar */
-    shared_ptr<uint8_t> single_bar_buf(new uint8_t[row_per_bar * width * bytes_per_piexl], [](uint8_t* ptr) { delete[] ptr; });
-    ESP_PANEL_CHECK_FALSE_RET(single_bar_buf != nullptr, false, "Malloc color buffer failed");
-
     /* Draw color bar from top left to bottom right, the order is B - G - R */
-    for (int j = 0; j < bits_per_piexl; j++) {
-        for (int i = 0; i < row_per_bar * width; i++) {
-            for (int k = 0; k < bytes_per_piexl; k++) {
-                if ((bus->getType() == ESP_PANEL_BUS_TYPE_SPI) || (bus->getType() == ESP_PANEL_BUS_TYPE_QSPI)) {
-                    // For SPI interface, the data bytes should be swapped since the data is sent by LSB first
-                    single_bar_buf.get()[i * bytes_per_piexl + k] = SPI_SWAP_DATA_TX(BIT(j), bits_per_piexl) >> (k * 8);
-                } else {
-                    single_bar_buf.get()[i * bytes_per_piexl + k] = BIT(j) >> (k * 8);
-                }
-            }
+    for (int j = 0; (row_per_bar > 0) && (j < bits_per_piexl); j++) {
+        uint32_t color = BIT(j);
+        if ((bus->getType() == ESP_PANEL_BUS_TYPE_SPI) || (bus->getType() == ESP_PANEL_BUS_TYPE_QSPI)) {
+            // For SPI interface, the data bytes should be swapped since the data is sent by LSB first
+            color = SPI_SWAP_DATA_TX(BIT(j), bits_per_piexl);
         }
         line_count += row_per_bar;
         ESP_PANEL_CHECK_FALSE_RET(
-            drawBitmapWaitUntilFinish(0, j * row_per_bar, width, row_per_bar, single_bar_buf.get()), false,
-            "Draw bitmap failed"
+            fillRect(0, j * row_per_bar, width, row_per_bar, color), false, "Fill color bar failed"
         );
     }
 
@@ -511,10 +1021,8 @@ bool ESP_PanelLcd::colorBarTest(uint16_t width, uint16_t height)
     if (res_line_count > 0) {
         ESP_LOGD(TAG, "Fill the rest lines (%d) with white color", res_line_count);
 
-        memset(single_bar_buf.get(), 0xff, res_line_count * width * bytes_per_piexl);
         ESP_PANEL_CHECK_FALSE_RET(
-            drawBitmapWaitUntilFinish(0, line_count, width, res_line_count, single_bar_buf.get()), false,
-            "Draw bitmap failed"
+            fillRect(0, line_count, width, res_line_count, 0xFFFFFFFF), false, "Fill white color failed"
         );
     }
 
@@ -579,6 +1087,17 @@ int ESP_PanelLcd::getColorBits(void)
     return bits_per_pixel;
 }
 
+int ESP_PanelLcd::getBytesPerPixelToSend(void)
+{
+    if (_sw_rotation.convert_format) {
+        return esp_panel_pixel_format_get_bytes(_sw_rotation.to_format);
+    }
+
+    int bits_per_pixel = getColorBits();
+
+    return (bits_per_pixel > 0) ? ((bits_per_pixel + 7) / 8) : -1;
+}
+
 void *ESP_PanelLcd::getFrameBufferByIndex(uint8_t index)
 {
     ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), NULL, "Not begun");
@@ -619,11 +1138,14 @@ bool ESP_PanelLcd::loadVendorConfigFromBus(void)
     ESP_PANEL_CHECK_NULL_RET(bus, false, "Invalid bus");
 
     switch (bus->getType()) {
+    /* The MIPI-DCS drivers skip the unchanged address window through the cache */
     case ESP_PANEL_BUS_TYPE_SPI:
         vendor_config.flags.use_spi_interface = 1;
+        vendor_config.window_cache = &_window_cache;
         break;
     case ESP_PANEL_BUS_TYPE_QSPI:
         vendor_config.flags.use_qspi_interface = 1;
+        vendor_config.window_cache = &_window_cache;
         break;
 #if SOC_LCD_RGB_SUPPORTED
     /* Retrieve RGB configuration from the bus and register it into the vendor configuration */
@@ -651,6 +1173,393 @@ bool ESP_PanelLcd::loadVendorConfigFromBus(void)
     return true;
 }
 
+bool ESP_PanelLcd::drawBitmapBySoftware(
+    uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, const uint8_t *color_data, int timeout_ms
+)
+{
+    int bits_per_pixel = getColorBits();
+    ESP_PANEL_CHECK_FALSE_RET(bits_per_pixel > 0, false, "Invalid color bits");
+    ESP_PANEL_CHECK_FALSE_RET((width > 0) && (height > 0), false, "Invalid bitmap size");
+
+    uint8_t bytes_per_pixel = (bits_per_pixel + 7) / 8;
+    uint8_t out_bytes_per_pixel = bytes_per_pixel;
+    if (_sw_rotation.convert_format) {
+        out_bytes_per_pixel = esp_panel_pixel_format_get_bytes(_sw_rotation.to_format);
+    }
+    uint16_t x_end = x_start + width - 1;
+    uint16_t y_end = y_start + height - 1;
+    ESP_PANEL_CHECK_FALSE_RET(rotateAreaBySoftware(x_start, y_start, x_end, y_end), false, "Rotate area failed");
+
+    /* Only reallocate the buffer when it is too small */
+    size_t buf_size = width * height * out_bytes_per_pixel;
+    if (buf_size > _sw_rotation.buf_size) {
+        if (_sw_rotation.buf != NULL) {
+            heap_caps_free(_sw_rotation.buf);
+            _sw_rotation.buf_size = 0;
+        }
+        /* The RGB/MIPI-DSI LCDs copy the bitmap by CPU/DMA2D, other LCDs transmit it by DMA directly */
+        uint32_t caps = MALLOC_CAP_8BIT;
+        if ((bus->getType() != ESP_PANEL_BUS_TYPE_RGB) && (bus->getType() != ESP_PANEL_BUS_TYPE_MIPI_DSI)) {
+            caps |= MALLOC_CAP_DMA;
+        }
+        _sw_rotation.buf = (uint8_t *)heap_caps_malloc(buf_size, caps);
+        ESP_PANEL_CHECK_NULL_RET(_sw_rotation.buf, false, "Malloc rotation buffer(%d) failed", (int)buf_size);
+        _sw_rotation.buf_size = buf_size;
+    }
+    if (_sw_rotation.convert_format) {
+        /* Rotate, swap and expand the pixels in a single pass */
+        ESP_PANEL_CHECK_FALSE_RET(
+            esp_panel_pixel_convert_copy(
+                color_data, _sw_rotation.buf, 0, 0, width - 1, height - 1, width, height, _sw_rotation.degree,
+                _sw_rotation.from_format, _sw_rotation.to_format
+            ), false, "Convert bitmap failed"
+        );
+    } else {
+        ESP_PANEL_CHECK_FALSE_RET(
+            esp_panel_pixel_rotate_copy(
+                color_data, _sw_rotation.buf, 0, 0, width - 1, height - 1, width, height, _sw_rotation.degree,
+                bytes_per_pixel
+            ), false, "Rotate bitmap failed"
+        );
+    }
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        drawBitmapToPanel(x_start, y_start, x_end - x_start + 1, y_end - y_start + 1, _sw_rotation.buf), false,
+        "Draw bitmap failed"
+    );
+
+    /* The buffer will be reused by the next drawing, so always wait for the drawing to finish */
+    ESP_PANEL_CHECK_FALSE_RET(
+        waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), timeout_ms), false,
+        "Draw bitmap wait for finish timeout"
+    );
+
+    return true;
+}
+
+bool ESP_PanelLcd::rotateAreaBySoftware(uint16_t &x_start, uint16_t &y_start, uint16_t &x_end, uint16_t &y_end)
+{
+    if (_sw_rotation.degree == 0) {
+        return true;
+    }
+
+    /* Convert the area from the rotated frame into the LCD frame */
+    bool is_swap = (_sw_rotation.degree == 90) || (_sw_rotation.degree == 270);
+    uint16_t frame_width = is_swap ? _sw_rotation.lcd_height : _sw_rotation.lcd_width;
+    uint16_t frame_height = is_swap ? _sw_rotation.lcd_width : _sw_rotation.lcd_height;
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_pixel_rotate_area(frame_width, frame_height, _sw_rotation.degree, &x_start, &y_start, &x_end, &y_end),
+        false, "Invalid area (%d, %d) - (%d, %d)", x_start, y_start, x_end, y_end
+    );
+
+    return true;
+}
+
+bool ESP_PanelLcd::waitDrawBitmapFinish(uint32_t draw_count, int timeout_ms)
+{
+    /* For RGB LCD, since `esp_lcd_panel_draw_bitmap()` uses `memcpy()` instead of DMA operation, doesn't need to wait */
+    if ((bus->getType() == ESP_PANEL_BUS_TYPE_RGB) || (_draw_bitmap_finish_sem == NULL)) {
+        return true;
+    }
+
+    /* The semaphore is given by every finished drawing, so check the count again after taking it */
+    TickType_t start_tick = xTaskGetTickCount();
+    TickType_t timeout_tick = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    while (!esp_panel_draw_queue_is_done(&_draw_queue, draw_count)) {
+        TickType_t wait_tick = portMAX_DELAY;
+        if (timeout_ms >= 0) {
+            TickType_t elapsed_tick = xTaskGetTickCount() - start_tick;
+            if (elapsed_tick >= timeout_tick) {
+                return false;
+            }
+            wait_tick = timeout_tick - elapsed_tick;
+        }
+        xSemaphoreTake(_draw_bitmap_finish_sem, wait_tick);
+    }
+
+    return true;
+}
+
+bool ESP_PanelLcd::drawFillBand(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                                const void *data)
+{
+    ESP_PanelLcd *lcd_ptr = (ESP_PanelLcd *)user_ctx;
+
+    /* Only the last band notifies the finish callback */
+    return lcd_ptr->submitDrawBitmap(x_start, y_start, x_end, y_end, data, y_end == lcd_ptr->_fill.y_end);
+}
+
+bool ESP_PanelLcd::drawDiffRect(void *user_ctx, const esp_panel_pixel_rect_t *rect, bool is_last)
+{
+    ESP_PanelLcd *lcd_ptr = (ESP_PanelLcd *)user_ctx;
+    auto &diff = lcd_ptr->_tile_diff;
+
+    uint16_t width = rect->x2 - rect->x1 + 1;
+    uint16_t height = rect->y2 - rect->y1 + 1;
+    size_t line_size = width * diff.bytes_per_pixel;
+    const uint8_t *data = diff.data + ((rect->y1 - diff.y_start) * diff.width + (rect->x1 - diff.x_start)) *
+                          diff.bytes_per_pixel;
+    /* The rows of a full-width rectangle are contiguous in the bitmap, others are packed into the buffer */
+    if (width != diff.width) {
+        uint8_t *buf = diff.buf + diff.buf_offset;
+        for (int i = 0; i < height; i++) {
+            memcpy(buf + i * line_size, data + i * diff.width * diff.bytes_per_pixel, line_size);
+        }
+        data = buf;
+        diff.buf_offset += line_size * height;
+    }
+    diff.rect_num++;
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        lcd_ptr->submitDrawBitmap(rect->x1, rect->y1, rect->x2 + 1, rect->y2 + 1, data, is_last), false,
+        "Draw rect failed"
+    );
+    if (data != diff.data) {
+        diff.draw_count = esp_panel_draw_queue_get_submitted(&lcd_ptr->_draw_queue);
+    }
+
+    return true;
+}
+
+bool ESP_PanelLcd::submitDrawBitmap(
+    uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data, bool is_last
+)
+{
+    /* The scan line can't be followed if the rows of the drawing are not scanned from top to bottom */
+    if ((_te.handle != NULL) && !_flags.swap_xy && !_flags.mirror_y) {
+        return submitDrawBitmapByTe(x_start, y_start, x_end, y_end, data, is_last);
+    }
+
+    return queueDrawBitmap(x_start, y_start, x_end, y_end, data, is_last);
+}
+
+bool ESP_PanelLcd::submitDrawBitmapByTe(
+    uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data, bool is_last
+)
+{
+    int bytes_per_pixel = getBytesPerPixelToSend();
+    ESP_PANEL_CHECK_FALSE_RET(bytes_per_pixel > 0, false, "Invalid color bits");
+
+    size_t line_size = (x_end - x_start) * bytes_per_pixel;
+    const uint8_t *chunk_data = (const uint8_t *)data;
+    uint16_t y = y_start;
+    while (y < y_end) {
+        /* The start time of a transfer is only known when the bus is idle */
+        ESP_PANEL_CHECK_FALSE_RET(
+            waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), -1), false,
+            "Wait for the previous drawings failed"
+        );
+
+        esp_panel_te_sync_chunk_t chunk = {};
+        while (true) {
+            int64_t now_us = esp_timer_get_time();
+            ESP_PANEL_CHECK_FALSE_RET(
+                esp_panel_te_sync_plan(_te.handle, now_us, y + _gap_y, y_end - 1 + _gap_y, &chunk), false,
+                "Plan TE chunk failed, out of LCD height?"
+            );
+            int64_t wait_us = chunk.start_us - now_us;
+            if (wait_us <= 0) {
+                break;
+            }
+            if (wait_us <= TE_BUSY_WAIT_US_MAX) {
+                esp_rom_delay_us(wait_us);
+                break;
+            }
+            /* Sleep until the next TE edge, then plan again with it */
+            xSemaphoreTake(_te.sem, pdMS_TO_TICKS(wait_us / 1000) + 1);
+        }
+
+        uint16_t chunk_end = chunk.y_end - _gap_y + 1;
+        int64_t start_us = esp_timer_get_time();
+        ESP_PANEL_CHECK_FALSE_RET(
+            queueDrawBitmap(x_start, y, x_end, chunk_end, chunk_data, is_last && (chunk_end == y_end)), false,
+            "Draw TE chunk failed"
+        );
+        ESP_PANEL_CHECK_FALSE_RET(
+            waitDrawBitmapFinish(esp_panel_draw_queue_get_submitted(&_draw_queue), -1), false,
+            "Wait for the TE chunk failed"
+        );
+        esp_panel_te_sync_report(_te.handle, chunk_end - y, esp_timer_get_time() - start_us);
+
+        chunk_data += (chunk_end - y) * line_size;
+        y = chunk_end;
+    }
+
+    return true;
+}
+
+bool ESP_PanelLcd::queueDrawBitmap(
+    uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data, bool is_last
+)
+{
+    /* The bitmap in PSRAM is copied into the internal bounce buffers, which are not larger than a transfer */
+    if ((_bounce.handle != NULL) && esp_ptr_external_ram(data)) {
+        int bytes_per_pixel = getBytesPerPixelToSend();
+        ESP_PANEL_CHECK_FALSE_RET(bytes_per_pixel > 0, false, "Invalid color bits");
+        ESP_PANEL_CHECK_FALSE_RET(
+            esp_panel_draw_bounce_bitmap(
+                _bounce.handle, x_start, y_start, x_end, y_end, data, bytes_per_pixel, y_coord_align, is_last
+            ), false, "Draw bounce bitmap failed"
+        );
+        return true;
+    }
+
+    if (_max_transfer_size == 0) {
+        return queueDrawBand(x_start, y_start, x_end, y_end, data, is_last);
+    }
+
+    int bytes_per_pixel = getBytesPerPixelToSend();
+    ESP_PANEL_CHECK_FALSE_RET(bytes_per_pixel > 0, false, "Invalid color bits");
+
+    DrawSplitContext_t context = {
+        .lcd_ptr = this,
+        .is_last = is_last,
+    };
+    ESP_PANEL_CHECK_FALSE_RET(
+        esp_panel_draw_split_bitmap(
+            x_start, y_start, x_end, y_end, data, bytes_per_pixel, _max_transfer_size, y_coord_align, drawSplitBand,
+            &context
+        ), false, "Draw split bitmap failed"
+    );
+
+    return true;
+}
+
+bool ESP_PanelLcd::drawSplitBand(
+    void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data, bool is_last
+)
+{
+    DrawSplitContext_t *context = (DrawSplitContext_t *)user_ctx;
+
+    /* Only the last band of the last drawing notifies the finish callback */
+    return context->lcd_ptr->queueDrawBand(x_start, y_start, x_end, y_end, data, context->is_last && is_last);
+}
+
+bool ESP_PanelLcd::drawBounceBand(
+    void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data, bool is_last,
+    uint32_t *token
+)
+{
+    ESP_PanelLcd *lcd_ptr = (ESP_PanelLcd *)user_ctx;
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        lcd_ptr->queueDrawBand(x_start, y_start, x_end, y_end, data, is_last), false, "Draw bounce band failed"
+    );
+    *token = esp_panel_draw_queue_get_submitted(&lcd_ptr->_draw_queue);
+
+    return true;
+}
+
+bool ESP_PanelLcd::waitBounceBand(void *user_ctx, uint32_t token)
+{
+    ESP_PanelLcd *lcd_ptr = (ESP_PanelLcd *)user_ctx;
+
+    return lcd_ptr->waitDrawBitmapFinish(token, -1);
+}
+
+bool ESP_PanelLcd::sendScrollParam(void *user_ctx, int cmd, const void *param, size_t size)
+{
+    ESP_PanelLcd *lcd_ptr = (ESP_PanelLcd *)user_ctx;
+
+    return lcd_ptr->bus->writeRegisterData(cmd, param, size);
+}
+
+bool ESP_PanelLcd::drawScrollLines(void *user_ctx, uint16_t y_start, uint16_t y_end, const void *data)
+{
+    DrawScrollContext_t *context = (DrawScrollContext_t *)user_ctx;
+
+    return context->lcd_ptr->drawBitmap(0, y_start, context->width, y_end - y_start, (const uint8_t *)data);
+}
+
+bool ESP_PanelLcd::checkScrollEnabled(void)
+{
+    ESP_PANEL_CHECK_FALSE_RET(checkIsBegun(), false, "Not begun");
+    ESP_PANEL_CHECK_FALSE_RET(_scroll.height > 0, false, "Scroll area is not configured");
+    /* The scrolling follows the frame memory, which doesn't match the drawn lines in these cases */
+    ESP_PANEL_CHECK_FALSE_RET(
+        !_flags.swap_xy && !_flags.mirror_y && (_sw_rotation.degree == 0), false,
+        "Scroll doesn't work with swapped axes, mirrored Y axis or software rotation"
+    );
+
+    return true;
+}
+
+bool ESP_PanelLcd::queueDrawBand(
+    uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data, bool is_last
+)
+{
+    /* Only the last drawing of a bitmap notifies the finish callback, so the caller (like LVGL) is notified once */
+    uint32_t token = esp_panel_draw_queue_prepare(&_draw_queue, is_last);
+    ESP_PANEL_CHECK_ERR_RET(
+        esp_lcd_panel_draw_bitmap(handle, x_start, y_start, x_end, y_end, data), false, "Draw bitmap failed"
+    );
+    esp_panel_draw_queue_commit(&_draw_queue, token);
+
+    return true;
+}
+
+bool ESP_PanelLcd::drawBitmapToPanel(
+    uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, const uint8_t *data
+)
+{
+    if (_tile_diff.tile_size == 0) {
+        return submitDrawBitmap(x_start, y_start, x_start + width, y_start + height, data, true);
+    }
+
+    /* The tile diff is created again if the pixel format is changed */
+    int bytes_per_pixel = getBytesPerPixelToSend();
+    ESP_PANEL_CHECK_FALSE_RET(bytes_per_pixel > 0, false, "Invalid color bits");
+    if ((_tile_diff.handle == NULL) || (_tile_diff.bytes_per_pixel != bytes_per_pixel)) {
+        if (_tile_diff.handle != NULL) {
+            esp_panel_pixel_diff_del(_tile_diff.handle);
+        }
+        esp_panel_pixel_diff_config_t diff_config = {
+            .width = _tile_diff.lcd_width,
+            .height = _tile_diff.lcd_height,
+            .tile_size = _tile_diff.tile_size,
+            .bytes_per_pixel = (uint8_t)bytes_per_pixel,
+        };
+        _tile_diff.handle = esp_panel_pixel_diff_new(&diff_config);
+        ESP_PANEL_CHECK_NULL_RET(_tile_diff.handle, false, "Create tile diff failed");
+        _tile_diff.bytes_per_pixel = bytes_per_pixel;
+    }
+
+    /* The packed rectangles of the previous bitmap may still be in flight */
+    ESP_PANEL_CHECK_FALSE_RET(
+        waitDrawBitmapFinish(_tile_diff.draw_count, -1), false, "Wait for the previous tiles to finish failed"
+    );
+    size_t buf_size = width * height * bytes_per_pixel;
+    if (buf_size > _tile_diff.buf_size) {
+        if (_tile_diff.buf != NULL) {
+            heap_caps_free(_tile_diff.buf);
+            _tile_diff.buf_size = 0;
+        }
+        _tile_diff.buf = (uint8_t *)heap_caps_malloc(buf_size, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+        ESP_PANEL_CHECK_NULL_RET(_tile_diff.buf, false, "Malloc tile diff buffer(%d) failed", (int)buf_size);
+        _tile_diff.buf_size = buf_size;
+    }
+    _tile_diff.buf_offset = 0;
+    _tile_diff.rect_num = 0;
+    _tile_diff.x_start = x_start;
+    _tile_diff.y_start = y_start;
+    _tile_diff.width = width;
+    _tile_diff.data = data;
+
+    if (!esp_panel_pixel_diff_draw(_tile_diff.handle, x_start, y_start, width, height, data, drawDiffRect, this)) {
+        /* The hashes have been updated, so forget the area which may not be sent */
+        esp_panel_pixel_diff_invalidate(_tile_diff.handle, x_start, y_start, width, height);
+        ESP_LOGE(TAG, "Draw bitmap by tile diff failed");
+        return false;
+    }
+
+    /* Nothing is sent, so notify the finish callback here */
+    if ((_tile_diff.rect_num == 0) && (onDrawBitmapFinishCallback != NULL)) {
+        onDrawBitmapFinishCallback(_callback_data.user_data);
+    }
+
+    return true;
+}
+
 IRAM_ATTR bool ESP_PanelLcd::onDrawBitmapFinish(void *panel_io, void *edata, void *user_ctx)
 {
     ESP_PanelLcdCallbackData_t *callback_data = (ESP_PanelLcdCallbackData_t *)user_ctx;
@@ -663,8 +1572,10 @@ IRAM_ATTR bool ESP_PanelLcd::onDrawBitmapFinish(void *panel_io, void *edata, voi
         return false;
     }
 
+    bool need_notify = esp_panel_draw_queue_on_done(&lcd_ptr->_draw_queue);
+
     BaseType_t need_yield = pdFALSE;
-    if (lcd_ptr->onDrawBitmapFinishCallback != NULL) {
+    if (need_notify && (lcd_ptr->onDrawBitmapFinishCallback != NULL)) {
         need_yield = lcd_ptr->onDrawBitmapFinishCallback(callback_data->user_data) ? pdTRUE : need_yield;
     }
     if (lcd_ptr->_draw_bitmap_finish_sem != NULL) {
@@ -693,3 +1604,19 @@ IRAM_ATTR bool ESP_PanelLcd::onRefreshFinish(void *panel_io, void *edata, void *
 
     return (need_yield == pdTRUE);
 }
+
+IRAM_ATTR void ESP_PanelLcd::onTearingEffect(void *arg)
+{
+    ESP_PanelLcd *lcd_ptr = (ESP_PanelLcd *)arg;
+    if ((lcd_ptr == NULL) || (lcd_ptr->_te.handle == NULL)) {
+        return;
+    }
+
+    esp_panel_te_sync_on_te(lcd_ptr->_te.handle, esp_timer_get_time());
+
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(lcd_ptr->_te.sem, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
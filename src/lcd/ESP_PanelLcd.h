@@ -15,8 +15,16 @@
 #include "freertos/semphr.h"
 #include "base/esp_lcd_vendor_types.h"
 #include "bus/ESP_PanelBus.h"
+#include "utils/esp_panel_pixel_convert.h"
+#include "utils/esp_panel_draw_bounce.h"
+#include "utils/esp_panel_draw_queue.h"
+#include "utils/esp_panel_pixel_diff.h"
+#include "utils/esp_panel_scroll.h"
+#include "utils/esp_panel_te_sync.h"
+#include "utils/esp_panel_window_cache.h"
 
 #define ESP_PANEL_LCD_FRAME_BUFFER_MAX_NUM  (3)
+#define ESP_PANEL_LCD_FILL_BUFFER_SIZE      (4096)  // Minimum size of the line buffer used by `fillRect()`, in bytes
 
 /**
  * @brief LCD device default configuration macro
@@ -203,6 +211,8 @@ public:
      * @note  This function is non-blocking, the drawing will be finished in the background. So the bitmap data should
      *        not be modified until the drawing is finished
      * @note  For RGB interface, this function is same as `drawBitmapWaitUntilFinish()`
+     * @note  For SPI and QSPI interfaces, the bitmap larger than the maximum transfer size of the host is split into
+     *        bands of aligned lines, which are queued together, and the finish callback is only called once
      *
      * @param x_start    X coordinate of the start point, the range is [0, lcd_width - 1]
      * @param y_start    Y coordinate of the start point, the range is [0, lcd_height - 1]
@@ -236,6 +246,254 @@ public:
     bool drawBitmapWaitUntilFinish(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height,
                                    const uint8_t *color_data, int timeout_ms = -1);
 
+    /**
+     * @brief Draw the bitmap to the LCD without waiting, and get a token to wait for this drawing later
+     *
+     * @note  This function should be called after `begin()`
+     * @note  The drawings are queued by the bus (see the `trans_queue_depth` of the panel IO) and finished in order, so
+     *        the caller can render the next band while the previous ones are being sent. This function only blocks
+     *        when the queue of the bus is full
+     * @note  A token is finished when its drawing and all the drawings before it are finished. The bitmap data should
+     *        not be modified until its token is finished
+     * @note  If the software rotation or conversion is enabled, the drawing is already finished when this function
+     *        returns
+     *
+     * @param x_start    X coordinate of the start point, the range is [0, lcd_width - 1]
+     * @param y_start    Y coordinate of the start point, the range is [0, lcd_height - 1]
+     * @param width      Width of the bitmap, the range is [1, lcd_width]
+     * @param height     Height of the bitmap, the range is [1, lcd_height]
+     * @param color_data Pointer of the color data array
+     * @param token      Token of the drawing, used by `waitDrawBitmapToken()` and `checkDrawBitmapTokenDone()`
+     *
+     * @return true if success, otherwise false
+     */
+    bool drawBitmapAsync(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height,
+                         const uint8_t *color_data, uint32_t &token);
+
+    /**
+     * @brief Wait for the drawing of the token to finish
+     *
+     * @note  This function should be called after `begin()`
+     *
+     * @param token      Token returned by `drawBitmapAsync()`
+     * @param timeout_ms Timeout in milliseconds, -1 means wait forever
+     *
+     * @return true if success, otherwise false or timeout
+     */
+    bool waitDrawBitmapToken(uint32_t token, int timeout_ms = -1);
+
+    /**
+     * @brief Wait for all the queued drawings (including the ones of `drawBitmap()` and `fillRect()`) to finish
+     *
+     * @note  This function should be called after `begin()`
+     *
+     * @param timeout_ms Timeout in milliseconds, -1 means wait forever
+     *
+     * @return true if success, otherwise false or timeout
+     */
+    bool waitDrawBitmapQueue(int timeout_ms = -1);
+
+    /**
+     * @brief Check whether the drawing of the token is finished without waiting
+     *
+     * @param token Token returned by `drawBitmapAsync()`
+     *
+     * @return true if finished, otherwise false
+     */
+    bool checkDrawBitmapTokenDone(uint32_t token);
+
+    /**
+     * @brief Get the number of the drawings which are queued but not finished
+     *
+     * @return The number of the drawings in flight
+     */
+    uint32_t getDrawBitmapPendingNum(void);
+
+    /**
+     * @brief Fill a rectangle with a solid color without waiting for the drawing to finish
+     *
+     * @note  This function should be called after `begin()`
+     * @note  The color is sent from a small internal line buffer (see `ESP_PANEL_LCD_FILL_BUFFER_SIZE`) band by band,
+     *        so a full-screen clear doesn't need a frame sized buffer. The buffer is only refilled when the color
+     *        changes, and then this function waits for the previous filling to finish
+     * @note  For RGB/MIPI-DSI interface, the bands are copied into the frame buffer by the driver
+     * @note  The software rotation and pixel format conversion are also applied if they are enabled
+     *
+     * @param x_start X coordinate of the start point, the range is [0, lcd_width - 1]
+     * @param y_start Y coordinate of the start point, the range is [0, lcd_height - 1]
+     * @param width   Width of the rectangle, the range is [1, lcd_width]
+     * @param height  Height of the rectangle, the range is [1, lcd_height]
+     * @param color   Color of the pixel, stored in the same byte order as the bitmap passed to `drawBitmap()` (the
+     *                lowest byte first). For example, use `SPI_SWAP_DATA_TX(color, 16)` for a byte-swapped RGB565 LCD
+     *
+     * @return true if success, otherwise false
+     */
+    bool fillRect(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, uint32_t color);
+
+    /**
+     * @brief Rotate the bitmaps by software before drawing them, default is disabled (0 degree)
+     *
+     * @note  This function should be called after `init()`
+     * @note  This is mainly used by the LCDs which can't rotate by command (like the RGB/MIPI-DSI LCDs) when LVGL is not
+     *        used. After calling this function, the coordinates passed to `drawBitmap()` and
+     *        `drawBitmapWaitUntilFinish()` are in the rotated frame, and the bitmaps are rotated into an internal
+     *        buffer before drawing
+     * @note  Since the internal buffer is reused by the next drawing, `drawBitmap()` will wait for the drawing to finish
+     *        like `drawBitmapWaitUntilFinish()` when the software rotation is enabled
+     *
+     * @param degree     Rotation degree (clockwise), should be one of 0/90/180/270. 0 means disable
+     * @param lcd_width  Width of the LCD without rotation
+     * @param lcd_height Height of the LCD without rotation
+     *
+     * @return true if success, otherwise false
+     */
+    bool setSoftwareRotation(uint16_t degree, uint16_t lcd_width, uint16_t lcd_height);
+
+    /**
+     * @brief Convert the pixel format of the bitmaps by software before drawing them, default is disabled
+     *
+     * @note  This function should be called after `init()`
+     * @note  This is mainly used by the SPI/QSPI LCDs, whose wire format is different from the LVGL's buffer, like the
+     *        byte-swapped RGB565 (same as `SPI_SWAP_DATA_TX()`) or the 3 bytes RGB666 of the 18-bit LCDs. The
+     *        conversion is fused with the software rotation (see `setSoftwareRotation()`), so the bitmap is only read
+     *        once and the internal buffer is only written once
+     * @note  Since the internal buffer is reused by the next drawing, `drawBitmap()` will wait for the drawing to finish
+     *        like `drawBitmapWaitUntilFinish()` when the conversion is enabled
+     *
+     * @param from_format Format of the bitmaps, should be `ESP_PANEL_PIXEL_FORMAT_RGB565` or
+     *                    `ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP`
+     * @param to_format   Format sent to the LCD. Set it the same as `from_format` to disable the conversion
+     *
+     * @return true if success, otherwise false
+     */
+    bool setSoftwarePixelFormat(esp_panel_pixel_format_t from_format, esp_panel_pixel_format_t to_format);
+
+    /**
+     * @brief Only send the changed tiles of the bitmaps, default is disabled (0)
+     *
+     * @note  This function should be called after `init()`, and only works with the SPI/QSPI/I80 interfaces
+     * @note  Every tile keeps the hash of the last sent pixels, so the bus time scales with the changed pixels rather
+     *        than the redrawn area (like a label redrawn with the same text). See `utils/esp_panel_pixel_diff.h`
+     * @note  The changed rectangles which are narrower than the bitmap are packed into an internal buffer before
+     *        sending. The finish callback is still called once for every bitmap, and it is called immediately if
+     *        nothing changes
+     * @note  Call `resetTileDiff()` after drawing the LCD without this class (like calling `esp_lcd_panel_draw_bitmap()`
+     *        directly)
+     *
+     * @param tile_size  Width and height of a tile, the range is [4, 128]. 0 means disable
+     * @param lcd_width  Width of the LCD without rotation
+     * @param lcd_height Height of the LCD without rotation
+     *
+     * @return true if success, otherwise false
+     */
+    bool setTileDiff(uint8_t tile_size, uint16_t lcd_width, uint16_t lcd_height);
+
+    /**
+     * @brief Forget the hashes of all the tiles, so the next bitmaps are sent completely
+     *
+     * @note  This function should be called after `setTileDiff()`
+     *
+     * @return true if success, otherwise false
+     */
+    bool resetTileDiff(void);
+
+    /**
+     * @brief Get the hit/miss counters of the tile diff
+     *
+     * @note  This function should be called after `setTileDiff()`
+     *
+     * @param stats Counters of the tile diff
+     * @param clear Whether to clear the counters after reading
+     *
+     * @return true if success, otherwise false
+     */
+    bool getTileDiffStats(esp_panel_pixel_diff_stats_t &stats, bool clear = false);
+
+    /**
+     * @brief Synchronize the drawings with the tearing effect (TE) signal of the LCD, default is disabled (-1)
+     *
+     * @note  This function should be called after `begin()`, and only works with the SPI/QSPI/I80 interfaces. The TE
+     *        output of the LCD should be enabled by the initialization commands (like `0x35`)
+     * @note  The TE period and the bus speed are measured at runtime. Every drawing waits until its rows can be written
+     *        without being crossed by the scan line: a fast bus writes just after the scan line, and a slow bus is split
+     *        into chunks written behind it. See `utils/esp_panel_te_sync.h`
+     * @note  The drawings become synchronous, since a transfer can only be scheduled when the bus is idle
+     * @note  The rows are assumed to be scanned from top to bottom, so the drawings are not synchronized if the axes are
+     *        swapped or the Y axis is mirrored
+     *
+     * @param te_io        TE pin, -1 means disable
+     * @param lcd_height   Height of the LCD (the number of the scanned rows)
+     * @param vblank_lines Number of the blanking lines between the TE edge and the scan of the first row
+     *
+     * @return true if success, otherwise false
+     */
+    bool setTearingEffectSync(int te_io, uint16_t lcd_height, uint16_t vblank_lines = 8);
+
+    /**
+     * @brief Get the counters of the TE synchronization, like the missed TE edges
+     *
+     * @note  This function should be called after `setTearingEffectSync()`
+     *
+     * @param stats Counters of the TE synchronization
+     * @param clear Whether to clear the counters after reading
+     *
+     * @return true if success, otherwise false
+     */
+    bool getTearingEffectStats(esp_panel_te_sync_stats_t &stats, bool clear = false);
+
+    /**
+     * @brief Send the bitmaps in PSRAM through two internal bounce buffers, default is disabled (0)
+     *
+     * @note  This function should be called after `begin()`, and only works with the SPI/QSPI/I80 interfaces
+     * @note  The bitmap in PSRAM is copied band by band into the bounce buffers in turn, and the next band is copied
+     *        while the previous one is being sent. So the DMA never reads PSRAM and the driver doesn't copy the whole
+     *        bitmap. The bitmaps in the internal SRAM are sent directly
+     * @note  The drawing returns once the last band is queued, so the bitmap can be reused earlier, but the finish
+     *        callback is still called when the last band is sent
+     * @note  The size is aligned down to the cache line and limited by the maximum transfer size of the host. Use
+     *        `getBounceStats()` to compare the copy time with the wait time to size the buffers
+     *
+     * @param buf_size Size of every bounce buffer in bytes, 0 means disable
+     *
+     * @return true if success, otherwise false
+     */
+    bool setBounceBuffer(size_t buf_size);
+
+    /**
+     * @brief Get the timing of the bounce drawings, like the copy time and the time waiting for the bus
+     *
+     * @note  This function should be called after `setBounceBuffer()`
+     *
+     * @param stats Timing of the bounce drawings
+     * @param clear Whether to clear the counters after reading
+     *
+     * @return true if success, otherwise false
+     */
+    bool getBounceStats(esp_panel_draw_bounce_stats_t &stats, bool clear = false);
+
+    /**
+     * @brief Get the counters of the address window commands (CASET/RASET). The unchanged ones are skipped by the
+     *        drivers, such as the bands of a split drawing which share the same columns
+     *
+     * @note  This function should be called after `init()`, and it is only valid for the SPI and QSPI LCDs
+     *
+     * @param stats Counters of the address window commands
+     * @param clear Whether to clear the counters after reading
+     *
+     * @return true if success, otherwise false
+     */
+    bool getWindowCacheStats(esp_panel_window_cache_stats_t &stats, bool clear = false);
+
+    /**
+     * @brief Invalidate the cached address window, so the next drawing always sends the window commands
+     *
+     * @note  This function should be called after the window of the LCD is changed through the bus directly, such as
+     *        writing CASET/RASET by `ESP_PanelBus::writeRegisterData()` or the color stream of the bus
+     *
+     * @return true if success, otherwise false
+     */
+    bool invalidateWindowCache(void);
+
     /**
      * @brief Mirror the X axis
      *
@@ -328,6 +586,53 @@ public:
      */
     bool displayOff(void);
 
+    /**
+     * @brief Define the hardware vertical scroll area by the MIPI-DCS command VSCRDEF (0x33), and reset the scrolling
+     *
+     * @note  This function should be called after `begin()`, and only works with the drivers which support it (like
+     *        ILI9341, ST7789 and ST7796) on the SPI interface
+     * @note  The lines are counted in the frame memory from the top, and the Y gap is added before the top fixed area.
+     *        Their sum should be equal to the number of the lines of the frame memory, which may be larger than the LCD
+     *        height (like 320 for ST7789)
+     * @note  The scrolling follows the frame memory, so it doesn't work if the axes are swapped, the Y axis is mirrored
+     *        or the software rotation is enabled
+     *
+     * @param top_fixed_lines    Number of the lines of the top fixed area
+     * @param scroll_lines       Number of the lines of the scroll area
+     * @param bottom_fixed_lines Number of the lines of the bottom fixed area
+     *
+     * @return true if success, otherwise false
+     */
+    bool configScrollArea(uint16_t top_fixed_lines, uint16_t scroll_lines, uint16_t bottom_fixed_lines);
+
+    /**
+     * @brief Show the line of the scroll area at its first line by the MIPI-DCS command VSCRSADD (0x37)
+     *
+     * @note  This function should be called after `configScrollArea()`
+     *
+     * @param line Line of the scroll area, it wraps around the number of the lines of the area
+     *
+     * @return true if success, otherwise false
+     */
+    bool scrollTo(uint16_t line);
+
+    /**
+     * @brief Scroll the content of the scroll area by the lines, and only draw the exposed lines
+     *
+     * @note  This function should be called after `configScrollArea()`
+     * @note  Only the start address and the exposed lines are sent, instead of the whole scroll area. The exposed lines
+     *        are drawn by `drawBitmap()`, so the color data should not be modified until the drawing is finished
+     *
+     * @param lines      Number of the lines to scroll. A positive one moves the content up and `color_data` holds the
+     *                   new lines shown at the bottom. A negative one moves the content down and `color_data` holds the
+     *                   new lines shown at the top. The range is [-scroll_lines, scroll_lines]
+     * @param width      Width of the lines, the lines are drawn from X coordinate 0
+     * @param color_data Pointer of the color data of the exposed lines, from top to bottom
+     *
+     * @return true if success, otherwise false
+     */
+    bool scrollLines(int lines, uint16_t width, const uint8_t *color_data);
+
     /**
      * @brief Attach a callback function, which will be called when the refreshing is finished
      *
@@ -380,6 +685,16 @@ public:
      */
     int getColorBits(void);
 
+    /**
+     * @brief Get the degree of the software rotation
+     *
+     * @return The degree of the software rotation, 0 means disabled
+     */
+    uint16_t getSoftwareRotation(void)
+    {
+        return _sw_rotation.degree;
+    }
+
     /**
      * @brief Get the flag of the X and Y axis swap
      *
@@ -502,6 +817,9 @@ protected:
         uint8_t set_gap: 1;
         uint8_t display_on_off: 1;
     } disabled_functions;
+    struct {
+        uint8_t vertical_scroll: 1;
+    } supported_functions;
     uint8_t x_coord_align;
     uint8_t y_coord_align;
     ESP_PanelBus *bus;
@@ -512,6 +830,32 @@ protected:
 private:
     IRAM_ATTR static bool onDrawBitmapFinish(void *panel_io, void *edata, void *user_ctx);
     IRAM_ATTR static bool onRefreshFinish(void *panel_io, void *edata, void *user_ctx);
+    IRAM_ATTR static void onTearingEffect(void *arg);
+    static bool drawFillBand(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                             const void *data);
+    static bool drawDiffRect(void *user_ctx, const esp_panel_pixel_rect_t *rect, bool is_last);
+    static bool drawSplitBand(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                              const void *data, bool is_last);
+    static bool drawBounceBand(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                               const void *data, bool is_last, uint32_t *token);
+    static bool waitBounceBand(void *user_ctx, uint32_t token);
+    static bool sendScrollParam(void *user_ctx, int cmd, const void *param, size_t size);
+    static bool drawScrollLines(void *user_ctx, uint16_t y_start, uint16_t y_end, const void *data);
+    bool checkScrollEnabled(void);
+    bool submitDrawBitmap(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data,
+                          bool is_last);
+    bool submitDrawBitmapByTe(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data,
+                              bool is_last);
+    bool queueDrawBitmap(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data,
+                         bool is_last);
+    bool queueDrawBand(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data,
+                       bool is_last);
+    int getBytesPerPixelToSend(void);
+    bool drawBitmapToPanel(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, const uint8_t *data);
+    bool drawBitmapBySoftware(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height,
+                              const uint8_t *color_data, int timeout_ms);
+    bool rotateAreaBySoftware(uint16_t &x_start, uint16_t &y_start, uint16_t &x_end, uint16_t &y_end);
+    bool waitDrawBitmapFinish(uint32_t draw_count, int timeout_ms);
 
     struct {
         uint8_t is_begun: 1;
@@ -525,6 +869,56 @@ private:
     std::function<bool (void *)> onDrawBitmapFinishCallback;
     std::function<bool (void *)> onRefreshFinishCallback;
     SemaphoreHandle_t _draw_bitmap_finish_sem;
+    // The transactions in flight are limited by the queue depth of the bus, which is far fewer than the queue depth
+    esp_panel_draw_queue_t _draw_queue;
+    // The drawings larger than it are split into bands, `0` means no limit
+    size_t _max_transfer_size;
+    struct {
+        uint16_t degree;
+        uint16_t lcd_width;
+        uint16_t lcd_height;
+        bool convert_format;
+        esp_panel_pixel_format_t from_format;
+        esp_panel_pixel_format_t to_format;
+        uint8_t *buf;
+        size_t buf_size;
+    } _sw_rotation;
+    struct {
+        uint8_t *buf;
+        size_t buf_size;
+        uint8_t pixel[4];
+        uint8_t bytes_per_pixel;
+        uint16_t y_end;
+        uint32_t draw_count;
+    } _fill;
+    struct {
+        uint8_t tile_size;
+        uint16_t lcd_width;
+        uint16_t lcd_height;
+        uint8_t bytes_per_pixel;
+        esp_panel_pixel_diff_handle_t handle;
+        uint8_t *buf;
+        size_t buf_size;
+        size_t buf_offset;
+        uint32_t draw_count;
+        int rect_num;
+        uint16_t x_start;
+        uint16_t y_start;
+        uint16_t width;
+        const uint8_t *data;
+    } _tile_diff;
+    struct {
+        int io;
+        esp_panel_te_sync_handle_t handle;
+        SemaphoreHandle_t sem;
+    } _te;
+    struct {
+        esp_panel_draw_bounce_handle_t handle;
+        uint8_t *bufs[ESP_PANEL_DRAW_BOUNCE_BUF_NUM];
+    } _bounce;
+    esp_panel_scroll_t _scroll;
+    // Shared with the driver through the vendor configuration
+    esp_panel_window_cache_t _window_cache;
 
     typedef struct {
         void *lcd_ptr;
@@ -0,0 +1,191 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ESP_PanelLog.h"
+#include "bus/ESP_PanelBus.h"
+#include "ESP_PanelSwapChain.h"
+
+static const char *TAG = "ESP_PanelSwapChain";
+
+ESP_PanelSwapChain::ESP_PanelSwapChain(ESP_PanelLcd *lcd, uint8_t num_bufs, uint16_t lcd_width, uint16_t lcd_height):
+    _lcd(lcd),
+    _num_bufs(num_bufs),
+    _lcd_width(lcd_width),
+    _lcd_height(lcd_height),
+    _bufs{},
+    _chain(NULL),
+    _free_sem(NULL)
+{
+}
+
+ESP_PanelSwapChain::~ESP_PanelSwapChain()
+{
+    ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
+
+    if ((_chain != NULL) && !del()) {
+        ESP_LOGE(TAG, "Delete swap chain failed");
+    }
+
+    ESP_LOGD(TAG, "Destroyed");
+}
+
+bool ESP_PanelSwapChain::begin(void)
+{
+    ESP_PANEL_CHECK_NULL_RET(_lcd, false, "Invalid LCD");
+    ESP_PANEL_CHECK_FALSE_RET(_chain == NULL, false, "Already begun");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (_num_bufs >= ESP_PANEL_SWAP_CHAIN_BUF_NUM_MIN) && (_num_bufs <= ESP_PANEL_SWAP_CHAIN_BUF_NUM_MAX), false,
+        "Invalid buffer number(%d)", _num_bufs
+    );
+    ESP_PANEL_CHECK_NULL_RET(_lcd->getBus(), false, "Invalid bus");
+    ESP_PANEL_CHECK_FALSE_RET(
+        (_lcd->getBus()->getType() == ESP_PANEL_BUS_TYPE_RGB) ||
+        (_lcd->getBus()->getType() == ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "Only RGB and MIPI-DSI interfaces are supported"
+    );
+
+    ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
+    ESP_LOGD(TAG, "Begin start");
+
+    for (int i = 0; i < _num_bufs; i++) {
+        _bufs[i] = _lcd->getFrameBufferByIndex(i);
+        ESP_PANEL_CHECK_NULL_RET(_bufs[i], false, "Get frame buffer(%d) failed, not enough frame buffers?", i);
+    }
+
+    esp_panel_swap_chain_config_t chain_config = {
+        .num_bufs = _num_bufs,
+        .front_index = 0,
+    };
+    _chain = esp_panel_swap_chain_new(&chain_config);
+    ESP_PANEL_CHECK_NULL_RET(_chain, false, "Create swap chain failed");
+
+    _free_sem = xSemaphoreCreateBinary();
+    if ((_free_sem == NULL) || !_lcd->attachRefreshFinishCallback(onRefreshFinish, this)) {
+        ESP_LOGE(TAG, "Create semaphore or attach refresh finish callback failed");
+        if (_free_sem != NULL) {
+            vSemaphoreDelete(_free_sem);
+            _free_sem = NULL;
+        }
+        esp_panel_swap_chain_del(_chain);
+        _chain = NULL;
+
+        return false;
+    }
+
+    ESP_LOGD(TAG, "Begin end");
+
+    return true;
+}
+
+bool ESP_PanelSwapChain::del(void)
+{
+    ESP_PANEL_CHECK_NULL_RET(_chain, false, "Not begun");
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        _lcd->attachRefreshFinishCallback(NULL, NULL), false, "Detach refresh finish callback failed"
+    );
+    esp_panel_swap_chain_del(_chain);
+    _chain = NULL;
+    vSemaphoreDelete(_free_sem);
+    _free_sem = NULL;
+
+    ESP_LOGD(TAG, "Delete swap chain");
+
+    return true;
+}
+
+void *ESP_PanelSwapChain::acquire(int timeout_ms)
+{
+    ESP_PANEL_CHECK_NULL_RET(_chain, NULL, "Not begun");
+
+    TickType_t start_tick = xTaskGetTickCount();
+    TickType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    uint8_t index = 0;
+    /* The semaphore is given by every released buffer, so a release between the two calls is not missed */
+    while (!esp_panel_swap_chain_acquire(_chain, &index)) {
+        TickType_t wait_ticks = portMAX_DELAY;
+        if (timeout_ms >= 0) {
+            TickType_t elapsed_ticks = xTaskGetTickCount() - start_tick;
+            ESP_PANEL_CHECK_FALSE_RET(
+                elapsed_ticks < timeout_ticks, NULL, "Acquire buffer timeout(%d ms), or already acquired?", timeout_ms
+            );
+            wait_ticks = timeout_ticks - elapsed_ticks;
+        }
+        xSemaphoreTake(_free_sem, wait_ticks);
+    }
+
+    return _bufs[index];
+}
+
+bool ESP_PanelSwapChain::present(void *buf)
+{
+    ESP_PANEL_CHECK_NULL_RET(_chain, false, "Not begun");
+
+    int index = getBufferIndex(buf);
+    ESP_PANEL_CHECK_FALSE_RET(index >= 0, false, "Invalid buffer(%p)", buf);
+
+    /**
+     * Switch the LCD frame buffer before publishing it, so the buffer latched by a vsync in between is still treated as
+     * pending and the one actually scanned out is never released
+     */
+    ESP_PANEL_CHECK_FALSE_RET(
+        _lcd->drawBitmap(0, 0, _lcd_width, _lcd_height, (const uint8_t *)buf), false, "Switch frame buffer failed"
+    );
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_swap_chain_present(_chain, index), false, "Buffer(%d) is not acquired", index);
+
+    return true;
+}
+
+bool ESP_PanelSwapChain::release(void *buf)
+{
+    ESP_PANEL_CHECK_NULL_RET(_chain, false, "Not begun");
+
+    int index = getBufferIndex(buf);
+    ESP_PANEL_CHECK_FALSE_RET(index >= 0, false, "Invalid buffer(%p)", buf);
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_swap_chain_release(_chain, index), false, "Buffer(%d) is not acquired", index);
+
+    return true;
+}
+
+void *ESP_PanelSwapChain::getFrontBuffer(void)
+{
+    ESP_PANEL_CHECK_NULL_RET(_chain, NULL, "Not begun");
+
+    return _bufs[esp_panel_swap_chain_get_front(_chain)];
+}
+
+bool ESP_PanelSwapChain::getStats(esp_panel_swap_chain_stats_t &stats)
+{
+    ESP_PANEL_CHECK_NULL_RET(_chain, false, "Not begun");
+
+    return esp_panel_swap_chain_get_stats(_chain, &stats);
+}
+
+IRAM_ATTR bool ESP_PanelSwapChain::onRefreshFinish(void *user_data)
+{
+    ESP_PanelSwapChain *chain_ptr = (ESP_PanelSwapChain *)user_data;
+    if ((chain_ptr == NULL) || (chain_ptr->_chain == NULL)) {
+        return false;
+    }
+
+    BaseType_t need_yield = pdFALSE;
+    if (esp_panel_swap_chain_on_vsync(chain_ptr->_chain)) {
+        xSemaphoreGiveFromISR(chain_ptr->_free_sem, &need_yield);
+    }
+
+    return (need_yield == pdTRUE);
+}
+
+int ESP_PanelSwapChain::getBufferIndex(void *buf)
+{
+    for (int i = 0; i < _num_bufs; i++) {
+        if ((buf != NULL) && (_bufs[i] == buf)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
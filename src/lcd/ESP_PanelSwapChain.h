@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "utils/esp_panel_swap_chain.h"
+#include "ESP_PanelLcd.h"
+
+/**
+ * @brief The swap chain class, which presents the frame buffers of an RGB or MIPI-DSI LCD without tearing
+ *
+ * @note  The renderer gets a buffer by `acquire()`, draws the whole frame into it, and then shows it by `present()`.
+ *        A buffer is never returned by `acquire()` while it is scanned out or waiting to be scanned out
+ * @note  With 2 buffers, `acquire()` blocks until the presented buffer is shown by the next vsync. With 3 buffers,
+ *        `acquire()` never blocks, the newest presented buffer is shown by the next vsync and the older one is reused
+ * @note  The refresh finish callback of the LCD is used by this class, so don't attach another one by
+ *        `ESP_PanelLcd::attachRefreshFinishCallback()`. The software rotation of the LCD should not be enabled either
+ */
+class ESP_PanelSwapChain {
+public:
+    /**
+     * @brief Construct a new swap chain, the `begin()` function should be called after this function
+     *
+     * @param lcd        Pointer of the LCD device, whose frame buffer number should be no less than `num_bufs`
+     * @param num_bufs   Number of the buffers, `2` or `3`
+     * @param lcd_width  Width of the LCD
+     * @param lcd_height Height of the LCD
+     */
+    ESP_PanelSwapChain(ESP_PanelLcd *lcd, uint8_t num_bufs, uint16_t lcd_width, uint16_t lcd_height);
+
+    /**
+     * @brief Destroy the swap chain
+     *
+     */
+    ~ESP_PanelSwapChain();
+
+    /**
+     * @brief Startup the swap chain, the frame buffer 0 is treated as the one being scanned out
+     *
+     * @note  This function should be called after `ESP_PanelLcd::begin()`
+     *
+     * @return true if success, otherwise false
+     */
+    bool begin(void);
+
+    /**
+     * @brief Delete the swap chain, release the resources
+     *
+     * @note  The buffer which is acquired should be presented or released before calling this function
+     *
+     * @return true if success, otherwise false
+     */
+    bool del(void);
+
+    /**
+     * @brief Acquire a buffer to render the next frame
+     *
+     * @note  Only one buffer can be acquired at a time
+     *
+     * @param timeout_ms The timeout to wait for a free buffer in milliseconds, `-1` means waiting forever
+     *
+     * @return The pointer of the buffer, or NULL if fail
+     */
+    void *acquire(int timeout_ms = -1);
+
+    /**
+     * @brief Present the acquired buffer, it will be scanned out from the next vsync. It doesn't block
+     *
+     * @param buf Pointer of the buffer returned by `acquire()`
+     *
+     * @return true if success, otherwise false
+     */
+    bool present(void *buf);
+
+    /**
+     * @brief Return the acquired buffer without presenting it, for example when nothing is changed
+     *
+     * @param buf Pointer of the buffer returned by `acquire()`
+     *
+     * @return true if success, otherwise false
+     */
+    bool release(void *buf);
+
+    /**
+     * @brief Get the buffer which is scanned out
+     *
+     * @return The pointer of the buffer, or NULL if fail
+     */
+    void *getFrontBuffer(void);
+
+    /**
+     * @brief Get the counters of the swap chain
+     *
+     * @param stats The counters
+     *
+     * @return true if success, otherwise false
+     */
+    bool getStats(esp_panel_swap_chain_stats_t &stats);
+
+private:
+    IRAM_ATTR static bool onRefreshFinish(void *user_data);
+    int getBufferIndex(void *buf);
+
+    ESP_PanelLcd *_lcd;
+    uint8_t _num_bufs;
+    uint16_t _lcd_width;
+    uint16_t _lcd_height;
+    void *_bufs[ESP_PANEL_SWAP_CHAIN_BUF_NUM_MAX];
+    esp_panel_swap_chain_handle_t _chain;
+    SemaphoreHandle_t _free_sem;
+};
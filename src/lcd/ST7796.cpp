@@ -12,11 +12,13 @@ static const char *TAG = "ST7796_CPP";
 ESP_PanelLcd_ST7796::ESP_PanelLcd_ST7796(ESP_PanelBus *bus, uint8_t color_bits, int rst_io):
     ESP_PanelLcd(bus, color_bits, rst_io)
 {
+    supported_functions.vertical_scroll = 1;
 }
 
 ESP_PanelLcd_ST7796::ESP_PanelLcd_ST7796(ESP_PanelBus *bus, const esp_lcd_panel_dev_config_t &panel_config):
     ESP_PanelLcd(bus, panel_config)
 {
+    supported_functions.vertical_scroll = 1;
 }
 
 ESP_PanelLcd_ST7796::~ESP_PanelLcd_ST7796()
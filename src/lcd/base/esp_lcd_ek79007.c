@@ -116,23 +116,23 @@ err:
     return ret;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0x80, (uint8_t []){0x8B}, 1, 0},
-    {0x81, (uint8_t []){0x78}, 1, 0},
-    {0x82, (uint8_t []){0x84}, 1, 0},
-    {0x83, (uint8_t []){0x88}, 1, 0},
-    {0x84, (uint8_t []){0xA8}, 1, 0},
-    {0x85, (uint8_t []){0xE3}, 1, 0},
-    {0x86, (uint8_t []){0x88}, 1, 0},
-    {0x11, (uint8_t []){0x00}, 0, 120},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x8B),
+    ESP_PANEL_INIT_SEQ_CMD(0x81, 0x78),
+    ESP_PANEL_INIT_SEQ_CMD(0x82, 0x84),
+    ESP_PANEL_INIT_SEQ_CMD(0x83, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0x84, 0xA8),
+    ESP_PANEL_INIT_SEQ_CMD(0x85, 0xE3),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(120),
 };
 
 static esp_err_t panel_ek79007_send_init_cmds(ek79007_panel_t *ek79007)
 {
     esp_lcd_panel_io_handle_t io = ek79007->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     uint8_t lane_command = EK79007_DSI_2_LANE;
     bool is_cmd_overwritten = false;
 
@@ -155,20 +155,19 @@ static esp_err_t panel_ek79007_send_init_cmds(ek79007_panel_t *ek79007)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (ek79007->init_cmds) {
-        init_cmds = ek79007->init_cmds;
-        init_cmds_size = ek79007->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, ek79007->init_cmds, ek79007->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        if (init_cmds[i].data_bytes > 0) {
-            switch (init_cmds[i].cmd) {
+        if (init_cmd.data_bytes > 0) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                ek79007->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                ek79007->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -178,15 +177,19 @@ static esp_err_t panel_ek79007_send_init_cmds(ek79007_panel_t *ek79007)
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
                 ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
-                         init_cmds[i].cmd);
+                         init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
 
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
+
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -176,70 +176,74 @@ err:
 }
 
 // *INDENT-OFF*
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0xf0, (uint8_t []){0x55, 0xaa, 0x52, 0x08, 0x00}, 5, 0},
-    {0xf6, (uint8_t []){0x5a, 0x87}, 2, 0},
-    {0xc1, (uint8_t []){0x3f}, 1, 0},
-    {0xc2, (uint8_t []){0x0e}, 1, 0},
-    {0xc6, (uint8_t []){0xf8}, 1, 0},
-    {0xc9, (uint8_t []){0x10}, 1, 0},
-    {0xcd, (uint8_t []){0x25}, 1, 0},
-    {0xf8, (uint8_t []){0x8a}, 1, 0},
-    {0xac, (uint8_t []){0x45}, 1, 0},
-    {0xa0, (uint8_t []){0xdd}, 1, 0},
-    {0xa7, (uint8_t []){0x47}, 1, 0},
-    {0xfa, (uint8_t []){0x00, 0x00, 0x00, 0x04}, 4, 0},
-    {0x86, (uint8_t []){0x99, 0xa3, 0xa3, 0x51}, 4, 0},
-    {0xa3, (uint8_t []){0xee}, 1, 0},
-    {0xfd, (uint8_t []){0x3c, 0x3c, 0x00}, 3, 0},
-    {0x71, (uint8_t []){0x48}, 1, 0},
-    {0x72, (uint8_t []){0x48}, 1, 0},
-    {0x73, (uint8_t []){0x00, 0x44}, 2, 0},
-    {0x97, (uint8_t []){0xee}, 1, 0},
-    {0x83, (uint8_t []){0x93}, 1, 0},
-    {0x9a, (uint8_t []){0x72}, 1, 0},
-    {0x9b, (uint8_t []){0x5a}, 1, 0},
-    {0x82, (uint8_t []){0x2c, 0x2c}, 2, 0},
-    {0x6d, (uint8_t []){0x00, 0x1f, 0x19, 0x1a, 0x10, 0x0e, 0x0c, 0x0a, 0x02, 0x07, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e,
-                        0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x08, 0x01, 0x09, 0x0b, 0x0d, 0x0f, 0x1a, 0x19, 0x1f, 0x00}, 32, 0},
-    {0x64, (uint8_t []){0x38, 0x05, 0x01, 0xdb, 0x03, 0x03, 0x38, 0x04, 0x01, 0xdc, 0x03, 0x03, 0x7a, 0x7a, 0x7a, 0x7a}, 16, 0},
-    {0x65, (uint8_t []){0x38, 0x03, 0x01, 0xdd, 0x03, 0x03, 0x38, 0x02, 0x01, 0xde, 0x03, 0x03, 0x7a, 0x7a, 0x7a, 0x7a}, 16, 0},
-    {0x66, (uint8_t []){0x38, 0x01, 0x01, 0xdf, 0x03, 0x03, 0x38, 0x00, 0x01, 0xe0, 0x03, 0x03, 0x7a, 0x7a, 0x7a, 0x7a}, 16, 0},
-    {0x67, (uint8_t []){0x30, 0x01, 0x01, 0xe1, 0x03, 0x03, 0x30, 0x02, 0x01, 0xe2, 0x03, 0x03, 0x7a, 0x7a, 0x7a, 0x7a}, 16, 0},
-    {0x68, (uint8_t []){0x00, 0x08, 0x15, 0x08, 0x15, 0x7a, 0x7a, 0x08, 0x15, 0x08, 0x15, 0x7a, 0x7a}, 13, 0},
-    {0x60, (uint8_t []){0x38, 0x08, 0x7a, 0x7a, 0x38, 0x09, 0x7a, 0x7a}, 8, 0},
-    {0x63, (uint8_t []){0x31, 0xe4, 0x7a, 0x7a, 0x31, 0xe5, 0x7a, 0x7a}, 8, 0},
-    {0x69, (uint8_t []){0x04, 0x22, 0x14, 0x22, 0x14, 0x22, 0x08}, 7, 0},
-    {0x6b, (uint8_t []){0x07}, 1, 0},
-    {0x7a, (uint8_t []){0x08, 0x13}, 2, 0},
-    {0x7b, (uint8_t []){0x08, 0x13}, 2, 0},
-    {0xd1, (uint8_t []){0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x47, 0x00,
-            0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6, 0x02, 0xee,
-            0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa, 0x03,
-            0xff}, 52, 0},
-    {0xd2, (uint8_t []){0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x47, 0x00,
-            0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6, 0x02, 0xee,
-            0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa, 0x03,
-            0xff}, 52, 0},
-    {0xd3, (uint8_t []){0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x47, 0x00,
-            0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6, 0x02, 0xee,
-            0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa, 0x03,
-            0xff}, 52, 0},
-    {0xd4, (uint8_t []){0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x47, 0x00,
-            0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6, 0x02, 0xee,
-            0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa, 0x03,
-            0xff}, 52, 0},
-    {0xd5, (uint8_t []){0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x47, 0x00,
-            0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6, 0x02, 0xee,
-            0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa, 0x03,
-            0xff}, 52, 0},
-    {0xd6, (uint8_t []){0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x47, 0x00,
-            0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6, 0x02, 0xee,
-            0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa, 0x03,
-            0xff}, 52, 0},
-    {0x11, (uint8_t []){0x00}, 0, 120},
-    {0x29, (uint8_t []){0x00}, 0, 20},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0xf0, 0x55, 0xaa, 0x52, 0x08, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xf6, 0x5a, 0x87),
+    ESP_PANEL_INIT_SEQ_CMD(0xc1, 0x3f),
+    ESP_PANEL_INIT_SEQ_CMD(0xc2, 0x0e),
+    ESP_PANEL_INIT_SEQ_CMD(0xc6, 0xf8),
+    ESP_PANEL_INIT_SEQ_CMD(0xc9, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xcd, 0x25),
+    ESP_PANEL_INIT_SEQ_CMD(0xf8, 0x8a),
+    ESP_PANEL_INIT_SEQ_CMD(0xac, 0x45),
+    ESP_PANEL_INIT_SEQ_CMD(0xa0, 0xdd),
+    ESP_PANEL_INIT_SEQ_CMD(0xa7, 0x47),
+    ESP_PANEL_INIT_SEQ_CMD(0xfa, 0x00, 0x00, 0x00, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0x99, 0xa3, 0xa3, 0x51),
+    ESP_PANEL_INIT_SEQ_CMD(0xa3, 0xee),
+    ESP_PANEL_INIT_SEQ_CMD(0xfd, 0x3c, 0x3c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x71, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0x72, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x00, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x97, 0xee),
+    ESP_PANEL_INIT_SEQ_CMD(0x83, 0x93),
+    ESP_PANEL_INIT_SEQ_CMD(0x9a, 0x72),
+    ESP_PANEL_INIT_SEQ_CMD(0x9b, 0x5a),
+    ESP_PANEL_INIT_SEQ_CMD(0x82, 0x2c, 0x2c),
+    ESP_PANEL_INIT_SEQ_CMD(0x6d, 0x00, 0x1f, 0x19, 0x1a, 0x10, 0x0e, 0x0c, 0x0a, 0x02, 0x07, 0x1e, 0x1e, 0x1e, 0x1e,
+            0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x08, 0x01, 0x09, 0x0b, 0x0d, 0x0f, 0x1a, 0x19, 0x1f, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x38, 0x05, 0x01, 0xdb, 0x03, 0x03, 0x38, 0x04, 0x01, 0xdc, 0x03, 0x03, 0x7a, 0x7a,
+            0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x38, 0x03, 0x01, 0xdd, 0x03, 0x03, 0x38, 0x02, 0x01, 0xde, 0x03, 0x03, 0x7a, 0x7a,
+            0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x38, 0x01, 0x01, 0xdf, 0x03, 0x03, 0x38, 0x00, 0x01, 0xe0, 0x03, 0x03, 0x7a, 0x7a,
+            0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x30, 0x01, 0x01, 0xe1, 0x03, 0x03, 0x30, 0x02, 0x01, 0xe2, 0x03, 0x03, 0x7a, 0x7a,
+            0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x00, 0x08, 0x15, 0x08, 0x15, 0x7a, 0x7a, 0x08, 0x15, 0x08, 0x15, 0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x38, 0x08, 0x7a, 0x7a, 0x38, 0x09, 0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x31, 0xe4, 0x7a, 0x7a, 0x31, 0xe5, 0x7a, 0x7a),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x04, 0x22, 0x14, 0x22, 0x14, 0x22, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x6b, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x7a, 0x08, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0x7b, 0x08, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0xd1, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35,
+            0x00, 0x47, 0x00, 0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6,
+            0x02, 0xee, 0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa,
+            0x03, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0xd2, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35,
+            0x00, 0x47, 0x00, 0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6,
+            0x02, 0xee, 0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa,
+            0x03, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0xd3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35,
+            0x00, 0x47, 0x00, 0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6,
+            0x02, 0xee, 0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa,
+            0x03, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0xd4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35,
+            0x00, 0x47, 0x00, 0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6,
+            0x02, 0xee, 0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa,
+            0x03, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0xd5, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35,
+            0x00, 0x47, 0x00, 0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6,
+            0x02, 0xee, 0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa,
+            0x03, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0xd6, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x18, 0x00, 0x21, 0x00, 0x2a, 0x00, 0x35,
+            0x00, 0x47, 0x00, 0x56, 0x00, 0x90, 0x00, 0xe5, 0x01, 0x68, 0x01, 0xd5, 0x01, 0xd7, 0x02, 0x36, 0x02, 0xa6,
+            0x02, 0xee, 0x03, 0x48, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc5, 0x03, 0xd0, 0x03, 0xe0, 0x03, 0xea, 0x03, 0xfa,
+            0x03, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(120),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x29), ESP_PANEL_INIT_SEQ_DELAY(20),
 };
 // *INDENT-OFF*
 
@@ -256,27 +260,26 @@ static esp_err_t panel_gc9503_send_init_cmds(gc9503_panel_t *gc9503)
 
     // Vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     if (gc9503->init_cmds) {
-        init_cmds = gc9503->init_cmds;
-        init_cmds_size = gc9503->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, gc9503->init_cmds, gc9503->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
     bool is_cmd_overwritten = false;
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            gc9503->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            gc9503->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            gc9503->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            gc9503->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -285,13 +288,16 @@ static esp_err_t panel_gc9503_send_init_cmds(gc9503_panel_t *gc9503)
 
         if (is_cmd_overwritten) {
             ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
-                     init_cmds[i].cmd);
+                     init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes),
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes),
                             TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
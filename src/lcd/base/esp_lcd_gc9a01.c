@@ -46,6 +46,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
 } gc9a01_panel_t;
 
 esp_err_t esp_lcd_new_panel_gc9a01(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
@@ -113,6 +114,7 @@ esp_err_t esp_lcd_new_panel_gc9a01(const esp_lcd_panel_io_handle_t io, const esp
     if (panel_dev_config->vendor_config) {
         gc9a01->init_cmds = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         gc9a01->init_cmds_size = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        gc9a01->window_cache = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->window_cache;
     }
     gc9a01->base.del = panel_gc9a01_del;
     gc9a01->base.reset = panel_gc9a01_reset;
@@ -160,6 +162,7 @@ static esp_err_t panel_gc9a01_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_gc9a01_reset(esp_lcd_panel_t *panel)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
 
     // perform hardware reset
@@ -176,57 +179,58 @@ static esp_err_t panel_gc9a01_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
     // Enable Inter Register
-    {0xfe, (uint8_t []){0x00}, 0, 0},
-    {0xef, (uint8_t []){0x00}, 0, 0},
-    {0xeb, (uint8_t []){0x14}, 1, 0},
-    {0x84, (uint8_t []){0x60}, 1, 0},
-    {0x85, (uint8_t []){0xff}, 1, 0},
-    {0x86, (uint8_t []){0xff}, 1, 0},
-    {0x87, (uint8_t []){0xff}, 1, 0},
-    {0x8e, (uint8_t []){0xff}, 1, 0},
-    {0x8f, (uint8_t []){0xff}, 1, 0},
-    {0x88, (uint8_t []){0x0a}, 1, 0},
-    {0x89, (uint8_t []){0x23}, 1, 0},
-    {0x8a, (uint8_t []){0x00}, 1, 0},
-    {0x8b, (uint8_t []){0x80}, 1, 0},
-    {0x8c, (uint8_t []){0x01}, 1, 0},
-    {0x8d, (uint8_t []){0x03}, 1, 0},
-    {0x90, (uint8_t []){0x08, 0x08, 0x08, 0x08}, 4, 0},
-    {0xff, (uint8_t []){0x60, 0x01, 0x04}, 3, 0},
-    {0xC3, (uint8_t []){0x13}, 1, 0},
-    {0xC4, (uint8_t []){0x13}, 1, 0},
-    {0xC9, (uint8_t []){0x30}, 1, 0},
-    {0xbe, (uint8_t []){0x11}, 1, 0},
-    {0xe1, (uint8_t []){0x10, 0x0e}, 2, 0},
-    {0xdf, (uint8_t []){0x21, 0x0c, 0x02}, 3, 0},
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0xfe),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0xef),
+    ESP_PANEL_INIT_SEQ_CMD(0xeb, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0x84, 0x60),
+    ESP_PANEL_INIT_SEQ_CMD(0x85, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0x87, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0x8e, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0x8f, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0x88, 0x0a),
+    ESP_PANEL_INIT_SEQ_CMD(0x89, 0x23),
+    ESP_PANEL_INIT_SEQ_CMD(0x8a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x8b, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x8c, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x8d, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x90, 0x08, 0x08, 0x08, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x60, 0x01, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0xC3, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0xC4, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0xC9, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0xbe, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xe1, 0x10, 0x0e),
+    ESP_PANEL_INIT_SEQ_CMD(0xdf, 0x21, 0x0c, 0x02),
     // Set gamma
-    {0xF0, (uint8_t []){0x45, 0x09, 0x08, 0x08, 0x26, 0x2a}, 6, 0},
-    {0xF1, (uint8_t []){0x43, 0x70, 0x72, 0x36, 0x37, 0x6f}, 6, 0},
-    {0xF2, (uint8_t []){0x45, 0x09, 0x08, 0x08, 0x26, 0x2a}, 6, 0},
-    {0xF3, (uint8_t []){0x43, 0x70, 0x72, 0x36, 0x37, 0x6f}, 6, 0},
-    {0xed, (uint8_t []){0x1b, 0x0b}, 2, 0},
-    {0xae, (uint8_t []){0x77}, 1, 0},
-    {0xcd, (uint8_t []){0x63}, 1, 0},
-    {0x70, (uint8_t []){0x07, 0x07, 0x04, 0x0e, 0x0f, 0x09, 0x07, 0x08, 0x03}, 9, 0},
-    {0xE8, (uint8_t []){0x34}, 1, 0}, // 4 dot inversion
-    {0x60, (uint8_t []){0x38, 0x0b, 0x6D, 0x6D, 0x39, 0xf0, 0x6D, 0x6D}, 8, 0},
-    {0x61, (uint8_t []){0x38, 0xf4, 0x6D, 0x6D, 0x38, 0xf7, 0x6D, 0x6D}, 8, 0},
-    {0x62, (uint8_t []){0x38, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x38, 0x0F, 0x71, 0xEF, 0x70, 0x70}, 12, 0},
-    {0x63, (uint8_t []){0x38, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x38, 0x13, 0x71, 0xF3, 0x70, 0x70}, 12, 0},
-    {0x64, (uint8_t []){0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07}, 7, 0},
-    {0x66, (uint8_t []){0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00}, 10, 0},
-    {0x67, (uint8_t []){0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98}, 10, 0},
-    {0x74, (uint8_t []){0x10, 0x45, 0x80, 0x00, 0x00, 0x4E, 0x00}, 7, 0},
-    {0x98, (uint8_t []){0x3e, 0x07}, 2, 0},
-    {0x99, (uint8_t []){0x3e, 0x07}, 2, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2a),
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6f),
+    ESP_PANEL_INIT_SEQ_CMD(0xF2, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2a),
+    ESP_PANEL_INIT_SEQ_CMD(0xF3, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6f),
+    ESP_PANEL_INIT_SEQ_CMD(0xed, 0x1b, 0x0b),
+    ESP_PANEL_INIT_SEQ_CMD(0xae, 0x77),
+    ESP_PANEL_INIT_SEQ_CMD(0xcd, 0x63),
+    ESP_PANEL_INIT_SEQ_CMD(0x70, 0x07, 0x07, 0x04, 0x0e, 0x0f, 0x09, 0x07, 0x08, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0xE8, 0x34), // 4 dot inversion
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x38, 0x0b, 0x6D, 0x6D, 0x39, 0xf0, 0x6D, 0x6D),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x38, 0xf4, 0x6D, 0x6D, 0x38, 0xf7, 0x6D, 0x6D),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x38, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x38, 0x0F, 0x71, 0xEF, 0x70, 0x70),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x38, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x38, 0x13, 0x71, 0xF3, 0x70, 0x70),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0x74, 0x10, 0x45, 0x80, 0x00, 0x00, 0x4E, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x98, 0x3e, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x99, 0x3e, 0x07),
 };
 
 static esp_err_t panel_gc9a01_init(esp_lcd_panel_t *panel)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
@@ -239,27 +243,27 @@ static esp_err_t panel_gc9a01_init(esp_lcd_panel_t *panel)
         gc9a01->colmod_val,
     }, 1), TAG, "send command failed");
 
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     if (gc9a01->init_cmds) {
-        init_cmds = gc9a01->init_cmds;
-        init_cmds_size = gc9a01->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, gc9a01->init_cmds, gc9a01->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
     bool is_cmd_overwritten = false;
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            gc9a01->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            gc9a01->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            gc9a01->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            gc9a01->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -267,12 +271,15 @@ static esp_err_t panel_gc9a01_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -283,30 +290,39 @@ static esp_err_t panel_gc9a01_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = gc9a01->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += gc9a01->x_gap;
     x_end += gc9a01->x_gap;
     y_start += gc9a01->y_gap;
     y_end += gc9a01->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(gc9a01->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(gc9a01->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * gc9a01->fb_bits_per_pixel / 8;
     ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_gc9a01_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -326,6 +342,7 @@ static esp_err_t panel_gc9a01_invert_color(esp_lcd_panel_t *panel, bool invert_c
 static esp_err_t panel_gc9a01_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
     if (mirror_x) {
         gc9a01->madctl_val |= LCD_CMD_MX_BIT;
@@ -346,6 +363,7 @@ static esp_err_t panel_gc9a01_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_gc9a01_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
     if (swap_axes) {
         gc9a01->madctl_val |= LCD_CMD_MV_BIT;
@@ -361,6 +379,7 @@ static esp_err_t panel_gc9a01_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_gc9a01_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
     gc9a01->x_gap = x_gap;
     gc9a01->y_gap = y_gap;
     return ESP_OK;
@@ -369,6 +388,7 @@ static esp_err_t panel_gc9a01_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_g
 static esp_err_t panel_gc9a01_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     gc9a01_panel_t *gc9a01 = __containerof(panel, gc9a01_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9a01->window_cache);
     esp_lcd_panel_io_handle_t io = gc9a01->io;
     int command = 0;
 
@@ -49,6 +49,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -113,6 +114,7 @@ esp_err_t esp_lcd_new_panel_gc9b71(const esp_lcd_panel_io_handle_t io, const esp
     if (vendor_config) {
         gc9b71->init_cmds = vendor_config->init_cmds;
         gc9b71->init_cmds_size = vendor_config->init_cmds_size;
+        gc9b71->window_cache = vendor_config->window_cache;
         gc9b71->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     gc9b71->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -182,6 +184,7 @@ static esp_err_t panel_gc9b71_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_gc9b71_reset(esp_lcd_panel_t *panel)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
 
     // Perform hardware reset
@@ -198,71 +201,66 @@ static esp_err_t panel_gc9b71_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0xfe, (uint8_t []){0x00}, 0, 0},
-    {0xef, (uint8_t []){0x00}, 0, 0},
-    {0x80, (uint8_t []){0x11}, 1, 0},
-    {0x81, (uint8_t []){0x70}, 1, 0},
-    {0x82, (uint8_t []){0x09}, 1, 0},
-    {0x83, (uint8_t []){0x03}, 1, 0},
-    {0x84, (uint8_t []){0x62}, 1, 0},
-    {0x89, (uint8_t []){0x18}, 1, 0},
-    {0x8A, (uint8_t []){0x40}, 1, 0},
-    {0x8B, (uint8_t []){0x0A}, 1, 0},
-    {0xEC, (uint8_t []){0x07}, 1, 0},
-    {0x74, (uint8_t []){0x01, 0x80, 0x00, 0x00, 0x00, 0x00}, 6, 0},
-    {0x98, (uint8_t []){0x3E}, 1, 0},
-    {0x99, (uint8_t []){0x3E}, 1, 0},
-    {0xA1, (uint8_t []){0x01, 0x04}, 2, 0},
-    {0xA2, (uint8_t []){0x01, 0x04}, 2, 0},
-    {0xCB, (uint8_t []){0x02}, 1, 0},
-    {0x7C, (uint8_t []){0xB6, 0x24}, 2, 0},
-    {0xAC, (uint8_t []){0x74}, 1, 0},
-    {0xF6, (uint8_t []){0x80}, 1, 0},
-    {0xB5, (uint8_t []){0x09, 0x09}, 2, 0},
-    {0xEB, (uint8_t []){0x01, 0x81}, 2, 0},
-    {0x60, (uint8_t []){0x38, 0x06, 0x13, 0x56}, 4, 0},
-    {0x63, (uint8_t []){0x38, 0x08, 0x13, 0x56}, 4, 0},
-    {0x61, (uint8_t []){0x3B, 0x1b, 0x58, 0x38}, 4, 0},
-    {0x62, (uint8_t []){0x3B, 0x1b, 0x58, 0x38}, 4, 0},
-    {0x64, (uint8_t []){0x38, 0x0a, 0x73, 0x16, 0x13, 0x56}, 6, 0},
-    {0x66, (uint8_t []){0x38, 0x0b, 0x73, 0x17, 0x13, 0x56}, 6, 0},
-    {0x68, (uint8_t []){0x00, 0x0B, 0x22, 0x0B, 0x22, 0x1C, 0x1C}, 7, 0},
-    {0x69, (uint8_t []){0x00, 0x0B, 0x26, 0x0B, 0x26, 0x1C, 0x1C}, 7, 0},
-    {0x6A, (uint8_t []){0x15, 0x00}, 2, 0},
-    {
-        0x6E, (uint8_t [])
-        {
-            0x08, 0x02, 0x1a, 0x00, 0x12, 0x12, 0x11, 0x11, 0x14, 0x14, 0x13, 0x13, 0x04, 0x19, 0x1e, 0x1d,
-            0x1d, 0x1e, 0x19, 0x04, 0x0b, 0x0b, 0x0c, 0x0c, 0x09, 0x09, 0x0a, 0x0a, 0x00, 0x1a, 0x01, 0x07
-        },
-        32, 0
-    },
-    {0x6C, (uint8_t []){0xCC, 0x0C, 0xCC, 0x84, 0xCC, 0x04, 0x50}, 7, 0},
-    {0x7D, (uint8_t []){0x72}, 1, 0},
-    {0x70, (uint8_t []){0x02, 0x03, 0x09, 0x07, 0x09, 0x03, 0x09, 0x07, 0x09, 0x03}, 10, 0},
-    {0x90, (uint8_t []){0x06, 0x06, 0x05, 0x06}, 4, 0},
-    {0x93, (uint8_t []){0x45, 0xFF, 0x00}, 3, 0},
-    {0xC3, (uint8_t []){0x15}, 1, 0},
-    {0xC4, (uint8_t []){0x36}, 1, 0},
-    {0xC9, (uint8_t []){0x3d}, 1, 0},
-    {0xF0, (uint8_t []){0x47, 0x07, 0x0A, 0x0A, 0x00, 0x29}, 6, 0},
-    {0xF2, (uint8_t []){0x47, 0x07, 0x0a, 0x0A, 0x00, 0x29}, 6, 0},
-    {0xF1, (uint8_t []){0x42, 0x91, 0x10, 0x2D, 0x2F, 0x6F}, 6, 0},
-    {0xF3, (uint8_t []){0x42, 0x91, 0x10, 0x2D, 0x2F, 0x6F}, 6, 0},
-    {0xF9, (uint8_t []){0x30}, 1, 0},
-    {0xBE, (uint8_t []){0x11}, 1, 0},
-    {0xFB, (uint8_t []){0x00, 0x00}, 2, 0},
-    {0x11, (uint8_t []){0x00}, 0, 1000},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0xfe),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0xef),
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x81, 0x70),
+    ESP_PANEL_INIT_SEQ_CMD(0x82, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x83, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x84, 0x62),
+    ESP_PANEL_INIT_SEQ_CMD(0x89, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x8A, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x8B, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0xEC, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x74, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x98, 0x3E),
+    ESP_PANEL_INIT_SEQ_CMD(0x99, 0x3E),
+    ESP_PANEL_INIT_SEQ_CMD(0xA1, 0x01, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0xA2, 0x01, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0xCB, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x7C, 0xB6, 0x24),
+    ESP_PANEL_INIT_SEQ_CMD(0xAC, 0x74),
+    ESP_PANEL_INIT_SEQ_CMD(0xF6, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xB5, 0x09, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0xEB, 0x01, 0x81),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x38, 0x06, 0x13, 0x56),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x38, 0x08, 0x13, 0x56),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x3B, 0x1b, 0x58, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x3B, 0x1b, 0x58, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x38, 0x0a, 0x73, 0x16, 0x13, 0x56),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x38, 0x0b, 0x73, 0x17, 0x13, 0x56),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x00, 0x0B, 0x22, 0x0B, 0x22, 0x1C, 0x1C),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x00, 0x0B, 0x26, 0x0B, 0x26, 0x1C, 0x1C),
+    ESP_PANEL_INIT_SEQ_CMD(0x6A, 0x15, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x6E, 0x08, 0x02, 0x1a, 0x00, 0x12, 0x12, 0x11, 0x11, 0x14, 0x14, 0x13, 0x13, 0x04, 0x19,
+            0x1e, 0x1d, 0x1d, 0x1e, 0x19, 0x04, 0x0b, 0x0b, 0x0c, 0x0c, 0x09, 0x09, 0x0a, 0x0a, 0x00, 0x1a, 0x01, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x6C, 0xCC, 0x0C, 0xCC, 0x84, 0xCC, 0x04, 0x50),
+    ESP_PANEL_INIT_SEQ_CMD(0x7D, 0x72),
+    ESP_PANEL_INIT_SEQ_CMD(0x70, 0x02, 0x03, 0x09, 0x07, 0x09, 0x03, 0x09, 0x07, 0x09, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x90, 0x06, 0x06, 0x05, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x93, 0x45, 0xFF, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xC3, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0xC4, 0x36),
+    ESP_PANEL_INIT_SEQ_CMD(0xC9, 0x3d),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x47, 0x07, 0x0A, 0x0A, 0x00, 0x29),
+    ESP_PANEL_INIT_SEQ_CMD(0xF2, 0x47, 0x07, 0x0a, 0x0A, 0x00, 0x29),
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x42, 0x91, 0x10, 0x2D, 0x2F, 0x6F),
+    ESP_PANEL_INIT_SEQ_CMD(0xF3, 0x42, 0x91, 0x10, 0x2D, 0x2F, 0x6F),
+    ESP_PANEL_INIT_SEQ_CMD(0xF9, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0xBE, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xFB, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(1000),
 };
 
 static esp_err_t panel_gc9b71_init(esp_lcd_panel_t *panel)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     bool is_cmd_overwritten = false;
 
     ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_MADCTL, (uint8_t[]) {
@@ -275,23 +273,22 @@ static esp_err_t panel_gc9b71_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (gc9b71->init_cmds) {
-        init_cmds = gc9b71->init_cmds;
-        init_cmds_size = gc9b71->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, gc9b71->init_cmds, gc9b71->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            gc9b71->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            gc9b71->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            gc9b71->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            gc9b71->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -299,13 +296,16 @@ static esp_err_t panel_gc9b71_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG,
+        ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG,
                             "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -316,30 +316,39 @@ static esp_err_t panel_gc9b71_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = gc9b71->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += gc9b71->x_gap;
     x_end += gc9b71->x_gap;
     y_start += gc9b71->y_gap;
     y_end += gc9b71->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(gc9b71->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(gc9b71->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(gc9b71, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * gc9b71->fb_bits_per_pixel / 8;
     ESP_RETURN_ON_ERROR(tx_color(gc9b71, io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_gc9b71_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -359,6 +368,7 @@ static esp_err_t panel_gc9b71_invert_color(esp_lcd_panel_t *panel, bool invert_c
 static esp_err_t panel_gc9b71_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
     if (mirror_x) {
         gc9b71->madctl_val |= LCD_CMD_MX_BIT;
@@ -379,6 +389,7 @@ static esp_err_t panel_gc9b71_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_gc9b71_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
     if (swap_axes) {
         gc9b71->madctl_val |= LCD_CMD_MV_BIT;
@@ -394,6 +405,7 @@ static esp_err_t panel_gc9b71_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_gc9b71_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
     gc9b71->x_gap = x_gap;
     gc9b71->y_gap = y_gap;
     return ESP_OK;
@@ -402,6 +414,7 @@ static esp_err_t panel_gc9b71_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_g
 static esp_err_t panel_gc9b71_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     gc9b71_panel_t *gc9b71 = __containerof(panel, gc9b71_panel_t, base);
+    esp_panel_window_cache_invalidate(gc9b71->window_cache);
     esp_lcd_panel_io_handle_t io = gc9b71->io;
     int command = 0;
 
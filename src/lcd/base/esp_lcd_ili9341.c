@@ -45,6 +45,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
 } ili9341_panel_t;
 
 esp_err_t esp_lcd_new_panel_ili9341(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
@@ -112,6 +113,7 @@ esp_err_t esp_lcd_new_panel_ili9341(const esp_lcd_panel_io_handle_t io, const es
     if (panel_dev_config->vendor_config) {
         ili9341->init_cmds = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         ili9341->init_cmds_size = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        ili9341->window_cache = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->window_cache;
     }
     ili9341->base.del = panel_ili9341_del;
     ili9341->base.reset = panel_ili9341_reset;
@@ -159,6 +161,7 @@ static esp_err_t panel_ili9341_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_ili9341_reset(esp_lcd_panel_t *panel)
 {
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
     esp_lcd_panel_io_handle_t io = ili9341->io;
 
     // perform hardware reset
@@ -175,57 +178,60 @@ static esp_err_t panel_ili9341_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
     /* Power control B, power control = 0, DC_ENA = 1 */
-    {0xCF, (uint8_t []){0x00, 0xAA, 0XE0}, 3, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xCF, 0x00, 0xAA, 0XE0),
     /* Power on sequence control,
      * cp1 keeps 1 frame, 1st frame enable
      * vcl = 0, ddvdh=3, vgh=1, vgl=2
      * DDVDH_ENH=1
      */
-    {0xED, (uint8_t []){0x67, 0x03, 0X12, 0X81}, 4, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xED, 0x67, 0x03, 0X12, 0X81),
     /* Driver timing control A,
      * non-overlap=default +1
      * EQ=default - 1, CR=default
      * pre-charge=default - 1
      */
-    {0xE8, (uint8_t []){0x8A, 0x01, 0x78}, 3, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xE8, 0x8A, 0x01, 0x78),
     /* Power control A, Vcore=1.6V, DDVDH=5.6V */
-    {0xCB, (uint8_t []){0x39, 0x2C, 0x00, 0x34, 0x02}, 5, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xCB, 0x39, 0x2C, 0x00, 0x34, 0x02),
     /* Pump ratio control, DDVDH=2xVCl */
-    {0xF7, (uint8_t []){0x20}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xF7, 0x20),
 
-    {0xF7, (uint8_t []){0x20}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xF7, 0x20),
     /* Driver timing control, all=0 unit */
-    {0xEA, (uint8_t []){0x00, 0x00}, 2, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xEA, 0x00, 0x00),
     /* Power control 1, GVDD=4.75V */
-    {0xC0, (uint8_t []){0x23}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xC0, 0x23),
     /* Power control 2, DDVDH=VCl*2, VGH=VCl*7, VGL=-VCl*3 */
-    {0xC1, (uint8_t []){0x11}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x11),
     /* VCOM control 1, VCOMH=4.025V, VCOML=-0.950V */
-    {0xC5, (uint8_t []){0x43, 0x4C}, 2, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xC5, 0x43, 0x4C),
     /* VCOM control 2, VCOMH=VMH-2, VCOML=VML-2 */
-    {0xC7, (uint8_t []){0xA0}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xC7, 0xA0),
     /* Frame rate control, f=fosc, 70Hz fps */
-    {0xB1, (uint8_t []){0x00, 0x1B}, 2, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x00, 0x1B),
     /* Enable 3G, disabled */
-    {0xF2, (uint8_t []){0x00}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xF2, 0x00),
     /* Gamma set, curve 1 */
-    {0x26, (uint8_t []){0x01}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x01),
     /* Positive gamma correction */
-    {0xE0, (uint8_t []){0x1F, 0x36, 0x36, 0x3A, 0x0C, 0x05, 0x4F, 0X87, 0x3C, 0x08, 0x11, 0x35, 0x19, 0x13, 0x00}, 15, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x1F, 0x36, 0x36, 0x3A, 0x0C, 0x05, 0x4F, 0X87, 0x3C, 0x08, 0x11, 0x35, 0x19, 0x13,
+            0x00),
     /* Negative gamma correction */
-    {0xE1, (uint8_t []){0x00, 0x09, 0x09, 0x05, 0x13, 0x0A, 0x30, 0x78, 0x43, 0x07, 0x0E, 0x0A, 0x26, 0x2C, 0x1F}, 15, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xE1, 0x00, 0x09, 0x09, 0x05, 0x13, 0x0A, 0x30, 0x78, 0x43, 0x07, 0x0E, 0x0A, 0x26, 0x2C,
+            0x1F),
     /* Entry mode set, Low vol detect disabled, normal display */
-    {0xB7, (uint8_t []){0x07}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xB7, 0x07),
     /* Display function control */
-    {0xB6, (uint8_t []){0x08, 0x82, 0x27}, 3, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xB6, 0x08, 0x82, 0x27),
 };
 
 static esp_err_t panel_ili9341_init(esp_lcd_panel_t *panel)
 {
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
     esp_lcd_panel_io_handle_t io = ili9341->io;
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
@@ -238,27 +244,27 @@ static esp_err_t panel_ili9341_init(esp_lcd_panel_t *panel)
         ili9341->colmod_val,
     }, 1), TAG, "send command failed");
 
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     if (ili9341->init_cmds) {
-        init_cmds = ili9341->init_cmds;
-        init_cmds_size = ili9341->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, ili9341->init_cmds, ili9341->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
     bool is_cmd_overwritten = false;
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            ili9341->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            ili9341->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            ili9341->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            ili9341->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -266,12 +272,15 @@ static esp_err_t panel_ili9341_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -282,30 +291,39 @@ static esp_err_t panel_ili9341_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = ili9341->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += ili9341->x_gap;
     x_end += ili9341->x_gap;
     y_start += ili9341->y_gap;
     y_end += ili9341->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(ili9341->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(ili9341->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * ili9341->fb_bits_per_pixel / 8;
     esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len);
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_ili9341_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -325,6 +343,7 @@ static esp_err_t panel_ili9341_invert_color(esp_lcd_panel_t *panel, bool invert_
 static esp_err_t panel_ili9341_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
     esp_lcd_panel_io_handle_t io = ili9341->io;
     if (mirror_x) {
         ili9341->madctl_val |= LCD_CMD_MX_BIT;
@@ -345,6 +364,7 @@ static esp_err_t panel_ili9341_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 static esp_err_t panel_ili9341_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
     esp_lcd_panel_io_handle_t io = ili9341->io;
     if (swap_axes) {
         ili9341->madctl_val |= LCD_CMD_MV_BIT;
@@ -360,6 +380,7 @@ static esp_err_t panel_ili9341_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_ili9341_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
     ili9341->x_gap = x_gap;
     ili9341->y_gap = y_gap;
     return ESP_OK;
@@ -368,6 +389,7 @@ static esp_err_t panel_ili9341_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_
 static esp_err_t panel_ili9341_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     ili9341_panel_t *ili9341 = __containerof(panel, ili9341_panel_t, base);
+    esp_panel_window_cache_invalidate(ili9341->window_cache);
     esp_lcd_panel_io_handle_t io = ili9341->io;
     int command = 0;
 
@@ -158,204 +158,208 @@ err:
     return ret;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
+static const uint8_t vendor_specific_init_default[] = {
     // {cmd, { data }, data_size, delay_ms}
     /**** CMD_Page 3 ****/
-    {ILI9881C_CMD_CNDBKxSEL, (uint8_t []){ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1, ILI9881C_CMD_BKxSEL_BYTE2_PAGE3}, 3, 0},
-    {0x01, (uint8_t []){0x00}, 1, 0},
-    {0x02, (uint8_t []){0x00}, 1, 0},
-    {0x03, (uint8_t []){0x53}, 1, 0},
-    {0x04, (uint8_t []){0x53}, 1, 0},
-    {0x05, (uint8_t []){0x13}, 1, 0},
-    {0x06, (uint8_t []){0x04}, 1, 0},
-    {0x07, (uint8_t []){0x02}, 1, 0},
-    {0x08, (uint8_t []){0x02}, 1, 0},
-    {0x09, (uint8_t []){0x00}, 1, 0},
-    {0x0a, (uint8_t []){0x00}, 1, 0},
-    {0x0b, (uint8_t []){0x00}, 1, 0},
-    {0x0c, (uint8_t []){0x00}, 1, 0},
-    {0x0d, (uint8_t []){0x00}, 1, 0},
-    {0x0e, (uint8_t []){0x00}, 1, 0},
-    {0x0f, (uint8_t []){0x00}, 1, 0},
-    {0x10, (uint8_t []){0x00}, 1, 0},
-    {0x11, (uint8_t []){0x00}, 1, 0},
-    {0x12, (uint8_t []){0x00}, 1, 0},
-    {0x13, (uint8_t []){0x00}, 1, 0},
-    {0x14, (uint8_t []){0x00}, 1, 0},
-    {0x15, (uint8_t []){0x00}, 1, 0},
-    {0x16, (uint8_t []){0x00}, 1, 0},
-    {0x17, (uint8_t []){0x00}, 1, 0},
-    {0x18, (uint8_t []){0x00}, 1, 0},
-    {0x19, (uint8_t []){0x00}, 1, 0},
-    {0x1a, (uint8_t []){0x00}, 1, 0},
-    {0x1b, (uint8_t []){0x00}, 1, 0},
-    {0x1c, (uint8_t []){0x00}, 1, 0},
-    {0x1d, (uint8_t []){0x00}, 1, 0},
-    {0x1e, (uint8_t []){0xc0}, 1, 0},
-    {0x1f, (uint8_t []){0x80}, 1, 0},
-    {0x20, (uint8_t []){0x02}, 1, 0},
-    {0x21, (uint8_t []){0x09}, 1, 0},
-    {0x22, (uint8_t []){0x00}, 1, 0},
-    {0x23, (uint8_t []){0x00}, 1, 0},
-    {0x24, (uint8_t []){0x00}, 1, 0},
-    {0x25, (uint8_t []){0x00}, 1, 0},
-    {0x26, (uint8_t []){0x00}, 1, 0},
-    {0x27, (uint8_t []){0x00}, 1, 0},
-    {0x28, (uint8_t []){0x55}, 1, 0},
-    {0x29, (uint8_t []){0x03}, 1, 0},
-    {0x2a, (uint8_t []){0x00}, 1, 0},
-    {0x2b, (uint8_t []){0x00}, 1, 0},
-    {0x2c, (uint8_t []){0x00}, 1, 0},
-    {0x2d, (uint8_t []){0x00}, 1, 0},
-    {0x2e, (uint8_t []){0x00}, 1, 0},
-    {0x2f, (uint8_t []){0x00}, 1, 0},
-    {0x30, (uint8_t []){0x00}, 1, 0},
-    {0x31, (uint8_t []){0x00}, 1, 0},
-    {0x32, (uint8_t []){0x00}, 1, 0},
-    {0x33, (uint8_t []){0x00}, 1, 0},
-    {0x34, (uint8_t []){0x00}, 1, 0},
-    {0x35, (uint8_t []){0x00}, 1, 0},
-    {0x36, (uint8_t []){0x00}, 1, 0},
-    {0x37, (uint8_t []){0x00}, 1, 0},
-    {0x38, (uint8_t []){0x3C}, 1, 0},
-    {0x39, (uint8_t []){0x00}, 1, 0},
-    {0x3a, (uint8_t []){0x00}, 1, 0},
-    {0x3b, (uint8_t []){0x00}, 1, 0},
-    {0x3c, (uint8_t []){0x00}, 1, 0},
-    {0x3d, (uint8_t []){0x00}, 1, 0},
-    {0x3e, (uint8_t []){0x00}, 1, 0},
-    {0x3f, (uint8_t []){0x00}, 1, 0},
-    {0x40, (uint8_t []){0x00}, 1, 0},
-    {0x41, (uint8_t []){0x00}, 1, 0},
-    {0x42, (uint8_t []){0x00}, 1, 0},
-    {0x43, (uint8_t []){0x00}, 1, 0},
-    {0x44, (uint8_t []){0x00}, 1, 0},
-    {0x50, (uint8_t []){0x01}, 1, 0},
-    {0x51, (uint8_t []){0x23}, 1, 0},
-    {0x52, (uint8_t []){0x45}, 1, 0},
-    {0x53, (uint8_t []){0x67}, 1, 0},
-    {0x54, (uint8_t []){0x89}, 1, 0},
-    {0x55, (uint8_t []){0xab}, 1, 0},
-    {0x56, (uint8_t []){0x01}, 1, 0},
-    {0x57, (uint8_t []){0x23}, 1, 0},
-    {0x58, (uint8_t []){0x45}, 1, 0},
-    {0x59, (uint8_t []){0x67}, 1, 0},
-    {0x5a, (uint8_t []){0x89}, 1, 0},
-    {0x5b, (uint8_t []){0xab}, 1, 0},
-    {0x5c, (uint8_t []){0xcd}, 1, 0},
-    {0x5d, (uint8_t []){0xef}, 1, 0},
-    {0x5e, (uint8_t []){0x01}, 1, 0},
-    {0x5f, (uint8_t []){0x08}, 1, 0},
-    {0x60, (uint8_t []){0x02}, 1, 0},
-    {0x61, (uint8_t []){0x02}, 1, 0},
-    {0x62, (uint8_t []){0x0A}, 1, 0},
-    {0x63, (uint8_t []){0x15}, 1, 0},
-    {0x64, (uint8_t []){0x14}, 1, 0},
-    {0x65, (uint8_t []){0x02}, 1, 0},
-    {0x66, (uint8_t []){0x11}, 1, 0},
-    {0x67, (uint8_t []){0x10}, 1, 0},
-    {0x68, (uint8_t []){0x02}, 1, 0},
-    {0x69, (uint8_t []){0x0F}, 1, 0},
-    {0x6a, (uint8_t []){0x0E}, 1, 0},
-    {0x6b, (uint8_t []){0x02}, 1, 0},
-    {0x6c, (uint8_t []){0x0D}, 1, 0},
-    {0x6d, (uint8_t []){0x0C}, 1, 0},
-    {0x6e, (uint8_t []){0x06}, 1, 0},
-    {0x6f, (uint8_t []){0x02}, 1, 0},
-    {0x70, (uint8_t []){0x02}, 1, 0},
-    {0x71, (uint8_t []){0x02}, 1, 0},
-    {0x72, (uint8_t []){0x02}, 1, 0},
-    {0x73, (uint8_t []){0x02}, 1, 0},
-    {0x74, (uint8_t []){0x02}, 1, 0},
-    {0x75, (uint8_t []){0x06}, 1, 0},
-    {0x76, (uint8_t []){0x02}, 1, 0},
-    {0x77, (uint8_t []){0x02}, 1, 0},
-    {0x78, (uint8_t []){0x0A}, 1, 0},
-    {0x79, (uint8_t []){0x15}, 1, 0},
-    {0x7a, (uint8_t []){0x14}, 1, 0},
-    {0x7b, (uint8_t []){0x02}, 1, 0},
-    {0x7c, (uint8_t []){0x10}, 1, 0},
-    {0x7d, (uint8_t []){0x11}, 1, 0},
-    {0x7e, (uint8_t []){0x02}, 1, 0},
-    {0x7f, (uint8_t []){0x0C}, 1, 0},
-    {0x80, (uint8_t []){0x0D}, 1, 0},
-    {0x81, (uint8_t []){0x02}, 1, 0},
-    {0x82, (uint8_t []){0x0E}, 1, 0},
-    {0x83, (uint8_t []){0x0F}, 1, 0},
-    {0x84, (uint8_t []){0x08}, 1, 0},
-    {0x85, (uint8_t []){0x02}, 1, 0},
-    {0x86, (uint8_t []){0x02}, 1, 0},
-    {0x87, (uint8_t []){0x02}, 1, 0},
-    {0x88, (uint8_t []){0x02}, 1, 0},
-    {0x89, (uint8_t []){0x02}, 1, 0},
-    {0x8A, (uint8_t []){0x02}, 1, 0},
-    {ILI9881C_CMD_CNDBKxSEL, (uint8_t []){ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1, ILI9881C_CMD_BKxSEL_BYTE2_PAGE4}, 3, 0},
-    {0x6C, (uint8_t []){0x15}, 1, 0},
-    {0x6E, (uint8_t []){0x30}, 1, 0},
-    {0x6F, (uint8_t []){0x33}, 1, 0},
-    {0x8D, (uint8_t []){0x1F}, 1, 0},
-    {0x87, (uint8_t []){0xBA}, 1, 0},
-    {0x26, (uint8_t []){0x76}, 1, 0},
-    {0xB2, (uint8_t []){0xD1}, 1, 0},
-    {0x35, (uint8_t []){0x1F}, 1, 0},
-    {0x33, (uint8_t []){0x14}, 1, 0},
-    {0x3A, (uint8_t []){0xA9}, 1, 0},
-    {0x3B, (uint8_t []){0x3D}, 1, 0},
-    {0x38, (uint8_t []){0x01}, 1, 0},
-    {0x39, (uint8_t []){0x00}, 1, 0},
-    {ILI9881C_CMD_CNDBKxSEL, (uint8_t []){ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1, ILI9881C_CMD_BKxSEL_BYTE2_PAGE1}, 3, 0},
-    {0x22, (uint8_t []){0x09}, 1, 0},
-    {0x31, (uint8_t []){0x00}, 1, 0},
-    {0x40, (uint8_t []){0x53}, 1, 0},
-    {0x50, (uint8_t []){0xC0}, 1, 0},
-    {0x51, (uint8_t []){0xC0}, 1, 0},
-    {0x53, (uint8_t []){0x47}, 1, 0},
-    {0x55, (uint8_t []){0x46}, 1, 0},
-    {0x60, (uint8_t []){0x28}, 1, 0},
-    {0x2E, (uint8_t []){0xC8}, 1, 0},
-    {0xA0, (uint8_t []){0x01}, 1, 0},
-    {0xA1, (uint8_t []){0x10}, 1, 0},
-    {0xA2, (uint8_t []){0x1B}, 1, 0},
-    {0xA3, (uint8_t []){0x0C}, 1, 0},
-    {0xA4, (uint8_t []){0x14}, 1, 0},
-    {0xA5, (uint8_t []){0x25}, 1, 0},
-    {0xA6, (uint8_t []){0x1A}, 1, 0},
-    {0xA7, (uint8_t []){0x1D}, 1, 0},
-    {0xA8, (uint8_t []){0x68}, 1, 0},
-    {0xA9, (uint8_t []){0x1B}, 1, 0},
-    {0xAA, (uint8_t []){0x26}, 1, 0},
-    {0xAB, (uint8_t []){0x5B}, 1, 0},
-    {0xAC, (uint8_t []){0x1B}, 1, 0},
-    {0xAD, (uint8_t []){0x17}, 1, 0},
-    {0xAE, (uint8_t []){0x4F}, 1, 0},
-    {0xAF, (uint8_t []){0x24}, 1, 0},
-    {0xB0, (uint8_t []){0x2A}, 1, 0},
-    {0xB1, (uint8_t []){0x4E}, 1, 0},
-    {0xB2, (uint8_t []){0x5F}, 1, 0},
-    {0xB3, (uint8_t []){0x39}, 1, 0},
-    {0xC0, (uint8_t []){0x0F}, 1, 0},
-    {0xC1, (uint8_t []){0x1B}, 1, 0},
-    {0xC2, (uint8_t []){0x27}, 1, 0},
-    {0xC3, (uint8_t []){0x16}, 1, 0},
-    {0xC4, (uint8_t []){0x14}, 1, 0},
-    {0xC5, (uint8_t []){0x28}, 1, 0},
-    {0xC6, (uint8_t []){0x1D}, 1, 0},
-    {0xC7, (uint8_t []){0x21}, 1, 0},
-    {0xC8, (uint8_t []){0x6C}, 1, 0},
-    {0xC9, (uint8_t []){0x1B}, 1, 0},
-    {0xCA, (uint8_t []){0x26}, 1, 0},
-    {0xCB, (uint8_t []){0x5B}, 1, 0},
-    {0xCC, (uint8_t []){0x1B}, 1, 0},
-    {0xCD, (uint8_t []){0x1B}, 1, 0},
-    {0xCE, (uint8_t []){0x4F}, 1, 0},
-    {0xCF, (uint8_t []){0x24}, 1, 0},
-    {0xD0, (uint8_t []){0x2A}, 1, 0},
-    {0xD1, (uint8_t []){0x4E}, 1, 0},
-    {0xD2, (uint8_t []){0x5F}, 1, 0},
-    {0xD3, (uint8_t []){0x39}, 1, 0},
-    {ILI9881C_CMD_CNDBKxSEL, (uint8_t []){ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1, ILI9881C_CMD_BKxSEL_BYTE2_PAGE0}, 3, 0},
-    {0x35, (uint8_t []){0x00}, 1, 0},
-    {0x29, (uint8_t []){0x00}, 0, 0},
+    ESP_PANEL_INIT_SEQ_CMD(ILI9881C_CMD_CNDBKxSEL, ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1,
+            ILI9881C_CMD_BKxSEL_BYTE2_PAGE3),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x53),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x53),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0b, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0d, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0e, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0f, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x12, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x13, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x14, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x17, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x19, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1b, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1d, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1e, 0xc0),
+    ESP_PANEL_INIT_SEQ_CMD(0x1f, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x55),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2b, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2d, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2e, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2f, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x32, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x33, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x34, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x36, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x38, 0x3C),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3b, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3d, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3e, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3f, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x40, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x41, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x42, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x43, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x44, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x50, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x51, 0x23),
+    ESP_PANEL_INIT_SEQ_CMD(0x52, 0x45),
+    ESP_PANEL_INIT_SEQ_CMD(0x53, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x54, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0x55, 0xab),
+    ESP_PANEL_INIT_SEQ_CMD(0x56, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x57, 0x23),
+    ESP_PANEL_INIT_SEQ_CMD(0x58, 0x45),
+    ESP_PANEL_INIT_SEQ_CMD(0x59, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x5a, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0x5b, 0xab),
+    ESP_PANEL_INIT_SEQ_CMD(0x5c, 0xcd),
+    ESP_PANEL_INIT_SEQ_CMD(0x5d, 0xef),
+    ESP_PANEL_INIT_SEQ_CMD(0x5e, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x5f, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x0F),
+    ESP_PANEL_INIT_SEQ_CMD(0x6a, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0x6b, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x6c, 0x0D),
+    ESP_PANEL_INIT_SEQ_CMD(0x6d, 0x0C),
+    ESP_PANEL_INIT_SEQ_CMD(0x6e, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x6f, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x70, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x71, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x72, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x74, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x75, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x76, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x77, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x78, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0x79, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0x7a, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0x7b, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x7c, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x7d, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x7e, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x7f, 0x0C),
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x0D),
+    ESP_PANEL_INIT_SEQ_CMD(0x81, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x82, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0x83, 0x0F),
+    ESP_PANEL_INIT_SEQ_CMD(0x84, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x85, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x87, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x88, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x89, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x8A, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(ILI9881C_CMD_CNDBKxSEL, ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1,
+            ILI9881C_CMD_BKxSEL_BYTE2_PAGE4),
+    ESP_PANEL_INIT_SEQ_CMD(0x6C, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0x6E, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0x6F, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0x8D, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x87, 0xBA),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x76),
+    ESP_PANEL_INIT_SEQ_CMD(0xB2, 0xD1),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x33, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0x3A, 0xA9),
+    ESP_PANEL_INIT_SEQ_CMD(0x3B, 0x3D),
+    ESP_PANEL_INIT_SEQ_CMD(0x38, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(ILI9881C_CMD_CNDBKxSEL, ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1,
+            ILI9881C_CMD_BKxSEL_BYTE2_PAGE1),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x40, 0x53),
+    ESP_PANEL_INIT_SEQ_CMD(0x50, 0xC0),
+    ESP_PANEL_INIT_SEQ_CMD(0x51, 0xC0),
+    ESP_PANEL_INIT_SEQ_CMD(0x53, 0x47),
+    ESP_PANEL_INIT_SEQ_CMD(0x55, 0x46),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x28),
+    ESP_PANEL_INIT_SEQ_CMD(0x2E, 0xC8),
+    ESP_PANEL_INIT_SEQ_CMD(0xA0, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xA1, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xA2, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x0C),
+    ESP_PANEL_INIT_SEQ_CMD(0xA4, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0x25),
+    ESP_PANEL_INIT_SEQ_CMD(0xA6, 0x1A),
+    ESP_PANEL_INIT_SEQ_CMD(0xA7, 0x1D),
+    ESP_PANEL_INIT_SEQ_CMD(0xA8, 0x68),
+    ESP_PANEL_INIT_SEQ_CMD(0xA9, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xAA, 0x26),
+    ESP_PANEL_INIT_SEQ_CMD(0xAB, 0x5B),
+    ESP_PANEL_INIT_SEQ_CMD(0xAC, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xAD, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0xAE, 0x4F),
+    ESP_PANEL_INIT_SEQ_CMD(0xAF, 0x24),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x4E),
+    ESP_PANEL_INIT_SEQ_CMD(0xB2, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0xB3, 0x39),
+    ESP_PANEL_INIT_SEQ_CMD(0xC0, 0x0F),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x27),
+    ESP_PANEL_INIT_SEQ_CMD(0xC3, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0xC4, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0xC5, 0x28),
+    ESP_PANEL_INIT_SEQ_CMD(0xC6, 0x1D),
+    ESP_PANEL_INIT_SEQ_CMD(0xC7, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0xC8, 0x6C),
+    ESP_PANEL_INIT_SEQ_CMD(0xC9, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xCA, 0x26),
+    ESP_PANEL_INIT_SEQ_CMD(0xCB, 0x5B),
+    ESP_PANEL_INIT_SEQ_CMD(0xCC, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xCD, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0xCE, 0x4F),
+    ESP_PANEL_INIT_SEQ_CMD(0xCF, 0x24),
+    ESP_PANEL_INIT_SEQ_CMD(0xD0, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0xD1, 0x4E),
+    ESP_PANEL_INIT_SEQ_CMD(0xD2, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0xD3, 0x39),
+    ESP_PANEL_INIT_SEQ_CMD(ILI9881C_CMD_CNDBKxSEL, ILI9881C_CMD_BKxSEL_BYTE0, ILI9881C_CMD_BKxSEL_BYTE1,
+            ILI9881C_CMD_BKxSEL_BYTE2_PAGE0),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x29),
 
     //============ Gamma END===========
 };
@@ -390,8 +394,9 @@ static esp_err_t panel_ili9881c_init(esp_lcd_panel_t *panel)
     esp_lcd_panel_io_rx_param(io, 0x02, &ID3, 1);
     ESP_LOGI(TAG, "ID1: 0x%x, ID2: 0x%x, ID3: 0x%x", ID1, ID2, ID3);
 
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     uint8_t lane_command = ILI9881C_DSI_2_LANE;
     bool is_command0_enable = false;
     bool is_cmd_overwritten = false;
@@ -437,24 +442,23 @@ static esp_err_t panel_ili9881c_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (ili9881c->init_cmds) {
-        init_cmds = ili9881c->init_cmds;
-        init_cmds_size = ili9881c->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, ili9881c->init_cmds, ili9881c->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        if (is_command0_enable && init_cmds[i].data_bytes > 0) {
-            switch (init_cmds[i].cmd) {
+        if (is_command0_enable && init_cmd.data_bytes > 0) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                ili9881c->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                ili9881c->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             case LCD_CMD_COLMOD:
                 is_cmd_overwritten = true;
-                ili9881c->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+                ili9881c->colmod_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -464,20 +468,23 @@ static esp_err_t panel_ili9881c_init(esp_lcd_panel_t *panel)
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
                 ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
-                         init_cmds[i].cmd);
+                         init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
 
-        if ((init_cmds[i].cmd == ILI9881C_CMD_CNDBKxSEL) && (((uint8_t *)init_cmds[i].data)[2] == ILI9881C_CMD_BKxSEL_BYTE2_PAGE0)) {
+        if ((init_cmd.cmd == ILI9881C_CMD_CNDBKxSEL) && (((uint8_t *)init_cmd.data)[2] == ILI9881C_CMD_BKxSEL_BYTE2_PAGE0)) {
             is_command0_enable = true;
-        } else if ((init_cmds[i].cmd == ILI9881C_CMD_CNDBKxSEL) && (((uint8_t *)init_cmds[i].data)[2] != ILI9881C_CMD_BKxSEL_BYTE2_PAGE0)) {
+        } else if ((init_cmd.cmd == ILI9881C_CMD_CNDBKxSEL) && (((uint8_t *)init_cmd.data)[2] != ILI9881C_CMD_BKxSEL_BYTE2_PAGE0)) {
             is_command0_enable = false;
         }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(ili9881c->init(panel), TAG, "init MIPI DPI panel failed");
@@ -149,232 +149,232 @@ err:
     return ret;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-    //  {cmd, { data }, data_size, delay_ms}
+static const uint8_t vendor_specific_init_default[] = {
+    //  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
     // {0xE0, (uint8_t[]){0x00}, 1, 0},
-    {0xE0, (uint8_t[]){0x00}, 1, 0},
-    {0xE1, (uint8_t[]){0x93}, 1, 0},
-    {0xE2, (uint8_t[]){0x65}, 1, 0},
-    {0xE3, (uint8_t[]){0xF8}, 1, 0},
-    {0x80, (uint8_t[]){0x01}, 1, 0},
-
-    {0xE0, (uint8_t[]){0x01}, 1, 0},
-    {0x00, (uint8_t[]){0x00}, 1, 0},
-    {0x01, (uint8_t[]){0x38}, 1, 0},
-    {0x03, (uint8_t[]){0x10}, 1, 0},
-    {0x04, (uint8_t[]){0x38}, 1, 0},
-
-    {0x0C, (uint8_t[]){0x74}, 1, 0},
-
-    {0x17, (uint8_t[]){0x00}, 1, 0},
-    {0x18, (uint8_t[]){0xAF}, 1, 0},
-    {0x19, (uint8_t[]){0x00}, 1, 0},
-    {0x1A, (uint8_t[]){0x00}, 1, 0},
-    {0x1B, (uint8_t[]){0xAF}, 1, 0},
-    {0x1C, (uint8_t[]){0x00}, 1, 0},
-
-    {0x35, (uint8_t[]){0x26}, 1, 0},
-
-    {0x37, (uint8_t[]){0x09}, 1, 0},
-
-    {0x38, (uint8_t[]){0x04}, 1, 0},
-    {0x39, (uint8_t[]){0x00}, 1, 0},
-    {0x3A, (uint8_t[]){0x01}, 1, 0},
-    {0x3C, (uint8_t[]){0x78}, 1, 0},
-    {0x3D, (uint8_t[]){0xFF}, 1, 0},
-    {0x3E, (uint8_t[]){0xFF}, 1, 0},
-    {0x3F, (uint8_t[]){0x7F}, 1, 0},
-
-    {0x40, (uint8_t[]){0x06}, 1, 0},
-    {0x41, (uint8_t[]){0xA0}, 1, 0},
-    {0x42, (uint8_t[]){0x81}, 1, 0},
-    {0x43, (uint8_t[]){0x1E}, 1, 0},
-    {0x44, (uint8_t[]){0x0D}, 1, 0},
-    {0x45, (uint8_t[]){0x28}, 1, 0},
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xE1, 0x93),
+    ESP_PANEL_INIT_SEQ_CMD(0xE2, 0x65),
+    ESP_PANEL_INIT_SEQ_CMD(0xE3, 0xF8),
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x01),
+
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x38),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x0C, 0x74),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x17, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0xAF),
+    ESP_PANEL_INIT_SEQ_CMD(0x19, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1A, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1B, 0xAF),
+    ESP_PANEL_INIT_SEQ_CMD(0x1C, 0x00),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x26),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0x09),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x38, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x3A, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x3C, 0x78),
+    ESP_PANEL_INIT_SEQ_CMD(0x3D, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0x3E, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0x3F, 0x7F),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x40, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x41, 0xA0),
+    ESP_PANEL_INIT_SEQ_CMD(0x42, 0x81),
+    ESP_PANEL_INIT_SEQ_CMD(0x43, 0x1E),
+    ESP_PANEL_INIT_SEQ_CMD(0x44, 0x0D),
+    ESP_PANEL_INIT_SEQ_CMD(0x45, 0x28),
     //{0x4A, (uint8_t[]){0x35}, 1, 0},//bist
 
-    {0x55, (uint8_t[]){0x02}, 1, 0},
-    {0x57, (uint8_t[]){0x69}, 1, 0},
-    {0x59, (uint8_t[]){0x0A}, 1, 0},
-    {0x5A, (uint8_t[]){0x2A}, 1, 0},
-    {0x5B, (uint8_t[]){0x17}, 1, 0},
-
-    {0x5D, (uint8_t[]){0x7F}, 1, 0},
-    {0x5E, (uint8_t[]){0x6A}, 1, 0},
-    {0x5F, (uint8_t[]){0x5B}, 1, 0},
-    {0x60, (uint8_t[]){0x4F}, 1, 0},
-    {0x61, (uint8_t[]){0x4A}, 1, 0},
-    {0x62, (uint8_t[]){0x3D}, 1, 0},
-    {0x63, (uint8_t[]){0x41}, 1, 0},
-    {0x64, (uint8_t[]){0x2A}, 1, 0},
-    {0x65, (uint8_t[]){0x44}, 1, 0},
-    {0x66, (uint8_t[]){0x43}, 1, 0},
-    {0x67, (uint8_t[]){0x44}, 1, 0},
-    {0x68, (uint8_t[]){0x62}, 1, 0},
-    {0x69, (uint8_t[]){0x52}, 1, 0},
-    {0x6A, (uint8_t[]){0x59}, 1, 0},
-    {0x6B, (uint8_t[]){0x4C}, 1, 0},
-    {0x6C, (uint8_t[]){0x48}, 1, 0},
-    {0x6D, (uint8_t[]){0x3A}, 1, 0},
-    {0x6E, (uint8_t[]){0x26}, 1, 0},
-    {0x6F, (uint8_t[]){0x00}, 1, 0},
-    {0x70, (uint8_t[]){0x7F}, 1, 0},
-    {0x71, (uint8_t[]){0x6A}, 1, 0},
-    {0x72, (uint8_t[]){0x5B}, 1, 0},
-    {0x73, (uint8_t[]){0x4F}, 1, 0},
-    {0x74, (uint8_t[]){0x4A}, 1, 0},
-    {0x75, (uint8_t[]){0x3D}, 1, 0},
-    {0x76, (uint8_t[]){0x41}, 1, 0},
-    {0x77, (uint8_t[]){0x2A}, 1, 0},
-    {0x78, (uint8_t[]){0x44}, 1, 0},
-    {0x79, (uint8_t[]){0x43}, 1, 0},
-    {0x7A, (uint8_t[]){0x44}, 1, 0},
-    {0x7B, (uint8_t[]){0x62}, 1, 0},
-    {0x7C, (uint8_t[]){0x52}, 1, 0},
-    {0x7D, (uint8_t[]){0x59}, 1, 0},
-    {0x7E, (uint8_t[]){0x4C}, 1, 0},
-    {0x7F, (uint8_t[]){0x48}, 1, 0},
-    {0x80, (uint8_t[]){0x3A}, 1, 0},
-    {0x81, (uint8_t[]){0x26}, 1, 0},
-    {0x82, (uint8_t[]){0x00}, 1, 0},
-
-    {0xE0, (uint8_t[]){0x02}, 1, 0},
-    {0x00, (uint8_t[]){0x42}, 1, 0},
-    {0x01, (uint8_t[]){0x42}, 1, 0},
-    {0x02, (uint8_t[]){0x40}, 1, 0},
-    {0x03, (uint8_t[]){0x40}, 1, 0},
-    {0x04, (uint8_t[]){0x5E}, 1, 0},
-    {0x05, (uint8_t[]){0x5E}, 1, 0},
-    {0x06, (uint8_t[]){0x5F}, 1, 0},
-    {0x07, (uint8_t[]){0x5F}, 1, 0},
-    {0x08, (uint8_t[]){0x5F}, 1, 0},
-    {0x09, (uint8_t[]){0x57}, 1, 0},
-    {0x0A, (uint8_t[]){0x57}, 1, 0},
-    {0x0B, (uint8_t[]){0x77}, 1, 0},
-    {0x0C, (uint8_t[]){0x77}, 1, 0},
-    {0x0D, (uint8_t[]){0x47}, 1, 0},
-    {0x0E, (uint8_t[]){0x47}, 1, 0},
-    {0x0F, (uint8_t[]){0x45}, 1, 0},
-    {0x10, (uint8_t[]){0x45}, 1, 0},
-    {0x11, (uint8_t[]){0x4B}, 1, 0},
-    {0x12, (uint8_t[]){0x4B}, 1, 0},
-    {0x13, (uint8_t[]){0x49}, 1, 0},
-    {0x14, (uint8_t[]){0x49}, 1, 0},
-    {0x15, (uint8_t[]){0x5F}, 1, 0},
-
-    {0x16, (uint8_t[]){0x41}, 1, 0},
-    {0x17, (uint8_t[]){0x41}, 1, 0},
-    {0x18, (uint8_t[]){0x40}, 1, 0},
-    {0x19, (uint8_t[]){0x40}, 1, 0},
-    {0x1A, (uint8_t[]){0x5E}, 1, 0},
-    {0x1B, (uint8_t[]){0x5E}, 1, 0},
-    {0x1C, (uint8_t[]){0x5F}, 1, 0},
-    {0x1D, (uint8_t[]){0x5F}, 1, 0},
-    {0x1E, (uint8_t[]){0x5F}, 1, 0},
-    {0x1F, (uint8_t[]){0x57}, 1, 0},
-    {0x20, (uint8_t[]){0x57}, 1, 0},
-    {0x21, (uint8_t[]){0x77}, 1, 0},
-    {0x22, (uint8_t[]){0x77}, 1, 0},
-    {0x23, (uint8_t[]){0x46}, 1, 0},
-    {0x24, (uint8_t[]){0x46}, 1, 0},
-    {0x25, (uint8_t[]){0x44}, 1, 0},
-    {0x26, (uint8_t[]){0x44}, 1, 0},
-    {0x27, (uint8_t[]){0x4A}, 1, 0},
-    {0x28, (uint8_t[]){0x4A}, 1, 0},
-    {0x29, (uint8_t[]){0x48}, 1, 0},
-    {0x2A, (uint8_t[]){0x48}, 1, 0},
-    {0x2B, (uint8_t[]){0x5F}, 1, 0},
-
-    {0x2C, (uint8_t[]){0x01}, 1, 0},
-    {0x2D, (uint8_t[]){0x01}, 1, 0},
-    {0x2E, (uint8_t[]){0x00}, 1, 0},
-    {0x2F, (uint8_t[]){0x00}, 1, 0},
-    {0x30, (uint8_t[]){0x1F}, 1, 0},
-    {0x31, (uint8_t[]){0x1F}, 1, 0},
-    {0x32, (uint8_t[]){0x1E}, 1, 0},
-    {0x33, (uint8_t[]){0x1E}, 1, 0},
-    {0x34, (uint8_t[]){0x1F}, 1, 0},
-    {0x35, (uint8_t[]){0x17}, 1, 0},
-    {0x36, (uint8_t[]){0x17}, 1, 0},
-    {0x37, (uint8_t[]){0x37}, 1, 0},
-    {0x38, (uint8_t[]){0x37}, 1, 0},
-    {0x39, (uint8_t[]){0x08}, 1, 0},
-    {0x3A, (uint8_t[]){0x08}, 1, 0},
-    {0x3B, (uint8_t[]){0x0A}, 1, 0},
-    {0x3C, (uint8_t[]){0x0A}, 1, 0},
-    {0x3D, (uint8_t[]){0x04}, 1, 0},
-    {0x3E, (uint8_t[]){0x04}, 1, 0},
-    {0x3F, (uint8_t[]){0x06}, 1, 0},
-    {0x40, (uint8_t[]){0x06}, 1, 0},
-    {0x41, (uint8_t[]){0x1F}, 1, 0},
-
-    {0x42, (uint8_t[]){0x02}, 1, 0},
-    {0x43, (uint8_t[]){0x02}, 1, 0},
-    {0x44, (uint8_t[]){0x00}, 1, 0},
-    {0x45, (uint8_t[]){0x00}, 1, 0},
-    {0x46, (uint8_t[]){0x1F}, 1, 0},
-    {0x47, (uint8_t[]){0x1F}, 1, 0},
-    {0x48, (uint8_t[]){0x1E}, 1, 0},
-    {0x49, (uint8_t[]){0x1E}, 1, 0},
-    {0x4A, (uint8_t[]){0x1F}, 1, 0},
-    {0x4B, (uint8_t[]){0x17}, 1, 0},
-    {0x4C, (uint8_t[]){0x17}, 1, 0},
-    {0x4D, (uint8_t[]){0x37}, 1, 0},
-    {0x4E, (uint8_t[]){0x37}, 1, 0},
-    {0x4F, (uint8_t[]){0x09}, 1, 0},
-    {0x50, (uint8_t[]){0x09}, 1, 0},
-    {0x51, (uint8_t[]){0x0B}, 1, 0},
-    {0x52, (uint8_t[]){0x0B}, 1, 0},
-    {0x53, (uint8_t[]){0x05}, 1, 0},
-    {0x54, (uint8_t[]){0x05}, 1, 0},
-    {0x55, (uint8_t[]){0x07}, 1, 0},
-    {0x56, (uint8_t[]){0x07}, 1, 0},
-    {0x57, (uint8_t[]){0x1F}, 1, 0},
-
-    {0x58, (uint8_t[]){0x40}, 1, 0},
-    {0x5B, (uint8_t[]){0x30}, 1, 0},
-    {0x5C, (uint8_t[]){0x00}, 1, 0},
-    {0x5D, (uint8_t[]){0x34}, 1, 0},
-    {0x5E, (uint8_t[]){0x05}, 1, 0},
-    {0x5F, (uint8_t[]){0x02}, 1, 0},
-    {0x63, (uint8_t[]){0x00}, 1, 0},
-    {0x64, (uint8_t[]){0x6A}, 1, 0},
-    {0x67, (uint8_t[]){0x73}, 1, 0},
-    {0x68, (uint8_t[]){0x07}, 1, 0},
-    {0x69, (uint8_t[]){0x08}, 1, 0},
-    {0x6A, (uint8_t[]){0x6A}, 1, 0},
-    {0x6B, (uint8_t[]){0x08}, 1, 0},
-
-    {0x6C, (uint8_t[]){0x00}, 1, 0},
-    {0x6D, (uint8_t[]){0x00}, 1, 0},
-    {0x6E, (uint8_t[]){0x00}, 1, 0},
-    {0x6F, (uint8_t[]){0x88}, 1, 0},
-
-    {0x75, (uint8_t[]){0xFF}, 1, 0},
-    {0x77, (uint8_t[]){0xDD}, 1, 0},
-    {0x78, (uint8_t[]){0x2C}, 1, 0},
-    {0x79, (uint8_t[]){0x15}, 1, 0},
-    {0x7A, (uint8_t[]){0x17}, 1, 0},
-    {0x7D, (uint8_t[]){0x14}, 1, 0},
-    {0x7E, (uint8_t[]){0x82}, 1, 0},
-
-    {0xE0, (uint8_t[]){0x04}, 1, 0},
-    {0x00, (uint8_t[]){0x0E}, 1, 0},
-    {0x02, (uint8_t[]){0xB3}, 1, 0},
-    {0x09, (uint8_t[]){0x61}, 1, 0},
-    {0x0E, (uint8_t[]){0x48}, 1, 0},
-
-    {0x37, (uint8_t[]){0x58}, 1, 0},
-    {0x2B, (uint8_t[]){0x0F}, 1, 0},
-
-    {0xE0, (uint8_t[]){0x00}, 1, 0},
-
-    {0xE6, (uint8_t[]){0x02}, 1, 0},
-    {0xE7, (uint8_t[]){0x0C}, 1, 0},
-
-    {0x11, (uint8_t[]){0x00}, 1, 120},
-
-    {0x29, (uint8_t[]){0x00}, 1, 20},
+    ESP_PANEL_INIT_SEQ_CMD(0x55, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x57, 0x69),
+    ESP_PANEL_INIT_SEQ_CMD(0x59, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0x5A, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0x5B, 0x17),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x5D, 0x7F),
+    ESP_PANEL_INIT_SEQ_CMD(0x5E, 0x6A),
+    ESP_PANEL_INIT_SEQ_CMD(0x5F, 0x5B),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x4F),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x4A),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x3D),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x43),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x62),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x52),
+    ESP_PANEL_INIT_SEQ_CMD(0x6A, 0x59),
+    ESP_PANEL_INIT_SEQ_CMD(0x6B, 0x4C),
+    ESP_PANEL_INIT_SEQ_CMD(0x6C, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0x6D, 0x3A),
+    ESP_PANEL_INIT_SEQ_CMD(0x6E, 0x26),
+    ESP_PANEL_INIT_SEQ_CMD(0x6F, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x70, 0x7F),
+    ESP_PANEL_INIT_SEQ_CMD(0x71, 0x6A),
+    ESP_PANEL_INIT_SEQ_CMD(0x72, 0x5B),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x4F),
+    ESP_PANEL_INIT_SEQ_CMD(0x74, 0x4A),
+    ESP_PANEL_INIT_SEQ_CMD(0x75, 0x3D),
+    ESP_PANEL_INIT_SEQ_CMD(0x76, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0x77, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0x78, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x79, 0x43),
+    ESP_PANEL_INIT_SEQ_CMD(0x7A, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x7B, 0x62),
+    ESP_PANEL_INIT_SEQ_CMD(0x7C, 0x52),
+    ESP_PANEL_INIT_SEQ_CMD(0x7D, 0x59),
+    ESP_PANEL_INIT_SEQ_CMD(0x7E, 0x4C),
+    ESP_PANEL_INIT_SEQ_CMD(0x7F, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x3A),
+    ESP_PANEL_INIT_SEQ_CMD(0x81, 0x26),
+    ESP_PANEL_INIT_SEQ_CMD(0x82, 0x00),
+
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x5E),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x5E),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x57),
+    ESP_PANEL_INIT_SEQ_CMD(0x0A, 0x57),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0x77),
+    ESP_PANEL_INIT_SEQ_CMD(0x0C, 0x77),
+    ESP_PANEL_INIT_SEQ_CMD(0x0D, 0x47),
+    ESP_PANEL_INIT_SEQ_CMD(0x0E, 0x47),
+    ESP_PANEL_INIT_SEQ_CMD(0x0F, 0x45),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x45),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x4B),
+    ESP_PANEL_INIT_SEQ_CMD(0x12, 0x4B),
+    ESP_PANEL_INIT_SEQ_CMD(0x13, 0x49),
+    ESP_PANEL_INIT_SEQ_CMD(0x14, 0x49),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0x5F),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0x17, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x19, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x1A, 0x5E),
+    ESP_PANEL_INIT_SEQ_CMD(0x1B, 0x5E),
+    ESP_PANEL_INIT_SEQ_CMD(0x1C, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0x1D, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0x1E, 0x5F),
+    ESP_PANEL_INIT_SEQ_CMD(0x1F, 0x57),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x57),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x77),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x77),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x46),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x46),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x4A),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x4A),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x5F),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x2C, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x2D, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x2E, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2F, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x32, 0x1E),
+    ESP_PANEL_INIT_SEQ_CMD(0x33, 0x1E),
+    ESP_PANEL_INIT_SEQ_CMD(0x34, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x36, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0x37),
+    ESP_PANEL_INIT_SEQ_CMD(0x38, 0x37),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x3A, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x3B, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0x3C, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0x3D, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x3E, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x3F, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x40, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x41, 0x1F),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x42, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x43, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x44, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x45, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x46, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x47, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x48, 0x1E),
+    ESP_PANEL_INIT_SEQ_CMD(0x49, 0x1E),
+    ESP_PANEL_INIT_SEQ_CMD(0x4A, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0x4B, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x4C, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x4D, 0x37),
+    ESP_PANEL_INIT_SEQ_CMD(0x4E, 0x37),
+    ESP_PANEL_INIT_SEQ_CMD(0x4F, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x50, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x51, 0x0B),
+    ESP_PANEL_INIT_SEQ_CMD(0x52, 0x0B),
+    ESP_PANEL_INIT_SEQ_CMD(0x53, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0x54, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0x55, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x56, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x57, 0x1F),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x58, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x5B, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0x5C, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x5D, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x5E, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0x5F, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x6A),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x73),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x6A, 0x6A),
+    ESP_PANEL_INIT_SEQ_CMD(0x6B, 0x08),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x6C, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x6D, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x6E, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x6F, 0x88),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x75, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0x77, 0xDD),
+    ESP_PANEL_INIT_SEQ_CMD(0x78, 0x2C),
+    ESP_PANEL_INIT_SEQ_CMD(0x79, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0x7A, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x7D, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0x7E, 0x82),
+
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0xB3),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x61),
+    ESP_PANEL_INIT_SEQ_CMD(0x0E, 0x48),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0x58),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x0F),
+
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x00),
+
+    ESP_PANEL_INIT_SEQ_CMD(0xE6, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xE7, 0x0C),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x00), ESP_PANEL_INIT_SEQ_DELAY(120),
+
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x00), ESP_PANEL_INIT_SEQ_DELAY(20),
 };
 
 static esp_err_t panel_jd9365_del(esp_lcd_panel_t *panel)
@@ -396,8 +396,8 @@ static esp_err_t panel_jd9365_init(esp_lcd_panel_t *panel)
 {
     jd9365_panel_t *jd9365 = (jd9365_panel_t *)panel->user_data;
     esp_lcd_panel_io_handle_t io = jd9365->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     uint8_t lane_command = JD9365_DSI_2_LANE;
     bool is_user_set = true;
     bool is_cmd_overwritten = false;
@@ -443,24 +443,23 @@ static esp_err_t panel_jd9365_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (jd9365->init_cmds) {
-        init_cmds = jd9365->init_cmds;
-        init_cmds_size = jd9365->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, jd9365->init_cmds, jd9365->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        if (is_user_set && (init_cmds[i].data_bytes > 0)) {
-            switch (init_cmds[i].cmd) {
+        if (is_user_set && (init_cmd.data_bytes > 0)) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                jd9365->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                jd9365->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             case LCD_CMD_COLMOD:
                 is_cmd_overwritten = true;
-                jd9365->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+                jd9365->colmod_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -470,19 +469,22 @@ static esp_err_t panel_jd9365_init(esp_lcd_panel_t *panel)
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
                 ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
-                         init_cmds[i].cmd);
+                         init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
 
         // Check if the current cmd is the "page set" cmd
-        if ((init_cmds[i].cmd == JD9365_CMD_PAGE) && (init_cmds[i].data_bytes > 0)) {
-            is_user_set = (((uint8_t *)init_cmds[i].data)[0] == JD9365_PAGE_USER);
+        if ((init_cmd.cmd == JD9365_CMD_PAGE) && (init_cmd.data_bytes > 0)) {
+            is_user_set = (((uint8_t *)init_cmd.data)[0] == JD9365_PAGE_USER);
         }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(jd9365->init(panel), TAG, "init MIPI DPI panel failed");
@@ -45,6 +45,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
 } nv3022b_panel_t;
 
 esp_err_t esp_lcd_new_panel_nv3022b(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
@@ -116,6 +117,7 @@ esp_err_t esp_lcd_new_panel_nv3022b(const esp_lcd_panel_io_handle_t io, const es
     if (panel_dev_config->vendor_config) {
         nv3022b->init_cmds = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         nv3022b->init_cmds_size = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        nv3022b->window_cache = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->window_cache;
     }
     nv3022b->base.del = panel_nv3022b_del;
     nv3022b->base.reset = panel_nv3022b_reset;
@@ -163,6 +165,7 @@ static esp_err_t panel_nv3022b_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_nv3022b_reset(esp_lcd_panel_t *panel)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
+    esp_panel_window_cache_invalidate(nv3022b->window_cache);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
 
     // perform hardware reset
@@ -179,46 +182,47 @@ static esp_err_t panel_nv3022b_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0xfd, (uint8_t []){0x06, 0x08}, 2, 0},
-    {0x61, (uint8_t []){0x07, 0x07}, 2, 0},
-    {0x73, (uint8_t []){0x70}, 1, 0},
-    {0x73, (uint8_t []){0x00}, 1, 0},
-    {0x62, (uint8_t []){0x00, 0x44, 0x40}, 3, 0},
-    {0x65, (uint8_t []){0x08, 0x10, 0x21}, 3, 0},
-    {0x66, (uint8_t []){0x08, 0x10, 0x21}, 3, 0},
-    {0x67, (uint8_t []){0x21, 0x40}, 2, 0},
-    {0x68, (uint8_t []){0x9f, 0x30, 0x27, 0x21}, 4, 0},
-    {0xb1, (uint8_t []){0x0f, 0x02, 0x01}, 3, 0},
-    {0xb4, (uint8_t []){0x01}, 1, 0},
-    {0xb5, (uint8_t []){0x02, 0x02, 0x0a, 0x14}, 4, 0},
-    {0xb6, (uint8_t []){0x44, 0x01, 0x9f, 0x00, 0x02}, 5, 0},
-    {0xe6, (uint8_t []){0x00, 0xff}, 2, 0},
-    {0xe7, (uint8_t []){0x01, 0x04, 0x03, 0x03, 0x00, 0x12}, 6, 0},
-    {0xe8, (uint8_t []){0x00, 0x70, 0x00}, 3, 0},
-    {0xec, (uint8_t []){0x52}, 1, 0},
-    {0xdf, (uint8_t []){0x11}, 1, 0},
-    {0xe0, (uint8_t []){0x06, 0x05, 0x0b, 0x12, 0x10, 0x10, 0x10, 0x15}, 8, 0},
-    {0xe3, (uint8_t []){0x15, 0x10, 0x11, 0x0e, 0x12, 0x0d, 0x06, 0x06}, 8, 0},
-    {0xe1, (uint8_t []){0x35, 0x75}, 2, 0},
-    {0xe4, (uint8_t []){0x74, 0x35}, 2, 0},
-    {0xe2, (uint8_t []){0x22, 0x22, 0x21, 0x35, 0x36, 0x3f}, 6, 0},
-    {0xe5, (uint8_t []){0x3f, 0x35, 0x34, 0x21, 0x22, 0x22}, 6, 0},
-    {0xf1, (uint8_t []){0x01, 0x01, 0x02}, 3, 0},
-    {0xf6, (uint8_t []){0x09, 0x30, 0x00, 0x00}, 4, 0},
-    {0xfd, (uint8_t []){0xfa, 0xfc}, 2, 0},
-    {0x35, (uint8_t []){0x00}, 1, 0},
-    {0x11, (uint8_t []){0x00}, 0, 200},
-    {0x2a, (uint8_t []){0x00, 0x00, 0x00, 0xef}, 4, 0},
-    {0x2b, (uint8_t []){0x00, 0x00, 0x01, 0x1b}, 4, 0},
-    {0x29, (uint8_t []){0}, 0, 10},
-    {0x2c, (uint8_t []){0}, 0, 0},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0xfd, 0x06, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x07, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x70),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x00, 0x44, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x08, 0x10, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x08, 0x10, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x21, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x9f, 0x30, 0x27, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0xb1, 0x0f, 0x02, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xb4, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xb5, 0x02, 0x02, 0x0a, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0xb6, 0x44, 0x01, 0x9f, 0x00, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xe6, 0x00, 0xff),
+    ESP_PANEL_INIT_SEQ_CMD(0xe7, 0x01, 0x04, 0x03, 0x03, 0x00, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0xe8, 0x00, 0x70, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xec, 0x52),
+    ESP_PANEL_INIT_SEQ_CMD(0xdf, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xe0, 0x06, 0x05, 0x0b, 0x12, 0x10, 0x10, 0x10, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0xe3, 0x15, 0x10, 0x11, 0x0e, 0x12, 0x0d, 0x06, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0xe1, 0x35, 0x75),
+    ESP_PANEL_INIT_SEQ_CMD(0xe4, 0x74, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0xe2, 0x22, 0x22, 0x21, 0x35, 0x36, 0x3f),
+    ESP_PANEL_INIT_SEQ_CMD(0xe5, 0x3f, 0x35, 0x34, 0x21, 0x22, 0x22),
+    ESP_PANEL_INIT_SEQ_CMD(0xf1, 0x01, 0x01, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xf6, 0x09, 0x30, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xfd, 0xfa, 0xfc),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(200),
+    ESP_PANEL_INIT_SEQ_CMD(0x2a, 0x00, 0x00, 0x00, 0xef),
+    ESP_PANEL_INIT_SEQ_CMD(0x2b, 0x00, 0x00, 0x01, 0x1b),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x29), ESP_PANEL_INIT_SEQ_DELAY(10),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x2c),
 };
 
 static esp_err_t panel_nv3022b_init(esp_lcd_panel_t *panel)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
+    esp_panel_window_cache_invalidate(nv3022b->window_cache);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
@@ -231,27 +235,27 @@ static esp_err_t panel_nv3022b_init(esp_lcd_panel_t *panel)
         nv3022b->colmod_val,
     }, 1), TAG, "send command failed");
 
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     if (nv3022b->init_cmds) {
-        init_cmds = nv3022b->init_cmds;
-        init_cmds_size = nv3022b->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, nv3022b->init_cmds, nv3022b->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
     bool is_cmd_overwritten = false;
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            nv3022b->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            nv3022b->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            nv3022b->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            nv3022b->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -259,12 +263,15 @@ static esp_err_t panel_nv3022b_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -281,19 +288,23 @@ static esp_err_t panel_nv3022b_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     y_start += nv3022b->y_gap;
     y_end += nv3022b->y_gap;
 
-    // define an area of frame memory where MCU can access
-    esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4);
-    esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4);
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(nv3022b->window_cache, x_start, x_end - 1)) {
+        esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4);
+    }
+    if (esp_panel_window_cache_check_row(nv3022b->window_cache, y_start, y_end - 1)) {
+        esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4);
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * nv3022b->fb_bits_per_pixel / 8;
     esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len);
@@ -318,6 +329,7 @@ static esp_err_t panel_nv3022b_invert_color(esp_lcd_panel_t *panel, bool invert_
 static esp_err_t panel_nv3022b_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
+    esp_panel_window_cache_invalidate(nv3022b->window_cache);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
     if (mirror_x) {
         nv3022b->madctl_val |= LCD_CMD_MX_BIT;
@@ -338,6 +350,7 @@ static esp_err_t panel_nv3022b_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 static esp_err_t panel_nv3022b_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
+    esp_panel_window_cache_invalidate(nv3022b->window_cache);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
     if (swap_axes) {
         nv3022b->madctl_val |= LCD_CMD_MV_BIT;
@@ -353,6 +366,7 @@ static esp_err_t panel_nv3022b_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_nv3022b_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
+    esp_panel_window_cache_invalidate(nv3022b->window_cache);
     nv3022b->x_gap = x_gap;
     nv3022b->y_gap = y_gap;
     return ESP_OK;
@@ -361,6 +375,7 @@ static esp_err_t panel_nv3022b_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_
 static esp_err_t panel_nv3022b_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     nv3022b_panel_t *nv3022b = __containerof(panel, nv3022b_panel_t, base);
+    esp_panel_window_cache_invalidate(nv3022b->window_cache);
     esp_lcd_panel_io_handle_t io = nv3022b->io;
     int command = 0;
 
@@ -49,6 +49,7 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -113,6 +114,7 @@ esp_err_t esp_lcd_new_panel_sh8601(const esp_lcd_panel_io_handle_t io, const esp
     if (vendor_config) {
         sh8601->init_cmds = vendor_config->init_cmds;
         sh8601->init_cmds_size = vendor_config->init_cmds_size;
+        sh8601->window_cache = vendor_config->window_cache;
         sh8601->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     sh8601->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -178,6 +180,7 @@ static esp_err_t panel_sh8601_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_sh8601_reset(esp_lcd_panel_t *panel)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    esp_panel_window_cache_invalidate(sh8601->window_cache);
     esp_lcd_panel_io_handle_t io = sh8601->io;
 
     // Perform hardware reset
@@ -194,19 +197,20 @@ static esp_err_t panel_sh8601_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0x44, (uint8_t []){0x00, 0xc8}, 2, 0},
-    {0x35, (uint8_t []){0x00}, 0, 0},
-    {0x53, (uint8_t []){0x20}, 1, 25},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0x44, 0x00, 0xc8),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0x53, 0x20), ESP_PANEL_INIT_SEQ_DELAY(25),
 };
 
 static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    esp_panel_window_cache_invalidate(sh8601->window_cache);
     esp_lcd_panel_io_handle_t io = sh8601->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     bool is_cmd_overwritten = false;
 
     ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_MADCTL, (uint8_t[]) {
@@ -219,23 +223,22 @@ static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (sh8601->init_cmds) {
-        init_cmds = sh8601->init_cmds;
-        init_cmds_size = sh8601->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, sh8601->init_cmds, sh8601->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            sh8601->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            sh8601->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            sh8601->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            sh8601->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -243,13 +246,16 @@ static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(tx_param(sh8601, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG,
+        ESP_RETURN_ON_ERROR(tx_param(sh8601, io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG,
                             "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -260,30 +266,39 @@ static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = sh8601->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += sh8601->x_gap;
     x_end += sh8601->x_gap;
     y_start += sh8601->y_gap;
     y_end += sh8601->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(sh8601->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(sh8601, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(sh8601->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(sh8601, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * sh8601->fb_bits_per_pixel / 8;
     tx_color(sh8601, io, LCD_CMD_RAMWR, color_data, len);
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(sh8601->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_sh8601_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -303,6 +318,7 @@ static esp_err_t panel_sh8601_invert_color(esp_lcd_panel_t *panel, bool invert_c
 static esp_err_t panel_sh8601_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    esp_panel_window_cache_invalidate(sh8601->window_cache);
     esp_lcd_panel_io_handle_t io = sh8601->io;
     esp_err_t ret = ESP_OK;
 
@@ -330,6 +346,7 @@ static esp_err_t panel_sh8601_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_sh8601_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    esp_panel_window_cache_invalidate(sh8601->window_cache);
     sh8601->x_gap = x_gap;
     sh8601->y_gap = y_gap;
     return ESP_OK;
@@ -338,6 +355,7 @@ static esp_err_t panel_sh8601_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_g
 static esp_err_t panel_sh8601_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     sh8601_panel_t *sh8601 = __containerof(panel, sh8601_panel_t, base);
+    esp_panel_window_cache_invalidate(sh8601->window_cache);
     esp_lcd_panel_io_handle_t io = sh8601->io;
     int command = 0;
 
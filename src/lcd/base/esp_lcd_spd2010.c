@@ -54,6 +54,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -118,6 +119,7 @@ esp_err_t esp_lcd_new_panel_spd2010(const esp_lcd_panel_io_handle_t io, const es
     if (vendor_config) {
         spd2010->init_cmds = vendor_config->init_cmds;
         spd2010->init_cmds_size = vendor_config->init_cmds_size;
+        spd2010->window_cache = vendor_config->window_cache;
         spd2010->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     spd2010->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -183,6 +185,7 @@ static esp_err_t panel_spd2010_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_spd2010_reset(esp_lcd_panel_t *panel)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
+    esp_panel_window_cache_invalidate(spd2010->window_cache);
     esp_lcd_panel_io_handle_t io = spd2010->io;
 
     // Perform hardware reset
@@ -199,418 +202,419 @@ static esp_err_t panel_spd2010_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0xFF, (uint8_t []){0x20, 0x10, 0x10}, 3, 0},
-    {0x0C, (uint8_t []){0x11}, 1, 0},
-    {0x10, (uint8_t []){0x02}, 1, 0},
-    {0x11, (uint8_t []){0x11}, 1, 0},
-    {0x15, (uint8_t []){0x42}, 1, 0},
-    {0x16, (uint8_t []){0x11}, 1, 0},
-    {0x1A, (uint8_t []){0x02}, 1, 0},
-    {0x1B, (uint8_t []){0x11}, 1, 0},
-    {0x61, (uint8_t []){0x80}, 1, 0},
-    {0x62, (uint8_t []){0x80}, 1, 0},
-    {0x54, (uint8_t []){0x44}, 1, 0},
-    {0x58, (uint8_t []){0x88}, 1, 0},
-    {0x5C, (uint8_t []){0xcc}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x10}, 3, 0},
-    {0x20, (uint8_t []){0x80}, 1, 0},
-    {0x21, (uint8_t []){0x81}, 1, 0},
-    {0x22, (uint8_t []){0x31}, 1, 0},
-    {0x23, (uint8_t []){0x20}, 1, 0},
-    {0x24, (uint8_t []){0x11}, 1, 0},
-    {0x25, (uint8_t []){0x11}, 1, 0},
-    {0x26, (uint8_t []){0x12}, 1, 0},
-    {0x27, (uint8_t []){0x12}, 1, 0},
-    {0x30, (uint8_t []){0x80}, 1, 0},
-    {0x31, (uint8_t []){0x81}, 1, 0},
-    {0x32, (uint8_t []){0x31}, 1, 0},
-    {0x33, (uint8_t []){0x20}, 1, 0},
-    {0x34, (uint8_t []){0x11}, 1, 0},
-    {0x35, (uint8_t []){0x11}, 1, 0},
-    {0x36, (uint8_t []){0x12}, 1, 0},
-    {0x37, (uint8_t []){0x12}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x10}, 3, 0},
-    {0x41, (uint8_t []){0x11}, 1, 0},
-    {0x42, (uint8_t []){0x22}, 1, 0},
-    {0x43, (uint8_t []){0x33}, 1, 0},
-    {0x49, (uint8_t []){0x11}, 1, 0},
-    {0x4A, (uint8_t []){0x22}, 1, 0},
-    {0x4B, (uint8_t []){0x33}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x15}, 3, 0},
-    {0x00, (uint8_t []){0x00}, 1, 0},
-    {0x01, (uint8_t []){0x00}, 1, 0},
-    {0x02, (uint8_t []){0x00}, 1, 0},
-    {0x03, (uint8_t []){0x00}, 1, 0},
-    {0x04, (uint8_t []){0x10}, 1, 0},
-    {0x05, (uint8_t []){0x0C}, 1, 0},
-    {0x06, (uint8_t []){0x23}, 1, 0},
-    {0x07, (uint8_t []){0x22}, 1, 0},
-    {0x08, (uint8_t []){0x21}, 1, 0},
-    {0x09, (uint8_t []){0x20}, 1, 0},
-    {0x0A, (uint8_t []){0x33}, 1, 0},
-    {0x0B, (uint8_t []){0x32}, 1, 0},
-    {0x0C, (uint8_t []){0x34}, 1, 0},
-    {0x0D, (uint8_t []){0x35}, 1, 0},
-    {0x0E, (uint8_t []){0x01}, 1, 0},
-    {0x0F, (uint8_t []){0x01}, 1, 0},
-    {0x20, (uint8_t []){0x00}, 1, 0},
-    {0x21, (uint8_t []){0x00}, 1, 0},
-    {0x22, (uint8_t []){0x00}, 1, 0},
-    {0x23, (uint8_t []){0x00}, 1, 0},
-    {0x24, (uint8_t []){0x0C}, 1, 0},
-    {0x25, (uint8_t []){0x10}, 1, 0},
-    {0x26, (uint8_t []){0x20}, 1, 0},
-    {0x27, (uint8_t []){0x21}, 1, 0},
-    {0x28, (uint8_t []){0x22}, 1, 0},
-    {0x29, (uint8_t []){0x23}, 1, 0},
-    {0x2A, (uint8_t []){0x33}, 1, 0},
-    {0x2B, (uint8_t []){0x32}, 1, 0},
-    {0x2C, (uint8_t []){0x34}, 1, 0},
-    {0x2D, (uint8_t []){0x35}, 1, 0},
-    {0x2E, (uint8_t []){0x01}, 1, 0},
-    {0x2F, (uint8_t []){0x01}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x16}, 3, 0},
-    {0x00, (uint8_t []){0x00}, 1, 0},
-    {0x01, (uint8_t []){0x00}, 1, 0},
-    {0x02, (uint8_t []){0x00}, 1, 0},
-    {0x03, (uint8_t []){0x00}, 1, 0},
-    {0x04, (uint8_t []){0x08}, 1, 0},
-    {0x05, (uint8_t []){0x04}, 1, 0},
-    {0x06, (uint8_t []){0x19}, 1, 0},
-    {0x07, (uint8_t []){0x18}, 1, 0},
-    {0x08, (uint8_t []){0x17}, 1, 0},
-    {0x09, (uint8_t []){0x16}, 1, 0},
-    {0x0A, (uint8_t []){0x33}, 1, 0},
-    {0x0B, (uint8_t []){0x32}, 1, 0},
-    {0x0C, (uint8_t []){0x34}, 1, 0},
-    {0x0D, (uint8_t []){0x35}, 1, 0},
-    {0x0E, (uint8_t []){0x01}, 1, 0},
-    {0x0F, (uint8_t []){0x01}, 1, 0},
-    {0x20, (uint8_t []){0x00}, 1, 0},
-    {0x21, (uint8_t []){0x00}, 1, 0},
-    {0x22, (uint8_t []){0x00}, 1, 0},
-    {0x23, (uint8_t []){0x00}, 1, 0},
-    {0x24, (uint8_t []){0x04}, 1, 0},
-    {0x25, (uint8_t []){0x08}, 1, 0},
-    {0x26, (uint8_t []){0x16}, 1, 0},
-    {0x27, (uint8_t []){0x17}, 1, 0},
-    {0x28, (uint8_t []){0x18}, 1, 0},
-    {0x29, (uint8_t []){0x19}, 1, 0},
-    {0x2A, (uint8_t []){0x33}, 1, 0},
-    {0x2B, (uint8_t []){0x32}, 1, 0},
-    {0x2C, (uint8_t []){0x34}, 1, 0},
-    {0x2D, (uint8_t []){0x35}, 1, 0},
-    {0x2E, (uint8_t []){0x01}, 1, 0},
-    {0x2F, (uint8_t []){0x01}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x00, (uint8_t []){0x99}, 1, 0},
-    {0x2A, (uint8_t []){0x28}, 1, 0},
-    {0x2B, (uint8_t []){0x0f}, 1, 0},
-    {0x2C, (uint8_t []){0x16}, 1, 0},
-    {0x2D, (uint8_t []){0x28}, 1, 0},
-    {0x2E, (uint8_t []){0x0f}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0xA0}, 3, 0},
-    {0x08, (uint8_t []){0xdc}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x45}, 3, 0},
-    {0x01, (uint8_t []){0x9C}, 1, 0},
-    {0x03, (uint8_t []){0x9C}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x42}, 3, 0},
-    {0x05, (uint8_t []){0x2c}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x11}, 3, 0},
-    {0x50, (uint8_t []){0x01}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0x2A, (uint8_t []){0x00, 0x00, 0x01, 0x9B}, 4, 0},
-    {0x2B, (uint8_t []){0x00, 0x00, 0x01, 0x9B}, 4, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x40}, 3, 0},
-    {0x86, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x0D, (uint8_t []){0x66}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x17}, 3, 0},
-    {0x39, (uint8_t []){0x3c}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x31}, 3, 0},
-    {0x38, (uint8_t []){0x03}, 1, 0},
-    {0x39, (uint8_t []){0xf0}, 1, 0},
-    {0x36, (uint8_t []){0x03}, 1, 0},
-    {0x37, (uint8_t []){0xe8}, 1, 0},
-    {0x34, (uint8_t []){0x03}, 1, 0},
-    {0x35, (uint8_t []){0xCF}, 1, 0},
-    {0x32, (uint8_t []){0x03}, 1, 0},
-    {0x33, (uint8_t []){0xBA}, 1, 0},
-    {0x30, (uint8_t []){0x03}, 1, 0},
-    {0x31, (uint8_t []){0xA2}, 1, 0},
-    {0x2e, (uint8_t []){0x03}, 1, 0},
-    {0x2f, (uint8_t []){0x95}, 1, 0},
-    {0x2c, (uint8_t []){0x03}, 1, 0},
-    {0x2d, (uint8_t []){0x7e}, 1, 0},
-    {0x2a, (uint8_t []){0x03}, 1, 0},
-    {0x2b, (uint8_t []){0x62}, 1, 0},
-    {0x28, (uint8_t []){0x03}, 1, 0},
-    {0x29, (uint8_t []){0x44}, 1, 0},
-    {0x26, (uint8_t []){0x02}, 1, 0},
-    {0x27, (uint8_t []){0xfc}, 1, 0},
-    {0x24, (uint8_t []){0x02}, 1, 0},
-    {0x25, (uint8_t []){0xd0}, 1, 0},
-    {0x22, (uint8_t []){0x02}, 1, 0},
-    {0x23, (uint8_t []){0x98}, 1, 0},
-    {0x20, (uint8_t []){0x02}, 1, 0},
-    {0x21, (uint8_t []){0x6f}, 1, 0},
-    {0x1e, (uint8_t []){0x02}, 1, 0},
-    {0x1f, (uint8_t []){0x32}, 1, 0},
-    {0x1c, (uint8_t []){0x01}, 1, 0},
-    {0x1d, (uint8_t []){0xf6}, 1, 0},
-    {0x1a, (uint8_t []){0x01}, 1, 0},
-    {0x1b, (uint8_t []){0xb8}, 1, 0},
-    {0x18, (uint8_t []){0x01}, 1, 0},
-    {0x19, (uint8_t []){0x6E}, 1, 0},
-    {0x16, (uint8_t []){0x01}, 1, 0},
-    {0x17, (uint8_t []){0x41}, 1, 0},
-    {0x14, (uint8_t []){0x00}, 1, 0},
-    {0x15, (uint8_t []){0xfd}, 1, 0},
-    {0x12, (uint8_t []){0x00}, 1, 0},
-    {0x13, (uint8_t []){0xCf}, 1, 0},
-    {0x10, (uint8_t []){0x00}, 1, 0},
-    {0x11, (uint8_t []){0x98}, 1, 0},
-    {0x0e, (uint8_t []){0x00}, 1, 0},
-    {0x0f, (uint8_t []){0x89}, 1, 0},
-    {0x0c, (uint8_t []){0x00}, 1, 0},
-    {0x0d, (uint8_t []){0x79}, 1, 0},
-    {0x0a, (uint8_t []){0x00}, 1, 0},
-    {0x0b, (uint8_t []){0x67}, 1, 0},
-    {0x08, (uint8_t []){0x00}, 1, 0},
-    {0x09, (uint8_t []){0x55}, 1, 0},
-    {0x06, (uint8_t []){0x00}, 1, 0},
-    {0x07, (uint8_t []){0x3F}, 1, 0},
-    {0x04, (uint8_t []){0x00}, 1, 0},
-    {0x05, (uint8_t []){0x28}, 1, 0},
-    {0x02, (uint8_t []){0x00}, 1, 0},
-    {0x03, (uint8_t []){0x0E}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x32}, 3, 0},
-    {0x38, (uint8_t []){0x03}, 1, 0},
-    {0x39, (uint8_t []){0xf0}, 1, 0},
-    {0x36, (uint8_t []){0x03}, 1, 0},
-    {0x37, (uint8_t []){0xe8}, 1, 0},
-    {0x34, (uint8_t []){0x03}, 1, 0},
-    {0x35, (uint8_t []){0xCF}, 1, 0},
-    {0x32, (uint8_t []){0x03}, 1, 0},
-    {0x33, (uint8_t []){0xBA}, 1, 0},
-    {0x30, (uint8_t []){0x03}, 1, 0},
-    {0x31, (uint8_t []){0xA2}, 1, 0},
-    {0x2e, (uint8_t []){0x03}, 1, 0},
-    {0x2f, (uint8_t []){0x95}, 1, 0},
-    {0x2c, (uint8_t []){0x03}, 1, 0},
-    {0x2d, (uint8_t []){0x7e}, 1, 0},
-    {0x2a, (uint8_t []){0x03}, 1, 0},
-    {0x2b, (uint8_t []){0x62}, 1, 0},
-    {0x28, (uint8_t []){0x03}, 1, 0},
-    {0x29, (uint8_t []){0x44}, 1, 0},
-    {0x26, (uint8_t []){0x02}, 1, 0},
-    {0x27, (uint8_t []){0xfc}, 1, 0},
-    {0x24, (uint8_t []){0x02}, 1, 0},
-    {0x25, (uint8_t []){0xd0}, 1, 0},
-    {0x22, (uint8_t []){0x02}, 1, 0},
-    {0x23, (uint8_t []){0x98}, 1, 0},
-    {0x20, (uint8_t []){0x02}, 1, 0},
-    {0x21, (uint8_t []){0x6f}, 1, 0},
-    {0x1e, (uint8_t []){0x02}, 1, 0},
-    {0x1f, (uint8_t []){0x32}, 1, 0},
-    {0x1c, (uint8_t []){0x01}, 1, 0},
-    {0x1d, (uint8_t []){0xf6}, 1, 0},
-    {0x1a, (uint8_t []){0x01}, 1, 0},
-    {0x1b, (uint8_t []){0xb8}, 1, 0},
-    {0x18, (uint8_t []){0x01}, 1, 0},
-    {0x19, (uint8_t []){0x6E}, 1, 0},
-    {0x16, (uint8_t []){0x01}, 1, 0},
-    {0x17, (uint8_t []){0x41}, 1, 0},
-    {0x14, (uint8_t []){0x00}, 1, 0},
-    {0x15, (uint8_t []){0xfd}, 1, 0},
-    {0x12, (uint8_t []){0x00}, 1, 0},
-    {0x13, (uint8_t []){0xCf}, 1, 0},
-    {0x10, (uint8_t []){0x00}, 1, 0},
-    {0x11, (uint8_t []){0x98}, 1, 0},
-    {0x0e, (uint8_t []){0x00}, 1, 0},
-    {0x0f, (uint8_t []){0x89}, 1, 0},
-    {0x0c, (uint8_t []){0x00}, 1, 0},
-    {0x0d, (uint8_t []){0x79}, 1, 0},
-    {0x0a, (uint8_t []){0x00}, 1, 0},
-    {0x0b, (uint8_t []){0x67}, 1, 0},
-    {0x08, (uint8_t []){0x00}, 1, 0},
-    {0x09, (uint8_t []){0x55}, 1, 0},
-    {0x06, (uint8_t []){0x00}, 1, 0},
-    {0x07, (uint8_t []){0x3F}, 1, 0},
-    {0x04, (uint8_t []){0x00}, 1, 0},
-    {0x05, (uint8_t []){0x28}, 1, 0},
-    {0x02, (uint8_t []){0x00}, 1, 0},
-    {0x03, (uint8_t []){0x0E}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x11}, 3, 0},
-    {0x60, (uint8_t []){0x01}, 1, 0},
-    {0x65, (uint8_t []){0x03}, 1, 0},
-    {0x66, (uint8_t []){0x38}, 1, 0},
-    {0x67, (uint8_t []){0x04}, 1, 0},
-    {0x68, (uint8_t []){0x34}, 1, 0},
-    {0x69, (uint8_t []){0x03}, 1, 0},
-    {0x61, (uint8_t []){0x03}, 1, 0},
-    {0x62, (uint8_t []){0x38}, 1, 0},
-    {0x63, (uint8_t []){0x04}, 1, 0},
-    {0x64, (uint8_t []){0x34}, 1, 0},
-    {0x0A, (uint8_t []){0x11}, 1, 0},
-    {0x0B, (uint8_t []){0x20}, 1, 0},
-    {0x0c, (uint8_t []){0x20}, 1, 0},
-    {0x55, (uint8_t []){0x06}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x42}, 3, 0},
-    {0x05, (uint8_t []){0x3D}, 1, 0},
-    {0x06, (uint8_t []){0x03}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x1F, (uint8_t []){0xDC}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x17}, 3, 0},
-    {0x11, (uint8_t []){0xAA}, 1, 0},
-    {0x16, (uint8_t []){0x12}, 1, 0},
-    {0x0B, (uint8_t []){0xC3}, 1, 0},
-    {0x10, (uint8_t []){0x0E}, 1, 0},
-    {0x14, (uint8_t []){0xAA}, 1, 0},
-    {0x18, (uint8_t []){0xA0}, 1, 0},
-    {0x1A, (uint8_t []){0x80}, 1, 0},
-    {0x1F, (uint8_t []){0x80}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x11}, 3, 0},
-    {0x30, (uint8_t []){0xEE}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x15, (uint8_t []){0x0F}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x2D}, 3, 0},
-    {0x01, (uint8_t []){0x3E}, 1, 0},
-    {0xff, (uint8_t []){0x20, 0x10, 0x40}, 3, 0},
-    {0x83, (uint8_t []){0xC4}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x00, (uint8_t []){0xCC}, 1, 0},
-    {0x36, (uint8_t []){0xA0}, 1, 0},
-    {0x2A, (uint8_t []){0x2D}, 1, 0},
-    {0x2B, (uint8_t []){0x1e}, 1, 0},
-    {0x2C, (uint8_t []){0x26}, 1, 0},
-    {0x2D, (uint8_t []){0x2D}, 1, 0},
-    {0x2E, (uint8_t []){0x1e}, 1, 0},
-    {0x1F, (uint8_t []){0xE6}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0xA0}, 3, 0},
-    {0x08, (uint8_t []){0xE6}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x10, (uint8_t []){0x0F}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x18}, 3, 0},
-    {0x01, (uint8_t []){0x01}, 1, 0},
-    {0x00, (uint8_t []){0x1E}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x43}, 3, 0},
-    {0x03, (uint8_t []){0x04}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x18}, 3, 0},
-    {0x3A, (uint8_t []){0x01}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x50}, 3, 0},
-    {0x05, (uint8_t []){0x08}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x50}, 3, 0},
-    {0x00, (uint8_t []){0xA6}, 1, 0},
-    {0x01, (uint8_t []){0xA6}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x50}, 3, 0},
-    {0x08, (uint8_t []){0x55}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x10}, 3, 0},
-    {0x0B, (uint8_t []){0x43}, 1, 0},
-    {0x0C, (uint8_t []){0x12}, 1, 0},
-    {0x10, (uint8_t []){0x01}, 1, 0},
-    {0x11, (uint8_t []){0x12}, 1, 0},
-    {0x15, (uint8_t []){0x00}, 1, 0},
-    {0x16, (uint8_t []){0x00}, 1, 0},
-    {0x1A, (uint8_t []){0x00}, 1, 0},
-    {0x1B, (uint8_t []){0x00}, 1, 0},
-    {0x61, (uint8_t []){0x00}, 1, 0},
-    {0x62, (uint8_t []){0x00}, 1, 0},
-    {0x51, (uint8_t []){0x11}, 1, 0},
-    {0x55, (uint8_t []){0x55}, 1, 0},
-    {0x58, (uint8_t []){0x00}, 1, 0},
-    {0x5C, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x10}, 3, 0},
-    {0x20, (uint8_t []){0x81}, 1, 0},
-    {0x21, (uint8_t []){0x82}, 1, 0},
-    {0x22, (uint8_t []){0x72}, 1, 0},
-    {0x30, (uint8_t []){0x00}, 1, 0},
-    {0x31, (uint8_t []){0x00}, 1, 0},
-    {0x32, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x10}, 3, 0},
-    {0x44, (uint8_t []){0x44}, 1, 0},
-    {0x45, (uint8_t []){0x55}, 1, 0},
-    {0x46, (uint8_t []){0x66}, 1, 0},
-    {0x47, (uint8_t []){0x77}, 1, 0},
-    {0x49, (uint8_t []){0x00}, 1, 0},
-    {0x4A, (uint8_t []){0x00}, 1, 0},
-    {0x4B, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x17}, 3, 0},
-    {0x37, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x15}, 3, 0},
-    {0x04, (uint8_t []){0x08}, 1, 0},
-    {0x05, (uint8_t []){0x04}, 1, 0},
-    {0x06, (uint8_t []){0x1C}, 1, 0},
-    {0x07, (uint8_t []){0x1A}, 1, 0},
-    {0x08, (uint8_t []){0x18}, 1, 0},
-    {0x09, (uint8_t []){0x16}, 1, 0},
-    {0x24, (uint8_t []){0x05}, 1, 0},
-    {0x25, (uint8_t []){0x09}, 1, 0},
-    {0x26, (uint8_t []){0x17}, 1, 0},
-    {0x27, (uint8_t []){0x19}, 1, 0},
-    {0x28, (uint8_t []){0x1B}, 1, 0},
-    {0x29, (uint8_t []){0x1D}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x16}, 3, 0},
-    {0x04, (uint8_t []){0x09}, 1, 0},
-    {0x05, (uint8_t []){0x05}, 1, 0},
-    {0x06, (uint8_t []){0x1D}, 1, 0},
-    {0x07, (uint8_t []){0x1B}, 1, 0},
-    {0x08, (uint8_t []){0x19}, 1, 0},
-    {0x09, (uint8_t []){0x17}, 1, 0},
-    {0x24, (uint8_t []){0x04}, 1, 0},
-    {0x25, (uint8_t []){0x08}, 1, 0},
-    {0x26, (uint8_t []){0x16}, 1, 0},
-    {0x27, (uint8_t []){0x18}, 1, 0},
-    {0x28, (uint8_t []){0x1A}, 1, 0},
-    {0x29, (uint8_t []){0x1C}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x18}, 3, 0},
-    {0x1F, (uint8_t []){0x02}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x11}, 3, 0},
-    {0x15, (uint8_t []){0x99}, 1, 0},
-    {0x16, (uint8_t []){0x99}, 1, 0},
-    {0x1C, (uint8_t []){0x88}, 1, 0},
-    {0x1D, (uint8_t []){0x88}, 1, 0},
-    {0x1E, (uint8_t []){0x88}, 1, 0},
-    {0x13, (uint8_t []){0xf0}, 1, 0},
-    {0x14, (uint8_t []){0x34}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x12, (uint8_t []){0x89}, 1, 0},
-    {0x06, (uint8_t []){0x06}, 1, 0},
-    {0x18, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x11}, 3, 0},
-    {0x0A, (uint8_t []){0x00}, 1, 0},
-    {0x0B, (uint8_t []){0xF0}, 1, 0},
-    {0x0c, (uint8_t []){0xF0}, 1, 0},
-    {0x6A, (uint8_t []){0x10}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x11}, 3, 0},
-    {0x08, (uint8_t []){0x70}, 1, 0},
-    {0x09, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0x35, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x12}, 3, 0},
-    {0x21, (uint8_t []){0x70}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x2D}, 3, 0},
-    {0x02, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x20, 0x10, 0x00}, 3, 0},
-    {0x11, (uint8_t []){0x00}, 0, 120},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x0C, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x1A, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x1B, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x54, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x58, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0x5C, 0xcc),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x81),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x31),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0x81),
+    ESP_PANEL_INIT_SEQ_CMD(0x32, 0x31),
+    ESP_PANEL_INIT_SEQ_CMD(0x33, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0x34, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x36, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x41, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x42, 0x22),
+    ESP_PANEL_INIT_SEQ_CMD(0x43, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0x49, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x4A, 0x22),
+    ESP_PANEL_INIT_SEQ_CMD(0x4B, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x0C),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x23),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x22),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0x0A, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x0C, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x0D, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0x0E, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x0F, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x0C),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x22),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x23),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x2C, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x2D, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0x2E, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x2F, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x19),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x0A, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x0C, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x0D, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0x0E, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x0F, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x19),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x2C, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x2D, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0x2E, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x2F, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x99),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x28),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x0f),
+    ESP_PANEL_INIT_SEQ_CMD(0x2C, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x2D, 0x28),
+    ESP_PANEL_INIT_SEQ_CMD(0x2E, 0x0f),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0xA0),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0xdc),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x45),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x9C),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x9C),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x2c),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x50, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x00, 0x00, 0x01, 0x9B),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x00, 0x00, 0x01, 0x9B),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x0D, 0x66),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0x3c),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x31),
+    ESP_PANEL_INIT_SEQ_CMD(0x38, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0xf0),
+    ESP_PANEL_INIT_SEQ_CMD(0x36, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0xe8),
+    ESP_PANEL_INIT_SEQ_CMD(0x34, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0xCF),
+    ESP_PANEL_INIT_SEQ_CMD(0x32, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x33, 0xBA),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0xA2),
+    ESP_PANEL_INIT_SEQ_CMD(0x2e, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2f, 0x95),
+    ESP_PANEL_INIT_SEQ_CMD(0x2c, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2d, 0x7e),
+    ESP_PANEL_INIT_SEQ_CMD(0x2a, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2b, 0x62),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0xfc),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0xd0),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x6f),
+    ESP_PANEL_INIT_SEQ_CMD(0x1e, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x1f, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x1c, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x1d, 0xf6),
+    ESP_PANEL_INIT_SEQ_CMD(0x1a, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x1b, 0xb8),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x19, 0x6E),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x17, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0x14, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0xfd),
+    ESP_PANEL_INIT_SEQ_CMD(0x12, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x13, 0xCf),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0x0e, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0f, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0x0c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0d, 0x79),
+    ESP_PANEL_INIT_SEQ_CMD(0x0a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0b, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x55),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x3F),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x28),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x38, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x39, 0xf0),
+    ESP_PANEL_INIT_SEQ_CMD(0x36, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0xe8),
+    ESP_PANEL_INIT_SEQ_CMD(0x34, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0xCF),
+    ESP_PANEL_INIT_SEQ_CMD(0x32, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x33, 0xBA),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0xA2),
+    ESP_PANEL_INIT_SEQ_CMD(0x2e, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2f, 0x95),
+    ESP_PANEL_INIT_SEQ_CMD(0x2c, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2d, 0x7e),
+    ESP_PANEL_INIT_SEQ_CMD(0x2a, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x2b, 0x62),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0xfc),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0xd0),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x23, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x6f),
+    ESP_PANEL_INIT_SEQ_CMD(0x1e, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x1f, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0x1c, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x1d, 0xf6),
+    ESP_PANEL_INIT_SEQ_CMD(0x1a, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x1b, 0xb8),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x19, 0x6E),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x17, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0x14, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0xfd),
+    ESP_PANEL_INIT_SEQ_CMD(0x12, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x13, 0xCf),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0x0e, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0f, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0x0c, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0d, 0x79),
+    ESP_PANEL_INIT_SEQ_CMD(0x0a, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0b, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x55),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x3F),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x28),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0x0A, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0x0c, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0x55, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x3D),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x1F, 0xDC),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0xAA),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0xC3),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0x14, 0xAA),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0xA0),
+    ESP_PANEL_INIT_SEQ_CMD(0x1A, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0x1F, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0xEE),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0x0F),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x2D),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x3E),
+    ESP_PANEL_INIT_SEQ_CMD(0xff, 0x20, 0x10, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x83, 0xC4),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0xCC),
+    ESP_PANEL_INIT_SEQ_CMD(0x36, 0xA0),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x2D),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x1e),
+    ESP_PANEL_INIT_SEQ_CMD(0x2C, 0x26),
+    ESP_PANEL_INIT_SEQ_CMD(0x2D, 0x2D),
+    ESP_PANEL_INIT_SEQ_CMD(0x2E, 0x1e),
+    ESP_PANEL_INIT_SEQ_CMD(0x1F, 0xE6),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0xA0),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0xE6),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x0F),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0x1E),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x43),
+    ESP_PANEL_INIT_SEQ_CMD(0x03, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x3A, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x50),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x50),
+    ESP_PANEL_INIT_SEQ_CMD(0x00, 0xA6),
+    ESP_PANEL_INIT_SEQ_CMD(0x01, 0xA6),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x50),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x55),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0x43),
+    ESP_PANEL_INIT_SEQ_CMD(0x0C, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x10, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1A, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x1B, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x51, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x55, 0x55),
+    ESP_PANEL_INIT_SEQ_CMD(0x58, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x5C, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x20, 0x81),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x82),
+    ESP_PANEL_INIT_SEQ_CMD(0x22, 0x72),
+    ESP_PANEL_INIT_SEQ_CMD(0x30, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x31, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x32, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0x45, 0x55),
+    ESP_PANEL_INIT_SEQ_CMD(0x46, 0x66),
+    ESP_PANEL_INIT_SEQ_CMD(0x47, 0x77),
+    ESP_PANEL_INIT_SEQ_CMD(0x49, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x4A, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x4B, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x37, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x15),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x1C),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x1A),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x19),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x1D),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x04, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0x05, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x1D),
+    ESP_PANEL_INIT_SEQ_CMD(0x07, 0x1B),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x19),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x17),
+    ESP_PANEL_INIT_SEQ_CMD(0x24, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x25, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x26, 0x16),
+    ESP_PANEL_INIT_SEQ_CMD(0x27, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x28, 0x1A),
+    ESP_PANEL_INIT_SEQ_CMD(0x29, 0x1C),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0x1F, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x15, 0x99),
+    ESP_PANEL_INIT_SEQ_CMD(0x16, 0x99),
+    ESP_PANEL_INIT_SEQ_CMD(0x1C, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0x1D, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0x1E, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0x13, 0xf0),
+    ESP_PANEL_INIT_SEQ_CMD(0x14, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x12, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0x06, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x18, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x0A, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x0B, 0xF0),
+    ESP_PANEL_INIT_SEQ_CMD(0x0c, 0xF0),
+    ESP_PANEL_INIT_SEQ_CMD(0x6A, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0x08, 0x70),
+    ESP_PANEL_INIT_SEQ_CMD(0x09, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x12),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x70),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x2D),
+    ESP_PANEL_INIT_SEQ_CMD(0x02, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x20, 0x10, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(120),
 };
 
 static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
+    esp_panel_window_cache_invalidate(spd2010->window_cache);
     esp_lcd_panel_io_handle_t io = spd2010->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     bool is_user_set = true;
     bool is_cmd_overwritten = false;
 
@@ -627,24 +631,23 @@ static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (spd2010->init_cmds) {
-        init_cmds = spd2010->init_cmds;
-        init_cmds_size = spd2010->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, spd2010->init_cmds, spd2010->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal only when command2 is disable
-        if (is_user_set && (init_cmds[i].data_bytes > 0)) {
-            switch (init_cmds[i].cmd) {
+        if (is_user_set && (init_cmd.data_bytes > 0)) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                spd2010->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                spd2010->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             case LCD_CMD_COLMOD:
                 is_cmd_overwritten = true;
-                spd2010->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+                spd2010->colmod_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -654,20 +657,23 @@ static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
                 ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
-                         init_cmds[i].cmd);
+                         init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(tx_param(spd2010, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG,
+        ESP_RETURN_ON_ERROR(tx_param(spd2010, io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG,
                             "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
 
         // Check if the current cmd is the "command set" cmd
-        if ((init_cmds[i].cmd == SPD2010_CMD_SET) && (init_cmds[i].data_bytes > 2)) {
-            is_user_set = (((uint8_t *)init_cmds[i].data)[2] == SPD2010_CMD_SET_USER);
+        if ((init_cmd.cmd == SPD2010_CMD_SET) && (init_cmd.data_bytes > 2)) {
+            is_user_set = (((uint8_t *)init_cmd.data)[2] == SPD2010_CMD_SET_USER);
         }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -678,30 +684,39 @@ static esp_err_t panel_spd2010_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = spd2010->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += spd2010->x_gap;
     x_end += spd2010->x_gap;
     y_start += spd2010->y_gap;
     y_end += spd2010->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(spd2010, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(spd2010->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(spd2010, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(spd2010->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(spd2010, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * spd2010->fb_bits_per_pixel / 8;
     ESP_RETURN_ON_ERROR(tx_color(spd2010, io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(spd2010->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_spd2010_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -721,6 +736,7 @@ static esp_err_t panel_spd2010_invert_color(esp_lcd_panel_t *panel, bool invert_
 static esp_err_t panel_spd2010_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
+    esp_panel_window_cache_invalidate(spd2010->window_cache);
     esp_lcd_panel_io_handle_t io = spd2010->io;
     if (mirror_x) {
         spd2010->madctl_val |= BIT(1);
@@ -747,6 +763,7 @@ static esp_err_t panel_spd2010_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_spd2010_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
+    esp_panel_window_cache_invalidate(spd2010->window_cache);
     spd2010->x_gap = x_gap;
     spd2010->y_gap = y_gap;
     return ESP_OK;
@@ -755,6 +772,7 @@ static esp_err_t panel_spd2010_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_
 static esp_err_t panel_spd2010_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     spd2010_panel_t *spd2010 = __containerof(panel, spd2010_panel_t, base);
+    esp_panel_window_cache_invalidate(spd2010->window_cache);
     esp_lcd_panel_io_handle_t io = spd2010->io;
     int command = 0;
 
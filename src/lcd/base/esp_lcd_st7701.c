@@ -182,50 +182,55 @@ err:
     return ret;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x13}, 5, 0},
-    {0xEF, (uint8_t []){0x08}, 1, 0},
-    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x10}, 5, 0},
-    {0xC0, (uint8_t []){0x3B, 0x00}, 2, 0},
-    {0xC1, (uint8_t []){0x10, 0x02}, 2, 0},
-    {0xC2, (uint8_t []){0x20, 0x06}, 2, 0},
-    {0xCC, (uint8_t []){0x10}, 1, 0},
-    {0xB0, (uint8_t []){0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF}, 16, 0},
-    {0xB1, (uint8_t []){0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF}, 16, 0},
-    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x11}, 5, 0},
-    {0xB0, (uint8_t []){0x8D}, 1, 0},
-    {0xB1, (uint8_t []){0x48}, 1, 0},
-    {0xB2, (uint8_t []){0x89}, 1, 0},
-    {0xB3, (uint8_t []){0x80}, 1, 0},
-    {0xB5, (uint8_t []){0x49}, 1, 0},
-    {0xB7, (uint8_t []){0x85}, 1, 0},
-    {0xB8, (uint8_t []){0x32}, 1, 0},
-    {0xC1, (uint8_t []){0x78}, 1, 0},
-    {0xC2, (uint8_t []){0x78}, 1, 0},
-    {0xD0, (uint8_t []){0x88}, 1, 100},
-    {0xE0, (uint8_t []){0x00, 0x00, 0x02}, 3, 0},
-    {0xE1, (uint8_t []){0x05, 0xC0, 0x07, 0xC0, 0x04, 0xC0, 0x06, 0xC0, 0x00, 0x44, 0x44}, 11, 0},
-    {0xE2, (uint8_t []){0x00, 0x00, 0x33, 0x33, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00}, 13, 0},
-    {0xE3, (uint8_t []){0x00, 0x00, 0x11, 0x11}, 4, 0},
-    {0xE4, (uint8_t []){0x44, 0x44}, 2, 0},
-    {0xE5, (uint8_t []){0x0D, 0xF1, 0x10, 0x98, 0x0F, 0xF3, 0x10, 0x98, 0x09, 0xED, 0x10, 0x98, 0x0B, 0xEF, 0x10, 0x98}, 16, 0},
-    {0xE6, (uint8_t []){0x00, 0x00, 0x11, 0x11}, 4, 0},
-    {0xE7, (uint8_t []){0x44, 0x44}, 2, 0},
-    {0xE8, (uint8_t []){0x0C, 0xF0, 0x10, 0x98, 0x0E, 0xF2, 0x10, 0x98, 0x08, 0xEC, 0x10, 0x98, 0x0A, 0xEE, 0x10, 0x98}, 16, 0},
-    {0xEB, (uint8_t []){0x00, 0x01, 0xE4, 0xE4, 0x44, 0x88, 0x00}, 7, 0},
-    {0xED, (uint8_t []){0xFF, 0x04, 0x56, 0x7F, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xF7, 0x65, 0x40, 0xFF}, 16, 0},
-    {0xEF, (uint8_t []){0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F}, 6, 0},
-    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x00}, 5, 0},
-    {0x11, (uint8_t []){0x00}, 0, 120},
-    {0x29, (uint8_t []){0x00}, 0, 0},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0xEF, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xC0, 0x3B, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x10, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x20, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0xCC, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B,
+            0x73, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B,
+            0x73, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x8D),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0xB2, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0xB3, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xB5, 0x49),
+    ESP_PANEL_INIT_SEQ_CMD(0xB7, 0x85),
+    ESP_PANEL_INIT_SEQ_CMD(0xB8, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x78),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x78),
+    ESP_PANEL_INIT_SEQ_CMD(0xD0, 0x88), ESP_PANEL_INIT_SEQ_DELAY(100),
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x00, 0x00, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xE1, 0x05, 0xC0, 0x07, 0xC0, 0x04, 0xC0, 0x06, 0xC0, 0x00, 0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0xE2, 0x00, 0x00, 0x33, 0x33, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xE3, 0x00, 0x00, 0x11, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xE4, 0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0xE5, 0x0D, 0xF1, 0x10, 0x98, 0x0F, 0xF3, 0x10, 0x98, 0x09, 0xED, 0x10, 0x98, 0x0B, 0xEF,
+            0x10, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0xE6, 0x00, 0x00, 0x11, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xE7, 0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0xE8, 0x0C, 0xF0, 0x10, 0x98, 0x0E, 0xF2, 0x10, 0x98, 0x08, 0xEC, 0x10, 0x98, 0x0A, 0xEE,
+            0x10, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0xEB, 0x00, 0x01, 0xE4, 0xE4, 0x44, 0x88, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xED, 0xFF, 0x04, 0x56, 0x7F, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xF7, 0x65,
+            0x40, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xEF, 0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(120),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x29),
 };
 
 static esp_err_t panel_st7701_send_init_cmds(st7701_panel_t *st7701)
 {
     esp_lcd_panel_io_handle_t io = st7701->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     bool is_command2_disable = true;
     bool is_cmd_overwritten = false;
 
@@ -243,24 +248,23 @@ static esp_err_t panel_st7701_send_init_cmds(st7701_panel_t *st7701)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (st7701->init_cmds) {
-        init_cmds = st7701->init_cmds;
-        init_cmds_size = st7701->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, st7701->init_cmds, st7701->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal only when command2 is disable
-        if (is_command2_disable && (init_cmds[i].data_bytes > 0)) {
-            switch (init_cmds[i].cmd) {
+        if (is_command2_disable && (init_cmd.data_bytes > 0)) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                st7701->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                st7701->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             case LCD_CMD_COLMOD:
                 is_cmd_overwritten = true;
-                st7701->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+                st7701->colmod_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -270,20 +274,23 @@ static esp_err_t panel_st7701_send_init_cmds(st7701_panel_t *st7701)
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
                 ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
-                         init_cmds[i].cmd);
+                         init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes),
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes),
                             TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
 
         // Check if the current cmd is the command2 disable cmd
-        if ((init_cmds[i].cmd == ST7701_CMD_CND2BKxSEL) && (init_cmds[i].data_bytes > 4)) {
-            is_command2_disable = !(((uint8_t *)init_cmds[i].data)[4] & ST7701_CMD_CN2_BIT);
+        if ((init_cmd.cmd == ST7701_CMD_CND2BKxSEL) && (init_cmd.data_bytes > 4)) {
+            is_command2_disable = !(((uint8_t *)init_cmd.data)[4] & ST7701_CMD_CN2_BIT);
         }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
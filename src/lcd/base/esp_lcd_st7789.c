@@ -45,6 +45,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
 } st7789_panel_t;
 
 esp_err_t esp_lcd_new_panel_st7789(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
@@ -112,6 +113,7 @@ esp_err_t esp_lcd_new_panel_st7789(const esp_lcd_panel_io_handle_t io, const esp
     if (panel_dev_config->vendor_config) {
         st7789->init_cmds = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         st7789->init_cmds_size = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        st7789->window_cache = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->window_cache;
     }
     st7789->base.del = panel_st7789_del;
     st7789->base.reset = panel_st7789_reset;
@@ -159,6 +161,7 @@ static esp_err_t panel_st7789_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_st7789_reset(esp_lcd_panel_t *panel)
 {
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
+    esp_panel_window_cache_invalidate(st7789->window_cache);
     esp_lcd_panel_io_handle_t io = st7789->io;
 
     // perform hardware reset
@@ -178,6 +181,7 @@ static esp_err_t panel_st7789_reset(esp_lcd_panel_t *panel)
 static esp_err_t panel_st7789_init(esp_lcd_panel_t *panel)
 {
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
+    esp_panel_window_cache_invalidate(st7789->window_cache);
     esp_lcd_panel_io_handle_t io = st7789->io;
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
@@ -190,27 +194,22 @@ static esp_err_t panel_st7789_init(esp_lcd_panel_t *panel)
         st7789->colmod_val,
     }, 1), TAG, "send command failed");
 
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
-    if (st7789->init_cmds) {
-        init_cmds = st7789->init_cmds;
-        init_cmds_size = st7789->init_cmds_size;
-    } else {
-        init_cmds = NULL;
-        init_cmds_size = 0;
-    }
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, st7789->init_cmds, st7789->init_cmds_size),
+                        ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
 
     bool is_cmd_overwritten = false;
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            st7789->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            st7789->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            st7789->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            st7789->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -218,12 +217,15 @@ static esp_err_t panel_st7789_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -234,30 +236,39 @@ static esp_err_t panel_st7789_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = st7789->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += st7789->x_gap;
     x_end += st7789->x_gap;
     y_start += st7789->y_gap;
     y_end += st7789->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(st7789->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(st7789->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st7789->fb_bits_per_pixel / 8;
     ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len), TAG, "send color failed");
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(st7789->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_st7789_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -277,6 +288,7 @@ static esp_err_t panel_st7789_invert_color(esp_lcd_panel_t *panel, bool invert_c
 static esp_err_t panel_st7789_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
+    esp_panel_window_cache_invalidate(st7789->window_cache);
     esp_lcd_panel_io_handle_t io = st7789->io;
     if (mirror_x) {
         st7789->madctl_val |= LCD_CMD_MX_BIT;
@@ -297,6 +309,7 @@ static esp_err_t panel_st7789_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_st7789_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
+    esp_panel_window_cache_invalidate(st7789->window_cache);
     esp_lcd_panel_io_handle_t io = st7789->io;
     if (swap_axes) {
         st7789->madctl_val |= LCD_CMD_MV_BIT;
@@ -312,6 +325,7 @@ static esp_err_t panel_st7789_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_st7789_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
+    esp_panel_window_cache_invalidate(st7789->window_cache);
     st7789->x_gap = x_gap;
     st7789->y_gap = y_gap;
     return ESP_OK;
@@ -320,6 +334,7 @@ static esp_err_t panel_st7789_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_g
 static esp_err_t panel_st7789_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     st7789_panel_t *st7789 = __containerof(panel, st7789_panel_t, base);
+    esp_panel_window_cache_invalidate(st7789->window_cache);
     esp_lcd_panel_io_handle_t io = st7789->io;
     int command = 0;
 
@@ -52,6 +52,7 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -111,6 +112,7 @@ esp_err_t esp_lcd_new_panel_st77916(const esp_lcd_panel_io_handle_t io, const es
     if (vendor_config) {
         st77916->init_cmds = vendor_config->init_cmds;
         st77916->init_cmds_size = vendor_config->init_cmds_size;
+        st77916->window_cache = vendor_config->window_cache;
         st77916->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     st77916->base.del = panel_st77916_del;
@@ -175,6 +177,7 @@ static esp_err_t panel_st77916_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_st77916_reset(esp_lcd_panel_t *panel)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
+    esp_panel_window_cache_invalidate(st77916->window_cache);
     esp_lcd_panel_io_handle_t io = st77916->io;
 
     // Perform hardware reset
@@ -191,231 +194,232 @@ static esp_err_t panel_st77916_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-    {0xF0, (uint8_t []){0x08}, 1, 0},
-    {0xF2, (uint8_t []){0x08}, 1, 0},
-    {0x9B, (uint8_t []){0x51}, 1, 0},
-    {0x86, (uint8_t []){0x53}, 1, 0},
-    {0xF2, (uint8_t []){0x80}, 1, 0},
-    {0xF0, (uint8_t []){0x00}, 1, 0},
-    {0xF0, (uint8_t []){0x01}, 1, 0},
-    {0xF1, (uint8_t []){0x01}, 1, 0},
-    {0xB0, (uint8_t []){0x54}, 1, 0},
-    {0xB1, (uint8_t []){0x3F}, 1, 0},
-    {0xB2, (uint8_t []){0x2A}, 1, 0},
-    {0xB4, (uint8_t []){0x46}, 1, 0},
-    {0xB5, (uint8_t []){0x34}, 1, 0},
-    {0xB6, (uint8_t []){0xD5}, 1, 0},
-    {0xB7, (uint8_t []){0x30}, 1, 0},
-    {0xB8, (uint8_t []){0x04}, 1, 0},
-    {0xBA, (uint8_t []){0x00}, 1, 0},
-    {0xBB, (uint8_t []){0x08}, 1, 0},
-    {0xBC, (uint8_t []){0x08}, 1, 0},
-    {0xBD, (uint8_t []){0x00}, 1, 0},
-    {0xC0, (uint8_t []){0x80}, 1, 0},
-    {0xC1, (uint8_t []){0x10}, 1, 0},
-    {0xC2, (uint8_t []){0x37}, 1, 0},
-    {0xC3, (uint8_t []){0x80}, 1, 0},
-    {0xC4, (uint8_t []){0x10}, 1, 0},
-    {0xC5, (uint8_t []){0x37}, 1, 0},
-    {0xC6, (uint8_t []){0xA9}, 1, 0},
-    {0xC7, (uint8_t []){0x41}, 1, 0},
-    {0xC8, (uint8_t []){0x51}, 1, 0},
-    {0xC9, (uint8_t []){0xA9}, 1, 0},
-    {0xCA, (uint8_t []){0x41}, 1, 0},
-    {0xCB, (uint8_t []){0x51}, 1, 0},
-    {0xD0, (uint8_t []){0x91}, 1, 0},
-    {0xD1, (uint8_t []){0x68}, 1, 0},
-    {0xD2, (uint8_t []){0x69}, 1, 0},
-    {0xF5, (uint8_t []){0x00, 0xA5}, 2, 0},
-    {0xDD, (uint8_t []){0x35}, 1, 0},
-    {0xDE, (uint8_t []){0x35}, 1, 0},
-    {0xF1, (uint8_t []){0x10}, 1, 0},
-    {0xF0, (uint8_t []){0x00}, 1, 0},
-    {0xF0, (uint8_t []){0x02}, 1, 0},
-    {0xE0, (uint8_t []){0x70, 0x09, 0x12, 0x0C, 0x0B, 0x27, 0x38, 0x54, 0x4E, 0x19, 0x15, 0x15, 0x2C, 0x2F}, 14, 0},
-    {0xE1, (uint8_t []){0x70, 0x08, 0x11, 0x0C, 0x0B, 0x27, 0x38, 0x43, 0x4C, 0x18, 0x14, 0x14, 0x2B, 0x2D}, 14, 0},
-    {0xF0, (uint8_t []){0x10}, 1, 0},
-    {0xF3, (uint8_t []){0x10}, 1, 0},
-    {0xE0, (uint8_t []){0x0A}, 1, 0},
-    {0xE1, (uint8_t []){0x00}, 1, 0},
-    {0xE2, (uint8_t []){0x0B}, 1, 0},
-    {0xE3, (uint8_t []){0x00}, 1, 0},
-    {0xE4, (uint8_t []){0xE0}, 1, 0},
-    {0xE5, (uint8_t []){0x06}, 1, 0},
-    {0xE6, (uint8_t []){0x21}, 1, 0},
-    {0xE7, (uint8_t []){0x00}, 1, 0},
-    {0xE8, (uint8_t []){0x05}, 1, 0},
-    {0xE9, (uint8_t []){0x82}, 1, 0},
-    {0xEA, (uint8_t []){0xDF}, 1, 0},
-    {0xEB, (uint8_t []){0x89}, 1, 0},
-    {0xEC, (uint8_t []){0x20}, 1, 0},
-    {0xED, (uint8_t []){0x14}, 1, 0},
-    {0xEE, (uint8_t []){0xFF}, 1, 0},
-    {0xEF, (uint8_t []){0x00}, 1, 0},
-    {0xF8, (uint8_t []){0xFF}, 1, 0},
-    {0xF9, (uint8_t []){0x00}, 1, 0},
-    {0xFA, (uint8_t []){0x00}, 1, 0},
-    {0xFB, (uint8_t []){0x30}, 1, 0},
-    {0xFC, (uint8_t []){0x00}, 1, 0},
-    {0xFD, (uint8_t []){0x00}, 1, 0},
-    {0xFE, (uint8_t []){0x00}, 1, 0},
-    {0xFF, (uint8_t []){0x00}, 1, 0},
-    {0x60, (uint8_t []){0x42}, 1, 0},
-    {0x61, (uint8_t []){0xE0}, 1, 0},
-    {0x62, (uint8_t []){0x40}, 1, 0},
-    {0x63, (uint8_t []){0x40}, 1, 0},
-    {0x64, (uint8_t []){0x02}, 1, 0},
-    {0x65, (uint8_t []){0x00}, 1, 0},
-    {0x66, (uint8_t []){0x40}, 1, 0},
-    {0x67, (uint8_t []){0x03}, 1, 0},
-    {0x68, (uint8_t []){0x00}, 1, 0},
-    {0x69, (uint8_t []){0x00}, 1, 0},
-    {0x6A, (uint8_t []){0x00}, 1, 0},
-    {0x6B, (uint8_t []){0x00}, 1, 0},
-    {0x70, (uint8_t []){0x42}, 1, 0},
-    {0x71, (uint8_t []){0xE0}, 1, 0},
-    {0x72, (uint8_t []){0x40}, 1, 0},
-    {0x73, (uint8_t []){0x40}, 1, 0},
-    {0x74, (uint8_t []){0x02}, 1, 0},
-    {0x75, (uint8_t []){0x00}, 1, 0},
-    {0x76, (uint8_t []){0x40}, 1, 0},
-    {0x77, (uint8_t []){0x03}, 1, 0},
-    {0x78, (uint8_t []){0x00}, 1, 0},
-    {0x79, (uint8_t []){0x00}, 1, 0},
-    {0x7A, (uint8_t []){0x00}, 1, 0},
-    {0x7B, (uint8_t []){0x00}, 1, 0},
-    {0x80, (uint8_t []){0x38}, 1, 0},
-    {0x81, (uint8_t []){0x00}, 1, 0},
-    {0x82, (uint8_t []){0x04}, 1, 0},
-    {0x83, (uint8_t []){0x02}, 1, 0},
-    {0x84, (uint8_t []){0xDC}, 1, 0},
-    {0x85, (uint8_t []){0x00}, 1, 0},
-    {0x86, (uint8_t []){0x00}, 1, 0},
-    {0x87, (uint8_t []){0x00}, 1, 0},
-    {0x88, (uint8_t []){0x38}, 1, 0},
-    {0x89, (uint8_t []){0x00}, 1, 0},
-    {0x8A, (uint8_t []){0x06}, 1, 0},
-    {0x8B, (uint8_t []){0x02}, 1, 0},
-    {0x8C, (uint8_t []){0xDE}, 1, 0},
-    {0x8D, (uint8_t []){0x00}, 1, 0},
-    {0x8E, (uint8_t []){0x00}, 1, 0},
-    {0x8F, (uint8_t []){0x00}, 1, 0},
-    {0x90, (uint8_t []){0x38}, 1, 0},
-    {0x91, (uint8_t []){0x00}, 1, 0},
-    {0x92, (uint8_t []){0x08}, 1, 0},
-    {0x93, (uint8_t []){0x02}, 1, 0},
-    {0x94, (uint8_t []){0xE0}, 1, 0},
-    {0x95, (uint8_t []){0x00}, 1, 0},
-    {0x96, (uint8_t []){0x00}, 1, 0},
-    {0x97, (uint8_t []){0x00}, 1, 0},
-    {0x98, (uint8_t []){0x38}, 1, 0},
-    {0x99, (uint8_t []){0x00}, 1, 0},
-    {0x9A, (uint8_t []){0x0A}, 1, 0},
-    {0x9B, (uint8_t []){0x02}, 1, 0},
-    {0x9C, (uint8_t []){0xE2}, 1, 0},
-    {0x9D, (uint8_t []){0x00}, 1, 0},
-    {0x9E, (uint8_t []){0x00}, 1, 0},
-    {0x9F, (uint8_t []){0x00}, 1, 0},
-    {0xA0, (uint8_t []){0x38}, 1, 0},
-    {0xA1, (uint8_t []){0x00}, 1, 0},
-    {0xA2, (uint8_t []){0x03}, 1, 0},
-    {0xA3, (uint8_t []){0x02}, 1, 0},
-    {0xA4, (uint8_t []){0xDB}, 1, 0},
-    {0xA5, (uint8_t []){0x00}, 1, 0},
-    {0xA6, (uint8_t []){0x00}, 1, 0},
-    {0xA7, (uint8_t []){0x00}, 1, 0},
-    {0xA8, (uint8_t []){0x38}, 1, 0},
-    {0xA9, (uint8_t []){0x00}, 1, 0},
-    {0xAA, (uint8_t []){0x05}, 1, 0},
-    {0xAB, (uint8_t []){0x02}, 1, 0},
-    {0xAC, (uint8_t []){0xDD}, 1, 0},
-    {0xAD, (uint8_t []){0x00}, 1, 0},
-    {0xAE, (uint8_t []){0x00}, 1, 0},
-    {0xAF, (uint8_t []){0x00}, 1, 0},
-    {0xB0, (uint8_t []){0x38}, 1, 0},
-    {0xB1, (uint8_t []){0x00}, 1, 0},
-    {0xB2, (uint8_t []){0x07}, 1, 0},
-    {0xB3, (uint8_t []){0x02}, 1, 0},
-    {0xB4, (uint8_t []){0xDF}, 1, 0},
-    {0xB5, (uint8_t []){0x00}, 1, 0},
-    {0xB6, (uint8_t []){0x00}, 1, 0},
-    {0xB7, (uint8_t []){0x00}, 1, 0},
-    {0xB8, (uint8_t []){0x38}, 1, 0},
-    {0xB9, (uint8_t []){0x00}, 1, 0},
-    {0xBA, (uint8_t []){0x09}, 1, 0},
-    {0xBB, (uint8_t []){0x02}, 1, 0},
-    {0xBC, (uint8_t []){0xE1}, 1, 0},
-    {0xBD, (uint8_t []){0x00}, 1, 0},
-    {0xBE, (uint8_t []){0x00}, 1, 0},
-    {0xBF, (uint8_t []){0x00}, 1, 0},
-    {0xC0, (uint8_t []){0x22}, 1, 0},
-    {0xC1, (uint8_t []){0xAA}, 1, 0},
-    {0xC2, (uint8_t []){0x65}, 1, 0},
-    {0xC3, (uint8_t []){0x74}, 1, 0},
-    {0xC4, (uint8_t []){0x47}, 1, 0},
-    {0xC5, (uint8_t []){0x56}, 1, 0},
-    {0xC6, (uint8_t []){0x00}, 1, 0},
-    {0xC7, (uint8_t []){0x88}, 1, 0},
-    {0xC8, (uint8_t []){0x99}, 1, 0},
-    {0xC9, (uint8_t []){0x33}, 1, 0},
-    {0xD0, (uint8_t []){0x11}, 1, 0},
-    {0xD1, (uint8_t []){0xAA}, 1, 0},
-    {0xD2, (uint8_t []){0x65}, 1, 0},
-    {0xD3, (uint8_t []){0x74}, 1, 0},
-    {0xD4, (uint8_t []){0x47}, 1, 0},
-    {0xD5, (uint8_t []){0x56}, 1, 0},
-    {0xD6, (uint8_t []){0x00}, 1, 0},
-    {0xD7, (uint8_t []){0x88}, 1, 0},
-    {0xD8, (uint8_t []){0x99}, 1, 0},
-    {0xD9, (uint8_t []){0x33}, 1, 0},
-    {0xF3, (uint8_t []){0x01}, 1, 0},
-    {0xF0, (uint8_t []){0x00}, 1, 0},
-    {0xF0, (uint8_t []){0x01}, 1, 0},
-    {0xF1, (uint8_t []){0x01}, 1, 0},
-    {0xA0, (uint8_t []){0x0B}, 1, 0},
-    {0xA3, (uint8_t []){0x2A}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x2B}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x2C}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x2D}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x2E}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x2F}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x30}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x31}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x32}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA3, (uint8_t []){0x33}, 1, 0},
-    {0xA5, (uint8_t []){0xC3}, 1, 1},
-    {0xA0, (uint8_t []){0x09}, 1, 0},
-    {0xF1, (uint8_t []){0x10}, 1, 0},
-    {0xF0, (uint8_t []){0x00}, 1, 0},
-    {0x2A, (uint8_t []){0x00, 0x00, 0x01, 0x67}, 4, 0},
-    {0x2B, (uint8_t []){0x01, 0x68, 0x01, 0x68}, 4, 0},
-    {0x4D, (uint8_t []){0x00}, 1, 0},
-    {0x4E, (uint8_t []){0x00}, 1, 0},
-    {0x4F, (uint8_t []){0x00}, 1, 0},
-    {0x4C, (uint8_t []){0x01}, 1, 10},
-    {0x4C, (uint8_t []){0x00}, 1, 0},
-    {0x2A, (uint8_t []){0x00, 0x00, 0x01, 0x67}, 4, 0},
-    {0x2B, (uint8_t []){0x00, 0x00, 0x01, 0x67}, 4, 0},
-    {0x21, (uint8_t []){0x00}, 1, 0},
-    {0x11, (uint8_t []){0x00}, 1, 120},
+static const uint8_t vendor_specific_init_default[] = {
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xF2, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x9B, 0x51),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0x53),
+    ESP_PANEL_INIT_SEQ_CMD(0xF2, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x54),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x3F),
+    ESP_PANEL_INIT_SEQ_CMD(0xB2, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0xB4, 0x46),
+    ESP_PANEL_INIT_SEQ_CMD(0xB5, 0x34),
+    ESP_PANEL_INIT_SEQ_CMD(0xB6, 0xD5),
+    ESP_PANEL_INIT_SEQ_CMD(0xB7, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0xB8, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0xBA, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xBB, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xBC, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xBD, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xC0, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x37),
+    ESP_PANEL_INIT_SEQ_CMD(0xC3, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xC4, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xC5, 0x37),
+    ESP_PANEL_INIT_SEQ_CMD(0xC6, 0xA9),
+    ESP_PANEL_INIT_SEQ_CMD(0xC7, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0xC8, 0x51),
+    ESP_PANEL_INIT_SEQ_CMD(0xC9, 0xA9),
+    ESP_PANEL_INIT_SEQ_CMD(0xCA, 0x41),
+    ESP_PANEL_INIT_SEQ_CMD(0xCB, 0x51),
+    ESP_PANEL_INIT_SEQ_CMD(0xD0, 0x91),
+    ESP_PANEL_INIT_SEQ_CMD(0xD1, 0x68),
+    ESP_PANEL_INIT_SEQ_CMD(0xD2, 0x69),
+    ESP_PANEL_INIT_SEQ_CMD(0xF5, 0x00, 0xA5),
+    ESP_PANEL_INIT_SEQ_CMD(0xDD, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0xDE, 0x35),
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x70, 0x09, 0x12, 0x0C, 0x0B, 0x27, 0x38, 0x54, 0x4E, 0x19, 0x15, 0x15, 0x2C, 0x2F),
+    ESP_PANEL_INIT_SEQ_CMD(0xE1, 0x70, 0x08, 0x11, 0x0C, 0x0B, 0x27, 0x38, 0x43, 0x4C, 0x18, 0x14, 0x14, 0x2B, 0x2D),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xF3, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0xE1, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xE2, 0x0B),
+    ESP_PANEL_INIT_SEQ_CMD(0xE3, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xE4, 0xE0),
+    ESP_PANEL_INIT_SEQ_CMD(0xE5, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0xE6, 0x21),
+    ESP_PANEL_INIT_SEQ_CMD(0xE7, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xE8, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0xE9, 0x82),
+    ESP_PANEL_INIT_SEQ_CMD(0xEA, 0xDF),
+    ESP_PANEL_INIT_SEQ_CMD(0xEB, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0xEC, 0x20),
+    ESP_PANEL_INIT_SEQ_CMD(0xED, 0x14),
+    ESP_PANEL_INIT_SEQ_CMD(0xEE, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xEF, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xF8, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xF9, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFA, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFB, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0xFC, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFD, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFE, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x61, 0xE0),
+    ESP_PANEL_INIT_SEQ_CMD(0x62, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x63, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x64, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x67, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x68, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x69, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x6A, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x6B, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x70, 0x42),
+    ESP_PANEL_INIT_SEQ_CMD(0x71, 0xE0),
+    ESP_PANEL_INIT_SEQ_CMD(0x72, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x74, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x75, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x76, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x77, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0x78, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x79, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x7A, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x7B, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x81, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x82, 0x04),
+    ESP_PANEL_INIT_SEQ_CMD(0x83, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x84, 0xDC),
+    ESP_PANEL_INIT_SEQ_CMD(0x85, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x87, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x88, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x89, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x8A, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x8B, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x8C, 0xDE),
+    ESP_PANEL_INIT_SEQ_CMD(0x8D, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x8E, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x8F, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x90, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x91, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x92, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x93, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x94, 0xE0),
+    ESP_PANEL_INIT_SEQ_CMD(0x95, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x96, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x97, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x98, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0x99, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x9A, 0x0A),
+    ESP_PANEL_INIT_SEQ_CMD(0x9B, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0x9C, 0xE2),
+    ESP_PANEL_INIT_SEQ_CMD(0x9D, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x9E, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x9F, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xA0, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0xA1, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xA2, 0x03),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xA4, 0xDB),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xA6, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xA7, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xA8, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0xA9, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xAA, 0x05),
+    ESP_PANEL_INIT_SEQ_CMD(0xAB, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xAC, 0xDD),
+    ESP_PANEL_INIT_SEQ_CMD(0xAD, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xAE, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xAF, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xB2, 0x07),
+    ESP_PANEL_INIT_SEQ_CMD(0xB3, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xB4, 0xDF),
+    ESP_PANEL_INIT_SEQ_CMD(0xB5, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xB6, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xB7, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xB8, 0x38),
+    ESP_PANEL_INIT_SEQ_CMD(0xB9, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xBA, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0xBB, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xBC, 0xE1),
+    ESP_PANEL_INIT_SEQ_CMD(0xBD, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xBE, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xBF, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xC0, 0x22),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0xAA),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x65),
+    ESP_PANEL_INIT_SEQ_CMD(0xC3, 0x74),
+    ESP_PANEL_INIT_SEQ_CMD(0xC4, 0x47),
+    ESP_PANEL_INIT_SEQ_CMD(0xC5, 0x56),
+    ESP_PANEL_INIT_SEQ_CMD(0xC6, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xC7, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0xC8, 0x99),
+    ESP_PANEL_INIT_SEQ_CMD(0xC9, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0xD0, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xD1, 0xAA),
+    ESP_PANEL_INIT_SEQ_CMD(0xD2, 0x65),
+    ESP_PANEL_INIT_SEQ_CMD(0xD3, 0x74),
+    ESP_PANEL_INIT_SEQ_CMD(0xD4, 0x47),
+    ESP_PANEL_INIT_SEQ_CMD(0xD5, 0x56),
+    ESP_PANEL_INIT_SEQ_CMD(0xD6, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xD7, 0x88),
+    ESP_PANEL_INIT_SEQ_CMD(0xD8, 0x99),
+    ESP_PANEL_INIT_SEQ_CMD(0xD9, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0xF3, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xA0, 0x0B),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x2A),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x2B),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x2C),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x2D),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x2E),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x2F),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x30),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x31),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA3, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0xA5, 0xC3), ESP_PANEL_INIT_SEQ_DELAY(1),
+    ESP_PANEL_INIT_SEQ_CMD(0xA0, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x00, 0x00, 0x01, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x01, 0x68, 0x01, 0x68),
+    ESP_PANEL_INIT_SEQ_CMD(0x4D, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x4E, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x4F, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x4C, 0x01), ESP_PANEL_INIT_SEQ_DELAY(10),
+    ESP_PANEL_INIT_SEQ_CMD(0x4C, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x00, 0x00, 0x01, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x00, 0x00, 0x01, 0x67),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x00), ESP_PANEL_INIT_SEQ_DELAY(120),
 };
 
 static esp_err_t panel_st77916_init(esp_lcd_panel_t *panel)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
+    esp_panel_window_cache_invalidate(st77916->window_cache);
     esp_lcd_panel_io_handle_t io = st77916->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     bool is_user_set = true;
     bool is_cmd_overwritten = false;
 
@@ -429,24 +433,23 @@ static esp_err_t panel_st77916_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (st77916->init_cmds) {
-        init_cmds = st77916->init_cmds;
-        init_cmds_size = st77916->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, st77916->init_cmds, st77916->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        if (is_user_set && (init_cmds[i].data_bytes > 0)) {
-            switch (init_cmds[i].cmd) {
+        if (is_user_set && (init_cmd.data_bytes > 0)) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                st77916->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                st77916->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             case LCD_CMD_COLMOD:
                 is_cmd_overwritten = true;
-                st77916->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+                st77916->colmod_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -455,19 +458,22 @@ static esp_err_t panel_st77916_init(esp_lcd_panel_t *panel)
 
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
-                ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+                ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(tx_param(st77916, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(tx_param(st77916, io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
 
         // Check if the current cmd is the "command set" cmd
-        if ((init_cmds[i].cmd == ST77916_CMD_SET)) {
-            is_user_set = ((uint8_t *)init_cmds[i].data)[0] == ST77916_PARAM_SET ? true : false;
+        if ((init_cmd.cmd == ST77916_CMD_SET)) {
+            is_user_set = ((uint8_t *)init_cmd.data)[0] == ST77916_PARAM_SET ? true : false;
         }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -478,30 +484,39 @@ static esp_err_t panel_st77916_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = st77916->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += st77916->x_gap;
     x_end += st77916->x_gap;
     y_start += st77916->y_gap;
     y_end += st77916->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(st77916, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(st77916->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(st77916, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(st77916->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(st77916, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st77916->fb_bits_per_pixel / 8;
     tx_color(st77916, io, LCD_CMD_RAMWR, color_data, len);
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(st77916->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_st77916_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -521,6 +536,7 @@ static esp_err_t panel_st77916_invert_color(esp_lcd_panel_t *panel, bool invert_
 static esp_err_t panel_st77916_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
+    esp_panel_window_cache_invalidate(st77916->window_cache);
     esp_lcd_panel_io_handle_t io = st77916->io;
     esp_err_t ret = ESP_OK;
 
@@ -543,6 +559,7 @@ static esp_err_t panel_st77916_mirror(esp_lcd_panel_t *panel, bool mirror_x, boo
 static esp_err_t panel_st77916_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
+    esp_panel_window_cache_invalidate(st77916->window_cache);
     esp_lcd_panel_io_handle_t io = st77916->io;
     if (swap_axes) {
         st77916->madctl_val |= LCD_CMD_MV_BIT;
@@ -558,6 +575,7 @@ static esp_err_t panel_st77916_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_st77916_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
+    esp_panel_window_cache_invalidate(st77916->window_cache);
     st77916->x_gap = x_gap;
     st77916->y_gap = y_gap;
     return ESP_OK;
@@ -566,6 +584,7 @@ static esp_err_t panel_st77916_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_
 static esp_err_t panel_st77916_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     st77916_panel_t *st77916 = __containerof(panel, st77916_panel_t, base);
+    esp_panel_window_cache_invalidate(st77916->window_cache);
     esp_lcd_panel_io_handle_t io = st77916->io;
     int command = 0;
 
@@ -50,6 +50,7 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -113,6 +114,7 @@ esp_err_t esp_lcd_new_panel_st77922(const esp_lcd_panel_io_handle_t io, const es
     if (vendor_config) {
         st77922->init_cmds = vendor_config->init_cmds;
         st77922->init_cmds_size = vendor_config->init_cmds_size;
+        st77922->window_cache = vendor_config->window_cache;
         st77922->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     st77922->base.del = panel_st77922_del;
@@ -177,6 +179,7 @@ static esp_err_t panel_st77922_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_st77922_reset(esp_lcd_panel_t *panel)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
+    esp_panel_window_cache_invalidate(st77922->window_cache);
     esp_lcd_panel_io_handle_t io = st77922->io;
 
     // Perform hardware reset
@@ -193,78 +196,82 @@ static esp_err_t panel_st77922_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-    {0x28, (uint8_t []){0x00}, 0, 0},
-    {0x10, (uint8_t []){0x00}, 0, 0},
-    {0x2A, (uint8_t []){0x00, 0x00, 0x02, 0x13}, 4, 0},
-    {0x2B, (uint8_t []){0x00, 0x00, 0x01, 0x2B}, 4, 0},
-    {0xD0, (uint8_t []){0x80}, 1, 0},
+static const uint8_t vendor_specific_init_default[] = {
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x28),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x00, 0x00, 0x02, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0x2B, 0x00, 0x00, 0x01, 0x2B),
+    ESP_PANEL_INIT_SEQ_CMD(0xD0, 0x80),
     // ======================CMD2======================
-    {0xF1, (uint8_t []){0x00}, 1, 0},
-    {0x60, (uint8_t []){0x00, 0x00, 0x00}, 3, 0},
-    {0x65, (uint8_t []){0x00}, 1, 0},
-    {0x66, (uint8_t []){0x00, 0x3F}, 2, 0},
-    {0xBE, (uint8_t []){0x1E, 0x01, 0x06}, 3, 0},   // VCM SSI
-    {0x70, (uint8_t []){0x02, 0x7D, 0x12, 0x14, 0x30, 0x00, 0x07, 0x52, 0x01, 0x00, 0x00, 0x1A}, 12, 0},    // VFP, VBP, Gate line
-    {0x71, (uint8_t []){0xD0}, 1, 0},   // MIPI CMD Mode
-    {0x7B, (uint8_t []){0x00, 0x08, 0x08}, 3, 0},
-    {0x80, (uint8_t []){0x55, 0x62, 0x2F, 0x17, 0xF0, 0x52, 0x70, 0xD2, 0x52, 0x62, 0xEA}, 11, 0},
-    {0x81, (uint8_t []){0x26, 0x52, 0x72, 0x27}, 4, 0},
-    {0x84, (uint8_t []){0x92, 0x25}, 2, 0},
-    {0x86, (uint8_t []){0xC6, 0x04, 0xB1, 0x02, 0x58, 0x12, 0x58, 0x10, 0x13, 0x01, 0xAA, 0x00, 0xAA, 0xAA}, 14, 0},
-    {0x87, (uint8_t []){0x10, 0x10, 0x58, 0x00, 0x02, 0x3A}, 6, 0},
-    {0x88, (uint8_t []){0x00, 0x00, 0x2C, 0x10, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x06}, 15, 0},
-    {0x89, (uint8_t []){0x00, 0x00, 0x00}, 3, 0},
-    {0x8A, (uint8_t []){0x13, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x10, 0x10, 0x00, 0x3E, 0x19}, 11, 0},
-    {0x8B, (uint8_t []){0x15, 0xB1, 0xB1, 0x44, 0x96, 0x2C, 0x10, 0x97, 0x8E}, 9, 0},   // VGL Pump
-    {0x8C, (uint8_t []){0x1D, 0xB1, 0xB1, 0x44, 0x96, 0x2C, 0x10, 0x50, 0x0F, 0x01, 0xC5, 0x12, 0x09}, 13, 0},  // VGH Pump
-    {0x8D, (uint8_t []){0x0C}, 1, 0},
-    {0x8E, (uint8_t []){0x33, 0x01, 0x0C, 0x13, 0x01, 0x01}, 6, 0},
-    {0x90, (uint8_t []){0x00, 0x44, 0x33, 0x36, 0x00, 0x79, 0x40, 0xB6, 0xB6}, 9, 0},
-    {0x91, (uint8_t []){0x00, 0x44, 0x33, 0x37, 0x00, 0x78, 0x40, 0xB6, 0xB6}, 9, 0},
-    {0x92, (uint8_t []){0x02, 0x44, 0x55, 0x82, 0x86, 0x2F, 0x00, 0x04, 0x73, 0xB6}, 10, 0},
-    {0x93, (uint8_t []){0x0C, 0x00, 0x11, 0x81, 0x87, 0x3F, 0x00, 0x00, 0x73, 0x73}, 10, 0},
-    {0x94, (uint8_t []){0x08, 0x00, 0x00, 0x00, 0x00, 0x00}, 6, 0},
-    {0x95, (uint8_t []){0x1A, 0x1A, 0x00, 0x00, 0xFF}, 5, 0},
-    {0x96, (uint8_t []){0x44, 0x35, 0x07, 0x16, 0x20, 0x21, 0x07, 0x06, 0xB6, 0xB6, 0x00, 0x40}, 12, 0},
-    {0x97, (uint8_t []){0x44, 0x35, 0x25, 0x34, 0x22, 0x23, 0x05, 0x04, 0xB6, 0xB6, 0x00, 0x40}, 12, 0},
-    {0xBA, (uint8_t []){0x55, 0xB6, 0xB6, 0xB6, 0xB6}, 5, 0},
-    {0x9A, (uint8_t []){0x40, 0x0C, 0x56, 0x01, 0x08, 0xB6, 0xB6}, 7, 0},
-    {0x9B, (uint8_t []){0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00}, 7, 0},
-    {0x9C, (uint8_t []){0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00}, 13, 0},
-    {0x9D, (uint8_t []){0x80, 0x15, 0x00, 0x07, 0x01, 0x80, 0x73, 0x73}, 8, 0},
-    {0x9E, (uint8_t []){0x00, 0x00, 0x00, 0x00, 0x80, 0x1E, 0x01}, 7, 0},
-    {0x9F, (uint8_t []){0xA0, 0x09, 0x00, 0x57}, 4, 0},
-    {0xB3, (uint8_t []){0x00, 0x30, 0x0F, 0x00, 0x00, 0x00, 0x00}, 7, 0},
-    {0xB4, (uint8_t []){0x10, 0x1C, 0x19, 0x14, 0x18, 0x01, 0x1D, 0x03, 0x12, 0x0A, 0x11, 0x08}, 12, 0},
-    {0xB5, (uint8_t []){0x1C, 0x1C, 0x19, 0x14, 0x18, 0x00, 0x1D, 0x02, 0x10, 0x0B, 0x13, 0x09}, 12, 0},
-    {0xB6, (uint8_t []){0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x0F, 0xFE}, 7, 0},
-    {0xB7, (uint8_t []){0x00, 0x09, 0x10, 0x0B, 0x0A, 0x06, 0x38, 0x04, 0x04, 0x4F, 0x09, 0x15, 0x15, 0x30, 0x37, 0x0F}, 16, 0},  // GammaP
-    {0xB8, (uint8_t []){0x00, 0x09, 0x0F, 0x0A, 0x09, 0x05, 0x37, 0x03, 0x03, 0x4F, 0x09, 0x15, 0x15, 0x31, 0x36, 0x0F}, 16, 0},  // GammaN
-    {0xB9, (uint8_t []){0x23, 0x23}, 2, 0},
-    {0xBF, (uint8_t []){0x0F, 0x13, 0x13, 0x09, 0x09, 0x09}, 6, 0},     // VGHP/VGLP
+    ESP_PANEL_INIT_SEQ_CMD(0xF1, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x60, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x65, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x66, 0x00, 0x3F),
+    ESP_PANEL_INIT_SEQ_CMD(0xBE, 0x1E, 0x01, 0x06), // VCM SSI
+    ESP_PANEL_INIT_SEQ_CMD(0x70, 0x02, 0x7D, 0x12, 0x14, 0x30, 0x00, 0x07, 0x52, 0x01, 0x00, 0x00, 0x1A), // VFP, VBP, Gate line
+    ESP_PANEL_INIT_SEQ_CMD(0x71, 0xD0), // MIPI CMD Mode
+    ESP_PANEL_INIT_SEQ_CMD(0x7B, 0x00, 0x08, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0x80, 0x55, 0x62, 0x2F, 0x17, 0xF0, 0x52, 0x70, 0xD2, 0x52, 0x62, 0xEA),
+    ESP_PANEL_INIT_SEQ_CMD(0x81, 0x26, 0x52, 0x72, 0x27),
+    ESP_PANEL_INIT_SEQ_CMD(0x84, 0x92, 0x25),
+    ESP_PANEL_INIT_SEQ_CMD(0x86, 0xC6, 0x04, 0xB1, 0x02, 0x58, 0x12, 0x58, 0x10, 0x13, 0x01, 0xAA, 0x00, 0xAA, 0xAA),
+    ESP_PANEL_INIT_SEQ_CMD(0x87, 0x10, 0x10, 0x58, 0x00, 0x02, 0x3A),
+    ESP_PANEL_INIT_SEQ_CMD(0x88, 0x00, 0x00, 0x2C, 0x10, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+            0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0x89, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x8A, 0x13, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x10, 0x10, 0x00, 0x3E, 0x19),
+    ESP_PANEL_INIT_SEQ_CMD(0x8B, 0x15, 0xB1, 0xB1, 0x44, 0x96, 0x2C, 0x10, 0x97, 0x8E), // VGL Pump
+    ESP_PANEL_INIT_SEQ_CMD(0x8C, 0x1D, 0xB1, 0xB1, 0x44, 0x96, 0x2C, 0x10, 0x50, 0x0F, 0x01, 0xC5, 0x12, 0x09), // VGH Pump
+    ESP_PANEL_INIT_SEQ_CMD(0x8D, 0x0C),
+    ESP_PANEL_INIT_SEQ_CMD(0x8E, 0x33, 0x01, 0x0C, 0x13, 0x01, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x90, 0x00, 0x44, 0x33, 0x36, 0x00, 0x79, 0x40, 0xB6, 0xB6),
+    ESP_PANEL_INIT_SEQ_CMD(0x91, 0x00, 0x44, 0x33, 0x37, 0x00, 0x78, 0x40, 0xB6, 0xB6),
+    ESP_PANEL_INIT_SEQ_CMD(0x92, 0x02, 0x44, 0x55, 0x82, 0x86, 0x2F, 0x00, 0x04, 0x73, 0xB6),
+    ESP_PANEL_INIT_SEQ_CMD(0x93, 0x0C, 0x00, 0x11, 0x81, 0x87, 0x3F, 0x00, 0x00, 0x73, 0x73),
+    ESP_PANEL_INIT_SEQ_CMD(0x94, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x95, 0x1A, 0x1A, 0x00, 0x00, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0x96, 0x44, 0x35, 0x07, 0x16, 0x20, 0x21, 0x07, 0x06, 0xB6, 0xB6, 0x00, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0x97, 0x44, 0x35, 0x25, 0x34, 0x22, 0x23, 0x05, 0x04, 0xB6, 0xB6, 0x00, 0x40),
+    ESP_PANEL_INIT_SEQ_CMD(0xBA, 0x55, 0xB6, 0xB6, 0xB6, 0xB6),
+    ESP_PANEL_INIT_SEQ_CMD(0x9A, 0x40, 0x0C, 0x56, 0x01, 0x08, 0xB6, 0xB6),
+    ESP_PANEL_INIT_SEQ_CMD(0x9B, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x9C, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x9D, 0x80, 0x15, 0x00, 0x07, 0x01, 0x80, 0x73, 0x73),
+    ESP_PANEL_INIT_SEQ_CMD(0x9E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1E, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0x9F, 0xA0, 0x09, 0x00, 0x57),
+    ESP_PANEL_INIT_SEQ_CMD(0xB3, 0x00, 0x30, 0x0F, 0x00, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xB4, 0x10, 0x1C, 0x19, 0x14, 0x18, 0x01, 0x1D, 0x03, 0x12, 0x0A, 0x11, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xB5, 0x1C, 0x1C, 0x19, 0x14, 0x18, 0x00, 0x1D, 0x02, 0x10, 0x0B, 0x13, 0x09),
+    ESP_PANEL_INIT_SEQ_CMD(0xB6, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x0F, 0xFE),
+    ESP_PANEL_INIT_SEQ_CMD(0xB7, 0x00, 0x09, 0x10, 0x0B, 0x0A, 0x06, 0x38, 0x04, 0x04, 0x4F, 0x09, 0x15, 0x15, 0x30,
+            0x37, 0x0F), // GammaP
+    ESP_PANEL_INIT_SEQ_CMD(0xB8, 0x00, 0x09, 0x0F, 0x0A, 0x09, 0x05, 0x37, 0x03, 0x03, 0x4F, 0x09, 0x15, 0x15, 0x31,
+            0x36, 0x0F), // GammaN
+    ESP_PANEL_INIT_SEQ_CMD(0xB9, 0x23, 0x23),
+    ESP_PANEL_INIT_SEQ_CMD(0xBF, 0x0F, 0x13, 0x13, 0x09, 0x09, 0x09), // VGHP/VGLP
     // ======================CMD3======================
-    {0xF2, (uint8_t []){0x00}, 1, 0},
-    {0x73, (uint8_t []){0x04, 0xBA, 0x1A, 0x58, 0x5B}, 5, 0},           // VOP= 5v
-    {0x77, (uint8_t []){0x6B, 0x5B, 0xFB, 0xC3, 0xC5}, 5, 0},
-    {0x7A, (uint8_t []){0x15, 0x27}, 2, 0},
-    {0x7B, (uint8_t []){0x04, 0x57}, 2, 0},
-    {0x7E, (uint8_t []){0x01, 0x0E}, 2, 0},
-    {0xBF, (uint8_t []){0x36}, 1, 0},
-    {0xE3, (uint8_t []){0x43, 0x43}, 2, 0},                             // VMF
+    ESP_PANEL_INIT_SEQ_CMD(0xF2, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x73, 0x04, 0xBA, 0x1A, 0x58, 0x5B), // VOP= 5v
+    ESP_PANEL_INIT_SEQ_CMD(0x77, 0x6B, 0x5B, 0xFB, 0xC3, 0xC5),
+    ESP_PANEL_INIT_SEQ_CMD(0x7A, 0x15, 0x27),
+    ESP_PANEL_INIT_SEQ_CMD(0x7B, 0x04, 0x57),
+    ESP_PANEL_INIT_SEQ_CMD(0x7E, 0x01, 0x0E),
+    ESP_PANEL_INIT_SEQ_CMD(0xBF, 0x36),
+    ESP_PANEL_INIT_SEQ_CMD(0xE3, 0x43, 0x43), // VMF
     // ======================CMD1======================
-    {0xF0, (uint8_t []){0x00}, 1, 0},
-    {0x21, (uint8_t []){0x00}, 1, 0},
-    {0x11, (uint8_t []){0x00}, 1, 120},
-    {0x35, (uint8_t []){0x00}, 1, 20},
+    ESP_PANEL_INIT_SEQ_CMD(0xF0, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x21, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0x11, 0x00), ESP_PANEL_INIT_SEQ_DELAY(120),
+    ESP_PANEL_INIT_SEQ_CMD(0x35, 0x00), ESP_PANEL_INIT_SEQ_DELAY(20),
 };
 
 static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
+    esp_panel_window_cache_invalidate(st77922->window_cache);
     esp_lcd_panel_io_handle_t io = st77922->io;
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     bool is_user_set = true;
     bool is_cmd_overwritten = false;
 
@@ -280,24 +287,23 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
     // vendor specific initialization, it can be different between manufacturers
     // should consult the LCD supplier for initialization sequence code
     if (st77922->init_cmds) {
-        init_cmds = st77922->init_cmds;
-        init_cmds_size = st77922->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, st77922->init_cmds, st77922->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        if (is_user_set && (init_cmds[i].data_bytes > 0)) {
-            switch (init_cmds[i].cmd) {
+        if (is_user_set && (init_cmd.data_bytes > 0)) {
+            switch (init_cmd.cmd) {
             case LCD_CMD_MADCTL:
                 is_cmd_overwritten = true;
-                st77922->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+                st77922->madctl_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             case LCD_CMD_COLMOD:
                 is_cmd_overwritten = true;
-                st77922->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+                st77922->colmod_val = ((uint8_t *)init_cmd.data)[0];
                 break;
             default:
                 is_cmd_overwritten = false;
@@ -306,17 +312,20 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
 
             if (is_cmd_overwritten) {
                 is_cmd_overwritten = false;
-                ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+                ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
             }
         }
 
         // Send command
-        ESP_RETURN_ON_ERROR(tx_param(st77922, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(tx_param(st77922, io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
 
         // Check if the current cmd is the "command set" cmd
-        is_user_set = (init_cmds[i].cmd == ST77922_CMD_SET) ? true : false;
+        is_user_set = (init_cmd.cmd == ST77922_CMD_SET) ? true : false;
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -327,30 +336,39 @@ static esp_err_t panel_st77922_draw_bitmap(esp_lcd_panel_t *panel, int x_start,
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = st77922->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += st77922->x_gap;
     x_end += st77922->x_gap;
     y_start += st77922->y_gap;
     y_end += st77922->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(tx_param(st77922, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(tx_param(st77922, io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(st77922->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(st77922, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(st77922->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(tx_param(st77922, io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st77922->fb_bits_per_pixel / 8;
     tx_color(st77922, io, LCD_CMD_RAMWR, color_data, len);
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(st77922->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_st77922_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -370,6 +388,7 @@ static esp_err_t panel_st77922_invert_color(esp_lcd_panel_t *panel, bool invert_
 static esp_err_t panel_st77922_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
+    esp_panel_window_cache_invalidate(st77922->window_cache);
     esp_lcd_panel_io_handle_t io = st77922->io;
     esp_err_t ret = ESP_OK;
 
@@ -398,6 +417,7 @@ static esp_err_t panel_st77922_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_st77922_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
+    esp_panel_window_cache_invalidate(st77922->window_cache);
     st77922->x_gap = x_gap;
     st77922->y_gap = y_gap;
     return ESP_OK;
@@ -406,6 +426,7 @@ static esp_err_t panel_st77922_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_
 static esp_err_t panel_st77922_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     st77922_panel_t *st77922 = __containerof(panel, st77922_panel_t, base);
+    esp_panel_window_cache_invalidate(st77922->window_cache);
     esp_lcd_panel_io_handle_t io = st77922->io;
     int command = 0;
 
@@ -45,6 +45,7 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_window_cache_t *window_cache;
 } st7796_panel_t;
 
 esp_err_t esp_lcd_new_panel_st7796(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
@@ -116,6 +117,7 @@ esp_err_t esp_lcd_new_panel_st7796(const esp_lcd_panel_io_handle_t io, const esp
     if (panel_dev_config->vendor_config) {
         st7796->init_cmds = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         st7796->init_cmds_size = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        st7796->window_cache = ((esp_lcd_panel_vendor_config_t *)panel_dev_config->vendor_config)->window_cache;
     }
     st7796->base.del = panel_st7796_del;
     st7796->base.reset = panel_st7796_reset;
@@ -163,6 +165,7 @@ static esp_err_t panel_st7796_del(esp_lcd_panel_t *panel)
 static esp_err_t panel_st7796_reset(esp_lcd_panel_t *panel)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
+    esp_panel_window_cache_invalidate(st7796->window_cache);
     esp_lcd_panel_io_handle_t io = st7796->io;
 
     // perform hardware reset
@@ -179,25 +182,26 @@ static esp_err_t panel_st7796_reset(esp_lcd_panel_t *panel)
     return ESP_OK;
 }
 
-static const esp_lcd_panel_vendor_init_cmd_t vendor_specific_init_default[] = {
-//  {cmd, { data }, data_size, delay_ms}
-    {0xf0, (uint8_t []){0xc3}, 1, 0},
-    {0xf0, (uint8_t []){0x96}, 1, 0},
-    {0xb4, (uint8_t []){0x01}, 1, 0},
-    {0xb7, (uint8_t []){0xc6}, 1, 0},
-    {0xe8, (uint8_t []){0x40, 0x8a, 0x00, 0x00, 0x29, 0x19, 0xa5, 0x33}, 8, 0},
-    {0xc1, (uint8_t []){0x06}, 1, 0},
-    {0xc2, (uint8_t []){0xa7}, 1, 0},
-    {0xc5, (uint8_t []){0x18}, 1, 0},
-    {0xe0, (uint8_t []){0xf0, 0x09, 0x0b, 0x06, 0x04, 0x15, 0x2f, 0x54, 0x42, 0x3c, 0x17, 0x14, 0x18, 0x1b}, 14, 0},
-    {0xe1, (uint8_t []){0xf0, 0x09, 0x0b, 0x06, 0x04, 0x03, 0x2d, 0x43, 0x42, 0x3b, 0x16, 0x14, 0x17, 0x1b}, 14, 0},
-    {0xf0, (uint8_t []){0x3c}, 1, 0},
-    {0xf0, (uint8_t []){0x69}, 1, 0},
+static const uint8_t vendor_specific_init_default[] = {
+//  ESP_PANEL_INIT_SEQ_CMD(cmd, data...), ESP_PANEL_INIT_SEQ_DELAY(delay_ms)
+    ESP_PANEL_INIT_SEQ_CMD(0xf0, 0xc3),
+    ESP_PANEL_INIT_SEQ_CMD(0xf0, 0x96),
+    ESP_PANEL_INIT_SEQ_CMD(0xb4, 0x01),
+    ESP_PANEL_INIT_SEQ_CMD(0xb7, 0xc6),
+    ESP_PANEL_INIT_SEQ_CMD(0xe8, 0x40, 0x8a, 0x00, 0x00, 0x29, 0x19, 0xa5, 0x33),
+    ESP_PANEL_INIT_SEQ_CMD(0xc1, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0xc2, 0xa7),
+    ESP_PANEL_INIT_SEQ_CMD(0xc5, 0x18),
+    ESP_PANEL_INIT_SEQ_CMD(0xe0, 0xf0, 0x09, 0x0b, 0x06, 0x04, 0x15, 0x2f, 0x54, 0x42, 0x3c, 0x17, 0x14, 0x18, 0x1b),
+    ESP_PANEL_INIT_SEQ_CMD(0xe1, 0xf0, 0x09, 0x0b, 0x06, 0x04, 0x03, 0x2d, 0x43, 0x42, 0x3b, 0x16, 0x14, 0x17, 0x1b),
+    ESP_PANEL_INIT_SEQ_CMD(0xf0, 0x3c),
+    ESP_PANEL_INIT_SEQ_CMD(0xf0, 0x69),
 };
 
 static esp_err_t panel_st7796_init(esp_lcd_panel_t *panel)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
+    esp_panel_window_cache_invalidate(st7796->window_cache);
     esp_lcd_panel_io_handle_t io = st7796->io;
 
     // LCD goes into sleep mode and display will be turned off after power on reset, exit sleep mode first
@@ -210,27 +214,27 @@ static esp_err_t panel_st7796_init(esp_lcd_panel_t *panel)
         st7796->colmod_val,
     }, 1), TAG, "send command failed");
 
-    const esp_lcd_panel_vendor_init_cmd_t *init_cmds = NULL;
-    uint16_t init_cmds_size = 0;
+    esp_panel_init_seq_t init_seq;
+
+    esp_lcd_panel_vendor_init_cmd_t init_cmd;
     if (st7796->init_cmds) {
-        init_cmds = st7796->init_cmds;
-        init_cmds_size = st7796->init_cmds_size;
+        ESP_RETURN_ON_FALSE(esp_panel_init_seq_init_from_cmds(&init_seq, st7796->init_cmds, st7796->init_cmds_size),
+                            ESP_ERR_INVALID_ARG, TAG, "Invalid init commands");
     } else {
-        init_cmds = vendor_specific_init_default;
-        init_cmds_size = sizeof(vendor_specific_init_default) / sizeof(esp_lcd_panel_vendor_init_cmd_t);
+        esp_panel_init_seq_init(&init_seq, vendor_specific_init_default, sizeof(vendor_specific_init_default));
     }
 
     bool is_cmd_overwritten = false;
-    for (int i = 0; i < init_cmds_size; i++) {
+    while (esp_panel_init_seq_next(&init_seq, &init_cmd)) {
         // Check if the command has been used or conflicts with the internal
-        switch (init_cmds[i].cmd) {
+        switch (init_cmd.cmd) {
         case LCD_CMD_MADCTL:
             is_cmd_overwritten = true;
-            st7796->madctl_val = ((uint8_t *)init_cmds[i].data)[0];
+            st7796->madctl_val = ((uint8_t *)init_cmd.data)[0];
             break;
         case LCD_CMD_COLMOD:
             is_cmd_overwritten = true;
-            st7796->colmod_val = ((uint8_t *)init_cmds[i].data)[0];
+            st7796->colmod_val = ((uint8_t *)init_cmd.data)[0];
             break;
         default:
             is_cmd_overwritten = false;
@@ -238,12 +242,15 @@ static esp_err_t panel_st7796_init(esp_lcd_panel_t *panel)
         }
 
         if (is_cmd_overwritten) {
-            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
+            ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmd.cmd);
         }
 
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmd.cmd, init_cmd.data, init_cmd.data_bytes), TAG, "send command failed");
+        if (init_cmd.delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(init_cmd.delay_ms));
+        }
     }
+    ESP_RETURN_ON_FALSE(esp_panel_init_seq_is_end(&init_seq), ESP_ERR_INVALID_ARG, TAG, "Invalid init sequence");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -254,30 +261,39 @@ static esp_err_t panel_st7796_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
     assert((x_start < x_end) && (y_start < y_end) && "start position must be smaller than end position");
     esp_lcd_panel_io_handle_t io = st7796->io;
+    esp_err_t ret = ESP_OK;
 
     x_start += st7796->x_gap;
     x_end += st7796->x_gap;
     y_start += st7796->y_gap;
     y_end += st7796->y_gap;
 
-    // define an area of frame memory where MCU can access
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,
-        x_start & 0xFF,
-        ((x_end - 1) >> 8) & 0xFF,
-        (x_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
-        (y_start >> 8) & 0xFF,
-        y_start & 0xFF,
-        ((y_end - 1) >> 8) & 0xFF,
-        (y_end - 1) & 0xFF,
-    }, 4), TAG, "send command failed");
+    // define an area of frame memory where MCU can access, the unchanged ranges are skipped
+    if (esp_panel_window_cache_check_column(st7796->window_cache, x_start, x_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,
+            x_start & 0xFF,
+            ((x_end - 1) >> 8) & 0xFF,
+            (x_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
+    if (esp_panel_window_cache_check_row(st7796->window_cache, y_start, y_end - 1)) {
+        ESP_GOTO_ON_ERROR(esp_lcd_panel_io_tx_param(io, LCD_CMD_RASET, (uint8_t[]) {
+            (y_start >> 8) & 0xFF,
+            y_start & 0xFF,
+            ((y_end - 1) >> 8) & 0xFF,
+            (y_end - 1) & 0xFF,
+        }, 4), err, TAG, "send command failed");
+    }
     // transfer frame buffer
     size_t len = (x_end - x_start) * (y_end - y_start) * st7796->fb_bits_per_pixel / 8;
     ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_color(io, LCD_CMD_RAMWR, color_data, len), TAG, "send command failed");
 
     return ESP_OK;
+
+err:
+    esp_panel_window_cache_invalidate(st7796->window_cache);
+    return ret;
 }
 
 static esp_err_t panel_st7796_invert_color(esp_lcd_panel_t *panel, bool invert_color_data)
@@ -297,6 +313,7 @@ static esp_err_t panel_st7796_invert_color(esp_lcd_panel_t *panel, bool invert_c
 static esp_err_t panel_st7796_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
+    esp_panel_window_cache_invalidate(st7796->window_cache);
     esp_lcd_panel_io_handle_t io = st7796->io;
     if (mirror_x) {
         st7796->madctl_val |= LCD_CMD_MX_BIT;
@@ -317,6 +334,7 @@ static esp_err_t panel_st7796_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool
 static esp_err_t panel_st7796_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
+    esp_panel_window_cache_invalidate(st7796->window_cache);
     esp_lcd_panel_io_handle_t io = st7796->io;
     if (swap_axes) {
         st7796->madctl_val |= LCD_CMD_MV_BIT;
@@ -332,6 +350,7 @@ static esp_err_t panel_st7796_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
 static esp_err_t panel_st7796_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
+    esp_panel_window_cache_invalidate(st7796->window_cache);
     st7796->x_gap = x_gap;
     st7796->y_gap = y_gap;
     return ESP_OK;
@@ -340,6 +359,7 @@ static esp_err_t panel_st7796_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_g
 static esp_err_t panel_st7796_disp_on_off(esp_lcd_panel_t *panel, bool on_off)
 {
     st7796_panel_t *st7796 = __containerof(panel, st7796_panel_t, base);
+    esp_panel_window_cache_invalidate(st7796->window_cache);
     esp_lcd_panel_io_handle_t io = st7796->io;
     int command = 0;
 
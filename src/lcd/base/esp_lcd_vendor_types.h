@@ -14,6 +14,8 @@
 #if SOC_MIPI_DSI_SUPPORTED
 #include "esp_lcd_mipi_dsi.h"
 #endif
+#include "utils/esp_panel_init_seq.h"
+#include "utils/esp_panel_window_cache.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,13 +24,11 @@ extern "C" {
 /**
  * @brief LCD panel initialization commands.
  *
+ * @note  It's the same as `esp_panel_init_seq_cmd_t`, so the table can be read by the interpreter of
+ *        `esp_panel_init_seq.h`, which also reads the bytecode of the default initialization sequences
+ *
  */
-typedef struct {
-    int cmd;                /*<! The specific LCD command */
-    const void *data;       /*<! Buffer that holds the command specific data */
-    size_t data_bytes;      /*<! Size of `data` in memory, in bytes */
-    unsigned int delay_ms;  /*<! Delay in milliseconds after this command */
-} esp_lcd_panel_vendor_init_cmd_t;
+typedef esp_panel_init_seq_cmd_t esp_lcd_panel_vendor_init_cmd_t;
 
 /**
  * @brief LCD panel vendor configuration.
@@ -39,7 +39,7 @@ typedef struct {
 typedef struct {
     const esp_lcd_panel_vendor_init_cmd_t *init_cmds;   /*!< Pointer to initialization commands array. Set to NULL if using default commands.
                                                          *   The array should be declared as `static const` and positioned outside the function.
-                                                         *   Please refer to `vendor_specific_init_default` in source file.
+                                                         *   The zero delays are skipped and the commands are sent back to back.
                                                          */
     unsigned int init_cmds_size;                        /*<! Number of commands in above array */
 
@@ -53,6 +53,10 @@ typedef struct {
         const esp_lcd_dpi_panel_config_t *dpi_config;   /*!< MIPI-DPI panel configuration */
     } mipi_config;
 #endif
+    esp_panel_window_cache_t *window_cache;             /*!< Cache of the address window for the MIPI-DCS panels, the
+                                                         *   unchanged CASET/RASET commands are skipped. Set to NULL to
+                                                         *   always send them. Only valid for the SPI and QSPI interfaces
+                                                         */
 
     struct {
         unsigned int mirror_by_cmd: 1;              /*<! The `mirror()` function will be implemented by LCD command if set to 1.
@@ -49,6 +49,69 @@ using namespace std;
 #define CREATE_TOUCH(name, bus, cfg)  _CREATE_TOUCH(name, bus, cfg)
 #define _CREATE_EXPANDER(name, host_id, address) make_shared<ESP_IOExpander_##name>(host_id, address)
 #define CREATE_EXPANDER(name, host_id, address)  _CREATE_EXPANDER(name, host_id, address)
+/**
+ * Macros for the parallel bring-up of `begin()`. The devices using the same bus are never initialized at the same time
+ *
+ */
+#define BEGIN_STEP_NUM_MAX          (4)
+#define BEGIN_PARALLEL_WORKER_NUM   (2)
+#define BEGIN_PARALLEL_STACK_SIZE   (6 * 1024)
+#define BEGIN_BUS_I2C(host_id)      (1UL << (host_id))
+#define BEGIN_BUS_SPI(host_id)      (1UL << (4 + (host_id)))
+#define BEGIN_BUS_LCD               (1UL << 8)
+#if ESP_PANEL_USE_EXPANDER
+#define BEGIN_EXPANDER_BUSES        BEGIN_BUS_I2C(ESP_PANEL_EXPANDER_HOST_ID)
+#else
+#define BEGIN_EXPANDER_BUSES        (0)
+#endif
+/* The hooks of the boards usually drive the pins of the IO expander, so they hold the bus of it */
+#if ESP_PANEL_USE_LCD
+#if (ESP_PANEL_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_SPI) || (ESP_PANEL_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_QSPI)
+#define BEGIN_LCD_BUS               BEGIN_BUS_SPI(ESP_PANEL_LCD_BUS_HOST_ID)
+#else
+#define BEGIN_LCD_BUS               BEGIN_BUS_LCD
+#endif
+#if (ESP_PANEL_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_RGB) && ((ESP_PANEL_LCD_3WIRE_SPI_CS_USE_EXPNADER) || \
+        (ESP_PANEL_LCD_3WIRE_SPI_SCL_USE_EXPNADER) || (ESP_PANEL_LCD_3WIRE_SPI_SDA_USE_EXPNADER))
+#define BEGIN_LCD_BUSES             (BEGIN_LCD_BUS | BEGIN_EXPANDER_BUSES)
+#elif defined(ESP_PANEL_BEGIN_LCD_START_FUNCTION) || defined(ESP_PANEL_BEGIN_LCD_END_FUNCTION)
+#define BEGIN_LCD_BUSES             (BEGIN_LCD_BUS | BEGIN_EXPANDER_BUSES)
+#else
+#define BEGIN_LCD_BUSES             BEGIN_LCD_BUS
+#endif
+#endif /* ESP_PANEL_USE_LCD */
+#if ESP_PANEL_USE_TOUCH
+#if ESP_PANEL_TOUCH_BUS_TYPE == ESP_PANEL_BUS_TYPE_I2C
+#define BEGIN_TOUCH_BUS             BEGIN_BUS_I2C(ESP_PANEL_TOUCH_BUS_HOST_ID)
+#else
+#define BEGIN_TOUCH_BUS             BEGIN_BUS_SPI(ESP_PANEL_TOUCH_BUS_HOST_ID)
+#endif
+#if defined(ESP_PANEL_BEGIN_TOUCH_START_FUNCTION) || defined(ESP_PANEL_BEGIN_TOUCH_END_FUNCTION)
+#define BEGIN_TOUCH_BUSES           (BEGIN_TOUCH_BUS | BEGIN_EXPANDER_BUSES)
+#else
+#define BEGIN_TOUCH_BUSES           BEGIN_TOUCH_BUS
+#endif
+#endif /* ESP_PANEL_USE_TOUCH */
+/**
+ * The hooks of LCD may drive the pins of touch (like the INT pin which selects the address of GT911), and the two
+ * devices may share a reset pin, so the touch waits for the LCD in these cases
+ *
+ */
+#if ESP_PANEL_USE_LCD && ESP_PANEL_USE_TOUCH && \
+    (defined(ESP_PANEL_BEGIN_LCD_START_FUNCTION) || defined(ESP_PANEL_BEGIN_LCD_END_FUNCTION) || \
+     defined(ESP_PANEL_BEGIN_TOUCH_START_FUNCTION) || defined(ESP_PANEL_BEGIN_TOUCH_END_FUNCTION) || \
+     ((ESP_PANEL_LCD_IO_RST >= 0) && (ESP_PANEL_LCD_IO_RST == ESP_PANEL_TOUCH_IO_RST)))
+#define BEGIN_TOUCH_AFTER_LCD       (1)
+#else
+#define BEGIN_TOUCH_AFTER_LCD       (0)
+#endif
+#if defined(ESP_PANEL_BEGIN_BACKLIGHT_START_FUNCTION) || defined(ESP_PANEL_BEGIN_BACKLIGHT_END_FUNCTION)
+#define BEGIN_BACKLIGHT_AFTER_TOUCH (1)
+#define BEGIN_BACKLIGHT_BUSES       BEGIN_EXPANDER_BUSES
+#else
+#define BEGIN_BACKLIGHT_AFTER_TOUCH (0)
+#define BEGIN_BACKLIGHT_BUSES       (0)
+#endif
 
 static const char *TAG = "ESP_Panel";
 
@@ -59,6 +122,8 @@ static const esp_lcd_panel_vendor_init_cmd_t lcd_init_cmds[] = ESP_PANEL_LCD_VEN
 ESP_Panel::ESP_Panel():
     _is_initialed(false),
     _use_external_expander(false),
+    _use_parallel_begin(false),
+    _begin_timeline{},
     _lcd_bus_ptr(nullptr),
     _touch_bus_ptr(nullptr),
     _lcd_ptr(nullptr),
@@ -97,6 +162,11 @@ void ESP_Panel::configExpander(ESP_IOExpander *expander)
     _expander_ptr.reset(expander);
 }
 
+void ESP_Panel::configParallelBegin(bool enable)
+{
+    _use_parallel_begin = enable;
+}
+
 bool ESP_Panel::init(void)
 {
     ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
@@ -494,6 +564,73 @@ bool ESP_Panel::begin(void)
     ESP_PANEL_BEGIN_START_FUNCTION(this);
 #endif
 
+    esp_panel_boot_step_t steps[BEGIN_STEP_NUM_MAX] = {};
+    uint8_t num = 0;
+    uint32_t expander_step = 0;
+    uint32_t lcd_step = 0;
+    uint32_t touch_step = 0;
+    (void)expander_step;
+    (void)lcd_step;
+    (void)touch_step;
+#if ESP_PANEL_USE_EXPANDER
+    steps[num] = {
+        "expander", [](void *ctx) { return static_cast<ESP_Panel *>(ctx)->beginExpander(); }, this, 0,
+        BEGIN_EXPANDER_BUSES,
+    };
+    expander_step = ESP_PANEL_BOOT_STEP(num++);
+#endif
+#if ESP_PANEL_USE_LCD
+    steps[num] = {
+        "lcd", [](void *ctx) { return static_cast<ESP_Panel *>(ctx)->beginLcd(); }, this, expander_step,
+        BEGIN_LCD_BUSES,
+    };
+    lcd_step = ESP_PANEL_BOOT_STEP(num++);
+#endif
+#if ESP_PANEL_USE_TOUCH
+    steps[num] = {
+        "touch", [](void *ctx) { return static_cast<ESP_Panel *>(ctx)->beginTouch(); }, this,
+        expander_step | (BEGIN_TOUCH_AFTER_LCD ? lcd_step : 0), BEGIN_TOUCH_BUSES,
+    };
+    touch_step = ESP_PANEL_BOOT_STEP(num++);
+#endif
+#if ESP_PANEL_USE_BACKLIGHT
+    steps[num] = {
+        "backlight", [](void *ctx) { return static_cast<ESP_Panel *>(ctx)->beginBacklight(); }, this,
+        expander_step | lcd_step | (BEGIN_BACKLIGHT_AFTER_TOUCH ? touch_step : 0), BEGIN_BACKLIGHT_BUSES,
+    };
+    num++;
+#endif
+
+    esp_panel_boot_config_t boot_config = ESP_PANEL_BOOT_CONFIG_DEFAULT();
+    if (_use_parallel_begin) {
+        /* Keep the interrupts of the devices on the same core as the caller */
+        boot_config.num_workers = BEGIN_PARALLEL_WORKER_NUM;
+        boot_config.core_id = xPortGetCoreID();
+        boot_config.stack_size = BEGIN_PARALLEL_STACK_SIZE;
+    }
+    bool is_ok = esp_panel_boot_run(&boot_config, steps, num, &_begin_timeline);
+    for (int i = 0; i < _begin_timeline.num; i++) {
+        const esp_panel_boot_record_t *record = &_begin_timeline.records[i];
+        if (record->flags.is_run) {
+            ESP_LOGD(TAG, "Begin %s: %d ~ %d us (thread %d)", record->name, (int)record->start_us,
+                     (int)record->end_us, (int)record->worker);
+        }
+    }
+    ESP_LOGD(TAG, "Begin devices: %d us (%d us in total)", (int)_begin_timeline.total_us,
+             (int)_begin_timeline.busy_us);
+    ESP_PANEL_CHECK_FALSE_RET(is_ok, false, "Begin devices failed (step %d)", _begin_timeline.failed_step);
+
+    ESP_LOGD(TAG, "Panel begin end");
+    // Run additional code after the panel is started if needed
+#ifdef ESP_PANEL_BEGIN_END_FUNCTION
+    ESP_PANEL_BEGIN_END_FUNCTION(this);
+#endif
+
+    return true;
+}
+
+bool ESP_Panel::beginExpander(void)
+{
 #if ESP_PANEL_USE_EXPANDER
     // Run additional code before starting the IO expander if needed
 #ifdef ESP_PANEL_BEGIN_EXPANDER_START_FUNCTION
@@ -508,6 +645,11 @@ bool ESP_Panel::begin(void)
 #endif
 #endif /* ESP_PANEL_USE_EXPANDER */
 
+    return true;
+}
+
+bool ESP_Panel::beginLcd(void)
+{
 #if ESP_PANEL_USE_LCD
     // Run additional code before starting the bus and LCD if needed
 #ifdef ESP_PANEL_BEGIN_LCD_START_FUNCTION
@@ -548,6 +690,11 @@ bool ESP_Panel::begin(void)
 #endif
 #endif /* ESP_PANEL_USE_LCD */
 
+    return true;
+}
+
+bool ESP_Panel::beginTouch(void)
+{
 #if ESP_PANEL_USE_TOUCH
     // Run additional code before starting the bus and touch if needed
 #ifdef ESP_PANEL_BEGIN_TOUCH_START_FUNCTION
@@ -572,6 +719,11 @@ bool ESP_Panel::begin(void)
 #endif
 #endif /* ESP_PANEL_USE_TOUCH */
 
+    return true;
+}
+
+bool ESP_Panel::beginBacklight(void)
+{
 #if ESP_PANEL_USE_BACKLIGHT
     // Run additional code before starting the backlight if needed
 #ifdef ESP_PANEL_BEGIN_BACKLIGHT_START_FUNCTION
@@ -590,12 +742,6 @@ bool ESP_Panel::begin(void)
 #endif
 #endif /* ESP_PANEL_USE_BACKLIGHT */
 
-    ESP_LOGD(TAG, "Panel begin end");
-    // Run additional code after the panel is started if needed
-#ifdef ESP_PANEL_BEGIN_END_FUNCTION
-    ESP_PANEL_BEGIN_END_FUNCTION(this);
-#endif
-
     return true;
 }
 
@@ -666,4 +812,9 @@ ESP_IOExpander *ESP_Panel::getExpander(void)
     return _expander_ptr.get();
 }
 
+const esp_panel_boot_timeline_t *ESP_Panel::getBeginTimeline(void)
+{
+    return &_begin_timeline;
+}
+
 #endif /* ESP_PANEL_USE_BOARD */
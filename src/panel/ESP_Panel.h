@@ -12,6 +12,7 @@
 #include "lcd/ESP_PanelLcd.h"
 #include "touch/ESP_PanelTouch.h"
 #include "backlight/ESP_PanelBacklight.h"
+#include "utils/esp_panel_boot.h"
 #include "ESP_IOExpander_Library.h"
 
 #ifdef ESP_PANEL_USE_BOARD
@@ -46,6 +47,20 @@ public:
      */
     void configExpander(ESP_IOExpander *expander);
 
+    /**
+     * @brief Configure whether to bring up the devices in parallel. This function should be called before `begin()`
+     *
+     * @note  When enabled, the devices on different buses are initialized by helper threads at the same time, so the
+     *        waits of the LCD reset and sleep-out overlap with the touch initialization. The devices which share a
+     *        bus or a reset pin are still initialized one by one, and so are the LCD and the touch when the board
+     *        defines any of their `ESP_PANEL_BEGIN_*_FUNCTION()` hooks
+     * @note  The IO expander is always initialized before the other devices, and the backlight after the LCD
+     *
+     * @param enable Whether to enable the parallel bring-up, default is disabled
+     *
+     */
+    void configParallelBegin(bool enable);
+
     /**
      * @brief Initialize the panel device, the `begin()` function should be called after this function
      *
@@ -80,6 +95,13 @@ public:
     ESP_PanelBacklight *getBacklight(void);
     ESP_IOExpander *getExpander(void);
 
+    /**
+     * @brief Get the timeline of the last `begin()`, which records the start and end time of each device
+     *
+     * @return Pointer of the timeline
+     */
+    const esp_panel_boot_timeline_t *getBeginTimeline(void);
+
     /**
      * @brief Here are the functions to get the some parameters of the devices
      *
@@ -102,8 +124,15 @@ public:
     }
 
 private:
+    bool beginExpander(void);
+    bool beginLcd(void);
+    bool beginTouch(void);
+    bool beginBacklight(void);
+
     bool _is_initialed;
     bool _use_external_expander;
+    bool _use_parallel_begin;
+    esp_panel_boot_timeline_t _begin_timeline;
     std::shared_ptr<ESP_PanelBus> _lcd_bus_ptr;
     std::shared_ptr<ESP_PanelBus> _touch_bus_ptr;
     std::shared_ptr<ESP_PanelLcd> _lcd_ptr;
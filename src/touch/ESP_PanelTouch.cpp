@@ -4,8 +4,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include "ESP_PanelLog.h"
 #include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
 #include "ESP_PanelTouch.h"
 
 static const char *TAG = "ESP_PanelTouch";
@@ -51,7 +55,10 @@ ESP_PanelTouch::ESP_PanelTouch(ESP_PanelBus *bus, uint16_t width, uint16_t heigh
     _tp_buttons_state{0},
     onTouchInterruptCallback(NULL),
     _isr_sem(NULL),
-    callback_data(CALLBACK_DATA_DEFAULT())
+    callback_data(CALLBACK_DATA_DEFAULT()),
+    _filter(NULL),
+    _calib{},
+    _sampler{}
 {
     if (int_io >= 0) {
         config.interrupt_callback = onTouchInterrupt;
@@ -70,7 +77,10 @@ ESP_PanelTouch::ESP_PanelTouch(ESP_PanelBus *bus, const esp_lcd_touch_config_t &
     _tp_buttons_state{0},
     onTouchInterruptCallback(NULL),
     _isr_sem(NULL),
-    callback_data(CALLBACK_DATA_DEFAULT())
+    callback_data(CALLBACK_DATA_DEFAULT()),
+    _filter(NULL),
+    _calib{},
+    _sampler{}
 {
     if ((config.int_gpio_num != GPIO_NUM_NC) && (config.interrupt_callback == NULL) && (config.user_data == NULL)) {
         this->config.interrupt_callback = onTouchInterrupt;
@@ -113,12 +123,17 @@ bool ESP_PanelTouch::init(void)
 bool ESP_PanelTouch::del(void)
 {
     ESP_PANEL_CHECK_NULL_RET(handle, false, "Invalid handle");
+    ESP_PANEL_CHECK_FALSE_RET(stopSampler(), false, "Stop background sampler failed");
     ESP_PANEL_CHECK_ERR_RET(esp_lcd_touch_del(handle), false, "Delete touch panel failed");
 
     if (_isr_sem != NULL) {
         vSemaphoreDelete(_isr_sem);
         _isr_sem = NULL;
     }
+    if (_filter != NULL) {
+        heap_caps_free(_filter);
+        _filter = NULL;
+    }
 
     ESP_LOGD(TAG, "Touch panel @%p deleted", handle);
     handle = NULL;
@@ -166,6 +181,29 @@ bool ESP_PanelTouch::readRawData(uint8_t max_points_num, int timeout_ms)
         ESP_LOGE(TAG, "The max points number out of range [%d/%d]", max_points_num, CONFIG_ESP_LCD_TOUCH_MAX_POINTS);
     }
 
+    if (_sampler.task != NULL) {
+        esp_panel_touch_sample_t sample;
+        TickType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+        TickType_t start_ticks = xTaskGetTickCount();
+        /* The latest sample is kept in the ring after being taken, so only a newer one is taken as fresh */
+        while (!esp_panel_touch_ring_get_latest(&_sampler.ring, &sample) ||
+                ((int32_t)(sample.seq - _sampler.read_seq) < 0)) {
+            TickType_t elapsed_ticks = xTaskGetTickCount() - start_ticks;
+            if ((timeout_ms >= 0) && (elapsed_ticks >= timeout_ticks)) {
+                ESP_LOGD(TAG, "Touch panel @%p wait for sample timeout", handle);
+                return true;
+            }
+            xSemaphoreTake(_sampler.sample_sem, (timeout_ms < 0) ? portMAX_DELAY : (timeout_ticks - elapsed_ticks));
+        }
+        _sampler.read_seq = sample.seq + 1;
+        _tp_points_num = std::min(sample.points_num, max_points_num);
+        for (int i = 0; i < _tp_points_num; i++) {
+            _tp_points[i] = ESP_PanelTouchPoint(sample.points[i].x, sample.points[i].y, sample.points[i].strength);
+        }
+
+        return true;
+    }
+
     if (_isr_sem != NULL) {
         BaseType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
         if (xSemaphoreTake(_isr_sem, timeout_ticks) != pdTRUE) {
@@ -174,8 +212,10 @@ bool ESP_PanelTouch::readRawData(uint8_t max_points_num, int timeout_ms)
         }
     }
 
-    ESP_PANEL_CHECK_ERR_RET(esp_lcd_touch_read_data(handle), false, "Read data failed");
-    esp_lcd_touch_get_coordinates(handle, x, y, strength, &_tp_points_num, max_points_num);
+    int64_t timestamp_us = 0;
+    ESP_PANEL_CHECK_FALSE_RET(
+        readPointsFromDevice(x, y, strength, _tp_points_num, max_points_num, timestamp_us), false, "Read data failed"
+    );
 
     for (int i = 0; i < _tp_points_num; i++) {
         _tp_points[i].x = x[i];
@@ -222,6 +262,151 @@ int ESP_PanelTouch::readButtonState(uint8_t n, int timeout_ms)
     return getButtonState(n);
 }
 
+bool ESP_PanelTouch::setFilters(const esp_panel_touch_filter_stage_t stages[], uint8_t num, uint16_t track_distance)
+{
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Invalid handle");
+    ESP_PANEL_CHECK_FALSE_RET(_sampler.task == NULL, false, "Background sampler is running");
+
+    if (num == 0) {
+        heap_caps_free(_filter);
+        _filter = NULL;
+
+        return true;
+    }
+
+    esp_panel_touch_filter_t *filter = _filter;
+    if (filter == NULL) {
+        filter = (esp_panel_touch_filter_t *)heap_caps_malloc(
+                     sizeof(esp_panel_touch_filter_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+                 );
+        ESP_PANEL_CHECK_NULL_RET(filter, false, "Malloc filter failed");
+    }
+    esp_panel_touch_filter_config_t filter_config = {
+        .stages = stages,
+        .num_stages = num,
+        .track_distance = track_distance,
+    };
+    if (!esp_panel_touch_filter_init(filter, &filter_config)) {
+        ESP_LOGE(TAG, "Invalid filter stages");
+        if (filter != _filter) {
+            heap_caps_free(filter);
+        }
+
+        return false;
+    }
+    _filter = filter;
+    ESP_LOGD(TAG, "Filters set, stages(%d)", (int)num);
+
+    return true;
+}
+
+bool ESP_PanelTouch::calibrate(const esp_panel_touch_calib_point_t points[], uint8_t num)
+{
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Invalid handle");
+    ESP_PANEL_CHECK_FALSE_RET(_sampler.task == NULL, false, "Background sampler is running");
+
+    if (num == 0) {
+        _calib = {};
+
+        return true;
+    }
+
+    esp_panel_touch_calib_t matrix = {};
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_touch_calib_solve(points, num, &matrix), false,
+                              "Invalid calibration points(%d)", (int)num);
+    _calib.matrix = matrix;
+    _calib.is_enabled = true;
+    ESP_LOGD(TAG, "Calibration set, points(%d)", (int)num);
+
+    return true;
+}
+
+bool ESP_PanelTouch::saveCalibration(uint8_t *blob, size_t size)
+{
+    ESP_PANEL_CHECK_FALSE_RET(_calib.is_enabled, false, "Calibration is disabled");
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_touch_calib_save(&_calib.matrix, blob, size) > 0, false,
+                              "Save calibration failed");
+
+    return true;
+}
+
+bool ESP_PanelTouch::loadCalibration(const uint8_t *blob, size_t size)
+{
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Invalid handle");
+    ESP_PANEL_CHECK_FALSE_RET(_sampler.task == NULL, false, "Background sampler is running");
+
+    ESP_PANEL_CHECK_FALSE_RET(esp_panel_touch_calib_load(&_calib.matrix, blob, size), false,
+                              "Invalid calibration blob");
+    _calib.is_enabled = true;
+    ESP_LOGD(TAG, "Calibration loaded");
+
+    return true;
+}
+
+bool ESP_PanelTouch::setBackgroundSampler(uint32_t ring_size, uint32_t period_ms, esp_panel_touch_ring_policy_t policy,
+                                          int core_id, uint32_t priority)
+{
+    ESP_PANEL_CHECK_NULL_RET(handle, false, "Invalid handle");
+    ESP_PANEL_CHECK_FALSE_RET(period_ms > 0, false, "Invalid period");
+
+    ESP_PANEL_CHECK_FALSE_RET(stopSampler(), false, "Stop background sampler failed");
+    if (ring_size == 0) {
+        return true;
+    }
+
+    ESP_PANEL_CHECK_FALSE_RET(
+        (ring_size >= 2) && (ring_size <= 65536) && !(ring_size & (ring_size - 1)), false,
+        "Invalid ring size(%d), should be a power of 2", (int)ring_size
+    );
+    size_t buf_size = esp_panel_touch_ring_get_buf_size(ring_size);
+    _sampler.slots = (esp_panel_touch_ring_slot_t *)heap_caps_malloc(buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_PANEL_CHECK_NULL_RET(_sampler.slots, false, "Malloc sample ring(%d) failed", (int)buf_size);
+    esp_panel_touch_ring_init(&_sampler.ring, _sampler.slots, ring_size, policy);
+    _sampler.period_ms = period_ms;
+    _sampler.exit_sem = xSemaphoreCreateBinary();
+    _sampler.sample_sem = xSemaphoreCreateBinary();
+    if ((_sampler.exit_sem == NULL) || (_sampler.sample_sem == NULL) ||
+            (xTaskCreatePinnedToCore(samplerTask, ESP_PANEL_TOUCH_SAMPLER_TASK_NAME,
+                                     ESP_PANEL_TOUCH_SAMPLER_TASK_STACK_SIZE, this, priority, &_sampler.task,
+                                     (core_id < 0) ? tskNO_AFFINITY : core_id) != pdPASS)) {
+        ESP_LOGE(TAG, "Create semaphore or sampler task failed");
+        if (_sampler.exit_sem != NULL) {
+            vSemaphoreDelete(_sampler.exit_sem);
+        }
+        if (_sampler.sample_sem != NULL) {
+            vSemaphoreDelete(_sampler.sample_sem);
+        }
+        heap_caps_free(_sampler.slots);
+        _sampler = {};
+
+        return false;
+    }
+    ESP_LOGD(TAG, "Background sampler started, ring size(%d), period(%d ms)", (int)ring_size, (int)period_ms);
+
+    return true;
+}
+
+bool ESP_PanelTouch::getLatestSample(esp_panel_touch_sample_t &sample)
+{
+    ESP_PANEL_CHECK_NULL_RET(_sampler.task, false, "Background sampler is not running");
+
+    return esp_panel_touch_ring_get_latest(&_sampler.ring, &sample);
+}
+
+bool ESP_PanelTouch::popSample(esp_panel_touch_sample_t &sample)
+{
+    ESP_PANEL_CHECK_NULL_RET(_sampler.task, false, "Background sampler is not running");
+
+    return esp_panel_touch_ring_pop(&_sampler.ring, &sample);
+}
+
+bool ESP_PanelTouch::getSamplerStats(esp_panel_touch_ring_stats_t &stats, bool clear)
+{
+    ESP_PANEL_CHECK_NULL_RET(_sampler.task, false, "Background sampler is not running");
+
+    return esp_panel_touch_ring_get_stats(&_sampler.ring, &stats, clear);
+}
+
 void ESP_PanelTouch::configResetActiveLevel(uint8_t level)
 {
     config.levels.reset = level;
@@ -294,3 +479,94 @@ void ESP_PanelTouch::onTouchInterrupt(esp_lcd_touch_handle_t tp)
         portYIELD_FROM_ISR();
     }
 }
+
+bool ESP_PanelTouch::readPointsFromDevice(uint16_t x[], uint16_t y[], uint16_t strength[], uint8_t &points_num,
+                                          uint8_t max_points_num, int64_t &timestamp_us)
+{
+    points_num = 0;
+    if (esp_lcd_touch_read_data(handle) != ESP_OK) {
+        return false;
+    }
+    timestamp_us = esp_timer_get_time();
+    esp_lcd_touch_get_coordinates(handle, x, y, strength, &points_num, max_points_num);
+    if (_calib.is_enabled) {
+        // The points are read after the swap, so are the bounds of the screen
+        int x_max = _swap_xy ? config.y_max : config.x_max;
+        int y_max = _swap_xy ? config.x_max : config.y_max;
+        esp_panel_touch_calib_apply(&_calib.matrix, x, y, points_num, std::max<int>(x_max - 1, 0),
+                                    std::max<int>(y_max - 1, 0));
+    }
+    if (_filter != NULL) {
+        esp_panel_touch_filter_process(_filter, timestamp_us, x, y, points_num);
+    }
+
+    return true;
+}
+
+bool ESP_PanelTouch::stopSampler(void)
+{
+    if (_sampler.task == NULL) {
+        return true;
+    }
+
+    _sampler.is_exiting = true;
+    if (_isr_sem != NULL) {
+        xSemaphoreGive(_isr_sem);
+    }
+    ESP_PANEL_CHECK_FALSE_RET(
+        xSemaphoreTake(_sampler.exit_sem, pdMS_TO_TICKS(_sampler.period_ms + 1000)) == pdTRUE, false,
+        "Wait for sampler task to exit timeout"
+    );
+    vSemaphoreDelete(_sampler.exit_sem);
+    vSemaphoreDelete(_sampler.sample_sem);
+    heap_caps_free(_sampler.slots);
+    _sampler = {};
+
+    return true;
+}
+
+void ESP_PanelTouch::samplerTask(void *arg)
+{
+    ESP_PanelTouch *touch = (ESP_PanelTouch *)arg;
+    const TickType_t period_ticks = std::max<TickType_t>(pdMS_TO_TICKS(touch->_sampler.period_ms), 1);
+    const uint8_t max_points_num = std::min(CONFIG_ESP_LCD_TOUCH_MAX_POINTS, ESP_PANEL_TOUCH_RING_POINTS_MAX);
+    uint16_t x[CONFIG_ESP_LCD_TOUCH_MAX_POINTS] = {0};
+    uint16_t y[CONFIG_ESP_LCD_TOUCH_MAX_POINTS] = {0};
+    uint16_t strength[CONFIG_ESP_LCD_TOUCH_MAX_POINTS] = {0};
+    esp_panel_touch_sample_t sample = {};
+    bool is_pressed = false;
+
+    while (!touch->_sampler.is_exiting) {
+        if (touch->_isr_sem != NULL) {
+            /* Keep reading while touched, since some controllers don't raise an interrupt for the release */
+            if ((xSemaphoreTake(touch->_isr_sem, is_pressed ? period_ticks : portMAX_DELAY) != pdTRUE) && !is_pressed) {
+                continue;
+            }
+        } else {
+            vTaskDelay(period_ticks);
+        }
+        if (touch->_sampler.is_exiting) {
+            break;
+        }
+
+        uint8_t points_num = 0;
+        if (!touch->readPointsFromDevice(x, y, strength, points_num, max_points_num, sample.timestamp_us)) {
+            ESP_LOGW(TAG, "Touch panel @%p read data failed", touch->handle);
+            continue;
+        }
+        /* Only the first release is pushed */
+        if ((points_num == 0) && !is_pressed) {
+            continue;
+        }
+        sample.points_num = points_num;
+        for (int i = 0; i < points_num; i++) {
+            sample.points[i] = {x[i], y[i], strength[i]};
+        }
+        esp_panel_touch_ring_push(&touch->_sampler.ring, &sample);
+        xSemaphoreGive(touch->_sampler.sample_sem);
+        is_pressed = (points_num > 0);
+    }
+
+    xSemaphoreGive(touch->_sampler.exit_sem);
+    vTaskDelete(NULL);
+}
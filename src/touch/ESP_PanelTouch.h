@@ -9,6 +9,21 @@
 #include <functional>
 #include "touch/base/esp_lcd_touch.h"
 #include "bus/ESP_PanelBus.h"
+#include "utils/esp_panel_touch_calib.h"
+#include "utils/esp_panel_touch_filter.h"
+#include "utils/esp_panel_touch_ring.h"
+
+/**
+ * @brief Task of the background sampler, see `setBackgroundSampler()`. The stack covers a bus read, the calibration,
+ *        the filters and the logs
+ *
+ */
+#ifndef ESP_PANEL_TOUCH_SAMPLER_TASK_NAME
+#define ESP_PANEL_TOUCH_SAMPLER_TASK_NAME           "touch_sampler"
+#endif
+#ifndef ESP_PANEL_TOUCH_SAMPLER_TASK_STACK_SIZE
+#define ESP_PANEL_TOUCH_SAMPLER_TASK_STACK_SIZE     (4 * 1024)
+#endif
 
 /**
  * @brief Touch device default configuration macro
@@ -175,10 +190,15 @@ public:
      *        the raw data
      * @note  If the interrupt pin is set, this function will be blocked until either the interrupt occurs or a timeout
      *        is triggered
+     * @note  If the background sampler is running, this function takes the latest sample from it without accessing the
+     *        bus or waiting for the interrupt. It waits up to `timeout_ms` for a sample newer than the one taken last
+     *        time, and no point is read if none arrives, like the timeout of the interrupt. So the timeout should not be
+     *        shorter than the period of the sampler to follow a holding finger
      *
      * @param max_points_num The max number of the points to read
-     * @param timeout_ms     The timeout of waiting for the interrupt, it is only used when the interrupt pin is set. Set to
-     *                       `-1` if waiting forever
+     * @param timeout_ms     The timeout of waiting for the interrupt or the new sample of the background sampler, it is
+     *                       only used when the interrupt pin is set or the sampler is running. Set to `-1` if waiting
+     *                       forever
      *
      * @return true if success, otherwise false
      */
@@ -239,6 +259,129 @@ public:
      */
     int readButtonState(uint8_t index = 0, int timeout_ms = 0);
 
+    /**
+     * @brief Smooth the points read from the touch device by a chain of filter stages, default is disabled (0)
+     *
+     * @note  This function should be called after `begin()`, and before `setBackgroundSampler()`
+     * @note  The stages run in order on every tracked point, after `process_coordinates` of the configuration. A median
+     *        stage removes the spikes, and a One-Euro stage smooths the holding finger while following the moving
+     *        one, like `{ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3), ESP_PANEL_TOUCH_FILTER_STAGE_ONE_EURO(1000, 5000, 1000)}`.
+     *        See `utils/esp_panel_touch_filter.h`
+     * @note  The weights follow the intervals between the reads, so the smoothing is kept at a lower sample rate
+     *
+     * @param stages         Array of the stages, which are copied
+     * @param num            Number of the stages, up to `ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX`. 0 means disable
+     * @param track_distance A point farther than it from all the tracked points starts a new track, 0 means no limit
+     *
+     * @return true if success, otherwise false
+     */
+    bool setFilters(const esp_panel_touch_filter_stage_t stages[], uint8_t num, uint16_t track_distance = 0);
+
+    /**
+     * @brief Map the points read from the touch device by an affine calibration solved from the reference points,
+     *        default is disabled (0)
+     *
+     * @note  This function should be called after `begin()`, and before `setBackgroundSampler()`
+     * @note  The raw points of the references should be read while the calibration is disabled. Three points spread
+     *        over the screen give the exact solution, more points give the least-squares one. See
+     *        `utils/esp_panel_touch_calib.h`
+     * @note  The calibration runs before the filters, with integer math only. The points are clamped into the screen,
+     *        whose width and height follow `swapXY()`
+     * @note  The calibration runs after the mirror and the swap of the driver. For the resistive controllers like
+     *        XPT2046 with `ESP_PANEL_TOUCH_XPT2046_CONVERT_ADC_TO_COORDS` disabled, the raw ADC values can be
+     *        calibrated directly, but `mirrorX()`, `mirrorY()` and `swapXY()` must be disabled, since the mirror of the
+     *        driver (`x_max - x`) underflows on the raw values. The calibration covers the mirror and the swap anyway
+     *
+     * @param points Array of the reference points
+     * @param num    Number of the points, at least 3. 0 means disable
+     *
+     * @return true if success, otherwise false
+     */
+    bool calibrate(const esp_panel_touch_calib_point_t points[], uint8_t num);
+
+    /**
+     * @brief Save the calibration into a blob, which can be kept by the user like in NVS
+     *
+     * @param blob Buffer of the blob
+     * @param size Size of the buffer, at least `ESP_PANEL_TOUCH_CALIB_BLOB_SIZE`
+     *
+     * @return true if success, false if the calibration is disabled or the buffer is too small
+     */
+    bool saveCalibration(uint8_t *blob, size_t size);
+
+    /**
+     * @brief Restore and enable the calibration from a blob saved by `saveCalibration()`
+     *
+     * @note  This function should be called after `begin()`, and before `setBackgroundSampler()`
+     *
+     * @param blob The blob
+     * @param size Size of the blob
+     *
+     * @return true if success, otherwise false
+     */
+    bool loadCalibration(const uint8_t *blob, size_t size);
+
+    /**
+     * @brief Read the touch device by a background task, which pushes the timestamped samples into a lock-free ring,
+     *        default is disabled (0)
+     *
+     * @note  This function should be called after `begin()`
+     * @note  If the interrupt is enabled, the task reads on every interrupt, and keeps reading every `period_ms` while
+     *        the screen is touched, so the release is caught even if the controller doesn't raise an interrupt for it.
+     *        Otherwise, the task reads every `period_ms`
+     * @note  While the sampler is running, `readRawData()` takes the latest sample and only waits for a new one up to
+     *        its timeout, so the readers like LVGL don't wait for the bus. `popSample()` gets the history of the
+     *        samples. All the readers should be in the same task. See `utils/esp_panel_touch_ring.h`
+     * @note  The task is created with `ESP_PANEL_TOUCH_SAMPLER_TASK_NAME` and `ESP_PANEL_TOUCH_SAMPLER_TASK_STACK_SIZE`
+     * @note  The callback attached by `attachInterruptCallback()` still runs in the ISR
+     *
+     * @param ring_size Number of the samples kept in the ring, a power of 2. 0 means disable
+     * @param period_ms Period of the reading while touched or without the interrupt
+     * @param policy    Policy when the ring is full
+     * @param core_id   Core which the task is pinned to, -1 means no affinity
+     * @param priority  Priority of the task
+     *
+     * @return true if success, otherwise false
+     */
+    bool setBackgroundSampler(uint32_t ring_size, uint32_t period_ms = 10,
+                              esp_panel_touch_ring_policy_t policy = ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST,
+                              int core_id = -1, uint32_t priority = 5);
+
+    /**
+     * @brief Get the latest sample of the background sampler without consuming it
+     *
+     * @note  This function should be called after `setBackgroundSampler()`
+     *
+     * @param sample The sample
+     *
+     * @return true if success, false if no sample has been read or the sampler is not running
+     */
+    bool getLatestSample(esp_panel_touch_sample_t &sample);
+
+    /**
+     * @brief Pop the oldest sample of the background sampler which is not consumed
+     *
+     * @note  This function should be called after `setBackgroundSampler()`
+     * @note  The samples can be fed to the gesture engine, see `utils/esp_panel_touch_gesture.h`
+     *
+     * @param sample The sample, the gaps of `seq` show the lost samples
+     *
+     * @return true if success, false if the ring is empty or the sampler is not running
+     */
+    bool popSample(esp_panel_touch_sample_t &sample);
+
+    /**
+     * @brief Get the counters of the background sampler
+     *
+     * @note  This function should be called after `setBackgroundSampler()`
+     *
+     * @param stats Counters of the sample ring
+     * @param clear Whether to clear the counters after reading
+     *
+     * @return true if success, otherwise false
+     */
+    bool getSamplerStats(esp_panel_touch_ring_stats_t &stats, bool clear = false);
+
     /**
      * @brief Configure the active level of reset signal
      *
@@ -302,6 +445,10 @@ protected:
 
 private:
     static void onTouchInterrupt(esp_lcd_touch_handle_t tp);
+    static void samplerTask(void *arg);
+    bool readPointsFromDevice(uint16_t x[], uint16_t y[], uint16_t strength[], uint8_t &points_num,
+                              uint8_t max_points_num, int64_t &timestamp_us);
+    bool stopSampler(void);
 
     bool _swap_xy;
     bool _mirror_x;
@@ -317,4 +464,19 @@ private:
         void *user_data;
     } ESP_PanelTouchCallbackData_t;
     ESP_PanelTouchCallbackData_t callback_data;
+    esp_panel_touch_filter_t *_filter;
+    struct {
+        bool is_enabled;
+        esp_panel_touch_calib_t matrix;
+    } _calib;
+    struct {
+        TaskHandle_t task;
+        SemaphoreHandle_t exit_sem;     // Given by the task before it exits
+        SemaphoreHandle_t sample_sem;   // Given by the task after every pushed sample
+        uint32_t read_seq;              // Sequence number of the next sample taken by `readRawData()`
+        volatile bool is_exiting;
+        uint32_t period_ms;
+        esp_panel_touch_ring_slot_t *slots;
+        esp_panel_touch_ring_t ring;
+    } _sampler;
 };
@@ -37,9 +37,37 @@ end:
 
 bool ESP_PanelTouch_XPT2046::begin(void)
 {
+    ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
+
     ESP_PANEL_CHECK_NULL_RET(bus, false, "Invalid bus");
 
-    ESP_PANEL_CHECK_ERR_RET(esp_lcd_touch_new_spi_xpt2046(bus->getPanelIO_Handle(), &config, &handle), false, "New driver failed");
+    esp_lcd_touch_io_xpt2046_config_t tp_xpt2046_config = {
+        .spi_host_id = -1,
+    };
+    if ((ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES > 0) && (config.driver_data == NULL) &&
+            (bus->getType() == ESP_PANEL_BUS_TYPE_SPI)) {
+        ESP_PanelBus_SPI *spi_bus = static_cast<ESP_PanelBus_SPI *>(bus);
+        const esp_lcd_panel_io_spi_config_t *io_config = spi_bus->getIoConfig();
+        tp_xpt2046_config.spi_host_id = spi_bus->getHostId();
+        tp_xpt2046_config.cs_gpio_num = io_config->cs_gpio_num;
+        tp_xpt2046_config.pclk_hz = io_config->pclk_hz;
+        tp_xpt2046_config.spi_mode = io_config->spi_mode;
+        ESP_LOGD(TAG, "Use batch reads of the bus(host: %d, cs: %d)", tp_xpt2046_config.spi_host_id,
+                 tp_xpt2046_config.cs_gpio_num);
+        config.driver_data = (void *)&tp_xpt2046_config;
+        // The device of the batch reads takes over the CS line and the host slot of the panel IO, which can't be
+        // shared, so delete the panel IO first
+        if (bus->getPanelIO_Handle() != NULL) {
+            ESP_PANEL_CHECK_FALSE_RET(spi_bus->delPanelIO(), false, "Delete panel IO of the bus failed");
+        }
+    }
+
+    esp_err_t ret = esp_lcd_touch_new_spi_xpt2046(bus->getPanelIO_Handle(), &config, &handle);
+    // The driver has copied the config, don't keep the pointer to the local one
+    if (config.driver_data == (void *)&tp_xpt2046_config) {
+        config.driver_data = NULL;
+    }
+    ESP_PANEL_CHECK_ERR_RET(ret, false, "New driver failed");
 
     return true;
 }
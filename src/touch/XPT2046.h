@@ -8,6 +8,7 @@
 
 #include "base/esp_lcd_touch_xpt2046.h"
 #include "ESP_PanelTouch.h"
+#include "bus/SPI.h"
 
 /**
  * @brief XPT2046 touch device object class
@@ -44,6 +45,10 @@ public:
     /**
      * @brief Startup the touch device
      *
+     * @note  If `ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES` > 0 and `driver_data` of the configuration is not set, the
+     *        batch reads are used on the host and the CS line of the SPI bus. The panel IO of the bus is deleted to free
+     *        them (see `ESP_PanelBus_SPI::delPanelIO()`), so it can't be used by `readRegister()` anymore
+     *
      * @return true if success, otherwise false
      */
     bool begin(void) override;
@@ -9,8 +9,10 @@
 #include "ESP_PanelLog.h"
 
 #include <driver/gpio.h>
+#include <driver/spi_master.h>
 #include <esp_check.h>
 #include <esp_err.h>
+#include <esp_heap_caps.h>
 #include <esp_lcd_panel_io.h>
 #include <esp_rom_gpio.h>
 #include <freertos/FreeRTOS.h>
@@ -22,6 +24,7 @@
 
 #include "sdkconfig.h"
 
+#include "utils/esp_panel_xpt2046_batch.h"
 #include "esp_lcd_touch_xpt2046.h"
 
 static const char *TAG = "xpt2046";
@@ -53,6 +56,10 @@ enum xpt2046_registers {
     TEMP1       = 0xF6 | XPT2046_PD_BITS, // 1      111   0       1     1       X
 };
 
+#if CONFIG_XPT2046_BATCH_SAMPLES > ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX
+#error "The number of the batch samples is too large"
+#endif
+
 #if CONFIG_XPT2046_ENABLE_LOCKING
 #define XPT2046_LOCK(lock) portENTER_CRITICAL(lock)
 #define XPT2046_UNLOCK(lock) portEXIT_CRITICAL(lock)
@@ -67,6 +74,15 @@ static const uint16_t XPT2046_ADC_LIMIT = 4096;
 // Vref is approx 2.507V = 2507mV at moderate temperatures (refer p8 Vref vs Temperature chart)
 // counts@25C = TEMP0_mV / Vref_mv * XPT2046_ADC_LIMIT
 static const float XPT2046_TEMP0_COUNTS_AT_25C = (599.5 / 2507 * XPT2046_ADC_LIMIT);
+
+typedef struct {
+    esp_lcd_touch_t base;
+    spi_device_handle_t spi_dev;    /*!< Device of the batch reads, NULL if they are not used */
+    uint8_t *tx_buf;                /*!< Control bytes of a batch, built once */
+    uint8_t *rx_buf;
+    size_t batch_size;
+} xpt2046_touch_t;
+
 static esp_err_t xpt2046_read_data(esp_lcd_touch_handle_t tp);
 static bool xpt2046_get_xy(esp_lcd_touch_handle_t tp,
                            uint16_t *x, uint16_t *y,
@@ -74,6 +90,7 @@ static bool xpt2046_get_xy(esp_lcd_touch_handle_t tp,
                            uint8_t *point_num,
                            uint8_t max_point_num);
 static esp_err_t xpt2046_del(esp_lcd_touch_handle_t tp);
+static esp_err_t xpt2046_init_batch(xpt2046_touch_t *xpt2046, const esp_lcd_touch_io_xpt2046_config_t *config);
 
 esp_err_t esp_lcd_touch_new_spi_xpt2046(const esp_lcd_panel_io_handle_t io,
                                         const esp_lcd_touch_config_t *config,
@@ -81,17 +98,25 @@ esp_err_t esp_lcd_touch_new_spi_xpt2046(const esp_lcd_panel_io_handle_t io,
 {
     esp_err_t ret = ESP_OK;
     esp_lcd_touch_handle_t handle = NULL;
+    xpt2046_touch_t *xpt2046 = NULL;
 
     ESP_PANEL_ENABLE_TAG_DEBUG_LOG();
 
-    ESP_GOTO_ON_FALSE(io, ESP_ERR_INVALID_ARG, err, TAG,
-                      "esp_lcd_panel_io_handle_t must not be NULL");
     ESP_GOTO_ON_FALSE(config, ESP_ERR_INVALID_ARG, err, TAG,
                       "esp_lcd_touch_config_t must not be NULL");
 
-    handle = (esp_lcd_touch_handle_t)calloc(1, sizeof(esp_lcd_touch_t));
-    ESP_GOTO_ON_FALSE(handle, ESP_ERR_NO_MEM, err, TAG,
+    const esp_lcd_touch_io_xpt2046_config_t *xpt2046_config =
+        (const esp_lcd_touch_io_xpt2046_config_t *)config->driver_data;
+    bool use_batch = (CONFIG_XPT2046_BATCH_SAMPLES > 0) && (xpt2046_config != NULL) &&
+                     (xpt2046_config->spi_host_id >= 0);
+    // All the reads go through the batch device if it's used, so the panel IO isn't needed
+    ESP_GOTO_ON_FALSE(io || use_batch, ESP_ERR_INVALID_ARG, err, TAG,
+                      "esp_lcd_panel_io_handle_t must not be NULL");
+
+    xpt2046 = (xpt2046_touch_t *)calloc(1, sizeof(xpt2046_touch_t));
+    ESP_GOTO_ON_FALSE(xpt2046, ESP_ERR_NO_MEM, err, TAG,
                       "No memory available for XPT2046 state");
+    handle = &xpt2046->base;
     handle->io = io;
     handle->read_data = xpt2046_read_data;
     handle->get_xy = xpt2046_get_xy;
@@ -99,6 +124,10 @@ esp_err_t esp_lcd_touch_new_spi_xpt2046(const esp_lcd_panel_io_handle_t io,
     handle->data.lock.owner = portMUX_FREE_VAL;
     memcpy(&handle->config, config, sizeof(esp_lcd_touch_config_t));
 
+    if (use_batch) {
+        ESP_GOTO_ON_ERROR(xpt2046_init_batch(xpt2046, xpt2046_config), err, TAG, "Init batch reads failed");
+    }
+
     // this is not yet supported by esp_lcd_touch.
     if (config->int_gpio_num != GPIO_NUM_NC) {
         ESP_GOTO_ON_FALSE(GPIO_IS_VALID_GPIO(config->int_gpio_num),
@@ -140,26 +169,110 @@ err:
     return ret;
 }
 
+static esp_err_t xpt2046_init_batch(xpt2046_touch_t *xpt2046, const esp_lcd_touch_io_xpt2046_config_t *config)
+{
+    size_t size = ESP_PANEL_XPT2046_BATCH_SIZE(CONFIG_XPT2046_BATCH_SAMPLES);
+    // Round up to words, which the DMA of some targets needs to receive
+    size_t buf_size = (size + 3) & ~3;
+
+    xpt2046->tx_buf = heap_caps_calloc(1, buf_size, MALLOC_CAP_DMA);
+    xpt2046->rx_buf = heap_caps_calloc(1, buf_size, MALLOC_CAP_DMA);
+    ESP_RETURN_ON_FALSE(xpt2046->tx_buf && xpt2046->rx_buf, ESP_ERR_NO_MEM, TAG, "No memory for batch buffers");
+    esp_panel_xpt2046_batch_build(CONFIG_XPT2046_BATCH_SAMPLES, XPT2046_PD_BITS, xpt2046->tx_buf, buf_size);
+
+    spi_device_interface_config_t dev_config = {
+        .mode = config->spi_mode,
+        .clock_speed_hz = config->pclk_hz,
+        .spics_io_num = config->cs_gpio_num,
+        .queue_size = 1,
+    };
+    ESP_RETURN_ON_ERROR(spi_bus_add_device((spi_host_device_t)config->spi_host_id, &dev_config, &xpt2046->spi_dev),
+                        TAG, "SPI bus add device failed");
+    xpt2046->batch_size = size;
+    ESP_LOGD(TAG, "Batch reads of %d samples on host[%d]", CONFIG_XPT2046_BATCH_SAMPLES, config->spi_host_id);
+
+    return ESP_OK;
+}
+
 static esp_err_t xpt2046_del(esp_lcd_touch_handle_t tp)
 {
+    xpt2046_touch_t *xpt2046 = (xpt2046_touch_t *)tp;
+
     if (tp != NULL) {
         if (tp->config.int_gpio_num != GPIO_NUM_NC) {
             gpio_reset_pin(tp->config.int_gpio_num);
         }
+        if (xpt2046->spi_dev != NULL) {
+            spi_bus_remove_device(xpt2046->spi_dev);
+        }
+        heap_caps_free(xpt2046->tx_buf);
+        heap_caps_free(xpt2046->rx_buf);
     }
-    free(tp);
+    free(xpt2046);
 
     return ESP_OK;
 }
 
 static inline esp_err_t xpt2046_read_register(esp_lcd_touch_handle_t tp, uint8_t reg, uint16_t *value)
 {
+    xpt2046_touch_t *xpt2046 = (xpt2046_touch_t *)tp;
     uint8_t buf[2] = {0, 0};
-    ESP_RETURN_ON_ERROR(esp_lcd_panel_io_rx_param(tp->io, reg, buf, 2), TAG, "XPT2046 read error!");
+
+    if (xpt2046->spi_dev != NULL) {
+        // The batch device owns the CS line instead of the panel IO, read by a 24-clock transaction of it
+        spi_transaction_t trans = {
+            .flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_USE_RXDATA,
+            .length = 24,
+            .tx_data = {reg, 0, 0},
+        };
+        ESP_RETURN_ON_ERROR(spi_device_polling_transmit(xpt2046->spi_dev, &trans), TAG, "XPT2046 read error!");
+        buf[0] = trans.rx_data[1];
+        buf[1] = trans.rx_data[2];
+    } else {
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_rx_param(tp->io, reg, buf, 2), TAG, "XPT2046 read error!");
+    }
     *value = ((buf[0] << 8) | (buf[1]));
     return ESP_OK;
 }
 
+/**
+ * @brief Convert Z1, Z2 and all the X/Y samples in one full-duplex transaction, then take the median of the samples
+ */
+static esp_err_t xpt2046_read_batch(xpt2046_touch_t *xpt2046, uint16_t *z, uint32_t *x, uint32_t *y,
+                                    uint8_t *point_count)
+{
+    spi_transaction_t trans = {
+        .length = xpt2046->batch_size * 8,
+        .tx_buffer = xpt2046->tx_buf,
+        .rx_buffer = xpt2046->rx_buf,
+    };
+    ESP_RETURN_ON_ERROR(spi_device_polling_transmit(xpt2046->spi_dev, &trans), TAG, "XPT2046 read error!");
+
+    esp_panel_xpt2046_batch_result_t result = {};
+    ESP_RETURN_ON_FALSE(esp_panel_xpt2046_batch_decode(CONFIG_XPT2046_BATCH_SAMPLES, xpt2046->rx_buf,
+                        xpt2046->batch_size, &result), ESP_ERR_INVALID_STATE, TAG, "Decode batch failed");
+    *z = result.z;
+    if (*z < CONFIG_XPT2046_Z_THRESHOLD) {
+        return ESP_OK;
+    }
+
+    const int minimum_count = (1 == CONFIG_XPT2046_BATCH_SAMPLES ? 1 : CONFIG_XPT2046_BATCH_SAMPLES / 2);
+    if (result.valid_num < minimum_count) {
+        *z = 0;
+        return ESP_OK;
+    }
+#if CONFIG_XPT2046_CONVERT_ADC_TO_COORDS
+    *x = (uint32_t)result.x * xpt2046->base.config.x_max / XPT2046_ADC_LIMIT;
+    *y = (uint32_t)result.y * xpt2046->base.config.y_max / XPT2046_ADC_LIMIT;
+#else
+    *x = result.x;
+    *y = result.y;
+#endif // CONFIG_XPT2046_CONVERT_ADC_TO_COORDS
+    *point_count = 1;
+
+    return ESP_OK;
+}
+
 static esp_err_t xpt2046_read_data(esp_lcd_touch_handle_t tp)
 {
     uint16_t z1 = 0, z2 = 0, z = 0;
@@ -182,6 +295,12 @@ static esp_err_t xpt2046_read_data(esp_lcd_touch_handle_t tp)
     }
 #endif
 
+    xpt2046_touch_t *xpt2046 = (xpt2046_touch_t *)tp;
+    if (xpt2046->spi_dev != NULL) {
+        ESP_RETURN_ON_ERROR(xpt2046_read_batch(xpt2046, &z, &x, &y, &point_count), TAG, "XPT2046 read error!");
+        goto end;
+    }
+
     ESP_RETURN_ON_ERROR(xpt2046_read_register(tp, Z_VALUE_1, &z1), TAG, "XPT2046 read error!");
     ESP_RETURN_ON_ERROR(xpt2046_read_register(tp, Z_VALUE_2, &z2), TAG, "XPT2046 read error!");
 
@@ -217,8 +336,8 @@ static esp_err_t xpt2046_read_data(esp_lcd_touch_handle_t tp)
 #if CONFIG_XPT2046_CONVERT_ADC_TO_COORDS
                 // Convert the raw ADC value into a screen coordinate and store it
                 // for averaging.
-                x += ((x_temp / (double)XPT2046_ADC_LIMIT) * tp->config.x_max);
-                y += ((y_temp / (double)XPT2046_ADC_LIMIT) * tp->config.y_max);
+                x += (uint32_t)x_temp * tp->config.x_max / XPT2046_ADC_LIMIT;
+                y += (uint32_t)y_temp * tp->config.y_max / XPT2046_ADC_LIMIT;
 #else
                 // store the raw ADC values and let the user convert them to screen
                 // coordinates.
@@ -242,6 +361,7 @@ static esp_err_t xpt2046_read_data(esp_lcd_touch_handle_t tp)
         }
     }
 
+end:
     XPT2046_LOCK(&tp->data.lock);
     tp->data.coords[0].x = x;
     tp->data.coords[0].y = y;
@@ -26,6 +26,7 @@ extern "C" {
 #define CONFIG_XPT2046_INTERRUPT_MODE           (ESP_PANEL_TOUCH_XPT2046_INTERRUPT_MODE)
 #define CONFIG_XPT2046_VREF_ON_MODE             (ESP_PANEL_TOUCH_XPT2046_XPT2046_VREF_ON_MODE)
 #define CONFIG_XPT2046_CONVERT_ADC_TO_COORDS    (ESP_PANEL_TOUCH_XPT2046_CONVERT_ADC_TO_COORDS)
+#define CONFIG_XPT2046_BATCH_SAMPLES            (ESP_PANEL_TOUCH_XPT2046_BATCH_SAMPLES)
 
 /**
  * @brief Recommended clock for SPI read of the XPT2046
@@ -197,18 +198,37 @@ extern "C" {
     }
 #endif // IDF v5.1.3
 
+/**
+ * @brief XPT2046 Configuration Type, passed by `driver_data` of `esp_lcd_touch_config_t`
+ *
+ * @note  It's only used by the batch reads (`CONFIG_XPT2046_BATCH_SAMPLES` > 0), which convert all the channels of a
+ *        poll in one full-duplex transaction. That can't be done through the panel IO, so the driver adds its own
+ *        device on the host, and all the reads of the driver go through it
+ * @note  Only one device should drive a CS line, and the slots of the CS lines of a host are limited (3 for SPI2/3 of
+ *        ESP32). So the panel IO of the touch should be deleted before, and `NULL` passed as the panel IO
+ *
+ */
+typedef struct {
+    int spi_host_id;    /*!< SPI host of the touch, `-1` means the batch reads are not used */
+    int cs_gpio_num;    /*!< CS line of the touch */
+    int pclk_hz;        /*!< Frequency of the SPI clock */
+    uint8_t spi_mode;   /*!< SPI mode (0~3) */
+} esp_lcd_touch_io_xpt2046_config_t;
+
 /**
  * @brief Create a new XPT2046 touch driver
  *
  * @note The SPI communication should be initialized before use this function.
+ * @note The batch reads are used if `CONFIG_XPT2046_BATCH_SAMPLES` > 0 and `driver_data` of @param config is a
+ *       `esp_lcd_touch_io_xpt2046_config_t` with a valid host.
  *
- * @param io: LCD/Touch panel IO handle.
+ * @param io: LCD/Touch panel IO handle, which can be `NULL` with the batch reads.
  * @param config: Touch configuration.
  * @param out_touch: XPT2046 instance handle.
  * @return
  *      - ESP_OK                    on success
  *      - ESP_ERR_NO_MEM            if there is insufficient memory for allocating main structure.
- *      - ESP_ERR_INVALID_ARG       if @param io or @param config are null.
+ *      - ESP_ERR_INVALID_ARG       if @param config is null, or @param io is null without the batch reads.
  */
 esp_err_t esp_lcd_touch_new_spi_xpt2046(const esp_lcd_panel_io_handle_t io,
                                         const esp_lcd_touch_config_t *config,
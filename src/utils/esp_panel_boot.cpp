@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "esp_pthread.h"
+#define BOOT_USE_ESP_PTHREAD    (1)
+#endif
+#include "esp_panel_boot.h"
+
+using namespace std;
+
+typedef struct {
+    const esp_panel_boot_step_t *steps;
+    uint8_t num;
+    mutex lock;                     // Protect the fields below
+    condition_variable cv;
+    uint32_t started = 0;           // Mask of the started steps
+    uint32_t done = 0;              // Mask of the finished steps
+    uint32_t busy_buses = 0;
+    bool is_failed = false;
+    chrono::steady_clock::time_point start_time;
+    esp_panel_boot_timeline_t timeline = {};
+} boot_t;
+
+static uint32_t elapsed_us(const boot_t *boot)
+{
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - boot->start_time).count();
+}
+
+/* Find the first step which can be started, `-1` means none */
+static int find_ready(const boot_t *boot)
+{
+    if (boot->is_failed) {
+        return -1;
+    }
+    for (int i = 0; i < boot->num; i++) {
+        const esp_panel_boot_step_t *step = &boot->steps[i];
+        if (!(boot->started & ESP_PANEL_BOOT_STEP(i)) && ((step->deps & boot->done) == step->deps) &&
+                !(step->buses & boot->busy_buses)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static bool is_finished(const boot_t *boot)
+{
+    return (boot->done == (ESP_PANEL_BOOT_STEP(boot->num) - 1)) || (boot->is_failed && (boot->started == boot->done));
+}
+
+static void boot_loop(boot_t *boot, uint8_t worker)
+{
+    unique_lock<mutex> lock(boot->lock);
+    while (true) {
+        int index = -1;
+        boot->cv.wait(lock, [&] { return is_finished(boot) || ((index = find_ready(boot)) >= 0); });
+        if (index < 0) {
+            break;
+        }
+
+        const esp_panel_boot_step_t *step = &boot->steps[index];
+        esp_panel_boot_record_t *record = &boot->timeline.records[index];
+        boot->started |= ESP_PANEL_BOOT_STEP(index);
+        boot->busy_buses |= step->buses;
+        record->worker = worker;
+        record->start_us = elapsed_us(boot);
+        lock.unlock();
+
+        bool is_ok = step->func(step->ctx);
+
+        lock.lock();
+        record->end_us = elapsed_us(boot);
+        record->flags.is_run = 1;
+        record->flags.is_ok = is_ok;
+        boot->done |= ESP_PANEL_BOOT_STEP(index);
+        boot->busy_buses &= ~step->buses;
+        if (!is_ok && !boot->is_failed) {
+            boot->is_failed = true;
+            boot->timeline.failed_step = index;
+        }
+        boot->cv.notify_all();
+    }
+}
+
+bool esp_panel_boot_run(const esp_panel_boot_config_t *config, const esp_panel_boot_step_t *steps, uint8_t num,
+                        esp_panel_boot_timeline_t *timeline)
+{
+    const esp_panel_boot_config_t default_config = ESP_PANEL_BOOT_CONFIG_DEFAULT();
+    config = (config == nullptr) ? &default_config : config;
+    if (((steps == nullptr) && (num > 0)) || (num > ESP_PANEL_BOOT_STEP_NUM_MAX) ||
+            (config->num_workers > ESP_PANEL_BOOT_WORKER_NUM_MAX)) {
+        return false;
+    }
+    /* Only the previous steps can be depended on, so the graph has no cycle */
+    for (int i = 0; i < num; i++) {
+        if ((steps[i].func == nullptr) || (steps[i].deps & ~(ESP_PANEL_BOOT_STEP(i) - 1))) {
+            return false;
+        }
+    }
+
+    boot_t *boot = new boot_t();
+    if (boot == nullptr) {
+        return false;
+    }
+    boot->steps = steps;
+    boot->num = num;
+    boot->timeline.num = num;
+    boot->timeline.failed_step = -1;
+    for (int i = 0; i < num; i++) {
+        boot->timeline.records[i].name = steps[i].name;
+    }
+    boot->start_time = chrono::steady_clock::now();
+
+    /* No more threads than the steps which may run at the same time */
+    int num_workers = min<int>(config->num_workers, (num > 0) ? (num - 1) : 0);
+    vector<thread> threads;
+#if BOOT_USE_ESP_PTHREAD
+    /* The configuration only affects the threads created by the current thread */
+    esp_pthread_cfg_t pthread_cfg = esp_pthread_get_default_config();
+    pthread_cfg.thread_name = "panel_boot";
+    if (config->core_id >= 0) {
+        pthread_cfg.pin_to_core = config->core_id;
+    }
+    if (config->stack_size > 0) {
+        pthread_cfg.stack_size = config->stack_size;
+    }
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+    for (int i = 0; i < num_workers; i++) {
+        threads.emplace_back(boot_loop, boot, i + 1);
+    }
+#if BOOT_USE_ESP_PTHREAD
+    pthread_cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    boot_loop(boot, 0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    boot->timeline.total_us = elapsed_us(boot);
+    for (int i = 0; i < num; i++) {
+        const esp_panel_boot_record_t *record = &boot->timeline.records[i];
+        if (record->flags.is_run) {
+            boot->timeline.busy_us += record->end_us - record->start_us;
+        }
+    }
+    bool is_ok = !boot->is_failed;
+    if (timeline != nullptr) {
+        *timeline = boot->timeline;
+    }
+    delete boot;
+
+    return is_ok;
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of the steps of a bring-up
+ *
+ */
+#define ESP_PANEL_BOOT_STEP_NUM_MAX         (16)
+
+/**
+ * @brief Maximum number of the helper threads
+ *
+ */
+#define ESP_PANEL_BOOT_WORKER_NUM_MAX       (3)
+
+/**
+ * @brief Mask of a step, used by `deps` of the steps after it
+ *
+ */
+#define ESP_PANEL_BOOT_STEP(index)          (1UL << (index))
+
+/**
+ * @brief Function of a step
+ *
+ * @param ctx User context
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_boot_func_t)(void *ctx);
+
+/**
+ * @brief A step of the bring-up, like the initialization of a device
+ *
+ */
+typedef struct {
+    const char *name;               /*!< Name of the step, only used by the timeline */
+    esp_panel_boot_func_t func;     /*!< Function of the step */
+    void *ctx;                      /*!< User context passed to the function */
+    uint32_t deps;                  /*!< Mask of the steps which must be done before, only the previous steps are
+                                         allowed. Use `ESP_PANEL_BOOT_STEP()` to create it */
+    uint32_t buses;                 /*!< Mask of the buses used by the step, the steps sharing a bus never run at the
+                                         same time. The bits are defined by the caller */
+} esp_panel_boot_step_t;
+
+/**
+ * @brief Configuration of the bring-up
+ *
+ */
+typedef struct {
+    uint8_t num_workers;    /*!< Number of the helper threads. The caller thread also runs the steps, and `0` means the
+                                 steps are run one by one in order */
+    int core_id;            /*!< Core which the helper threads are pinned to, `-1` means no affinity.
+                                 Only valid on ESP SoCs */
+    uint32_t stack_size;    /*!< Stack size of the helper threads in bytes, `0` means the default size */
+} esp_panel_boot_config_t;
+
+/**
+ * @brief Default configuration of the bring-up, which runs the steps one by one
+ *
+ */
+#define ESP_PANEL_BOOT_CONFIG_DEFAULT() \
+    {                                   \
+        .num_workers = 0,               \
+        .core_id = -1,                  \
+        .stack_size = 0,                \
+    }
+
+/**
+ * @brief Record of a step in the timeline
+ *
+ */
+typedef struct {
+    const char *name;           /*!< Name of the step */
+    uint32_t start_us;          /*!< Start time since the beginning of the bring-up */
+    uint32_t end_us;            /*!< End time since the beginning of the bring-up */
+    uint8_t worker;             /*!< Thread which runs the step, `0` is the caller thread */
+    struct {
+        uint8_t is_run: 1;      /*!< If this flag is enabled, the step has been run */
+        uint8_t is_ok: 1;       /*!< If this flag is enabled, the step returned true */
+    } flags;
+} esp_panel_boot_record_t;
+
+/**
+ * @brief Timeline of the bring-up
+ *
+ */
+typedef struct {
+    esp_panel_boot_record_t records[ESP_PANEL_BOOT_STEP_NUM_MAX];   /*!< Records in the order of the steps */
+    uint8_t num;                /*!< Number of the steps */
+    uint32_t total_us;          /*!< Time of the whole bring-up */
+    uint32_t busy_us;           /*!< Sum of the time of all the steps, which is close to the time of running them one
+                                     by one */
+    int failed_step;            /*!< Index of the first failed step, `-1` means no step failed */
+} esp_panel_boot_timeline_t;
+
+/**
+ * @brief Run the steps of a bring-up and wait for them
+ *
+ * @note  A step starts when all of its dependencies are done and none of its buses is used by a running step. The
+ *        lower index is preferred, so the steps are run in order when there is no helper thread
+ * @note  After a step fails, no more steps are started, and the running ones are waited
+ * @note  The helper threads are backed by `std::thread`, and they are created and joined inside this function
+ *
+ * @param config   Pointer of the configuration, NULL means `ESP_PANEL_BOOT_CONFIG_DEFAULT()`
+ * @param steps    Array of the steps
+ * @param num      Number of the steps, up to `ESP_PANEL_BOOT_STEP_NUM_MAX`
+ * @param timeline Pointer to store the timeline, can be NULL
+ *
+ * @return true if all the steps succeed, otherwise false
+ */
+bool esp_panel_boot_run(const esp_panel_boot_config_t *config, const esp_panel_boot_step_t *steps, uint8_t num,
+                        esp_panel_boot_timeline_t *timeline);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#else
+#define IRAM_ATTR
+#endif
+#include "esp_panel_draw_queue.h"
+#include "esp_panel_color_stream.h"
+
+struct esp_panel_color_stream_t {
+    esp_panel_color_stream_config_t config;
+    esp_panel_draw_queue_t queue;
+    uint32_t buf_tokens[ESP_PANEL_COLOR_STREAM_BUF_NUM];    // Token of the last transfer which sends the buffer
+    uint8_t buf_index;
+    size_t buf_used;
+    int cmd;
+    int continue_cmd;
+    bool is_active;
+    bool is_first;
+    esp_panel_color_stream_stats_t stats;
+};
+
+static bool wait_transfer(struct esp_panel_color_stream_t *stream, uint32_t token)
+{
+    if (esp_panel_draw_queue_is_done(&stream->queue, token)) {
+        return true;
+    }
+    stream->stats.stalls++;
+
+    return stream->config.wait_cb(stream->config.user_ctx, token);
+}
+
+static bool send_buffer(struct esp_panel_color_stream_t *stream)
+{
+    int cmd = stream->is_first ? stream->cmd : stream->continue_cmd;
+    uint8_t *buf = stream->config.bufs[stream->buf_index];
+
+    /* The transfer may finish before it is committed */
+    uint32_t token = esp_panel_draw_queue_prepare(&stream->queue, true);
+    if (!stream->config.tx_cb(stream->config.user_ctx, cmd, buf, stream->buf_used)) {
+        return false;
+    }
+    esp_panel_draw_queue_commit(&stream->queue, token);
+
+    stream->buf_tokens[stream->buf_index] = token;
+    stream->stats.bytes += stream->buf_used;
+    stream->stats.transfers++;
+    stream->is_first = false;
+    stream->buf_used = 0;
+    stream->buf_index = (stream->buf_index + 1) % ESP_PANEL_COLOR_STREAM_BUF_NUM;
+
+    /* The next buffer may still be sent by the previous transfer */
+    return wait_transfer(stream, stream->buf_tokens[stream->buf_index]);
+}
+
+esp_panel_color_stream_handle_t esp_panel_color_stream_new(const esp_panel_color_stream_config_t *config)
+{
+    if ((config == NULL) || (config->buf_size == 0) || (config->tx_cb == NULL) || (config->wait_cb == NULL)) {
+        return NULL;
+    }
+    for (int i = 0; i < ESP_PANEL_COLOR_STREAM_BUF_NUM; i++) {
+        if (config->bufs[i] == NULL) {
+            return NULL;
+        }
+    }
+
+    struct esp_panel_color_stream_t *stream = calloc(1, sizeof(struct esp_panel_color_stream_t));
+    if (stream == NULL) {
+        return NULL;
+    }
+    stream->config = *config;
+
+    return stream;
+}
+
+void esp_panel_color_stream_del(esp_panel_color_stream_handle_t stream)
+{
+    free(stream);
+}
+
+bool esp_panel_color_stream_begin(esp_panel_color_stream_handle_t stream, int cmd, int continue_cmd)
+{
+    if ((stream == NULL) || stream->is_active) {
+        return false;
+    }
+
+    stream->cmd = cmd;
+    stream->continue_cmd = continue_cmd;
+    stream->buf_used = 0;
+    stream->is_first = true;
+    stream->is_active = true;
+
+    return true;
+}
+
+bool esp_panel_color_stream_write(esp_panel_color_stream_handle_t stream, const void *data, size_t size)
+{
+    if ((stream == NULL) || !stream->is_active || ((data == NULL) && (size > 0))) {
+        return false;
+    }
+
+    const uint8_t *src = (const uint8_t *)data;
+    while (size > 0) {
+        size_t copy_size = stream->config.buf_size - stream->buf_used;
+        copy_size = (copy_size < size) ? copy_size : size;
+        memcpy(stream->config.bufs[stream->buf_index] + stream->buf_used, src, copy_size);
+        stream->buf_used += copy_size;
+        src += copy_size;
+        size -= copy_size;
+
+        if ((stream->buf_used == stream->config.buf_size) && !send_buffer(stream)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool esp_panel_color_stream_end(esp_panel_color_stream_handle_t stream)
+{
+    if ((stream == NULL) || !stream->is_active) {
+        return false;
+    }
+
+    /* The stream keeps active until all the transfers are finished, since their finish events belong to it */
+    bool ret = ((stream->buf_used == 0) || send_buffer(stream)) &&
+               wait_transfer(stream, esp_panel_draw_queue_get_submitted(&stream->queue));
+    stream->is_active = false;
+    if (ret) {
+        stream->stats.streams++;
+    }
+
+    return ret;
+}
+
+IRAM_ATTR bool esp_panel_color_stream_is_active(esp_panel_color_stream_handle_t stream)
+{
+    return (stream != NULL) && stream->is_active;
+}
+
+IRAM_ATTR bool esp_panel_color_stream_on_done(esp_panel_color_stream_handle_t stream)
+{
+    if (stream == NULL) {
+        return false;
+    }
+
+    esp_panel_draw_queue_on_done(&stream->queue);
+
+    return true;
+}
+
+bool esp_panel_color_stream_is_done(esp_panel_color_stream_handle_t stream, uint32_t token)
+{
+    return (stream != NULL) && esp_panel_draw_queue_is_done(&stream->queue, token);
+}
+
+bool esp_panel_color_stream_get_stats(esp_panel_color_stream_handle_t stream, esp_panel_color_stream_stats_t *stats,
+                                      bool clear)
+{
+    if ((stream == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = stream->stats;
+    if (clear) {
+        stream->stats = (esp_panel_color_stream_stats_t) {};
+    }
+
+    return true;
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of the buffers used by the color stream, one is filled while the other is sent
+ *
+ */
+#define ESP_PANEL_COLOR_STREAM_BUF_NUM      (2)
+
+/**
+ * @brief Callback to send a full buffer, which has the same parameters as `esp_lcd_panel_io_tx_color()`
+ *
+ * @note  The transfer should be queued without waiting, and `esp_panel_color_stream_on_done()` should be called when
+ *        it is finished. The transfers are finished in order
+ *
+ * @param user_ctx User context
+ * @param cmd      Command sent before the color data, `-1` means no command
+ * @param data     Pointer of the color data, it is one of the stream buffers
+ * @param size     Size of the color data in bytes
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_color_stream_tx_cb_t)(void *user_ctx, int cmd, const void *data, size_t size);
+
+/**
+ * @brief Callback to wait until `esp_panel_color_stream_is_done()` returns true for the token
+ *
+ * @param user_ctx User context
+ * @param token    Token of the transfer
+ *
+ * @return true if success, otherwise false or timeout
+ */
+typedef bool (*esp_panel_color_stream_wait_cb_t)(void *user_ctx, uint32_t token);
+
+/**
+ * @brief Configuration of the color stream
+ *
+ */
+typedef struct {
+    uint8_t *bufs[ESP_PANEL_COLOR_STREAM_BUF_NUM];  /*!< Buffers to hold the color data, they should be DMA capable */
+    size_t buf_size;                                /*!< Size of every buffer in bytes */
+    esp_panel_color_stream_tx_cb_t tx_cb;           /*!< Callback to send a full buffer */
+    esp_panel_color_stream_wait_cb_t wait_cb;       /*!< Callback to wait for a transfer */
+    void *user_ctx;                                 /*!< User context passed to the callbacks */
+} esp_panel_color_stream_config_t;
+
+/**
+ * @brief Counters of the color stream
+ *
+ */
+typedef struct {
+    uint64_t bytes;             /*!< Number of the sent bytes */
+    uint32_t transfers;         /*!< Number of the sent buffers */
+    uint32_t streams;           /*!< Number of the finished streams */
+    uint32_t stalls;            /*!< Number of the times that writing waits for a buffer still being sent */
+} esp_panel_color_stream_stats_t;
+
+typedef struct esp_panel_color_stream_t *esp_panel_color_stream_handle_t;
+
+/**
+ * @brief Create a color stream
+ *
+ * @note  The color data is copied into the buffers in turn, and a buffer is sent once it is full. So the caller can
+ *        produce the pixels in pieces of any size (like lines of a decoder) while the previous buffer is being sent
+ *
+ * @param config Pointer of the configuration
+ *
+ * @return
+ *      - NULL:   if fail
+ *      - others: the handle of the color stream
+ */
+esp_panel_color_stream_handle_t esp_panel_color_stream_new(const esp_panel_color_stream_config_t *config);
+
+/**
+ * @brief Delete the color stream, the buffers are not freed
+ *
+ * @param stream Handle of the color stream
+ */
+void esp_panel_color_stream_del(esp_panel_color_stream_handle_t stream);
+
+/**
+ * @brief Begin a stream of color data
+ *
+ * @param stream       Handle of the color stream
+ * @param cmd          Command sent before the first buffer, like `0x2C` (RAMWR)
+ * @param continue_cmd Command sent before the following buffers, like `0x3C` (RAMWRC), `-1` means no command
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_color_stream_begin(esp_panel_color_stream_handle_t stream, int cmd, int continue_cmd);
+
+/**
+ * @brief Write a piece of color data to the stream
+ *
+ * @param stream Handle of the color stream
+ * @param data   Pointer of the color data, it can be reused once the function returns
+ * @param size   Size of the color data in bytes
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_color_stream_write(esp_panel_color_stream_handle_t stream, const void *data, size_t size);
+
+/**
+ * @brief End the stream, the remaining data is sent and all the transfers are waited for
+ *
+ * @param stream Handle of the color stream
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_color_stream_end(esp_panel_color_stream_handle_t stream);
+
+/**
+ * @brief Check whether the stream is begun and not ended
+ *
+ * @param stream Handle of the color stream
+ *
+ * @return true if active, otherwise false
+ */
+bool esp_panel_color_stream_is_active(esp_panel_color_stream_handle_t stream);
+
+/**
+ * @brief Handle the finish of the oldest transfer in flight
+ *
+ * @note  This function can be called from an ISR
+ *
+ * @param stream Handle of the color stream
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_color_stream_on_done(esp_panel_color_stream_handle_t stream);
+
+/**
+ * @brief Check whether the transfer of the token (and all the transfers before it) is finished
+ *
+ * @param stream Handle of the color stream
+ * @param token  Token of the transfer
+ *
+ * @return true if finished, otherwise false
+ */
+bool esp_panel_color_stream_is_done(esp_panel_color_stream_handle_t stream, uint32_t token);
+
+/**
+ * @brief Get the counters of the color stream
+ *
+ * @param stream Handle of the color stream
+ * @param stats  Pointer to store the counters
+ * @param clear  Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_color_stream_get_stats(esp_panel_color_stream_handle_t stream, esp_panel_color_stream_stats_t *stats,
+                                      bool clear);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_panel_draw_bounce.h"
+
+struct esp_panel_draw_bounce_t {
+    esp_panel_draw_bounce_config_t config;
+    uint32_t buf_tokens[ESP_PANEL_DRAW_BOUNCE_BUF_NUM];     // Token of the last drawing which sends the buffer
+    bool buf_is_used[ESP_PANEL_DRAW_BOUNCE_BUF_NUM];
+    uint8_t buf_index;
+    esp_panel_draw_bounce_stats_t stats;
+};
+
+static int64_t get_time_us(struct esp_panel_draw_bounce_t *bounce)
+{
+    return (bounce->config.get_time_us != NULL) ? bounce->config.get_time_us() : 0;
+}
+
+esp_panel_draw_bounce_handle_t esp_panel_draw_bounce_new(const esp_panel_draw_bounce_config_t *config)
+{
+    if ((config == NULL) || (config->buf_size == 0) || (config->draw_cb == NULL) || (config->wait_cb == NULL)) {
+        return NULL;
+    }
+    for (int i = 0; i < ESP_PANEL_DRAW_BOUNCE_BUF_NUM; i++) {
+        if (config->bufs[i] == NULL) {
+            return NULL;
+        }
+    }
+
+    struct esp_panel_draw_bounce_t *bounce = calloc(1, sizeof(struct esp_panel_draw_bounce_t));
+    if (bounce == NULL) {
+        return NULL;
+    }
+    bounce->config = *config;
+
+    return bounce;
+}
+
+void esp_panel_draw_bounce_del(esp_panel_draw_bounce_handle_t bounce)
+{
+    free(bounce);
+}
+
+bool esp_panel_draw_bounce_bitmap(esp_panel_draw_bounce_handle_t bounce, uint16_t x_start, uint16_t y_start,
+                                  uint16_t x_end, uint16_t y_end, const void *data, uint8_t bytes_per_pixel,
+                                  uint8_t y_align, bool is_last)
+{
+    if ((bounce == NULL) || (data == NULL) || (x_start >= x_end) || (y_start >= y_end) || (bytes_per_pixel == 0)) {
+        return false;
+    }
+
+    size_t line_size = (size_t)(x_end - x_start) * bytes_per_pixel;
+    int band_lines = bounce->config.buf_size / line_size;
+    y_align = (y_align == 0) ? 1 : y_align;
+    band_lines -= band_lines % y_align;
+    if (band_lines == 0) {
+        return false;
+    }
+
+    int64_t frame_start_us = get_time_us(bounce);
+    uint64_t copy_us = 0;
+    uint64_t wait_us = 0;
+    const uint8_t *src = (const uint8_t *)data;
+    for (int y = y_start; y < y_end; y += band_lines) {
+        int band_end = (y_end - y > band_lines) ? (y + band_lines) : y_end;
+        size_t band_size = (size_t)(band_end - y) * line_size;
+        uint8_t index = bounce->buf_index;
+
+        /* The buffer may still be sent by the band before the previous one */
+        int64_t start_us = get_time_us(bounce);
+        if (bounce->buf_is_used[index] && !bounce->config.wait_cb(bounce->config.user_ctx, bounce->buf_tokens[index])) {
+            return false;
+        }
+        int64_t copy_start_us = get_time_us(bounce);
+        memcpy(bounce->config.bufs[index], src, band_size);
+        int64_t copy_end_us = get_time_us(bounce);
+        wait_us += copy_start_us - start_us;
+        copy_us += copy_end_us - copy_start_us;
+
+        /* The next buffer is copied while this one is being sent */
+        uint32_t token = 0;
+        if (!bounce->config.draw_cb(bounce->config.user_ctx, x_start, y, x_end, band_end, bounce->config.bufs[index],
+                                    is_last && (band_end == y_end), &token)) {
+            return false;
+        }
+        bounce->buf_tokens[index] = token;
+        bounce->buf_is_used[index] = true;
+        bounce->buf_index = (index + 1) % ESP_PANEL_DRAW_BOUNCE_BUF_NUM;
+        bounce->stats.bands++;
+        bounce->stats.bytes += band_size;
+        src += band_size;
+    }
+
+    uint64_t frame_us = get_time_us(bounce) - frame_start_us;
+    bounce->stats.frames++;
+    bounce->stats.copy_us += copy_us;
+    bounce->stats.wait_us += wait_us;
+    bounce->stats.frame_us += frame_us;
+    bounce->stats.last_copy_us = copy_us;
+    bounce->stats.last_wait_us = wait_us;
+    bounce->stats.last_frame_us = frame_us;
+
+    return true;
+}
+
+bool esp_panel_draw_bounce_get_stats(esp_panel_draw_bounce_handle_t bounce, esp_panel_draw_bounce_stats_t *stats,
+                                     bool clear)
+{
+    if ((bounce == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = bounce->stats;
+    if (clear) {
+        bounce->stats = (esp_panel_draw_bounce_stats_t) {};
+    }
+
+    return true;
+}
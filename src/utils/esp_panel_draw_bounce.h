@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of the bounce buffers, one is filled while the other is sent
+ *
+ */
+#define ESP_PANEL_DRAW_BOUNCE_BUF_NUM       (2)
+
+/**
+ * @brief Alignment of the bounce buffers in bytes, which is the largest cache line size of the ESP SoCs
+ *
+ */
+#define ESP_PANEL_DRAW_BOUNCE_BUF_ALIGN     (64)
+
+/**
+ * @brief Callback to queue a band copied into a bounce buffer, which has the same parameters as
+ *        `esp_lcd_panel_draw_bitmap()`
+ *
+ * @param user_ctx User context
+ * @param x_start  Start X coordinate (inclusive)
+ * @param y_start  Start Y coordinate (inclusive)
+ * @param x_end    End X coordinate (exclusive)
+ * @param y_end    End Y coordinate (exclusive)
+ * @param data     Pointer of the bounce buffer
+ * @param is_last  Whether it is the last band of the bitmap
+ * @param token    Pointer to store the token of the queued drawing, which is passed to `wait_cb` later
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_draw_bounce_draw_cb_t)(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                                                uint16_t y_end, const void *data, bool is_last, uint32_t *token);
+
+/**
+ * @brief Callback to wait for the drawing of the token to finish
+ *
+ * @param user_ctx User context
+ * @param token    Token of the drawing
+ *
+ * @return true if success, otherwise false or timeout
+ */
+typedef bool (*esp_panel_draw_bounce_wait_cb_t)(void *user_ctx, uint32_t token);
+
+/**
+ * @brief Configuration of the bounce drawing
+ *
+ */
+typedef struct {
+    uint8_t *bufs[ESP_PANEL_DRAW_BOUNCE_BUF_NUM];   /*!< Bounce buffers, they should be internal and DMA capable */
+    size_t buf_size;                                /*!< Size of every bounce buffer in bytes */
+    esp_panel_draw_bounce_draw_cb_t draw_cb;        /*!< Callback to queue a band */
+    esp_panel_draw_bounce_wait_cb_t wait_cb;        /*!< Callback to wait for a drawing */
+    int64_t (*get_time_us)(void);                   /*!< Clock to measure the time, `NULL` means not measured */
+    void *user_ctx;                                 /*!< User context passed to the callbacks */
+} esp_panel_draw_bounce_config_t;
+
+/**
+ * @brief Timing of the bounce drawings, which helps to size the bounce buffers
+ *
+ * @note  If `wait_us` is a large part of `frame_us`, the bus is the bottleneck and larger buffers don't help. If it is
+ *        close to `0`, the copies are the bottleneck
+ *
+ */
+typedef struct {
+    uint32_t frames;            /*!< Number of the drawn bitmaps */
+    uint32_t bands;             /*!< Number of the copied bands */
+    uint64_t bytes;             /*!< Number of the copied bytes */
+    uint64_t copy_us;           /*!< Total time of copying to the bounce buffers */
+    uint64_t wait_us;           /*!< Total time of waiting for a bounce buffer still being sent */
+    uint64_t frame_us;          /*!< Total time from the first copy to the queueing of the last band */
+    uint32_t last_copy_us;      /*!< Copy time of the last bitmap */
+    uint32_t last_wait_us;      /*!< Wait time of the last bitmap */
+    uint32_t last_frame_us;     /*!< Total time of the last bitmap */
+} esp_panel_draw_bounce_stats_t;
+
+typedef struct esp_panel_draw_bounce_t *esp_panel_draw_bounce_handle_t;
+
+/**
+ * @brief Create a bounce drawing
+ *
+ * @note  The bitmap (typically in PSRAM) is copied band by band into the internal bounce buffers in turn, and a band
+ *        is queued once it is copied. So the next band is copied while the previous one is sent, and the DMA never
+ *        reads PSRAM
+ *
+ * @param config Pointer of the configuration
+ *
+ * @return
+ *      - NULL:   if fail
+ *      - others: the handle of the bounce drawing
+ */
+esp_panel_draw_bounce_handle_t esp_panel_draw_bounce_new(const esp_panel_draw_bounce_config_t *config);
+
+/**
+ * @brief Delete the bounce drawing, the buffers are not freed
+ *
+ * @param bounce Handle of the bounce drawing
+ */
+void esp_panel_draw_bounce_del(esp_panel_draw_bounce_handle_t bounce);
+
+/**
+ * @brief Draw a bitmap through the bounce buffers
+ *
+ * @note  Every band contains as many lines as a buffer can hold, and the number of lines is a multiple of `y_align`
+ *        except for the last band. The bands keep the X coordinates of the bitmap
+ * @note  The function returns after the last band is queued, so the bitmap can be reused once it returns
+ *
+ * @param bounce          Handle of the bounce drawing
+ * @param x_start         Start X coordinate (inclusive)
+ * @param y_start         Start Y coordinate (inclusive)
+ * @param x_end           End X coordinate (exclusive)
+ * @param y_end           End Y coordinate (exclusive)
+ * @param data            Pointer of the color data of the bitmap
+ * @param bytes_per_pixel Bytes of a single pixel
+ * @param y_align         Alignment of the band height in lines, `0` is treated as `1`
+ * @param is_last         Whether the last band notifies the finish
+ *
+ * @return true if success, otherwise false (like the buffers can't hold `y_align` lines)
+ */
+bool esp_panel_draw_bounce_bitmap(esp_panel_draw_bounce_handle_t bounce, uint16_t x_start, uint16_t y_start,
+                                  uint16_t x_end, uint16_t y_end, const void *data, uint8_t bytes_per_pixel,
+                                  uint8_t y_align, bool is_last);
+
+/**
+ * @brief Get the timing of the bounce drawings
+ *
+ * @param bounce Handle of the bounce drawing
+ * @param stats  Pointer to store the timing
+ * @param clear  Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_draw_bounce_get_stats(esp_panel_draw_bounce_handle_t bounce, esp_panel_draw_bounce_stats_t *stats,
+                                     bool clear);
+
+#ifdef __cplusplus
+}
+#endif
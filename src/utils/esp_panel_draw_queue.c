@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#else
+#define IRAM_ATTR
+#endif
+#include "esp_panel_draw_queue.h"
+
+#define SILENT_INDEX(token) ((token) % ESP_PANEL_DRAW_QUEUE_DEPTH_MAX)
+
+/**
+ * The finish ISR publishes `done_seq` with release, so a task which sees a drawing finished also sees everything the
+ * ISR did before. Every silent flag is a single byte, which is read and written in one access on all the targets
+ *
+ */
+uint32_t esp_panel_draw_queue_prepare(esp_panel_draw_queue_t *queue, bool notify)
+{
+    uint32_t token = __atomic_load_n(&queue->submit_seq, __ATOMIC_RELAXED) + 1;
+
+    /* The flag of the token is not read by the ISR until the drawing is started */
+    __atomic_store_n(&queue->silent[SILENT_INDEX(token)], notify ? 0 : 1, __ATOMIC_RELEASE);
+
+    return token;
+}
+
+void esp_panel_draw_queue_commit(esp_panel_draw_queue_t *queue, uint32_t token)
+{
+    __atomic_store_n(&queue->submit_seq, token, __ATOMIC_RELEASE);
+}
+
+IRAM_ATTR bool esp_panel_draw_queue_on_done(esp_panel_draw_queue_t *queue)
+{
+    uint32_t token = __atomic_load_n(&queue->done_seq, __ATOMIC_RELAXED) + 1;
+    bool is_silent = __atomic_load_n(&queue->silent[SILENT_INDEX(token)], __ATOMIC_ACQUIRE) != 0;
+    __atomic_store_n(&queue->done_seq, token, __ATOMIC_RELEASE);
+
+    return !is_silent;
+}
+
+uint32_t esp_panel_draw_queue_get_submitted(const esp_panel_draw_queue_t *queue)
+{
+    return __atomic_load_n(&queue->submit_seq, __ATOMIC_ACQUIRE);
+}
+
+bool esp_panel_draw_queue_is_done(const esp_panel_draw_queue_t *queue, uint32_t token)
+{
+    return (int32_t)(__atomic_load_n(&queue->done_seq, __ATOMIC_ACQUIRE) - token) >= 0;
+}
+
+uint32_t esp_panel_draw_queue_get_pending(const esp_panel_draw_queue_t *queue)
+{
+    /* The drawing may finish before it is committed */
+    uint32_t done_seq = __atomic_load_n(&queue->done_seq, __ATOMIC_ACQUIRE);
+    int32_t pending = (int32_t)(__atomic_load_n(&queue->submit_seq, __ATOMIC_ACQUIRE) - done_seq);
+
+    return (pending > 0) ? pending : 0;
+}
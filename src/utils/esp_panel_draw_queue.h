@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of the drawings in flight, which is limited by the ring of the silent flags
+ *
+ */
+#define ESP_PANEL_DRAW_QUEUE_DEPTH_MAX      (64)
+
+/**
+ * @brief Bookkeeping of the drawings in flight
+ *
+ * @note  The drawings are finished in the order they are submitted, so every drawing is identified by a sequence number
+ *        (token), and it is finished when the done sequence number reaches its token. The numbers wrap around, and
+ *        they are compared by the signed difference
+ * @note  The fields are shared between the tasks and the finish ISR, so they are only accessed by the functions below
+ *        with the atomic builtins. The struct is kept plain, since it is also embedded in the C++ classes
+ *
+ */
+typedef struct {
+    uint32_t submit_seq;            /*!< Token of the last submitted drawing, written by the submitting task only */
+    uint32_t done_seq;              /*!< Token of the last finished drawing, written by the finish ISR only */
+    uint8_t silent[ESP_PANEL_DRAW_QUEUE_DEPTH_MAX];  /*!< Flag of every token modulo the depth, set if the drawing
+                                                          doesn't notify the finish callback */
+} esp_panel_draw_queue_t;
+
+/**
+ * @brief Prepare the token of the next drawing. It should be called before starting the drawing, since the drawing may
+ *        finish before it is committed
+ *
+ * @param queue  Pointer of the queue
+ * @param notify Whether the drawing notifies the finish callback. For example, only the last drawing of a split bitmap
+ *               notifies it
+ *
+ * @return The token of the next drawing
+ */
+uint32_t esp_panel_draw_queue_prepare(esp_panel_draw_queue_t *queue, bool notify);
+
+/**
+ * @brief Commit the prepared drawing after it is started successfully
+ *
+ * @param queue Pointer of the queue
+ * @param token Token returned by `esp_panel_draw_queue_prepare()`
+ */
+void esp_panel_draw_queue_commit(esp_panel_draw_queue_t *queue, uint32_t token);
+
+/**
+ * @brief Handle the finish of the oldest drawing in flight
+ *
+ * @note  This function can be called from an ISR
+ *
+ * @param queue Pointer of the queue
+ *
+ * @return true if the finished drawing should notify the finish callback, otherwise false
+ */
+bool esp_panel_draw_queue_on_done(esp_panel_draw_queue_t *queue);
+
+/**
+ * @brief Get the token of the last committed drawing
+ *
+ * @param queue Pointer of the queue
+ *
+ * @return The token, which is finished once all the drawings in flight are finished
+ */
+uint32_t esp_panel_draw_queue_get_submitted(const esp_panel_draw_queue_t *queue);
+
+/**
+ * @brief Check whether the drawing of the token (and all the drawings before it) is finished
+ *
+ * @param queue Pointer of the queue
+ * @param token Token of the drawing
+ *
+ * @return true if finished, otherwise false
+ */
+bool esp_panel_draw_queue_is_done(const esp_panel_draw_queue_t *queue, uint32_t token);
+
+/**
+ * @brief Get the number of the drawings in flight
+ *
+ * @param queue Pointer of the queue
+ *
+ * @return The number of the drawings which are submitted but not finished
+ */
+uint32_t esp_panel_draw_queue_get_pending(const esp_panel_draw_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
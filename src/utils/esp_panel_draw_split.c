@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_draw_split.h"
+
+uint32_t esp_panel_draw_split_get_lines(size_t line_size, size_t max_size, uint8_t y_align)
+{
+    if ((line_size == 0) || (max_size == 0)) {
+        return 0;
+    }
+
+    y_align = (y_align == 0) ? 1 : y_align;
+    size_t lines = max_size / line_size;
+    lines -= lines % y_align;
+
+    return (lines > 0) ? lines : y_align;
+}
+
+bool esp_panel_draw_split_bitmap(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data,
+                                 uint8_t bytes_per_pixel, size_t max_size, uint8_t y_align,
+                                 esp_panel_draw_split_cb_t draw_cb, void *user_ctx)
+{
+    if ((data == NULL) || (draw_cb == NULL) || (x_start >= x_end) || (y_start >= y_end) || (bytes_per_pixel == 0)) {
+        return false;
+    }
+
+    size_t line_size = (size_t)(x_end - x_start) * bytes_per_pixel;
+    uint32_t band_lines = esp_panel_draw_split_get_lines(line_size, max_size, y_align);
+    if ((band_lines == 0) || (band_lines >= (uint32_t)(y_end - y_start))) {
+        return draw_cb(user_ctx, x_start, y_start, x_end, y_end, data, true);
+    }
+
+    const uint8_t *band_data = (const uint8_t *)data;
+    for (int y = y_start; y < y_end; y += band_lines) {
+        int band_end = (y_end - y > (int)band_lines) ? (y + band_lines) : y_end;
+        if (!draw_cb(user_ctx, x_start, y, x_end, band_end, band_data, band_end == y_end)) {
+            return false;
+        }
+        band_data += (size_t)(band_end - y) * line_size;
+    }
+
+    return true;
+}
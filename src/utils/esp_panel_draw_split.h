@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Callback to draw a band of the split bitmap, which has the same parameters as `esp_lcd_panel_draw_bitmap()`
+ *
+ * @param user_ctx User context
+ * @param x_start  Start X coordinate (inclusive)
+ * @param y_start  Start Y coordinate (inclusive)
+ * @param x_end    End X coordinate (exclusive)
+ * @param y_end    End Y coordinate (exclusive)
+ * @param data     Pointer of the color data of the band
+ * @param is_last  Whether it is the last band of the bitmap
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_draw_split_cb_t)(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                                          uint16_t y_end, const void *data, bool is_last);
+
+/**
+ * @brief Get the number of the lines of a band which fits in a single transfer
+ *
+ * @param line_size Size of a line in bytes
+ * @param max_size  Maximum size of a transfer in bytes, `0` means no limit
+ * @param y_align   Alignment of the band height in lines, `0` is treated as `1`
+ *
+ * @return The number of the lines, which is a multiple of `y_align` and at least `y_align`. If `y_align` lines exceed
+ *         `max_size`, they can't be split any more and the bus has to split them itself. `0` means no limit
+ */
+uint32_t esp_panel_draw_split_get_lines(size_t line_size, size_t max_size, uint8_t y_align);
+
+/**
+ * @brief Split a bitmap into bands of whole lines, every band fits in a single transfer
+ *
+ * @note  The bands keep the X coordinates of the bitmap, and every band except the last one has a height which is a
+ *        multiple of `y_align`, so the coordinates of the bands are aligned as long as the ones of the bitmap are
+ * @note  The bands are drawn from top to bottom without waiting, so they are queued by the bus and kept in flight
+ *
+ * @param x_start         Start X coordinate (inclusive)
+ * @param y_start         Start Y coordinate (inclusive)
+ * @param x_end           End X coordinate (exclusive)
+ * @param y_end           End Y coordinate (exclusive)
+ * @param data            Pointer of the color data of the bitmap
+ * @param bytes_per_pixel Bytes of a single pixel
+ * @param max_size        Maximum size of a transfer in bytes, `0` means no limit
+ * @param y_align         Alignment of the band height in lines, `0` is treated as `1`
+ * @param draw_cb         Callback to draw a band
+ * @param user_ctx        User context passed to the callback
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_draw_split_bitmap(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, const void *data,
+                                 uint8_t bytes_per_pixel, size_t max_size, uint8_t y_align,
+                                 esp_panel_draw_split_cb_t draw_cb, void *user_ctx);
+
+#ifdef __cplusplus
+}
+#endif
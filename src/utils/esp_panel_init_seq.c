@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_panel_init_seq.h"
+
+static bool reset(esp_panel_init_seq_t *seq)
+{
+    if (seq == NULL) {
+        return false;
+    }
+
+    seq->pos = 0;
+    seq->flags.is_invalid = 0;
+    seq->flags.is_delayed = 0;
+    seq->stats = (esp_panel_init_seq_stats_t) {};
+
+    return true;
+}
+
+bool esp_panel_init_seq_init(esp_panel_init_seq_t *seq, const uint8_t *code, size_t size)
+{
+    if (!reset(seq) || ((code == NULL) && (size > 0))) {
+        return false;
+    }
+
+    seq->code = code;
+    seq->cmds = NULL;
+    seq->size = size;
+
+    return true;
+}
+
+bool esp_panel_init_seq_init_from_cmds(esp_panel_init_seq_t *seq, const esp_panel_init_seq_cmd_t *cmds, size_t num)
+{
+    if (!reset(seq) || ((cmds == NULL) && (num > 0))) {
+        return false;
+    }
+
+    seq->code = NULL;
+    seq->cmds = cmds;
+    seq->size = num;
+
+    return true;
+}
+
+/* Read a command and the delays after it from the bytecode */
+static bool decode(esp_panel_init_seq_t *seq, esp_panel_init_seq_cmd_t *cmd)
+{
+    const uint8_t *code = seq->code;
+    size_t pos = seq->pos;
+    uint8_t data_bytes = code[pos];
+
+    // The operation should be a command, the delays are read after it
+    if ((data_bytes > ESP_PANEL_INIT_SEQ_DATA_BYTES_MAX) || (pos + 2 + data_bytes > seq->size)) {
+        return false;
+    }
+    cmd->cmd = code[pos + 1];
+    cmd->data = (data_bytes > 0) ? &code[pos + 2] : NULL;
+    cmd->data_bytes = data_bytes;
+    cmd->delay_ms = 0;
+    pos += 2 + data_bytes;
+
+    while ((pos < seq->size) && (code[pos] == ESP_PANEL_INIT_SEQ_OP_DELAY)) {
+        if (pos + 3 > seq->size) {
+            return false;
+        }
+        cmd->delay_ms += code[pos + 1] | (code[pos + 2] << 8);
+        pos += 3;
+    }
+    seq->pos = pos;
+
+    return true;
+}
+
+bool esp_panel_init_seq_next(esp_panel_init_seq_t *seq, esp_panel_init_seq_cmd_t *cmd)
+{
+    if ((seq == NULL) || (cmd == NULL) || seq->flags.is_invalid || (seq->pos >= seq->size)) {
+        return false;
+    }
+
+    if (seq->code != NULL) {
+        if (!decode(seq, cmd)) {
+            seq->flags.is_invalid = 1;
+            return false;
+        }
+    } else {
+        *cmd = seq->cmds[seq->pos++];
+    }
+
+    seq->stats.commands++;
+    if ((seq->stats.commands == 1) || seq->flags.is_delayed) {
+        seq->stats.batches++;
+    }
+    seq->flags.is_delayed = (cmd->delay_ms > 0);
+    if (seq->flags.is_delayed) {
+        seq->stats.delays++;
+        seq->stats.delay_ms += cmd->delay_ms;
+    }
+
+    return true;
+}
+
+bool esp_panel_init_seq_is_end(const esp_panel_init_seq_t *seq)
+{
+    return (seq != NULL) && !seq->flags.is_invalid && (seq->pos >= seq->size);
+}
+
+size_t esp_panel_init_seq_compile(const esp_panel_init_seq_cmd_t *cmds, size_t num, uint8_t *code, size_t size)
+{
+    if ((cmds == NULL) && (num > 0)) {
+        return 0;
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < num; i++) {
+        const esp_panel_init_seq_cmd_t *cmd = &cmds[i];
+        if ((cmd->cmd < 0) || (cmd->cmd > 0xFF) || (cmd->data_bytes > ESP_PANEL_INIT_SEQ_DATA_BYTES_MAX) ||
+                ((cmd->data == NULL) && (cmd->data_bytes > 0))) {
+            return 0;
+        }
+        if ((code != NULL) && (len + 2 + cmd->data_bytes <= size)) {
+            code[len] = cmd->data_bytes;
+            code[len + 1] = cmd->cmd;
+            if (cmd->data_bytes > 0) {
+                memcpy(&code[len + 2], cmd->data, cmd->data_bytes);
+            }
+        }
+        len += 2 + cmd->data_bytes;
+
+        for (unsigned int delay_ms = cmd->delay_ms; delay_ms > 0;) {
+            unsigned int ms = (delay_ms > ESP_PANEL_INIT_SEQ_DELAY_MS_MAX) ? ESP_PANEL_INIT_SEQ_DELAY_MS_MAX : delay_ms;
+            if ((code != NULL) && (len + 3 <= size)) {
+                code[len] = ESP_PANEL_INIT_SEQ_OP_DELAY;
+                code[len + 1] = ms & 0xFF;
+                code[len + 2] = (ms >> 8) & 0xFF;
+            }
+            len += 3;
+            delay_ms -= ms;
+        }
+    }
+
+    return ((code != NULL) && (len > size)) ? 0 : len;
+}
+
+bool esp_panel_init_seq_get_stats(esp_panel_init_seq_t *seq, esp_panel_init_seq_stats_t *stats, bool clear)
+{
+    if ((seq == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = seq->stats;
+    if (clear) {
+        seq->stats = (esp_panel_init_seq_stats_t) {};
+    }
+
+    return true;
+}
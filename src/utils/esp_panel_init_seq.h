@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opcodes of the initialization sequence bytecode
+ *
+ * @note  Every operation starts with a byte:
+ *        - `0x00 ~ ESP_PANEL_INIT_SEQ_DATA_BYTES_MAX`: a command with this number of parameter bytes, followed by the
+ *          command byte and the parameters
+ *        - `ESP_PANEL_INIT_SEQ_OP_DELAY`: a delay after the previous command, followed by the milliseconds in 2 bytes
+ *          (little-endian)
+ *
+ */
+#define ESP_PANEL_INIT_SEQ_DATA_BYTES_MAX   (0xFD)
+#define ESP_PANEL_INIT_SEQ_OP_DELAY         (0xFE)
+#define ESP_PANEL_INIT_SEQ_DELAY_MS_MAX     (0xFFFF)
+
+/**
+ * @brief Macros to write the bytecode at compile time, like:
+ *
+ *        static const uint8_t init_seq[] = {
+ *            ESP_PANEL_INIT_SEQ_CMD(0x3A, 0x55),
+ *            ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(120),
+ *        };
+ *
+ * @note  The command should be 8-bit, and a delay should follow a command
+ *
+ */
+#define ESP_PANEL_INIT_SEQ_CMD(cmd, ...)        (uint8_t)sizeof((uint8_t []){__VA_ARGS__}), (uint8_t)(cmd), __VA_ARGS__
+#define ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(cmd)    0x00, (uint8_t)(cmd)
+#define ESP_PANEL_INIT_SEQ_DELAY(ms)            ESP_PANEL_INIT_SEQ_OP_DELAY, (uint8_t)((ms) & 0xFF), \
+                                                (uint8_t)(((ms) >> 8) & 0xFF)
+
+/**
+ * @brief A command of the initialization sequence, same as `esp_lcd_panel_vendor_init_cmd_t`
+ *
+ */
+typedef struct {
+    int cmd;                /*<! The specific LCD command */
+    const void *data;       /*<! Buffer that holds the command specific data */
+    size_t data_bytes;      /*<! Size of `data` in memory, in bytes */
+    unsigned int delay_ms;  /*<! Delay in milliseconds after this command */
+} esp_panel_init_seq_cmd_t;
+
+/**
+ * @brief Counters of the initialization sequence
+ *
+ */
+typedef struct {
+    uint32_t commands;      /*!< Number of the commands */
+    uint32_t batches;       /*!< Number of the runs of commands without a delay in between */
+    uint32_t delays;        /*!< Number of the delays, the zero delays are skipped and the adjacent ones are merged */
+    uint32_t delay_ms;      /*!< Total delay in milliseconds */
+} esp_panel_init_seq_stats_t;
+
+/**
+ * @brief Interpreter of the initialization sequence, which reads the bytecode or a table of commands
+ *
+ */
+typedef struct {
+    const uint8_t *code;                    /*!< Bytecode, NULL if a table is used */
+    const esp_panel_init_seq_cmd_t *cmds;   /*!< Table of commands, NULL if the bytecode is used */
+    size_t size;                            /*!< Size of the bytecode in bytes, or number of the commands */
+    size_t pos;                             /*!< Position of the next operation */
+    struct {
+        uint32_t is_invalid: 1;             /*!< If this flag is enabled, the bytecode is broken */
+        uint32_t is_delayed: 1;             /*!< If this flag is enabled, the last command has a delay */
+    } flags;
+    esp_panel_init_seq_stats_t stats;
+} esp_panel_init_seq_t;
+
+/**
+ * @brief Initialize the interpreter with the bytecode
+ *
+ * @param seq  Pointer of the interpreter
+ * @param code Bytecode
+ * @param size Size of the bytecode in bytes
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_init_seq_init(esp_panel_init_seq_t *seq, const uint8_t *code, size_t size);
+
+/**
+ * @brief Initialize the interpreter with a table of commands
+ *
+ * @param seq  Pointer of the interpreter
+ * @param cmds Table of commands
+ * @param num  Number of the commands
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_init_seq_init_from_cmds(esp_panel_init_seq_t *seq, const esp_panel_init_seq_cmd_t *cmds, size_t num);
+
+/**
+ * @brief Get the next command, and its `delay_ms` includes all the delays until the next command
+ *
+ * @note  The caller should send the command, then delay only if `delay_ms` is not zero
+ *
+ * @param seq Pointer of the interpreter
+ * @param cmd Pointer to store the command
+ *
+ * @return true if a command is got, otherwise false (the end is reached or the bytecode is broken)
+ */
+bool esp_panel_init_seq_next(esp_panel_init_seq_t *seq, esp_panel_init_seq_cmd_t *cmd);
+
+/**
+ * @brief Check if all the operations are read without error
+ *
+ * @param seq Pointer of the interpreter
+ *
+ * @return true if the end is reached, otherwise false
+ */
+bool esp_panel_init_seq_is_end(const esp_panel_init_seq_t *seq);
+
+/**
+ * @brief Compile a table of commands into the bytecode
+ *
+ * @param cmds Table of commands
+ * @param num  Number of the commands
+ * @param code Buffer to store the bytecode, set to NULL to only get the size
+ * @param size Size of the buffer in bytes
+ *
+ * @note  The delays longer than `ESP_PANEL_INIT_SEQ_DELAY_MS_MAX` are split, and merged again by the interpreter
+ *
+ * @return Size of the bytecode in bytes, 0 if the table can't be compiled (a command is wider than 8 bits or has more
+ *         than `ESP_PANEL_INIT_SEQ_DATA_BYTES_MAX` parameters) or the buffer is too small
+ */
+size_t esp_panel_init_seq_compile(const esp_panel_init_seq_cmd_t *cmds, size_t num, uint8_t *code, size_t size);
+
+/**
+ * @brief Get the counters of the interpreter
+ *
+ * @param seq   Pointer of the interpreter
+ * @param stats Pointer to store the counters
+ * @param clear Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_init_seq_get_stats(esp_panel_init_seq_t *seq, esp_panel_init_seq_stats_t *stats, bool clear);
+
+#ifdef __cplusplus
+}
+#endif
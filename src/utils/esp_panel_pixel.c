@@ -0,0 +1,761 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+#include "esp_panel_pixel.h"
+
+/**
+ * The word based kernels pack/unpack pixels inside 32-bit words, which assumes a little-endian memory layout.
+ * All the ESP SoCs (Xtensa & RISC-V) and the common host architectures satisfy this.
+ *
+ */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "The pixel kernels only support little-endian architectures"
+#endif
+
+/**
+ * The SIMD kernels use the PIE instructions of ESP32-S3 and ESP32-P4, which load and store 16 bytes (8 pixels of 16bpp)
+ * per access and interleave the 16-bit lanes of two registers. The word kernels are the fallback on the other targets,
+ * on the host and for the frames which are not 16-byte aligned.
+ *
+ */
+#if defined(ESP_PLATFORM) && (CONFIG_IDF_TARGET_ESP32S3 || CONFIG_IDF_TARGET_ESP32P4)
+#define PIXEL_SIMD_ENABLED  (1)
+#else
+#define PIXEL_SIMD_ENABLED  (0)
+#endif
+
+#define IS_ALIGNED_4(ptr)   ((((uintptr_t)(ptr)) & 0x3) == 0)
+#define IS_ALIGNED_16(ptr)  ((((uintptr_t)(ptr)) & 0xF) == 0)
+#define MIN(a, b)           (((a) < (b)) ? (a) : (b))
+
+/**
+ * Block sizes used by `esp_panel_pixel_rotate_copy()`, they can be replaced by the autotuner. Index 0 is for 16bpp and
+ * index 1 is for 24bpp.
+ *
+ */
+static struct {
+    uint16_t w;
+    uint16_t h;
+} rotate_block_size[2] = {
+    {ESP_PANEL_PIXEL_ROTATE_BLOCK_W_DEFAULT, ESP_PANEL_PIXEL_ROTATE_BLOCK_H_DEFAULT},
+    {ESP_PANEL_PIXEL_ROTATE_BLOCK_W_DEFAULT, ESP_PANEL_PIXEL_ROTATE_BLOCK_H_DEFAULT},
+};
+
+__attribute__((always_inline))
+static inline void copy_pixel(uint8_t *to, const uint8_t *from, uint8_t bytes_per_pixel)
+{
+    switch (bytes_per_pixel) {
+    case 2:
+        *(uint16_t *)to = *(const uint16_t *)from;
+        break;
+    case 3:
+        to[0] = from[0];
+        to[1] = from[1];
+        to[2] = from[2];
+        break;
+    case 4:
+        *(uint32_t *)to = *(const uint32_t *)from;
+        break;
+    default:
+        *to = *from;
+        break;
+    }
+}
+
+static bool check_args(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                       uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate, uint8_t bytes_per_pixel)
+{
+    if ((from == NULL) || (to == NULL) || (bytes_per_pixel == 0) || (bytes_per_pixel > 4)) {
+        return false;
+    }
+    if ((x_start > x_end) || (y_start > y_end) || (x_end >= w) || (y_end >= h)) {
+        return false;
+    }
+
+    return (rotate == 0) || (rotate == 90) || (rotate == 180) || (rotate == 270);
+}
+
+/**
+ * Scalar kernels, one pixel per iteration. They work with any pixel size and are used as the reference.
+ *
+ * The mapping from the source pixel `(x, y)` to the destination pixel is:
+ *      - 90:  (y, w - 1 - x) in a `h x w` frame
+ *      - 180: (w - 1 - x, h - 1 - y) in a `w x h` frame
+ *      - 270: (h - 1 - y, x) in a `h x w` frame
+ *
+ */
+static void rotate_copy_scalar(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                               int w, int h, uint16_t rotate, int bpp)
+{
+    int from_bytes_per_line = w * bpp;
+    int from_index = 0;
+    int to_bytes_per_line = 0;
+    int to_index = 0;
+    int to_index_const = 0;
+
+    switch (rotate) {
+    case 90:
+        to_bytes_per_line = h * bpp;
+        to_index_const = (w - x_start - 1) * to_bytes_per_line;
+        for (int from_y = y_start; from_y <= y_end; from_y++) {
+            from_index = from_y * from_bytes_per_line + x_start * bpp;
+            to_index = to_index_const + from_y * bpp;
+            for (int from_x = x_start; from_x <= x_end; from_x++) {
+                copy_pixel(to + to_index, from + from_index, bpp);
+                from_index += bpp;
+                to_index -= to_bytes_per_line;
+            }
+        }
+        break;
+    case 180:
+        to_bytes_per_line = w * bpp;
+        to_index_const = (h - 1) * to_bytes_per_line + (w - x_start - 1) * bpp;
+        for (int from_y = y_start; from_y <= y_end; from_y++) {
+            from_index = from_y * from_bytes_per_line + x_start * bpp;
+            to_index = to_index_const - from_y * to_bytes_per_line;
+            for (int from_x = x_start; from_x <= x_end; from_x++) {
+                copy_pixel(to + to_index, from + from_index, bpp);
+                from_index += bpp;
+                to_index -= bpp;
+            }
+        }
+        break;
+    case 270:
+        to_bytes_per_line = h * bpp;
+        to_index_const = x_start * to_bytes_per_line + (h - 1) * bpp;
+        for (int from_y = y_start; from_y <= y_end; from_y++) {
+            from_index = from_y * from_bytes_per_line + x_start * bpp;
+            to_index = to_index_const - from_y * bpp;
+            for (int from_x = x_start; from_x <= x_end; from_x++) {
+                copy_pixel(to + to_index, from + from_index, bpp);
+                from_index += bpp;
+                to_index += to_bytes_per_line;
+            }
+        }
+        break;
+    default:
+        for (int from_y = y_start; from_y <= y_end; from_y++) {
+            from_index = (from_y * w + x_start) * bpp;
+            memcpy(to + from_index, from + from_index, (x_end - x_start + 1) * bpp);
+        }
+        break;
+    }
+}
+
+/**
+ * Generic scalar kernel for the mirror/transpose operations. The destination pixel of the source pixel `(x, y)` is
+ * located at `to + to_origin + x * to_step_x + y * to_step_y`.
+ *
+ */
+static void transform_copy_scalar(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                                  int w, int bpp, int to_origin, int to_step_x, int to_step_y)
+{
+    for (int from_y = y_start; from_y <= y_end; from_y++) {
+        const uint8_t *from_next = from + (from_y * w + x_start) * bpp;
+        uint8_t *to_next = to + to_origin + x_start * to_step_x + from_y * to_step_y;
+        for (int from_x = x_start; from_x <= x_end; from_x++) {
+            copy_pixel(to_next, from_next, bpp);
+            from_next += bpp;
+            to_next += to_step_x;
+        }
+    }
+}
+
+/**
+ * 16bpp kernels. They move a 2x2 pixel tile with two 32-bit loads and two 32-bit stores, instead of four 16-bit
+ * loads and stores. Take the 90 degree rotation as an example, the source words `a` (row y) and `b` (row y + 1) of
+ * columns `x` and `x + 1` are transposed into:
+ *
+ *      to[w - 1 - x][y..y+1] = (a.lo, b.lo)
+ *      to[w - 2 - x][y..y+1] = (a.hi, b.hi)
+ *
+ * The tile must be word-aligned in both frames, so the odd border rows/columns are handled by the scalar kernel.
+ *
+ */
+static void rotate_90_16bpp_block(const uint16_t *from, uint16_t *to, int x_start, int y_start, int x_end, int y_end,
+                                  int w, int h)
+{
+    for (int y = y_start; y < y_end; y += 2) {
+        const uint32_t *from_a = (const uint32_t *)(from + y * w + x_start);
+        const uint32_t *from_b = (const uint32_t *)(from + (y + 1) * w + x_start);
+        uint16_t *to_next = to + (w - 1 - x_start) * h + y;
+        for (int x = x_start; x < x_end; x += 2) {
+            uint32_t a = *from_a++;
+            uint32_t b = *from_b++;
+            *(uint32_t *)to_next = (a & 0xFFFF) | (b << 16);
+            to_next -= h;
+            *(uint32_t *)to_next = (a >> 16) | (b & 0xFFFF0000);
+            to_next -= h;
+        }
+    }
+}
+
+static void rotate_270_16bpp_block(const uint16_t *from, uint16_t *to, int x_start, int y_start, int x_end,
+                                   int y_end, int w, int h)
+{
+    for (int y = y_start; y < y_end; y += 2) {
+        const uint32_t *from_a = (const uint32_t *)(from + y * w + x_start);
+        const uint32_t *from_b = (const uint32_t *)(from + (y + 1) * w + x_start);
+        uint16_t *to_next = to + x_start * h + (h - 2 - y);
+        for (int x = x_start; x < x_end; x += 2) {
+            uint32_t a = *from_a++;
+            uint32_t b = *from_b++;
+            *(uint32_t *)to_next = (b & 0xFFFF) | (a << 16);
+            to_next += h;
+            *(uint32_t *)to_next = (b >> 16) | (a & 0xFFFF0000);
+            to_next += h;
+        }
+    }
+}
+
+/**
+ * Run the tile kernel on the part of the region which is aligned to `align` pixels in both directions, and the scalar
+ * kernel on the unaligned border rows/columns. The aligned part is walked block by block to keep the strided
+ * destination lines in cache.
+ *
+ */
+typedef void (*rotate_block_func_t)(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                                    int w, int h, uint16_t rotate);
+
+static void rotate_90_270_blocked(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                                  int w, int h, uint16_t rotate, int bpp, int align, int block_w, int block_h,
+                                  rotate_block_func_t block_func)
+{
+    int x_start_aligned = (x_start + align - 1) & ~(align - 1);
+    int x_end_aligned = ((x_end + 1) & ~(align - 1)) - 1;
+    int y_start_aligned = (y_start + align - 1) & ~(align - 1);
+    int y_end_aligned = ((y_end + 1) & ~(align - 1)) - 1;
+
+    if ((x_start_aligned > x_end_aligned) || (y_start_aligned > y_end_aligned)) {
+        rotate_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, h, rotate, bpp);
+        return;
+    }
+    if (y_start != y_start_aligned) {
+        rotate_copy_scalar(from, to, x_start, y_start, x_end, y_start_aligned - 1, w, h, rotate, bpp);
+    }
+    if (y_end != y_end_aligned) {
+        rotate_copy_scalar(from, to, x_start, y_end_aligned + 1, x_end, y_end, w, h, rotate, bpp);
+    }
+    if (x_start != x_start_aligned) {
+        rotate_copy_scalar(from, to, x_start, y_start_aligned, x_start_aligned - 1, y_end_aligned, w, h, rotate, bpp);
+    }
+    if (x_end != x_end_aligned) {
+        rotate_copy_scalar(from, to, x_end_aligned + 1, y_start_aligned, x_end, y_end_aligned, w, h, rotate, bpp);
+    }
+
+    /* Keep the block size a multiple of the alignment */
+    block_w = (block_w < align) ? align : (block_w & ~(align - 1));
+    block_h = (block_h < align) ? align : (block_h & ~(align - 1));
+    for (int i = y_start_aligned; i <= y_end_aligned; i += block_h) {
+        int max_y = MIN(i + block_h - 1, y_end_aligned);
+        for (int j = x_start_aligned; j <= x_end_aligned; j += block_w) {
+            int max_x = MIN(j + block_w - 1, x_end_aligned);
+            block_func(from, to, j, i, max_x, max_y, w, h, rotate);
+        }
+    }
+}
+
+static void rotate_90_270_16bpp_block(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end,
+                                      int y_end, int w, int h, uint16_t rotate)
+{
+    if (rotate == 90) {
+        rotate_90_16bpp_block((const uint16_t *)from, (uint16_t *)to, x_start, y_start, x_end, y_end, w, h);
+    } else {
+        rotate_270_16bpp_block((const uint16_t *)from, (uint16_t *)to, x_start, y_start, x_end, y_end, w, h);
+    }
+}
+
+static void rotate_180_16bpp(const uint16_t *from, uint16_t *to, int x_start, int y_start, int x_end, int y_end,
+                             int w, int h)
+{
+    /* Swapping the two halves of a word reverses two pixels at once */
+    int x_start_aligned = (x_start + 1) & ~1;
+    int x_end_aligned = ((x_end + 1) & ~1) - 1;
+
+    if (x_start_aligned > x_end_aligned) {
+        rotate_copy_scalar((const uint8_t *)from, (uint8_t *)to, x_start, y_start, x_end, y_end, w, h, 180, 2);
+        return;
+    }
+    if (x_start != x_start_aligned) {
+        rotate_copy_scalar((const uint8_t *)from, (uint8_t *)to, x_start, y_start, x_start, y_end, w, h, 180, 2);
+    }
+    if (x_end != x_end_aligned) {
+        rotate_copy_scalar((const uint8_t *)from, (uint8_t *)to, x_end, y_start, x_end, y_end, w, h, 180, 2);
+    }
+
+    for (int y = y_start; y <= y_end; y++) {
+        const uint32_t *from_next = (const uint32_t *)(from + y * w + x_start_aligned);
+        uint32_t *to_next = (uint32_t *)(to + (h - 1 - y) * w + (w - 2 - x_start_aligned));
+        int x = x_start_aligned;
+        for (; x + 3 <= x_end_aligned; x += 4) {
+            uint32_t a = from_next[0];
+            uint32_t b = from_next[1];
+            to_next[0] = (a >> 16) | (a << 16);
+            to_next[-1] = (b >> 16) | (b << 16);
+            from_next += 2;
+            to_next -= 2;
+        }
+        for (; x < x_end_aligned; x += 2) {
+            uint32_t a = *from_next++;
+            *to_next-- = (a >> 16) | (a << 16);
+        }
+    }
+}
+
+/**
+ * 24bpp kernels. The 180 degree kernel reverses four pixels (three words) per iteration:
+ *
+ *      from: | b3 b2 b1 b0 | b7 b6 b5 b4 | b11 b10 b9 b8 |   (word view, MSB first)
+ *      to:   | b6 b11 b10 b9 | b4 b3 b8 b7 | b2 b1 b0 b5 |
+ *
+ * The 90/270 degree kernels transpose a 4x4 pixel tile, which is loaded and stored as 4 x 3 words.
+ *
+ */
+static void rotate_180_24bpp(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                             int w, int h)
+{
+    int x_start_aligned = (x_start + 3) & ~3;
+    int x_end_aligned = ((x_end + 1) & ~3) - 1;
+
+    if (x_start_aligned > x_end_aligned) {
+        rotate_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, h, 180, 3);
+        return;
+    }
+    if (x_start != x_start_aligned) {
+        rotate_copy_scalar(from, to, x_start, y_start, x_start_aligned - 1, y_end, w, h, 180, 3);
+    }
+    if (x_end != x_end_aligned) {
+        rotate_copy_scalar(from, to, x_end_aligned + 1, y_start, x_end, y_end, w, h, 180, 3);
+    }
+
+    for (int y = y_start; y <= y_end; y++) {
+        const uint32_t *from_next = (const uint32_t *)(from + (y * w + x_start_aligned) * 3);
+        uint32_t *to_next = (uint32_t *)(to + ((h - 1 - y) * w + (w - 4 - x_start_aligned)) * 3);
+        for (int x = x_start_aligned; x < x_end_aligned; x += 4) {
+            uint32_t s0 = from_next[0];
+            uint32_t s1 = from_next[1];
+            uint32_t s2 = from_next[2];
+            to_next[0] = (s2 >> 8) | ((s1 & 0x00FF0000) << 8);
+            to_next[1] = (s1 >> 24) | ((s2 & 0xFF) << 8) | ((s0 >> 24) << 16) | (s1 << 24);
+            to_next[2] = ((s1 >> 8) & 0xFF) | (s0 << 8);
+            from_next += 3;
+            to_next -= 3;
+        }
+    }
+}
+
+static void rotate_90_270_24bpp_block(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end,
+                                      int y_end, int w, int h, uint16_t rotate)
+{
+    uint32_t p[4][4];
+
+    for (int y = y_start; y < y_end; y += 4) {
+        for (int x = x_start; x < x_end; x += 4) {
+            /* Load 4 pixels from each of the 4 source lines, 3 words per line */
+            for (int i = 0; i < 4; i++) {
+                const uint32_t *from_next = (const uint32_t *)(from + ((y + i) * w + x) * 3);
+                uint32_t s0 = from_next[0];
+                uint32_t s1 = from_next[1];
+                uint32_t s2 = from_next[2];
+                p[i][0] = s0 & 0xFFFFFF;
+                p[i][1] = (s0 >> 24) | ((s1 & 0xFFFF) << 8);
+                p[i][2] = (s1 >> 16) | ((s2 & 0xFF) << 16);
+                p[i][3] = s2 >> 8;
+            }
+            /* Every source column becomes 4 contiguous pixels (3 words) of a destination line */
+            for (int k = 0; k < 4; k++) {
+                uint32_t q0, q1, q2, q3;
+                uint32_t *to_next = NULL;
+                if (rotate == 90) {
+                    q0 = p[0][k];
+                    q1 = p[1][k];
+                    q2 = p[2][k];
+                    q3 = p[3][k];
+                    to_next = (uint32_t *)(to + ((w - 1 - x - k) * h + y) * 3);
+                } else {
+                    q0 = p[3][k];
+                    q1 = p[2][k];
+                    q2 = p[1][k];
+                    q3 = p[0][k];
+                    to_next = (uint32_t *)(to + ((x + k) * h + (h - 4 - y)) * 3);
+                }
+                to_next[0] = q0 | (q1 << 24);
+                to_next[1] = (q1 >> 8) | (q2 << 16);
+                to_next[2] = (q2 >> 16) | (q3 << 8);
+            }
+        }
+    }
+}
+
+#if PIXEL_SIMD_ENABLED
+#if CONFIG_IDF_TARGET_ESP32S3
+#define SIMD_OP(op)         "ee." op " "
+#define SIMD_ARCH_BEGIN     ""
+#define SIMD_ARCH_END       ""
+#else
+#define SIMD_OP(op)         "esp." op " "
+#define SIMD_ARCH_BEGIN     ".option push\n.option arch, +xesppie\n"
+#define SIMD_ARCH_END       ".option pop\n"
+#endif
+/* Load a line into `qn`, then move to the next line */
+#define SIMD_LOAD_LINE(n)   SIMD_OP("vld.128.ip") "q" #n ", %[from], 0\n" "add %[from], %[from], %[from_step]\n"
+/* Store `qn` into a line, then move to the next line */
+#define SIMD_STORE_LINE(n)  SIMD_OP("vst.128.ip") "q" #n ", %[to], 0\n" "add %[to], %[to], %[to_step]\n"
+/* `qa` = (a0, b0, a1, b1, a2, b2, a3, b3), `qb` = (a4, b4, a5, b5, a6, b6, a7, b7) */
+#define SIMD_ZIP_16(a, b)   SIMD_OP("vzip.16") "q" #a ", q" #b "\n"
+
+/**
+ * Transpose an 8x8 tile of 16bpp pixels. The 8 source lines are loaded into q0-q7, then three rounds of interleaving
+ * line `i` with line `i + 4` move the column `k` into `qk`, which is stored as a destination line.
+ *
+ * `from_step` and `to_step` are the signed distances in bytes between two lines, so the same tile serves both 90 and
+ * 270 degree by walking the lines downwards or upwards.
+ *
+ */
+__attribute__((always_inline))
+static inline void transpose_8x8_16bpp_simd(const uint16_t *from, int from_step, uint16_t *to, int to_step)
+{
+    __asm__ __volatile__(
+        SIMD_ARCH_BEGIN
+        SIMD_LOAD_LINE(0) SIMD_LOAD_LINE(1) SIMD_LOAD_LINE(2) SIMD_LOAD_LINE(3)
+        SIMD_LOAD_LINE(4) SIMD_LOAD_LINE(5) SIMD_LOAD_LINE(6) SIMD_LOAD_LINE(7)
+        SIMD_ZIP_16(0, 4) SIMD_ZIP_16(1, 5) SIMD_ZIP_16(2, 6) SIMD_ZIP_16(3, 7)
+        SIMD_ZIP_16(0, 2) SIMD_ZIP_16(4, 6) SIMD_ZIP_16(1, 3) SIMD_ZIP_16(5, 7)
+        SIMD_ZIP_16(0, 1) SIMD_ZIP_16(2, 3) SIMD_ZIP_16(4, 5) SIMD_ZIP_16(6, 7)
+        SIMD_STORE_LINE(0) SIMD_STORE_LINE(1) SIMD_STORE_LINE(2) SIMD_STORE_LINE(3)
+        SIMD_STORE_LINE(4) SIMD_STORE_LINE(5) SIMD_STORE_LINE(6) SIMD_STORE_LINE(7)
+        SIMD_ARCH_END
+        : [from] "+r"(from), [to] "+r"(to)
+        : [from_step] "r"(from_step), [to_step] "r"(to_step)
+        : "memory"
+    );
+}
+
+/**
+ * Reverse 16 pixels of 16bpp. Taking q0 and q1 as 16 lanes, an interleave rotates the 4 bits of the lane index left
+ * by one, and swapping the two registers before it inverts the top bit. So four of them invert all the bits, which
+ * puts the reversed second half into q0 and the reversed first half into q1.
+ *
+ */
+__attribute__((always_inline))
+static inline void reverse_16_16bpp_simd(const uint16_t *from, uint16_t *to)
+{
+    __asm__ __volatile__(
+        SIMD_ARCH_BEGIN
+        SIMD_OP("vld.128.ip") "q0, %[from], 16\n"
+        SIMD_OP("vld.128.ip") "q1, %[from], 16\n"
+        SIMD_ZIP_16(1, 0) SIMD_ZIP_16(0, 1) SIMD_ZIP_16(1, 0) SIMD_ZIP_16(0, 1)
+        SIMD_OP("vst.128.ip") "q0, %[to], 16\n"
+        SIMD_OP("vst.128.ip") "q1, %[to], 16\n"
+        SIMD_ARCH_END
+        : [from] "+r"(from), [to] "+r"(to)
+        :
+        : "memory"
+    );
+}
+
+static void rotate_90_270_16bpp_simd_block(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end,
+                                           int y_end, int w, int h, uint16_t rotate)
+{
+    const uint16_t *from_16 = (const uint16_t *)from;
+    uint16_t *to_16 = (uint16_t *)to;
+
+    for (int y = y_start; y < y_end; y += 8) {
+        for (int x = x_start; x < x_end; x += 8) {
+            if (rotate == 90) {
+                transpose_8x8_16bpp_simd(from_16 + y * w + x, w * 2, to_16 + (w - 1 - x) * h + y, -h * 2);
+            } else {
+                transpose_8x8_16bpp_simd(from_16 + (y + 7) * w + x, -w * 2, to_16 + x * h + (h - 8 - y), h * 2);
+            }
+        }
+    }
+}
+
+/**
+ * The 8x8 tiles need 8-pixel aligned columns and rows, the unaligned border rows/columns are handled by the word
+ * kernels instead of the scalar one.
+ *
+ */
+static void rotate_90_270_16bpp_simd(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                                     int w, int h, uint16_t rotate, int block_w, int block_h)
+{
+    int x_start_aligned = (x_start + 7) & ~7;
+    int x_end_aligned = ((x_end + 1) & ~7) - 1;
+    int y_start_aligned = (y_start + 7) & ~7;
+    int y_end_aligned = ((y_end + 1) & ~7) - 1;
+
+    if ((x_start_aligned > x_end_aligned) || (y_start_aligned > y_end_aligned)) {
+        rotate_90_270_blocked(
+            from, to, x_start, y_start, x_end, y_end, w, h, rotate, 2, 2, block_w, block_h, rotate_90_270_16bpp_block
+        );
+        return;
+    }
+    if (y_start != y_start_aligned) {
+        rotate_90_270_blocked(
+            from, to, x_start, y_start, x_end, y_start_aligned - 1, w, h, rotate, 2, 2, block_w, block_h,
+            rotate_90_270_16bpp_block
+        );
+    }
+    if (y_end != y_end_aligned) {
+        rotate_90_270_blocked(
+            from, to, x_start, y_end_aligned + 1, x_end, y_end, w, h, rotate, 2, 2, block_w, block_h,
+            rotate_90_270_16bpp_block
+        );
+    }
+    if (x_start != x_start_aligned) {
+        rotate_90_270_blocked(
+            from, to, x_start, y_start_aligned, x_start_aligned - 1, y_end_aligned, w, h, rotate, 2, 2, block_w,
+            block_h, rotate_90_270_16bpp_block
+        );
+    }
+    if (x_end != x_end_aligned) {
+        rotate_90_270_blocked(
+            from, to, x_end_aligned + 1, y_start_aligned, x_end, y_end_aligned, w, h, rotate, 2, 2, block_w,
+            block_h, rotate_90_270_16bpp_block
+        );
+    }
+
+    rotate_90_270_blocked(
+        from, to, x_start_aligned, y_start_aligned, x_end_aligned, y_end_aligned, w, h, rotate, 2, 8, block_w, block_h,
+        rotate_90_270_16bpp_simd_block
+    );
+}
+
+static void rotate_180_16bpp_simd(const uint16_t *from, uint16_t *to, int x_start, int y_start, int x_end, int y_end,
+                                  int w, int h)
+{
+    int x_start_aligned = (x_start + 7) & ~7;
+    int num = (x_end + 1 - x_start_aligned) / 16;
+
+    if (num <= 0) {
+        rotate_180_16bpp(from, to, x_start, y_start, x_end, y_end, w, h);
+        return;
+    }
+
+    int x_end_aligned = x_start_aligned + num * 16 - 1;
+    if (x_start != x_start_aligned) {
+        rotate_180_16bpp(from, to, x_start, y_start, x_start_aligned - 1, y_end, w, h);
+    }
+    if (x_end != x_end_aligned) {
+        rotate_180_16bpp(from, to, x_end_aligned + 1, y_start, x_end, y_end, w, h);
+    }
+
+    for (int y = y_start; y <= y_end; y++) {
+        const uint16_t *from_next = from + y * w + x_start_aligned;
+        uint16_t *to_next = to + (h - 1 - y) * w + (w - 16 - x_start_aligned);
+        for (int i = 0; i < num; i++) {
+            reverse_16_16bpp_simd(from_next, to_next);
+            from_next += 16;
+            to_next -= 16;
+        }
+    }
+}
+#endif /* PIXEL_SIMD_ENABLED */
+
+bool esp_panel_pixel_rotate_copy_ref(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                     uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                     uint8_t bytes_per_pixel)
+{
+    if (!check_args(from, to, x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel)) {
+        return false;
+    }
+
+    rotate_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel);
+
+    return true;
+}
+
+bool esp_panel_pixel_rotate_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                 uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                 uint8_t bytes_per_pixel)
+{
+    uint16_t block_w = ESP_PANEL_PIXEL_ROTATE_BLOCK_W_DEFAULT;
+    uint16_t block_h = ESP_PANEL_PIXEL_ROTATE_BLOCK_H_DEFAULT;
+
+    esp_panel_pixel_get_rotate_block_size(bytes_per_pixel, &block_w, &block_h);
+
+    return esp_panel_pixel_rotate_copy_with_block(
+               from, to, x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel, block_w, block_h
+           );
+}
+
+bool esp_panel_pixel_rotate_copy_with_block(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                            uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                            uint8_t bytes_per_pixel, uint16_t block_w, uint16_t block_h)
+{
+    if (!check_args(from, to, x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel)) {
+        return false;
+    }
+    if ((block_w == 0) || (block_h == 0)) {
+        return false;
+    }
+
+    bool is_aligned = IS_ALIGNED_4(from) && IS_ALIGNED_4(to);
+
+    switch (bytes_per_pixel) {
+    case 2:
+        /* Word access needs even line lengths in both frames */
+        if (!is_aligned || (w & 1) || (h & 1)) {
+            break;
+        }
+#if PIXEL_SIMD_ENABLED
+        /* The SIMD kernels need every line to start at a 16-byte boundary in both frames */
+        if (IS_ALIGNED_16(from) && IS_ALIGNED_16(to) && !(w & 7) && ((rotate == 180) || !(h & 7))) {
+            if (rotate == 180) {
+                rotate_180_16bpp_simd((const uint16_t *)from, (uint16_t *)to, x_start, y_start, x_end, y_end, w, h);
+                return true;
+            } else if (rotate != 0) {
+                rotate_90_270_16bpp_simd(from, to, x_start, y_start, x_end, y_end, w, h, rotate, block_w, block_h);
+                return true;
+            }
+        }
+#endif
+        if (rotate == 180) {
+            rotate_180_16bpp((const uint16_t *)from, (uint16_t *)to, x_start, y_start, x_end, y_end, w, h);
+            return true;
+        } else if (rotate != 0) {
+            rotate_90_270_blocked(
+                from, to, x_start, y_start, x_end, y_end, w, h, rotate, 2, 2, block_w, block_h,
+                rotate_90_270_16bpp_block
+            );
+            return true;
+        }
+        break;
+    case 3:
+        /* Word access needs every line to start at a word boundary in both frames */
+        if (!is_aligned || (w & 3) || ((rotate != 180) && (h & 3))) {
+            break;
+        }
+        if (rotate == 180) {
+            rotate_180_24bpp(from, to, x_start, y_start, x_end, y_end, w, h);
+            return true;
+        } else if (rotate != 0) {
+            rotate_90_270_blocked(
+                from, to, x_start, y_start, x_end, y_end, w, h, rotate, 3, 4, block_w, block_h,
+                rotate_90_270_24bpp_block
+            );
+            return true;
+        }
+        break;
+    default:
+        break;
+    }
+
+    rotate_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel);
+
+    return true;
+}
+
+bool esp_panel_pixel_mirror_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                 uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, bool mirror_x, bool mirror_y,
+                                 uint8_t bytes_per_pixel)
+{
+    if (!check_args(from, to, x_start, y_start, x_end, y_end, w, h, 0, bytes_per_pixel)) {
+        return false;
+    }
+
+    int bpp = bytes_per_pixel;
+
+    if (mirror_x && mirror_y) {
+        /* Mirroring both axes is the same as rotating 180 degree, which has the fast kernels */
+        return esp_panel_pixel_rotate_copy(from, to, x_start, y_start, x_end, y_end, w, h, 180, bytes_per_pixel);
+    } else if (mirror_x) {
+        transform_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, bpp, (w - 1) * bpp, -bpp, w * bpp);
+    } else if (mirror_y) {
+        for (int y = y_start; y <= y_end; y++) {
+            memcpy(to + ((h - 1 - y) * w + x_start) * bpp, from + (y * w + x_start) * bpp, (x_end - x_start + 1) * bpp);
+        }
+    } else {
+        rotate_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, h, 0, bpp);
+    }
+
+    return true;
+}
+
+bool esp_panel_pixel_transpose_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                    uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint8_t bytes_per_pixel)
+{
+    if (!check_args(from, to, x_start, y_start, x_end, y_end, w, h, 0, bytes_per_pixel)) {
+        return false;
+    }
+
+    int bpp = bytes_per_pixel;
+    transform_copy_scalar(from, to, x_start, y_start, x_end, y_end, w, bpp, 0, h * bpp, bpp);
+
+    return true;
+}
+
+bool esp_panel_pixel_rotate_area(uint16_t w, uint16_t h, uint16_t rotate, uint16_t *x_start, uint16_t *y_start,
+                                 uint16_t *x_end, uint16_t *y_end)
+{
+    if ((x_start == NULL) || (y_start == NULL) || (x_end == NULL) || (y_end == NULL)) {
+        return false;
+    }
+    if ((*x_start > *x_end) || (*y_start > *y_end) || (*x_end >= w) || (*y_end >= h)) {
+        return false;
+    }
+
+    uint16_t xs = *x_start;
+    uint16_t ys = *y_start;
+    uint16_t xe = *x_end;
+    uint16_t ye = *y_end;
+
+    switch (rotate) {
+    case 0:
+        break;
+    case 90:
+        *x_start = ys;
+        *x_end = ye;
+        *y_start = w - 1 - xe;
+        *y_end = w - 1 - xs;
+        break;
+    case 180:
+        *x_start = w - 1 - xe;
+        *x_end = w - 1 - xs;
+        *y_start = h - 1 - ye;
+        *y_end = h - 1 - ys;
+        break;
+    case 270:
+        *x_start = h - 1 - ye;
+        *x_end = h - 1 - ys;
+        *y_start = xs;
+        *y_end = xe;
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+bool esp_panel_pixel_set_rotate_block_size(uint8_t bytes_per_pixel, uint16_t block_w, uint16_t block_h)
+{
+    if ((bytes_per_pixel < 2) || (bytes_per_pixel > 3) || (block_w == 0) || (block_h == 0)) {
+        return false;
+    }
+
+    rotate_block_size[bytes_per_pixel - 2].w = block_w;
+    rotate_block_size[bytes_per_pixel - 2].h = block_h;
+
+    return true;
+}
+
+bool esp_panel_pixel_get_rotate_block_size(uint8_t bytes_per_pixel, uint16_t *block_w, uint16_t *block_h)
+{
+    if ((bytes_per_pixel < 2) || (bytes_per_pixel > 3) || (block_w == NULL) || (block_h == NULL)) {
+        return false;
+    }
+
+    *block_w = rotate_block_size[bytes_per_pixel - 2].w;
+    *block_h = rotate_block_size[bytes_per_pixel - 2].h;
+
+    return true;
+}
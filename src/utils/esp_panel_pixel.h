@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Default block size (in source pixels) used by the blocked rotation kernels
+ *
+ * @note  `W` is the number of source columns and `H` is the number of source rows of a single block
+ *
+ */
+#define ESP_PANEL_PIXEL_ROTATE_BLOCK_W_DEFAULT  (32)
+#define ESP_PANEL_PIXEL_ROTATE_BLOCK_H_DEFAULT  (256)
+
+/**
+ * @brief Rotate a region of the source frame and copy it into the destination frame, pixel by pixel
+ *
+ * @note  This is the scalar reference implementation, it supports any pixel size and is always bit-exact with
+ *        `esp_panel_pixel_rotate_copy()`. It is mainly used for verification and as the fallback path.
+ * @note  The source frame is `w x h` pixels, the destination frame is `h x w` pixels for 90/270 degree and `w x h`
+ *        pixels for 0/180 degree. Both frames are stored row by row without padding.
+ *
+ * @param from            Pointer of the source frame
+ * @param to              Pointer of the destination frame
+ * @param x_start         X coordinate of the region start (in source frame), the range is [0, w - 1]
+ * @param y_start         Y coordinate of the region start (in source frame), the range is [0, h - 1]
+ * @param x_end           X coordinate of the region end (inclusive), the range is [x_start, w - 1]
+ * @param y_end           Y coordinate of the region end (inclusive), the range is [y_start, h - 1]
+ * @param w               Width of the source frame
+ * @param h               Height of the source frame
+ * @param rotate          Rotation degree, should be one of 0/90/180/270 (clockwise)
+ * @param bytes_per_pixel Bytes of a single pixel, the range is [1, 4]
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_rotate_copy_ref(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                     uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                     uint8_t bytes_per_pixel);
+
+/**
+ * @brief Rotate a region of the source frame and copy it into the destination frame using the optimized kernels
+ *
+ * @note  The parameters and the output are the same as `esp_panel_pixel_rotate_copy_ref()`.
+ * @note  16bpp and 24bpp have dedicated kernels which move several pixels per memory access and walk the frame in
+ *        cache friendly blocks. Other pixel sizes and unaligned frames fall back to the scalar implementation.
+ * @note  On ESP32-S3/P4, 16bpp uses the SIMD (PIE) kernels when both frames start at a 16-byte boundary and the width
+ *        (and the height for 90/270 degree) is a multiple of 8, otherwise the word kernels. As the PIE registers are
+ *        only saved for tasks, this should not be called from an ISR on these targets.
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_rotate_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                 uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                 uint8_t bytes_per_pixel);
+
+/**
+ * @brief Same as `esp_panel_pixel_rotate_copy()`, but use the given block size instead of the configured one
+ *
+ * @note  This is mainly used to benchmark the block sizes, see `esp_panel_pixel_tune.h`
+ * @note  The block size is rounded down to the tile size of the kernel (2 pixels for 16bpp, 8 pixels for the 16bpp SIMD
+ *        kernels of ESP32-S3/P4, 4 pixels for 24bpp)
+ *
+ * @param block_w Number of source columns of a single block, should be greater than 0
+ * @param block_h Number of source rows of a single block, should be greater than 0
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_rotate_copy_with_block(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                            uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                            uint8_t bytes_per_pixel, uint16_t block_w, uint16_t block_h);
+
+/**
+ * @brief Set the block size used by `esp_panel_pixel_rotate_copy()` for the 90/270 degree rotation
+ *
+ * @note  The default size is `ESP_PANEL_PIXEL_ROTATE_BLOCK_W_DEFAULT x ESP_PANEL_PIXEL_ROTATE_BLOCK_H_DEFAULT`. The best
+ *        size depends on the SoC cache and the buffer placement (SRAM or PSRAM), use `esp_panel_pixel_tune.h` to find
+ *        it out
+ *
+ * @param bytes_per_pixel Bytes of a single pixel, only 2 and 3 have the blocked kernels
+ * @param block_w         Number of source columns of a single block, should be greater than 0
+ * @param block_h         Number of source rows of a single block, should be greater than 0
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_set_rotate_block_size(uint8_t bytes_per_pixel, uint16_t block_w, uint16_t block_h);
+
+/**
+ * @brief Get the block size used by `esp_panel_pixel_rotate_copy()` for the 90/270 degree rotation
+ *
+ * @param bytes_per_pixel Bytes of a single pixel, only 2 and 3 have the blocked kernels
+ * @param block_w         Pointer to store the number of source columns of a single block
+ * @param block_h         Pointer to store the number of source rows of a single block
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_get_rotate_block_size(uint8_t bytes_per_pixel, uint16_t *block_w, uint16_t *block_h);
+
+/**
+ * @brief Mirror a region of the source frame and copy it into the destination frame
+ *
+ * @note  Both frames are `w x h` pixels. The source pixel `(x, y)` is copied to `(w - 1 - x, y)` when `mirror_x` is
+ *        set and to `(x, h - 1 - y)` when `mirror_y` is set.
+ * @note  Mirroring both axes uses the optimized 180 degree kernels.
+ * @note  The other parameters are the same as `esp_panel_pixel_rotate_copy_ref()`.
+ *
+ * @param mirror_x Whether to mirror the X axis
+ * @param mirror_y Whether to mirror the Y axis
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_mirror_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                 uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, bool mirror_x, bool mirror_y,
+                                 uint8_t bytes_per_pixel);
+
+/**
+ * @brief Transpose a region of the source frame and copy it into the destination frame
+ *
+ * @note  The source frame is `w x h` pixels and the destination frame is `h x w` pixels. The source pixel `(x, y)`
+ *        is copied to `(y, x)`.
+ * @note  The parameters are the same as `esp_panel_pixel_rotate_copy_ref()` except `rotate`.
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_transpose_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                    uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint8_t bytes_per_pixel);
+
+/**
+ * @brief Convert a region of the source frame into the region it occupies in the destination frame after rotation
+ *
+ * @note  This is typically used to find out which part of the rotated frame should be flushed after
+ *        `esp_panel_pixel_rotate_copy()` only updated a dirty region.
+ *
+ * @param w       Width of the source frame
+ * @param h       Height of the source frame
+ * @param rotate  Rotation degree, should be one of 0/90/180/270 (clockwise)
+ * @param x_start Pointer of the X coordinate of the region start, it will be overwritten with the rotated value
+ * @param y_start Pointer of the Y coordinate of the region start, it will be overwritten with the rotated value
+ * @param x_end   Pointer of the X coordinate of the region end (inclusive), it will be overwritten with the rotated
+ *                value
+ * @param y_end   Pointer of the Y coordinate of the region end (inclusive), it will be overwritten with the rotated
+ *                value
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_rotate_area(uint16_t w, uint16_t h, uint16_t rotate, uint16_t *x_start, uint16_t *y_start,
+                                 uint16_t *x_end, uint16_t *y_end);
+
+#ifdef __cplusplus
+}
+#endif
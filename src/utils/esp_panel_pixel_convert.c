@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include "esp_panel_pixel_convert.h"
+
+/**
+ * For 90/270 degree, a source line becomes an output column. The output is written in tiles of several lines, so every
+ * source cache line which is loaded is used by all the lines of the tile instead of only one.
+ *
+ */
+#define CONVERT_TILE_LINES  (8)
+
+typedef void (*convert_kernel_t)(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end, int y_end,
+                                 int w);
+
+__attribute__((always_inline))
+static inline uint16_t load_rgb565(const uint8_t *from, int format)
+{
+    /* Byte access, since the LVGL's area buffer is not guaranteed to be aligned */
+    uint16_t value = from[0] | (from[1] << 8);
+
+    return (format == ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP) ? ((value >> 8) | (value << 8)) : value;
+}
+
+__attribute__((always_inline))
+static inline void store_pixel(uint8_t *to, uint16_t value, int format)
+{
+    uint8_t r = value >> 11;
+    uint8_t g = (value >> 5) & 0x3F;
+    uint8_t b = value & 0x1F;
+
+    switch (format) {
+    case ESP_PANEL_PIXEL_FORMAT_RGB565:
+        to[0] = value;
+        to[1] = value >> 8;
+        break;
+    case ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP:
+        to[0] = value >> 8;
+        to[1] = value;
+        break;
+    case ESP_PANEL_PIXEL_FORMAT_RGB666:
+        /* Expand the 5-bit components to 6-bit by replicating the MSB, then left-align them */
+        to[0] = ((r << 1) | (r >> 4)) << 2;
+        to[1] = g << 2;
+        to[2] = ((b << 1) | (b >> 4)) << 2;
+        break;
+    default:
+        /* Expand the components to 8-bit by replicating the MSBs */
+        to[0] = (r << 3) | (r >> 2);
+        to[1] = (g << 2) | (g >> 4);
+        to[2] = (b << 3) | (b >> 2);
+        break;
+    }
+}
+
+/**
+ * The output pixel `(x, y)` comes from the source pointer `origin + x * step_x + y * step_y`:
+ *      - 0:   origin is (x_start, y_start), step_x is +1 pixel, step_y is +1 line
+ *      - 90:  origin is (x_end, y_start),   step_x is +1 line,  step_y is -1 pixel
+ *      - 180: origin is (x_end, y_end),     step_x is -1 pixel, step_y is -1 line
+ *      - 270: origin is (x_start, y_end),   step_x is -1 line,  step_y is +1 pixel
+ *
+ * This function is always inlined with constant `rotate` and formats, so every kernel only keeps its own path.
+ *
+ */
+__attribute__((always_inline))
+static inline void convert_copy_generic(const uint8_t *from, uint8_t *to, int x_start, int y_start, int x_end,
+                                        int y_end, int w, int rotate, int from_format, int to_format)
+{
+    const int from_line_bytes = w * 2;
+    const int to_bpp = ((to_format == ESP_PANEL_PIXEL_FORMAT_RGB565) ||
+                        (to_format == ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP)) ? 2 : 3;
+    const uint8_t *origin = NULL;
+    int step_x = 0;
+    int step_y = 0;
+    int to_w = 0;
+    int to_h = 0;
+
+    switch (rotate) {
+    case 90:
+        origin = from + y_start * from_line_bytes + x_end * 2;
+        step_x = from_line_bytes;
+        step_y = -2;
+        break;
+    case 180:
+        origin = from + y_end * from_line_bytes + x_end * 2;
+        step_x = -2;
+        step_y = -from_line_bytes;
+        break;
+    case 270:
+        origin = from + y_end * from_line_bytes + x_start * 2;
+        step_x = -from_line_bytes;
+        step_y = 2;
+        break;
+    default:
+        origin = from + y_start * from_line_bytes + x_start * 2;
+        step_x = 2;
+        step_y = from_line_bytes;
+        break;
+    }
+    if ((rotate == 90) || (rotate == 270)) {
+        to_w = y_end - y_start + 1;
+        to_h = x_end - x_start + 1;
+    } else {
+        to_w = x_end - x_start + 1;
+        to_h = y_end - y_start + 1;
+    }
+
+    if ((rotate == 0) || (rotate == 180)) {
+        for (int y = 0; y < to_h; y++) {
+            const uint8_t *from_next = origin + y * step_y;
+            for (int x = 0; x < to_w; x++) {
+                store_pixel(to, load_rgb565(from_next, from_format), to_format);
+                from_next += step_x;
+                to += to_bpp;
+            }
+        }
+        return;
+    }
+
+    const int to_line_bytes = to_w * to_bpp;
+    for (int y = 0; y < to_h; y += CONVERT_TILE_LINES) {
+        int lines = (to_h - y < CONVERT_TILE_LINES) ? (to_h - y) : CONVERT_TILE_LINES;
+        for (int x = 0; x < to_w; x++) {
+            const uint8_t *from_next = origin + x * step_x + y * step_y;
+            uint8_t *to_next = to + y * to_line_bytes + x * to_bpp;
+            for (int i = 0; i < lines; i++) {
+                store_pixel(to_next, load_rgb565(from_next, from_format), to_format);
+                from_next += step_y;
+                to_next += to_line_bytes;
+            }
+        }
+    }
+}
+
+/* Instantiate a kernel for every combination of the rotation (0/90/180/270), the source and the output formats */
+#define CONVERT_KERNEL_NAME(rotate, from_format, to_format) convert_copy_##rotate##_##from_format##_##to_format
+#define CONVERT_KERNEL_DEFINE(rotate, from_format, to_format)                                                       \
+    static void CONVERT_KERNEL_NAME(rotate, from_format, to_format)(const uint8_t *from, uint8_t *to, int x_start,  \
+            int y_start, int x_end, int y_end, int w)                                                                \
+    {                                                                                                                \
+        convert_copy_generic(from, to, x_start, y_start, x_end, y_end, w, rotate, from_format, to_format);           \
+    }
+#define CONVERT_KERNEL_DEFINE_TO(rotate, from_format) \
+    CONVERT_KERNEL_DEFINE(rotate, from_format, 0)     \
+    CONVERT_KERNEL_DEFINE(rotate, from_format, 1)     \
+    CONVERT_KERNEL_DEFINE(rotate, from_format, 2)     \
+    CONVERT_KERNEL_DEFINE(rotate, from_format, 3)
+#define CONVERT_KERNEL_DEFINE_FROM(rotate) \
+    CONVERT_KERNEL_DEFINE_TO(rotate, 0)    \
+    CONVERT_KERNEL_DEFINE_TO(rotate, 1)
+
+CONVERT_KERNEL_DEFINE_FROM(0)
+CONVERT_KERNEL_DEFINE_FROM(90)
+CONVERT_KERNEL_DEFINE_FROM(180)
+CONVERT_KERNEL_DEFINE_FROM(270)
+
+#define CONVERT_KERNEL_TABLE_TO(rotate, from_format)          \
+    {                                                         \
+        CONVERT_KERNEL_NAME(rotate, from_format, 0),          \
+        CONVERT_KERNEL_NAME(rotate, from_format, 1),          \
+        CONVERT_KERNEL_NAME(rotate, from_format, 2),          \
+        CONVERT_KERNEL_NAME(rotate, from_format, 3),          \
+    }
+#define CONVERT_KERNEL_TABLE_FROM(rotate)                     \
+    {                                                         \
+        CONVERT_KERNEL_TABLE_TO(rotate, 0),                   \
+        CONVERT_KERNEL_TABLE_TO(rotate, 1),                   \
+    }
+
+_Static_assert((ESP_PANEL_PIXEL_FORMAT_RGB565 == 0) && (ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP == 1) &&
+               (ESP_PANEL_PIXEL_FORMAT_RGB666 == 2) && (ESP_PANEL_PIXEL_FORMAT_RGB888 == 3),
+               "The kernel table depends on the format values");
+
+/* Indexed by [rotate / 90][from_format][to_format] */
+static const convert_kernel_t convert_kernels[4][2][ESP_PANEL_PIXEL_FORMAT_MAX] = {
+    CONVERT_KERNEL_TABLE_FROM(0),
+    CONVERT_KERNEL_TABLE_FROM(90),
+    CONVERT_KERNEL_TABLE_FROM(180),
+    CONVERT_KERNEL_TABLE_FROM(270),
+};
+
+uint8_t esp_panel_pixel_format_get_bytes(esp_panel_pixel_format_t format)
+{
+    switch (format) {
+    case ESP_PANEL_PIXEL_FORMAT_RGB565:
+    case ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP:
+        return 2;
+    case ESP_PANEL_PIXEL_FORMAT_RGB666:
+    case ESP_PANEL_PIXEL_FORMAT_RGB888:
+        return 3;
+    default:
+        return 0;
+    }
+}
+
+bool esp_panel_pixel_convert_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                  uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                  esp_panel_pixel_format_t from_format, esp_panel_pixel_format_t to_format)
+{
+    if ((from == NULL) || (to == NULL)) {
+        return false;
+    }
+    if ((x_start > x_end) || (y_start > y_end) || (x_end >= w) || (y_end >= h)) {
+        return false;
+    }
+    if (((rotate != 0) && (rotate != 90) && (rotate != 180) && (rotate != 270)) ||
+            ((from_format != ESP_PANEL_PIXEL_FORMAT_RGB565) && (from_format != ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP)) ||
+            ((unsigned)to_format >= ESP_PANEL_PIXEL_FORMAT_MAX)) {
+        return false;
+    }
+
+    convert_kernels[rotate / 90][from_format][to_format](from, to, x_start, y_start, x_end, y_end, w);
+
+    return true;
+}
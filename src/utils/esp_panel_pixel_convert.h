@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Pixel formats supported by the conversion kernels
+ *
+ */
+typedef enum {
+    ESP_PANEL_PIXEL_FORMAT_RGB565 = 0,      /*!< 2 bytes per pixel, little-endian (native `uint16_t`), used by LVGL when
+                                                 `LV_COLOR_16_SWAP` is disabled */
+    ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP,     /*!< 2 bytes per pixel, big-endian, which is the wire format of SPI/QSPI
+                                                 panels (same as `SPI_SWAP_DATA_TX()`) */
+    ESP_PANEL_PIXEL_FORMAT_RGB666,          /*!< 3 bytes per pixel in R/G/B order, each component is left-aligned in
+                                                 its byte (bits [7:2]), used by the 18-bit panels */
+    ESP_PANEL_PIXEL_FORMAT_RGB888,          /*!< 3 bytes per pixel in R/G/B order */
+    ESP_PANEL_PIXEL_FORMAT_MAX,
+} esp_panel_pixel_format_t;
+
+/**
+ * @brief Get the bytes of a single pixel of the format
+ *
+ * @param format Pixel format
+ *
+ * @return
+ *      - 0:      if the format is invalid
+ *      - others: the bytes of a single pixel
+ */
+uint8_t esp_panel_pixel_format_get_bytes(esp_panel_pixel_format_t format);
+
+/**
+ * @brief Rotate a region of the source frame and convert it into the output format in a single pass
+ *
+ * @note  Every source pixel is read once and every output pixel is written once, so the rotation, the byte swap and
+ *        the format expansion don't need extra passes over the data. The kernels are specialized at compile time for
+ *        each combination of rotation and formats
+ * @note  Unlike `esp_panel_pixel_rotate_copy()`, the output only contains the rotated region. Its lines are packed
+ *        without padding, so it can be passed to `esp_lcd_panel_draw_bitmap()` directly. The output is
+ *        `(y_end - y_start + 1) x (x_end - x_start + 1)` pixels for 90/270 degree and
+ *        `(x_end - x_start + 1) x (y_end - y_start + 1)` pixels for 0/180 degree
+ * @note  The position of the output region in the rotated frame can be got by `esp_panel_pixel_rotate_area()`
+ *
+ * @param from        Pointer of the source frame
+ * @param to          Pointer of the output buffer, its size should be at least the pixels of the region multiplied by
+ *                    the bytes of `to_format`
+ * @param x_start     X coordinate of the region start (in source frame), the range is [0, w - 1]
+ * @param y_start     Y coordinate of the region start (in source frame), the range is [0, h - 1]
+ * @param x_end       X coordinate of the region end (inclusive), the range is [x_start, w - 1]
+ * @param y_end       Y coordinate of the region end (inclusive), the range is [y_start, h - 1]
+ * @param w           Width of the source frame
+ * @param h           Height of the source frame
+ * @param rotate      Rotation degree, should be one of 0/90/180/270 (clockwise)
+ * @param from_format Format of the source frame, should be `ESP_PANEL_PIXEL_FORMAT_RGB565` or
+ *                    `ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP`
+ * @param to_format   Format of the output buffer
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_convert_copy(const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start,
+                                  uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                  esp_panel_pixel_format_t from_format, esp_panel_pixel_format_t to_format);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,323 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_panel_pixel_diff.h"
+
+#define TILE_SIZE_MIN       (4)
+#define TILE_SIZE_MAX       (128)
+#define HASH_SEED           (0x811C9DC5)
+
+/* The part of a tile which is covered by the last sent bitmap, the coordinates are relative to the tile */
+typedef struct {
+    uint32_t hash;
+    uint8_t x1;
+    uint8_t y1;
+    uint8_t x2;
+    uint8_t y2;
+} tile_t;
+
+/* A run of the changed tiles in a tile row, which may be extended by the same runs of the next tile rows */
+typedef struct {
+    uint16_t col_start;
+    uint16_t col_end;
+    uint16_t y1;
+} run_t;
+
+struct esp_panel_pixel_diff_t {
+    esp_panel_pixel_diff_config_t config;
+    uint16_t cols;
+    uint16_t rows;
+    tile_t *tiles;
+    uint32_t *hashes;               // Hashes of the tiles in the current tile row
+    run_t *runs[2];                 // Runs of the previous and the current tile rows
+    esp_panel_pixel_rect_t pending; // The rectangle is sent one step behind, so the last one can be marked
+    bool has_pending;
+    esp_panel_pixel_diff_stats_t stats;
+};
+
+static inline uint32_t hash_block(uint32_t hash, uint32_t value)
+{
+    value *= 0xCC9E2D51;
+    value = (value << 15) | (value >> 17);
+    value *= 0x1B873593;
+    hash ^= value;
+    hash = (hash << 13) | (hash >> 19);
+
+    return hash * 5 + 0xE6546B64;
+}
+
+static inline uint32_t hash_bytes(uint32_t hash, const uint8_t *data, size_t len)
+{
+    uint32_t value;
+
+    while (len >= 4) {
+        memcpy(&value, data, 4);
+        hash = hash_block(hash, value);
+        data += 4;
+        len -= 4;
+    }
+    if (len > 0) {
+        value = 0;
+        memcpy(&value, data, len);
+        hash = hash_block(hash, value);
+    }
+
+    return hash;
+}
+
+static inline uint32_t hash_final(uint32_t hash)
+{
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/* The first and the last columns of the bitmap which are covered by the tile column */
+static inline int seg_x1(int tile_col, int tile_size, int x_start)
+{
+    int x = tile_col * tile_size;
+    return (x > x_start) ? x : x_start;
+}
+
+static inline int seg_x2(int tile_col, int tile_size, int x_end)
+{
+    int x = (tile_col + 1) * tile_size - 1;
+    return (x < x_end) ? x : x_end;
+}
+
+static inline void tile_invalidate(tile_t *tile)
+{
+    /* An empty part never matches */
+    tile->x1 = 1;
+    tile->x2 = 0;
+}
+
+static bool emit_rect(esp_panel_pixel_diff_handle_t diff, const esp_panel_pixel_rect_t *rect,
+                      esp_panel_pixel_diff_draw_cb_t draw_cb, void *user_ctx)
+{
+    bool ret = true;
+
+    if (diff->has_pending) {
+        ret = draw_cb(user_ctx, &diff->pending, false);
+    }
+    diff->pending = *rect;
+    diff->has_pending = true;
+
+    return ret;
+}
+
+esp_panel_pixel_diff_handle_t esp_panel_pixel_diff_new(const esp_panel_pixel_diff_config_t *config)
+{
+    if ((config == NULL) || (config->width == 0) || (config->height == 0) || (config->bytes_per_pixel == 0) ||
+            (config->tile_size < TILE_SIZE_MIN) || (config->tile_size > TILE_SIZE_MAX)) {
+        return NULL;
+    }
+
+    esp_panel_pixel_diff_handle_t diff = (esp_panel_pixel_diff_handle_t)calloc(1, sizeof(struct esp_panel_pixel_diff_t));
+    if (diff == NULL) {
+        return NULL;
+    }
+    diff->config = *config;
+    diff->cols = (config->width + config->tile_size - 1) / config->tile_size;
+    diff->rows = (config->height + config->tile_size - 1) / config->tile_size;
+    diff->tiles = (tile_t *)malloc(sizeof(tile_t) * diff->cols * diff->rows);
+    diff->hashes = (uint32_t *)malloc(sizeof(uint32_t) * diff->cols);
+    diff->runs[0] = (run_t *)malloc(sizeof(run_t) * diff->cols);
+    diff->runs[1] = (run_t *)malloc(sizeof(run_t) * diff->cols);
+    if ((diff->tiles == NULL) || (diff->hashes == NULL) || (diff->runs[0] == NULL) || (diff->runs[1] == NULL)) {
+        esp_panel_pixel_diff_del(diff);
+        return NULL;
+    }
+    esp_panel_pixel_diff_invalidate(diff, 0, 0, 0, 0);
+
+    return diff;
+}
+
+void esp_panel_pixel_diff_del(esp_panel_pixel_diff_handle_t diff)
+{
+    if (diff == NULL) {
+        return;
+    }
+
+    free(diff->tiles);
+    free(diff->hashes);
+    free(diff->runs[0]);
+    free(diff->runs[1]);
+    free(diff);
+}
+
+bool esp_panel_pixel_diff_invalidate(esp_panel_pixel_diff_handle_t diff, uint16_t x_start, uint16_t y_start,
+                                     uint16_t width, uint16_t height)
+{
+    if (diff == NULL) {
+        return false;
+    }
+    if ((width == 0) || (height == 0)) {
+        x_start = 0;
+        y_start = 0;
+        width = diff->config.width;
+        height = diff->config.height;
+    }
+    if ((x_start >= diff->config.width) || (y_start >= diff->config.height)) {
+        return false;
+    }
+
+    uint16_t tile_size = diff->config.tile_size;
+    int x_end = ((x_start + width) < diff->config.width) ? (x_start + width - 1) : (diff->config.width - 1);
+    int y_end = ((y_start + height) < diff->config.height) ? (y_start + height - 1) : (diff->config.height - 1);
+    for (int row = y_start / tile_size; row <= y_end / tile_size; row++) {
+        for (int col = x_start / tile_size; col <= x_end / tile_size; col++) {
+            tile_invalidate(&diff->tiles[row * diff->cols + col]);
+        }
+    }
+
+    return true;
+}
+
+bool esp_panel_pixel_diff_draw(esp_panel_pixel_diff_handle_t diff, uint16_t x_start, uint16_t y_start, uint16_t width,
+                               uint16_t height, const void *bitmap, esp_panel_pixel_diff_draw_cb_t draw_cb,
+                               void *user_ctx)
+{
+    if ((diff == NULL) || (bitmap == NULL) || (draw_cb == NULL) || (width == 0) || (height == 0) ||
+            (x_start + width > diff->config.width) || (y_start + height > diff->config.height)) {
+        return false;
+    }
+
+    const uint16_t tile_size = diff->config.tile_size;
+    const uint8_t bytes_per_pixel = diff->config.bytes_per_pixel;
+    const int x_end = x_start + width - 1;
+    const int y_end = y_start + height - 1;
+    const int col_start = x_start / tile_size;
+    const int col_num = x_end / tile_size - col_start + 1;
+
+    run_t *prev_runs = diff->runs[0];
+    run_t *cur_runs = diff->runs[1];
+    int prev_num = 0;
+    diff->has_pending = false;
+
+    for (int row = y_start / tile_size; row <= y_end / tile_size; row++) {
+        int band_y1 = (row * tile_size > y_start) ? (row * tile_size) : y_start;
+        int band_y2 = ((row + 1) * tile_size - 1 < y_end) ? ((row + 1) * tile_size - 1) : y_end;
+
+        /* Hash the parts of the tiles row by row, so the bitmap is read sequentially */
+        for (int col = 0; col < col_num; col++) {
+            diff->hashes[col] = HASH_SEED;
+        }
+        for (int y = band_y1; y <= band_y2; y++) {
+            const uint8_t *data = (const uint8_t *)bitmap + (size_t)(y - y_start) * width * bytes_per_pixel;
+            for (int col = 0; col < col_num; col++) {
+                int tile_col = col_start + col;
+                size_t len = (seg_x2(tile_col, tile_size, x_end) - seg_x1(tile_col, tile_size, x_start) + 1) *
+                             bytes_per_pixel;
+                diff->hashes[col] = hash_bytes(diff->hashes[col], data, len);
+                data += len;
+            }
+        }
+
+        /* Compare with the last sent parts, and collect the runs of the changed tiles */
+        int cur_num = 0;
+        for (int col = 0; col < col_num; col++) {
+            int tile_col = col_start + col;
+            tile_t *tile = &diff->tiles[row * diff->cols + tile_col];
+            int tile_x = tile_col * tile_size;
+            int tile_y = row * tile_size;
+            tile_t part = {
+                .hash = hash_final(diff->hashes[col]),
+                .x1 = (uint8_t)(seg_x1(tile_col, tile_size, x_start) - tile_x),
+                .y1 = (uint8_t)(band_y1 - tile_y),
+                .x2 = (uint8_t)(seg_x2(tile_col, tile_size, x_end) - tile_x),
+                .y2 = (uint8_t)(band_y2 - tile_y),
+            };
+            uint32_t bytes = (part.x2 - part.x1 + 1) * (part.y2 - part.y1 + 1) * bytes_per_pixel;
+            if ((tile->hash == part.hash) && (tile->x1 == part.x1) && (tile->y1 == part.y1) && (tile->x2 == part.x2) &&
+                    (tile->y2 == part.y2)) {
+                diff->stats.hits++;
+                diff->stats.bytes_skipped += bytes;
+                continue;
+            }
+            diff->stats.misses++;
+            diff->stats.bytes_sent += bytes;
+            *tile = part;
+
+            if ((cur_num > 0) && (cur_runs[cur_num - 1].col_end == col - 1)) {
+                cur_runs[cur_num - 1].col_end = col;
+            } else {
+                cur_runs[cur_num++] = (run_t) {
+                    .col_start = (uint16_t)col,
+                    .col_end = (uint16_t)col,
+                    .y1 = (uint16_t)band_y1,
+                };
+            }
+        }
+
+        /* Extend the same runs of the previous tile row, and send the others. Both are sorted by the columns */
+        int cur = 0;
+        for (int prev = 0; prev < prev_num; prev++) {
+            while ((cur < cur_num) && (cur_runs[cur].col_start < prev_runs[prev].col_start)) {
+                cur++;
+            }
+            if ((cur < cur_num) && (cur_runs[cur].col_start == prev_runs[prev].col_start) &&
+                    (cur_runs[cur].col_end == prev_runs[prev].col_end)) {
+                cur_runs[cur].y1 = prev_runs[prev].y1;
+                continue;
+            }
+            esp_panel_pixel_rect_t rect = {
+                .x1 = (uint16_t)seg_x1(col_start + prev_runs[prev].col_start, tile_size, x_start),
+                .y1 = prev_runs[prev].y1,
+                .x2 = (uint16_t)seg_x2(col_start + prev_runs[prev].col_end, tile_size, x_end),
+                .y2 = (uint16_t)(band_y1 - 1),
+            };
+            if (!emit_rect(diff, &rect, draw_cb, user_ctx)) {
+                return false;
+            }
+        }
+
+        run_t *runs = prev_runs;
+        prev_runs = cur_runs;
+        cur_runs = runs;
+        prev_num = cur_num;
+    }
+
+    for (int prev = 0; prev < prev_num; prev++) {
+        esp_panel_pixel_rect_t rect = {
+            .x1 = (uint16_t)seg_x1(col_start + prev_runs[prev].col_start, tile_size, x_start),
+            .y1 = prev_runs[prev].y1,
+            .x2 = (uint16_t)seg_x2(col_start + prev_runs[prev].col_end, tile_size, x_end),
+            .y2 = (uint16_t)y_end,
+        };
+        if (!emit_rect(diff, &rect, draw_cb, user_ctx)) {
+            return false;
+        }
+    }
+
+    if (diff->has_pending) {
+        diff->has_pending = false;
+        return draw_cb(user_ctx, &diff->pending, true);
+    }
+
+    return true;
+}
+
+bool esp_panel_pixel_diff_get_stats(esp_panel_pixel_diff_handle_t diff, esp_panel_pixel_diff_stats_t *stats,
+                                    bool clear)
+{
+    if ((diff == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = diff->stats;
+    if (clear) {
+        memset(&diff->stats, 0, sizeof(diff->stats));
+    }
+
+    return true;
+}
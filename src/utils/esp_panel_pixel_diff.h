@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_panel_pixel_region.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the tile diff
+ *
+ */
+typedef struct {
+    uint16_t width;             /*!< Width of the frame */
+    uint16_t height;            /*!< Height of the frame */
+    uint8_t tile_size;          /*!< Width and height of a tile, the range is [4, 128]. The tiles are aligned to the
+                                     frame origin, so the same area always maps to the same tiles */
+    uint8_t bytes_per_pixel;    /*!< Bytes of a single pixel */
+} esp_panel_pixel_diff_config_t;
+
+/**
+ * @brief Default tile size, which balances the number of commands and the unchanged pixels resent
+ *
+ */
+#define ESP_PANEL_PIXEL_DIFF_TILE_SIZE_DEFAULT  (16)
+
+/**
+ * @brief Hit/miss counters of the tile diff. A tile is counted once for every bitmap which covers it
+ *
+ */
+typedef struct {
+    uint32_t hits;              /*!< Number of the unchanged tiles, which are skipped */
+    uint32_t misses;            /*!< Number of the changed tiles, which are sent */
+    uint32_t bytes_skipped;     /*!< Bytes of the skipped pixels */
+    uint32_t bytes_sent;        /*!< Bytes of the sent pixels */
+} esp_panel_pixel_diff_stats_t;
+
+typedef struct esp_panel_pixel_diff_t *esp_panel_pixel_diff_handle_t;
+
+/**
+ * @brief Callback to send a changed rectangle of the bitmap
+ *
+ * @param user_ctx User context
+ * @param rect     Changed rectangle in the frame coordinates (inclusive), it is always inside the bitmap
+ * @param is_last  Whether it is the last rectangle of the bitmap
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_pixel_diff_draw_cb_t)(void *user_ctx, const esp_panel_pixel_rect_t *rect, bool is_last);
+
+/**
+ * @brief Create a tile diff, all the tiles are unknown (always changed) at first
+ *
+ * @param config Pointer of the configuration
+ *
+ * @return
+ *      - NULL:   if fail
+ *      - others: the handle of the tile diff
+ */
+esp_panel_pixel_diff_handle_t esp_panel_pixel_diff_new(const esp_panel_pixel_diff_config_t *config);
+
+/**
+ * @brief Delete the tile diff
+ *
+ * @param diff Handle of the tile diff
+ */
+void esp_panel_pixel_diff_del(esp_panel_pixel_diff_handle_t diff);
+
+/**
+ * @brief Forget the tiles in the area, they will be sent next time. Call it when the area is drawn without the diff
+ *
+ * @param diff    Handle of the tile diff
+ * @param x_start Start X coordinate of the area
+ * @param y_start Start Y coordinate of the area
+ * @param width   Width of the area, `0` means the whole frame
+ * @param height  Height of the area, `0` means the whole frame
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_diff_invalidate(esp_panel_pixel_diff_handle_t diff, uint16_t x_start, uint16_t y_start,
+                                     uint16_t width, uint16_t height);
+
+/**
+ * @brief Compare the bitmap with the last sent pixels tile by tile, and only send the changed tiles
+ *
+ * @note  Every tile keeps the hash of the last sent part of it, and the part is skipped only if it is the same part
+ *        with the same hash. So a bitmap which doesn't cover the whole tile (like the edges of a label) is still
+ *        skipped when the same area is redrawn with the same pixels
+ * @note  The adjacent changed tiles in a tile row are merged, and the same runs in the adjacent tile rows are merged
+ *        too, so a changed area is sent with as few commands as possible
+ * @note  The hashes are updated before sending, call `esp_panel_pixel_diff_invalidate()` if sending fails
+ *
+ * @param diff     Handle of the tile diff
+ * @param x_start  Start X coordinate of the bitmap
+ * @param y_start  Start Y coordinate of the bitmap
+ * @param width    Width of the bitmap
+ * @param height   Height of the bitmap
+ * @param bitmap   Pointer of the bitmap
+ * @param draw_cb  Callback to send a changed rectangle
+ * @param user_ctx User context passed to the callback
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_diff_draw(esp_panel_pixel_diff_handle_t diff, uint16_t x_start, uint16_t y_start, uint16_t width,
+                               uint16_t height, const void *bitmap, esp_panel_pixel_diff_draw_cb_t draw_cb,
+                               void *user_ctx);
+
+/**
+ * @brief Get the hit/miss counters
+ *
+ * @param diff  Handle of the tile diff
+ * @param stats Pointer of the counters
+ * @param clear Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_diff_get_stats(esp_panel_pixel_diff_handle_t diff, esp_panel_pixel_diff_stats_t *stats,
+                                    bool clear);
+
+#ifdef __cplusplus
+}
+#endif
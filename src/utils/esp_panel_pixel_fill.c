@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_panel_pixel_fill.h"
+
+size_t esp_panel_pixel_fill_buffer(uint8_t *buf, size_t buf_size, const uint8_t *pixel, uint8_t bytes_per_pixel)
+{
+    if ((buf == NULL) || (pixel == NULL) || (bytes_per_pixel == 0) || (bytes_per_pixel > 4) ||
+            (buf_size < bytes_per_pixel)) {
+        return 0;
+    }
+
+    /* Write the first pixel, then keep doubling the filled part */
+    size_t filled = bytes_per_pixel;
+    size_t total = (buf_size / bytes_per_pixel) * bytes_per_pixel;
+    memcpy(buf, pixel, bytes_per_pixel);
+    while (filled < total) {
+        size_t copy_size = (filled < total - filled) ? filled : (total - filled);
+        memcpy(buf + filled, buf, copy_size);
+        filled += copy_size;
+    }
+
+    return total / bytes_per_pixel;
+}
+
+bool esp_panel_pixel_fill_rect(const uint8_t *buf, size_t buf_size, uint16_t x_start, uint16_t y_start,
+                               uint16_t width, uint16_t height, uint8_t bytes_per_pixel, uint8_t y_align,
+                               esp_panel_pixel_fill_draw_cb_t draw_cb, void *user_ctx)
+{
+    if ((buf == NULL) || (draw_cb == NULL) || (width == 0) || (height == 0) || (bytes_per_pixel == 0)) {
+        return false;
+    }
+
+    size_t line_size = (size_t)width * bytes_per_pixel;
+    int band_lines = buf_size / line_size;
+    y_align = (y_align == 0) ? 1 : y_align;
+    band_lines -= band_lines % y_align;
+    if (band_lines == 0) {
+        return false;
+    }
+
+    int y_end = y_start + height;
+    for (int y = y_start; y < y_end; y += band_lines) {
+        int lines = (y_end - y < band_lines) ? (y_end - y) : band_lines;
+        if (!draw_cb(user_ctx, x_start, y, x_start + width, y + lines, buf)) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Callback to draw a band of the filled rectangle, which has the same parameters as
+ *        `esp_lcd_panel_draw_bitmap()`
+ *
+ * @param user_ctx User context
+ * @param x_start  Start X coordinate (inclusive)
+ * @param y_start  Start Y coordinate (inclusive)
+ * @param x_end    End X coordinate (exclusive)
+ * @param y_end    End Y coordinate (exclusive)
+ * @param data     Pointer of the color data, it is always the line buffer
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_pixel_fill_draw_cb_t)(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                                               uint16_t y_end, const void *data);
+
+/**
+ * @brief Fill the buffer with the repeated pixel
+ *
+ * @param buf             Pointer of the buffer
+ * @param buf_size        Size of the buffer in bytes
+ * @param pixel           Pointer of the pixel data
+ * @param bytes_per_pixel Bytes of a single pixel, the range is [1, 4]
+ *
+ * @return The number of the pixels filled
+ */
+size_t esp_panel_pixel_fill_buffer(uint8_t *buf, size_t buf_size, const uint8_t *pixel, uint8_t bytes_per_pixel);
+
+/**
+ * @brief Fill a rectangle with a solid color by drawing the same line buffer band by band
+ *
+ * @note  The line buffer should be filled by `esp_panel_pixel_fill_buffer()` before. Since every band sends the same
+ *        data, the bands can be queued without waiting for each other
+ * @note  Every band contains as many lines as the buffer can hold, and the number of lines is a multiple of `y_align`
+ *        except for the last band
+ *
+ * @param buf             Pointer of the line buffer
+ * @param buf_size        Size of the line buffer in bytes, it should be able to hold at least `y_align` lines of the
+ *                        rectangle
+ * @param x_start         Start X coordinate of the rectangle
+ * @param y_start         Start Y coordinate of the rectangle
+ * @param width           Width of the rectangle
+ * @param height          Height of the rectangle
+ * @param bytes_per_pixel Bytes of a single pixel
+ * @param y_align         Alignment of the band height in lines, `0` is treated as `1`
+ * @param draw_cb         Callback to draw a band
+ * @param user_ctx        User context passed to the callback
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_fill_rect(const uint8_t *buf, size_t buf_size, uint16_t x_start, uint16_t y_start,
+                               uint16_t width, uint16_t height, uint8_t bytes_per_pixel, uint8_t y_align,
+                               esp_panel_pixel_fill_draw_cb_t draw_cb, void *user_ctx);
+
+#ifdef __cplusplus
+}
+#endif
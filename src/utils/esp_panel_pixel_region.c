@@ -0,0 +1,238 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_pixel_region.h"
+
+#define RECT_PIECE_NUM_MAX  (4)
+
+static inline uint16_t min_u16(uint16_t a, uint16_t b)
+{
+    return (a < b) ? a : b;
+}
+
+static inline uint16_t max_u16(uint16_t a, uint16_t b)
+{
+    return (a > b) ? a : b;
+}
+
+static inline bool rect_contains(const esp_panel_pixel_rect_t *a, const esp_panel_pixel_rect_t *b)
+{
+    return (a->x1 <= b->x1) && (a->y1 <= b->y1) && (a->x2 >= b->x2) && (a->y2 >= b->y2);
+}
+
+static inline bool rect_intersects(const esp_panel_pixel_rect_t *a, const esp_panel_pixel_rect_t *b)
+{
+    return (a->x1 <= b->x2) && (b->x1 <= a->x2) && (a->y1 <= b->y2) && (b->y1 <= a->y2);
+}
+
+static inline esp_panel_pixel_rect_t rect_bbox(const esp_panel_pixel_rect_t *a, const esp_panel_pixel_rect_t *b)
+{
+    esp_panel_pixel_rect_t bbox = {
+        .x1 = min_u16(a->x1, b->x1),
+        .y1 = min_u16(a->y1, b->y1),
+        .x2 = max_u16(a->x2, b->x2),
+        .y2 = max_u16(a->y2, b->y2),
+    };
+
+    return bbox;
+}
+
+static uint32_t rect_cost(const esp_panel_pixel_region_cost_t *cost, const esp_panel_pixel_rect_t *rect)
+{
+    uint32_t burst_size = (cost->burst_size == 0) ? 1 : cost->burst_size;
+    uint32_t first_burst = rect->x1 * cost->bytes_per_pixel / burst_size;
+    uint32_t last_burst = ((rect->x2 + 1) * cost->bytes_per_pixel - 1) / burst_size;
+    uint32_t row_bytes = (last_burst - first_burst + 1) * burst_size;
+
+    return cost->copy_overhead + (rect->y2 - rect->y1 + 1) * (cost->row_overhead + row_bytes);
+}
+
+/* Remove the rectangle at `index` by moving the last one to its place */
+static inline void rect_remove(esp_panel_pixel_rect_t *rects, uint32_t *costs, size_t *num, size_t index)
+{
+    (*num)--;
+    rects[index] = rects[*num];
+    costs[index] = costs[*num];
+}
+
+/* Split `a` into the parts which are not covered by `b`: the top and bottom bands, then the left and right parts */
+static int rect_subtract(const esp_panel_pixel_rect_t *a, const esp_panel_pixel_rect_t *b,
+                         esp_panel_pixel_rect_t pieces[RECT_PIECE_NUM_MAX])
+{
+    int num = 0;
+    uint16_t y1 = a->y1;
+    uint16_t y2 = a->y2;
+
+    if (b->y1 > a->y1) {
+        pieces[num++] = (esp_panel_pixel_rect_t) {
+            a->x1, a->y1, a->x2, (uint16_t)(b->y1 - 1)
+        };
+        y1 = b->y1;
+    }
+    if (b->y2 < a->y2) {
+        pieces[num++] = (esp_panel_pixel_rect_t) {
+            a->x1, (uint16_t)(b->y2 + 1), a->x2, a->y2
+        };
+        y2 = b->y2;
+    }
+    if (b->x1 > a->x1) {
+        pieces[num++] = (esp_panel_pixel_rect_t) {
+            a->x1, y1, (uint16_t)(b->x1 - 1), y2
+        };
+    }
+    if (b->x2 < a->x2) {
+        pieces[num++] = (esp_panel_pixel_rect_t) {
+            (uint16_t)(b->x2 + 1), y1, a->x2, y2
+        };
+    }
+
+    return num;
+}
+
+uint32_t esp_panel_pixel_region_get_cost(const esp_panel_pixel_region_cost_t *cost, const esp_panel_pixel_rect_t *rects,
+                                         size_t num)
+{
+    if ((cost == NULL) || (rects == NULL)) {
+        return 0;
+    }
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < num; i++) {
+        total += rect_cost(cost, &rects[i]);
+    }
+
+    return total;
+}
+
+size_t esp_panel_pixel_region_coalesce(const esp_panel_pixel_region_cost_t *cost, esp_panel_pixel_rect_t *rects,
+                                       size_t num, size_t max_num)
+{
+    max_num = (max_num > ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX) ? ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX : max_num;
+    if ((cost == NULL) || (rects == NULL) || (num == 0) || (num > max_num)) {
+        return 0;
+    }
+    for (size_t i = 0; i < num; i++) {
+        if ((rects[i].x1 > rects[i].x2) || (rects[i].y1 > rects[i].y2)) {
+            return 0;
+        }
+    }
+
+    /* Cache the cost of every rectangle */
+    uint32_t costs[ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX];
+    for (size_t i = 0; i < num; i++) {
+        costs[i] = rect_cost(cost, &rects[i]);
+    }
+
+    /* Step 1: drop the rectangles which are contained by others */
+    for (size_t i = 0; i < num; i++) {
+        for (size_t j = 0; j < num; j++) {
+            if ((i != j) && rect_contains(&rects[i], &rects[j])) {
+                rect_remove(rects, costs, &num, j);
+                /* Check the moved rectangle again, and keep `i` pointing to the same rectangle */
+                if (i == num) {
+                    i = j;
+                }
+                j = (size_t) -1;
+            }
+        }
+    }
+
+    /* Step 2: merge the pair which saves the most cost, until no pair saves anything */
+    while (num > 1) {
+        int64_t best_gain = -1;
+        size_t best_i = 0;
+        size_t best_j = 0;
+        esp_panel_pixel_rect_t best_bbox = {};
+        uint32_t best_cost = 0;
+        for (size_t i = 0; i < num; i++) {
+            for (size_t j = i + 1; j < num; j++) {
+                esp_panel_pixel_rect_t bbox = rect_bbox(&rects[i], &rects[j]);
+                uint32_t bbox_cost = rect_cost(cost, &bbox);
+                int64_t gain = (int64_t)costs[i] + costs[j] - bbox_cost;
+                if (gain > best_gain) {
+                    best_gain = gain;
+                    best_i = i;
+                    best_j = j;
+                    best_bbox = bbox;
+                    best_cost = bbox_cost;
+                }
+            }
+        }
+        if (best_gain < 0) {
+            break;
+        }
+
+        rects[best_i] = best_bbox;
+        costs[best_i] = best_cost;
+        rect_remove(rects, costs, &num, best_j);
+        if (best_i == num) {
+            best_i = best_j;
+        }
+        /* The bounding box may also contain some other rectangles */
+        for (size_t k = 0; k < num; k++) {
+            if ((k != best_i) && rect_contains(&rects[best_i], &rects[k])) {
+                rect_remove(rects, costs, &num, k);
+                if (best_i == num) {
+                    best_i = k;
+                }
+                k--;
+            }
+        }
+    }
+
+    /* Step 3: cut the overlapped part off a rectangle, if copying the rest parts is cheaper. Every cut reduces the
+     * total cost, so it always ends */
+    for (size_t i = 0; i < num; i++) {
+        for (size_t j = 0; j < num; j++) {
+            if ((i == j) || !rect_intersects(&rects[i], &rects[j])) {
+                continue;
+            }
+
+            esp_panel_pixel_rect_t pieces[RECT_PIECE_NUM_MAX];
+            int piece_num = rect_subtract(&rects[j], &rects[i], pieces);
+            if (piece_num == 0) {
+                /* A piece of the previous cuts may be contained by another rectangle */
+                rect_remove(rects, costs, &num, j);
+                if (i == num) {
+                    i = j;
+                }
+                j--;
+                continue;
+            }
+            if (num - 1 + piece_num > max_num) {
+                continue;
+            }
+            uint32_t pieces_cost = esp_panel_pixel_region_get_cost(cost, pieces, piece_num);
+            if (pieces_cost >= costs[j]) {
+                continue;
+            }
+
+            rects[j] = pieces[0];
+            costs[j] = rect_cost(cost, &pieces[0]);
+            for (int k = 1; k < piece_num; k++) {
+                rects[num] = pieces[k];
+                costs[num] = rect_cost(cost, &pieces[k]);
+                num++;
+            }
+        }
+    }
+
+    /* Step 4: copy the bounding box of the whole region instead, if it is cheaper (like the near-full updates) */
+    if (num > 1) {
+        esp_panel_pixel_rect_t bbox = rects[0];
+        uint32_t total = 0;
+        for (size_t i = 0; i < num; i++) {
+            bbox = rect_bbox(&bbox, &rects[i]);
+            total += costs[i];
+        }
+        if (rect_cost(cost, &bbox) <= total) {
+            rects[0] = bbox;
+            num = 1;
+        }
+    }
+
+    return num;
+}
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Rectangle of pixels, all the coordinates are inclusive (same as `lv_area_t`)
+ *
+ */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+} esp_panel_pixel_rect_t;
+
+/**
+ * @brief Cost model of copying rectangles between frame buffers, all the costs are in bytes
+ *
+ * @note  The cost of a rectangle is `copy_overhead + rows * (row_overhead + row_bytes)`, where `row_bytes` is the
+ *        bytes of the whole bursts touched by a row, so a narrow rectangle which crosses a burst boundary is charged
+ *        for two bursts per row
+ *
+ */
+typedef struct {
+    uint8_t bytes_per_pixel;    /*!< Bytes of a single pixel */
+    uint16_t burst_size;        /*!< Bytes of a memory burst, like the cache line of PSRAM. `0` is treated as `1` */
+    uint32_t row_overhead;      /*!< Fixed cost of copying a row */
+    uint32_t copy_overhead;     /*!< Fixed cost of copying a rectangle */
+} esp_panel_pixel_region_cost_t;
+
+/**
+ * @brief Default cost model, which is measured with the rotation kernels on the frame buffers in PSRAM
+ *
+ */
+#define ESP_PANEL_PIXEL_REGION_COST_DEFAULT(bpp) \
+    {                                            \
+        .bytes_per_pixel = bpp,                  \
+        .burst_size = 64,                        \
+        .row_overhead = 16,                      \
+        .copy_overhead = 512,                    \
+    }
+
+/**
+ * @brief Maximum number of the rectangles processed by `esp_panel_pixel_region_coalesce()`
+ *
+ */
+#define ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX     (64)
+
+/**
+ * @brief Get the cost of copying the rectangles one by one
+ *
+ * @param cost  Pointer of the cost model
+ * @param rects Array of the rectangles
+ * @param num   Number of the rectangles
+ *
+ * @return The cost in bytes, `0` if the arguments are invalid
+ */
+uint32_t esp_panel_pixel_region_get_cost(const esp_panel_pixel_region_cost_t *cost, const esp_panel_pixel_rect_t *rects,
+                                         size_t num);
+
+/**
+ * @brief Coalesce the rectangles in place to minimize the cost of copying them
+ *
+ * @note  The result always covers all the pixels of the input rectangles, and may cover some extra pixels when it is
+ *        cheaper to copy a larger rectangle. The steps are:
+ *          1. Drop the rectangles which are contained by others
+ *          2. Repeatedly merge the pair whose bounding box saves the most cost
+ *          3. Split the rectangles which still overlap others, if copying the non-overlapping parts is cheaper
+ *          4. Replace all with the bounding box of the whole region, if it is cheaper
+ * @note  The complexity is `O(num^3)` in the worst case, so keep `num` small (like `LV_INV_BUF_SIZE`)
+ *
+ * @param cost    Pointer of the cost model
+ * @param rects   Array of the rectangles, it is updated in place
+ * @param num     Number of the input rectangles
+ * @param max_num Capacity of the array, the splitting in step 3 stops when the array is full. Only the first
+ *                `ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX` elements are used
+ *
+ * @return The number of the output rectangles, which is never larger than `max_num`. `0` if the arguments are invalid
+ */
+size_t esp_panel_pixel_region_coalesce(const esp_panel_pixel_region_cost_t *cost, esp_panel_pixel_rect_t *rects,
+                                       size_t num, size_t max_num);
+
+#ifdef __cplusplus
+}
+#endif
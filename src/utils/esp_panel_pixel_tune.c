@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "esp_timer.h"
+#else
+#include <time.h>
+#endif
+#include "esp_panel_pixel.h"
+#include "esp_panel_pixel_tune.h"
+
+static const uint16_t candidate_widths[] = {8, 16, 32, 64, 128};
+static const uint16_t candidate_heights[] = {16, 32, 64, 128, 256};
+
+_Static_assert(
+    sizeof(candidate_widths) / sizeof(candidate_widths[0]) * sizeof(candidate_heights) / sizeof(candidate_heights[0]) ==
+    ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM, "Invalid candidate number"
+);
+
+static uint64_t get_time_us(void)
+{
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+bool esp_panel_pixel_tune_rotate_block(const esp_panel_pixel_tune_config_t *config,
+                                       esp_panel_pixel_tune_result_t *results, esp_panel_pixel_tune_result_t *best)
+{
+    if ((config == NULL) || (config->from == NULL) || (config->to == NULL) || (config->w == 0) || (config->h == 0)) {
+        return false;
+    }
+    if (((config->rotate != 90) && (config->rotate != 270)) ||
+            ((config->bytes_per_pixel != 2) && (config->bytes_per_pixel != 3))) {
+        return false;
+    }
+
+    int loops = (config->loops == 0) ? 1 : config->loops;
+    esp_panel_pixel_tune_result_t best_result = {
+        .time_us = UINT32_MAX,
+    };
+    int index = 0;
+
+    for (size_t i = 0; i < sizeof(candidate_widths) / sizeof(candidate_widths[0]); i++) {
+        for (size_t j = 0; j < sizeof(candidate_heights) / sizeof(candidate_heights[0]); j++) {
+            esp_panel_pixel_tune_result_t result = {
+                .block_w = candidate_widths[i],
+                .block_h = candidate_heights[j],
+            };
+            uint64_t start_us = 0;
+
+            /* The first rotation only warms up the cache and is not measured */
+            for (int k = 0; k <= loops; k++) {
+                if (k == 1) {
+                    start_us = get_time_us();
+                }
+                if (!esp_panel_pixel_rotate_copy_with_block(
+                            config->from, config->to, 0, 0, config->w - 1, config->h - 1, config->w, config->h,
+                            config->rotate, config->bytes_per_pixel, result.block_w, result.block_h
+                        )) {
+                    return false;
+                }
+            }
+            result.time_us = (get_time_us() - start_us) / loops;
+
+            if (results != NULL) {
+                results[index] = result;
+            }
+            if (result.time_us < best_result.time_us) {
+                best_result = result;
+            }
+            index++;
+        }
+    }
+
+    if (config->flags.apply_best &&
+            !esp_panel_pixel_set_rotate_block_size(config->bytes_per_pixel, best_result.block_w, best_result.block_h)) {
+        return false;
+    }
+    if (best != NULL) {
+        *best = best_result;
+    }
+
+    return true;
+}
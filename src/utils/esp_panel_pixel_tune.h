@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of the candidate block shapes, which are the combinations of the widths `8/16/32/64/128` and the
+ *        heights `16/32/64/128/256`
+ *
+ */
+#define ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM  (25)
+
+/**
+ * @brief Configuration of the rotation block size autotuner
+ *
+ */
+typedef struct {
+    const uint8_t *from;        /*!< Source frame used to benchmark. It should be placed in the same memory (SRAM or
+                                     PSRAM) as the real frames, since the best block size depends on it */
+    uint8_t *to;                /*!< Destination frame used to benchmark, the content will be overwritten */
+    uint16_t w;                 /*!< Width of the source frame */
+    uint16_t h;                 /*!< Height of the source frame */
+    uint16_t rotate;            /*!< Rotation degree, should be 90 or 270 */
+    uint8_t bytes_per_pixel;    /*!< Bytes of a single pixel, should be 2 or 3 */
+    uint8_t loops;              /*!< Number of full frame rotations for each candidate, `0` is treated as `1` */
+    struct {
+        uint8_t apply_best: 1;  /*!< Whether to apply the best block size by `esp_panel_pixel_set_rotate_block_size()` */
+    } flags;
+} esp_panel_pixel_tune_config_t;
+
+/**
+ * @brief Measured result of a single candidate
+ *
+ */
+typedef struct {
+    uint16_t block_w;           /*!< Number of source columns of a single block */
+    uint16_t block_h;           /*!< Number of source rows of a single block */
+    uint32_t time_us;           /*!< Average time of a full frame rotation in microseconds */
+} esp_panel_pixel_tune_result_t;
+
+/**
+ * @brief Benchmark all the candidate block shapes with full frame rotations, and find out the fastest one
+ *
+ * @note  This function can be called at startup with the real frame buffers, or offline on the host with the
+ *        resolution of the panel. The best block size can be saved and restored by
+ *        `esp_panel_pixel_set_rotate_block_size()` to avoid tuning on every boot
+ * @note  Each candidate is warmed up by an extra rotation which is not measured
+ *
+ * @param config  Pointer of the configuration
+ * @param results Array to store the measured results of all candidates, can be NULL. Its length should be at least
+ *                `ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM`
+ * @param best    Pointer to store the fastest result, can be NULL
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_tune_rotate_block(const esp_panel_pixel_tune_config_t *config,
+                                       esp_panel_pixel_tune_result_t *results, esp_panel_pixel_tune_result_t *best);
+
+#ifdef __cplusplus
+}
+#endif
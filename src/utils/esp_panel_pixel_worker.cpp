@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#include "esp_pthread.h"
+#define PIXEL_WORKER_USE_ESP_PTHREAD    (1)
+#endif
+#include "esp_panel_pixel.h"
+#include "esp_panel_pixel_worker.h"
+
+typedef struct {
+    bool valid;
+    uint16_t y_start;
+    uint16_t y_end;
+} band_t;
+
+struct esp_panel_pixel_worker_t {
+    std::vector<std::thread> threads;
+    std::mutex run_mutex;               // Serialize the jobs from different callers
+    std::mutex mutex;                   // Protect the fields below
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    uint32_t job_id = 0;
+    int pending = 0;
+    bool exit = false;
+    esp_panel_pixel_worker_func_t func = nullptr;
+    void *ctx = nullptr;
+    band_t bands[ESP_PANEL_PIXEL_WORKER_NUM_MAX + 1] = {};
+};
+
+using namespace std;
+
+static void worker_loop(esp_panel_pixel_worker_t *worker, int index)
+{
+    uint32_t job_id = 0;
+
+    unique_lock<mutex> lock(worker->mutex);
+    while (true) {
+        worker->start_cv.wait(lock, [&] { return worker->exit || (worker->job_id != job_id); });
+        if (worker->exit) {
+            break;
+        }
+        job_id = worker->job_id;
+
+        /* The band 0 belongs to the caller thread */
+        band_t band = worker->bands[index + 1];
+        esp_panel_pixel_worker_func_t func = worker->func;
+        void *ctx = worker->ctx;
+        lock.unlock();
+        if (band.valid) {
+            func(ctx, band.y_start, band.y_end);
+        }
+        lock.lock();
+
+        if (--worker->pending == 0) {
+            worker->done_cv.notify_one();
+        }
+    }
+}
+
+esp_panel_pixel_worker_handle_t esp_panel_pixel_worker_new(const esp_panel_pixel_worker_config_t *config)
+{
+    if ((config == nullptr) || (config->num_workers == 0) || (config->num_workers > ESP_PANEL_PIXEL_WORKER_NUM_MAX)) {
+        return nullptr;
+    }
+
+    esp_panel_pixel_worker_t *worker = new esp_panel_pixel_worker_t();
+    if (worker == nullptr) {
+        return nullptr;
+    }
+
+#if PIXEL_WORKER_USE_ESP_PTHREAD
+    /* The configuration only affects the threads created by the current thread */
+    esp_pthread_cfg_t pthread_cfg = esp_pthread_get_default_config();
+    pthread_cfg.thread_name = "pixel_worker";
+    if (config->core_id >= 0) {
+        pthread_cfg.pin_to_core = config->core_id;
+    }
+    if (config->stack_size > 0) {
+        pthread_cfg.stack_size = config->stack_size;
+    }
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    for (int i = 0; i < config->num_workers; i++) {
+        worker->threads.emplace_back(worker_loop, worker, i);
+    }
+
+#if PIXEL_WORKER_USE_ESP_PTHREAD
+    pthread_cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
+    return worker;
+}
+
+void esp_panel_pixel_worker_del(esp_panel_pixel_worker_handle_t worker)
+{
+    if (worker == nullptr) {
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(worker->mutex);
+        worker->exit = true;
+    }
+    worker->start_cv.notify_all();
+    for (auto &thread : worker->threads) {
+        thread.join();
+    }
+
+    delete worker;
+}
+
+bool esp_panel_pixel_worker_run(esp_panel_pixel_worker_handle_t worker, esp_panel_pixel_worker_func_t func, void *ctx,
+                                uint16_t y_start, uint16_t y_end, uint8_t align)
+{
+    if ((func == nullptr) || (y_start > y_end)) {
+        return false;
+    }
+
+    int rows = y_end - y_start + 1;
+    int band_num = (worker == nullptr) ? 1 : (worker->threads.size() + 1);
+    align = (align == 0) ? 1 : align;
+
+    /* Round the band height up to the alignment, so the last band may be shorter or even empty */
+    int band_rows = (rows + band_num - 1) / band_num;
+    band_rows = ((band_rows + align - 1) / align) * align;
+    if ((band_num == 1) || (band_rows >= rows)) {
+        func(ctx, y_start, y_end);
+        return true;
+    }
+
+    lock_guard<mutex> run_lock(worker->run_mutex);
+    {
+        lock_guard<mutex> lock(worker->mutex);
+        for (int i = 0; i < band_num; i++) {
+            int band_start = y_start + i * band_rows;
+            int band_end = min(band_start + band_rows - 1, (int)y_end);
+            worker->bands[i].valid = (band_start <= y_end);
+            worker->bands[i].y_start = band_start;
+            worker->bands[i].y_end = band_end;
+        }
+        worker->func = func;
+        worker->ctx = ctx;
+        worker->pending = worker->threads.size();
+        worker->job_id++;
+    }
+    worker->start_cv.notify_all();
+
+    func(ctx, worker->bands[0].y_start, worker->bands[0].y_end);
+
+    unique_lock<mutex> lock(worker->mutex);
+    worker->done_cv.wait(lock, [&] { return worker->pending == 0; });
+
+    return true;
+}
+
+typedef struct {
+    const uint8_t *from;
+    uint8_t *to;
+    uint16_t x_start;
+    uint16_t x_end;
+    uint16_t w;
+    uint16_t h;
+    uint16_t rotate;
+    uint8_t bytes_per_pixel;
+    atomic<bool> is_ok;
+} rotate_copy_job_t;
+
+static void rotate_copy_job(void *ctx, uint16_t y_start, uint16_t y_end)
+{
+    rotate_copy_job_t *job = (rotate_copy_job_t *)ctx;
+
+    if (!esp_panel_pixel_rotate_copy(
+                job->from, job->to, job->x_start, y_start, job->x_end, y_end, job->w, job->h, job->rotate,
+                job->bytes_per_pixel
+            )) {
+        job->is_ok = false;
+    }
+}
+
+bool esp_panel_pixel_worker_rotate_copy(esp_panel_pixel_worker_handle_t worker, const uint8_t *from, uint8_t *to,
+                                        uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
+                                        uint16_t h, uint16_t rotate, uint8_t bytes_per_pixel)
+{
+    rotate_copy_job_t job = {
+        .from = from,
+        .to = to,
+        .x_start = x_start,
+        .x_end = x_end,
+        .w = w,
+        .h = h,
+        .rotate = rotate,
+        .bytes_per_pixel = bytes_per_pixel,
+        .is_ok = {true},
+    };
+
+    /* The bands are aligned to the largest tile (4 rows of the 24bpp kernels) */
+    if (!esp_panel_pixel_worker_run(worker, rotate_copy_job, &job, y_start, y_end, 4)) {
+        return false;
+    }
+
+    return job.is_ok;
+}
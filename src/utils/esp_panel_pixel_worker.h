@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the pixel worker
+ *
+ */
+typedef struct {
+    uint8_t num_workers;    /*!< Number of the helper threads. The caller thread also processes a band, so set it to
+                                 `1` to use both cores of a dual-core SoC */
+    int core_id;            /*!< Core which the helper threads are pinned to, `-1` means no affinity.
+                                 Only valid on ESP SoCs */
+    uint32_t stack_size;    /*!< Stack size of the helper threads in bytes, `0` means the default size */
+} esp_panel_pixel_worker_config_t;
+
+/**
+ * @brief Default configuration of the pixel worker, which uses a single helper thread without affinity
+ *
+ */
+#define ESP_PANEL_PIXEL_WORKER_CONFIG_DEFAULT() \
+    {                                           \
+        .num_workers = 1,                       \
+        .core_id = -1,                          \
+        .stack_size = 0,                        \
+    }
+
+/**
+ * @brief Maximum number of the helper threads
+ *
+ */
+#define ESP_PANEL_PIXEL_WORKER_NUM_MAX      (7)
+
+typedef struct esp_panel_pixel_worker_t *esp_panel_pixel_worker_handle_t;
+
+/**
+ * @brief Job function which processes the source rows `[y_start, y_end]` (inclusive) of a band
+ *
+ * @note  The bands of a single job are disjoint, and they are processed by different threads at the same time
+ *
+ */
+typedef void (*esp_panel_pixel_worker_func_t)(void *ctx, uint16_t y_start, uint16_t y_end);
+
+/**
+ * @brief Create a pixel worker. It is backed by `std::thread`, so the same implementation runs on ESP SoCs (pinned by
+ *        `esp_pthread`) and on the host
+ *
+ * @param config Pointer of the configuration
+ *
+ * @return
+ *      - NULL:   if fail
+ *      - others: the handle of the worker
+ */
+esp_panel_pixel_worker_handle_t esp_panel_pixel_worker_new(const esp_panel_pixel_worker_config_t *config);
+
+/**
+ * @brief Delete the pixel worker, the helper threads are joined before returning
+ *
+ * @param worker Handle of the worker
+ */
+void esp_panel_pixel_worker_del(esp_panel_pixel_worker_handle_t worker);
+
+/**
+ * @brief Split the rows `[y_start, y_end]` into bands, run the job on all the bands in parallel and wait for them
+ *
+ * @note  The caller thread processes the first band, and the helper threads process the others
+ * @note  The band boundaries are multiples of `align` rows (relative to `y_start`), so the tile based kernels are not
+ *        split in the middle of a tile. Too few rows are processed by the caller thread only
+ * @note  If `worker` is NULL, the whole job is processed by the caller thread
+ *
+ * @param worker  Handle of the worker, can be NULL
+ * @param func    Job function
+ * @param ctx     User context passed to the job function
+ * @param y_start Start row (inclusive)
+ * @param y_end   End row (inclusive)
+ * @param align   Alignment of the band boundaries in rows, `0` is treated as `1`
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_worker_run(esp_panel_pixel_worker_handle_t worker, esp_panel_pixel_worker_func_t func, void *ctx,
+                                uint16_t y_start, uint16_t y_end, uint8_t align);
+
+/**
+ * @brief Same as `esp_panel_pixel_rotate_copy()`, but the region is split by source rows and rotated in parallel
+ *
+ * @param worker Handle of the worker, can be NULL to rotate by the caller thread only
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_pixel_worker_rotate_copy(esp_panel_pixel_worker_handle_t worker, const uint8_t *from, uint8_t *to,
+                                        uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
+                                        uint16_t h, uint16_t rotate, uint8_t bytes_per_pixel);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_scroll.h"
+
+bool esp_panel_scroll_config_area(esp_panel_scroll_t *scroll, uint16_t gap, uint16_t top_fixed, uint16_t height,
+                                  uint16_t bottom_fixed, esp_panel_scroll_tx_param_cb_t tx_param_cb, void *user_ctx)
+{
+    if ((scroll == NULL) || (tx_param_cb == NULL) || (height == 0) ||
+            ((uint32_t)gap + top_fixed + height + bottom_fixed > UINT16_MAX)) {
+        return false;
+    }
+
+    /* The gap belongs to the top fixed area of the frame memory */
+    uint16_t tfa = gap + top_fixed;
+    uint8_t param[6] = {
+        (uint8_t)(tfa >> 8), (uint8_t)tfa,
+        (uint8_t)(height >> 8), (uint8_t)height,
+        (uint8_t)(bottom_fixed >> 8), (uint8_t)bottom_fixed,
+    };
+    if (!tx_param_cb(user_ctx, ESP_PANEL_SCROLL_CMD_VSCRDEF, param, sizeof(param))) {
+        return false;
+    }
+    scroll->gap = gap;
+    scroll->top_fixed = top_fixed;
+    scroll->height = height;
+    scroll->bottom_fixed = bottom_fixed;
+
+    return esp_panel_scroll_to(scroll, 0, tx_param_cb, user_ctx);
+}
+
+bool esp_panel_scroll_to(esp_panel_scroll_t *scroll, uint32_t line, esp_panel_scroll_tx_param_cb_t tx_param_cb,
+                         void *user_ctx)
+{
+    if ((scroll == NULL) || (tx_param_cb == NULL) || (scroll->height == 0)) {
+        return false;
+    }
+
+    uint16_t offset = line % scroll->height;
+    uint16_t vsp = scroll->gap + scroll->top_fixed + offset;
+    uint8_t param[2] = {(uint8_t)(vsp >> 8), (uint8_t)vsp};
+    if (!tx_param_cb(user_ctx, ESP_PANEL_SCROLL_CMD_VSCRSADD, param, sizeof(param))) {
+        return false;
+    }
+    scroll->offset = offset;
+
+    return true;
+}
+
+uint16_t esp_panel_scroll_get_memory_line(const esp_panel_scroll_t *scroll, uint16_t line)
+{
+    return scroll->top_fixed + (scroll->offset + line) % scroll->height;
+}
+
+bool esp_panel_scroll_lines(esp_panel_scroll_t *scroll, int lines, const void *data, size_t line_size,
+                            esp_panel_scroll_tx_param_cb_t tx_param_cb, esp_panel_scroll_draw_cb_t draw_cb,
+                            void *user_ctx)
+{
+    if ((scroll == NULL) || (draw_cb == NULL) || (scroll->height == 0) || (lines < -(int)scroll->height) ||
+            (lines > (int)scroll->height) || ((data == NULL) && (lines != 0))) {
+        return false;
+    }
+    if (lines == 0) {
+        return true;
+    }
+
+    int count = (lines > 0) ? lines : -lines;
+    uint32_t offset = (scroll->offset + scroll->height + lines) % scroll->height;
+    if (!esp_panel_scroll_to(scroll, offset, tx_param_cb, user_ctx)) {
+        return false;
+    }
+
+    /* The exposed lines are shown at the bottom or the top of the scroll area, and they wrap around in the memory */
+    uint16_t first = (lines > 0) ? (scroll->height - count) : 0;
+    const uint8_t *src = (const uint8_t *)data;
+    while (count > 0) {
+        uint16_t y_start = esp_panel_scroll_get_memory_line(scroll, first);
+        int band = scroll->top_fixed + scroll->height - y_start;
+        band = (band < count) ? band : count;
+        if (!draw_cb(user_ctx, y_start, y_start + band, src)) {
+            return false;
+        }
+        src += band * line_size;
+        first += band;
+        count -= band;
+    }
+
+    return true;
+}
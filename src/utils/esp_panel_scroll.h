@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief MIPI-DCS commands of the vertical scrolling
+ *
+ */
+#define ESP_PANEL_SCROLL_CMD_VSCRDEF    (0x33)  // Vertical scrolling definition: TFA, VSA and BFA, 2 bytes each
+#define ESP_PANEL_SCROLL_CMD_VSCRSADD   (0x37)  // Vertical scrolling start address: VSP, 2 bytes
+
+/**
+ * @brief Callback to send a command with parameters, which has the same parameters as `esp_lcd_panel_io_tx_param()`
+ *
+ * @param user_ctx User context
+ * @param cmd      Command
+ * @param param    Pointer of the parameters
+ * @param size     Size of the parameters in bytes
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_scroll_tx_param_cb_t)(void *user_ctx, int cmd, const void *param, size_t size);
+
+/**
+ * @brief Callback to draw the lines into the frame memory
+ *
+ * @param user_ctx User context
+ * @param y_start  Start line in the frame memory (inclusive), the gap is not included
+ * @param y_end    End line in the frame memory (exclusive), the gap is not included
+ * @param data     Pointer of the color data of the lines
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_scroll_draw_cb_t)(void *user_ctx, uint16_t y_start, uint16_t y_end, const void *data);
+
+/**
+ * @brief State of the vertical scrolling
+ *
+ * @note  The frame memory is divided into the top fixed area, the scroll area and the bottom fixed area. The panel shows
+ *        the line `offset` of the scroll area at its first scroll line, and wraps around at the end of the area. So
+ *        scrolling only changes the start address, and only the exposed lines need to be drawn
+ *
+ */
+typedef struct {
+    uint16_t gap;               /*!< Number of the lines before the frame memory used by the LCD, like the Y gap */
+    uint16_t top_fixed;         /*!< Number of the lines of the top fixed area */
+    uint16_t height;            /*!< Number of the lines of the scroll area */
+    uint16_t bottom_fixed;      /*!< Number of the lines of the bottom fixed area */
+    uint16_t offset;            /*!< Line of the scroll area shown at its first line */
+} esp_panel_scroll_t;
+
+/**
+ * @brief Define the scroll area (VSCRDEF) and reset the start address (VSCRSADD)
+ *
+ * @note  `gap + top_fixed + height + bottom_fixed` should be equal to the number of the lines of the frame memory, which
+ *        may be larger than the LCD height (like 320 for ST7789)
+ *
+ * @param scroll       Pointer of the scrolling state
+ * @param gap          Number of the lines before the frame memory used by the LCD
+ * @param top_fixed    Number of the lines of the top fixed area
+ * @param height       Number of the lines of the scroll area
+ * @param bottom_fixed Number of the lines of the bottom fixed area
+ * @param tx_param_cb  Callback to send the commands
+ * @param user_ctx     User context passed to the callback
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_scroll_config_area(esp_panel_scroll_t *scroll, uint16_t gap, uint16_t top_fixed, uint16_t height,
+                                  uint16_t bottom_fixed, esp_panel_scroll_tx_param_cb_t tx_param_cb, void *user_ctx);
+
+/**
+ * @brief Show the line of the scroll area at its first line (VSCRSADD)
+ *
+ * @param scroll      Pointer of the scrolling state
+ * @param line        Line of the scroll area, it wraps around the height of the area
+ * @param tx_param_cb Callback to send the command
+ * @param user_ctx    User context passed to the callback
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_scroll_to(esp_panel_scroll_t *scroll, uint32_t line, esp_panel_scroll_tx_param_cb_t tx_param_cb,
+                         void *user_ctx);
+
+/**
+ * @brief Get the line of the frame memory which is shown at the line of the scroll area
+ *
+ * @param scroll Pointer of the scrolling state
+ * @param line   Shown line of the scroll area, the range is [0, height - 1]
+ *
+ * @return The line of the frame memory, the gap is not included
+ */
+uint16_t esp_panel_scroll_get_memory_line(const esp_panel_scroll_t *scroll, uint16_t line);
+
+/**
+ * @brief Scroll the content by the lines and draw the exposed lines only
+ *
+ * @note  A positive `lines` moves the content up, and `data` holds the new lines shown at the bottom of the scroll area
+ *        from top to bottom. A negative one moves the content down, and `data` holds the new lines shown at the top
+ * @note  The exposed lines are drawn into the lines of the frame memory which just left the view, so they may be split
+ *        into two drawings when the lines wrap around
+ *
+ * @param scroll      Pointer of the scrolling state
+ * @param lines       Number of the lines to scroll, the range is [-height, height]
+ * @param data        Pointer of the color data of the exposed lines
+ * @param line_size   Size of a line in bytes
+ * @param tx_param_cb Callback to send the command
+ * @param draw_cb     Callback to draw the exposed lines
+ * @param user_ctx    User context passed to the callbacks
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_scroll_lines(esp_panel_scroll_t *scroll, int lines, const void *data, size_t line_size,
+                            esp_panel_scroll_tx_param_cb_t tx_param_cb, esp_panel_scroll_draw_cb_t draw_cb,
+                            void *user_ctx);
+
+#ifdef __cplusplus
+}
+#endif
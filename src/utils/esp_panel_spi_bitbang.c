@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include "esp_panel_spi_bitbang.h"
+
+/* Set the lines in `mask` to `levels`, the unchanged lines are skipped */
+static bool set_lines(esp_panel_spi_bitbang_t *bitbang, uint32_t mask, uint32_t levels)
+{
+    uint32_t changed = (bitbang->levels ^ levels) & mask;
+    if (changed == 0) {
+        return true;
+    }
+    if (!bitbang->config.write_cb(bitbang->config.user_ctx, changed, levels & changed)) {
+        return false;
+    }
+    bitbang->levels ^= changed;
+    bitbang->stats.writes++;
+    for (; changed; changed &= changed - 1) {
+        bitbang->stats.toggles++;
+    }
+
+    return true;
+}
+
+static uint32_t line_level(uint32_t line, bool is_high)
+{
+    return is_high ? line : 0;
+}
+
+bool esp_panel_spi_bitbang_init(esp_panel_spi_bitbang_t *bitbang, const esp_panel_spi_bitbang_config_t *config)
+{
+    if ((bitbang == NULL) || (config == NULL) || (config->write_cb == NULL) || (config->delay_cb == NULL)) {
+        return false;
+    }
+
+    bitbang->config = *config;
+    bitbang->levels = line_level(ESP_PANEL_SPI_BITBANG_LINE_CS, !config->flags.cs_high_active) |
+                      line_level(ESP_PANEL_SPI_BITBANG_LINE_SCL | ESP_PANEL_SPI_BITBANG_LINE_SDA,
+                                 config->flags.sda_scl_idle_high);
+    bitbang->stats = (esp_panel_spi_bitbang_stats_t) {};
+
+    return true;
+}
+
+bool esp_panel_spi_bitbang_write(esp_panel_spi_bitbang_t *bitbang, int dc_bit, uint32_t data, uint8_t bytes)
+{
+    if ((bitbang == NULL) || (bytes == 0) || (bytes > sizeof(uint32_t))) {
+        return false;
+    }
+
+    const esp_panel_spi_bitbang_config_t *config = &bitbang->config;
+    uint32_t half_period_us = config->half_period_us;
+    uint32_t cs_active = line_level(ESP_PANEL_SPI_BITBANG_LINE_CS, config->flags.cs_high_active);
+    uint32_t scl_before = line_level(ESP_PANEL_SPI_BITBANG_LINE_SCL, !config->flags.scl_active_rising_edge);
+    uint32_t scl_after = scl_before ^ ESP_PANEL_SPI_BITBANG_LINE_SCL;
+    uint32_t idle = line_level(ESP_PANEL_SPI_BITBANG_LINE_CS, !config->flags.cs_high_active) |
+                    line_level(ESP_PANEL_SPI_BITBANG_LINE_SCL | ESP_PANEL_SPI_BITBANG_LINE_SDA,
+                               config->flags.sda_scl_idle_high);
+
+    // CS active
+    if (!set_lines(bitbang, ESP_PANEL_SPI_BITBANG_LINE_CS, cs_active)) {
+        return false;
+    }
+    config->delay_cb(config->user_ctx, half_period_us);
+
+    /* Every bit is a `SCL inactive edge + SDA` write followed by a `SCL active edge` write */
+    int bits = esp_panel_spi_pack_get_package_bits(dc_bit, bytes);
+    for (int i = 0; i < bits; i++) {
+        bool is_high = esp_panel_spi_pack_get_bit(dc_bit, data, bytes, config->flags.lsb_first, i);
+        uint32_t sda = line_level(ESP_PANEL_SPI_BITBANG_LINE_SDA, is_high);
+        if (!set_lines(bitbang, ESP_PANEL_SPI_BITBANG_LINE_SCL | ESP_PANEL_SPI_BITBANG_LINE_SDA, scl_before | sda)) {
+            return false;
+        }
+        config->delay_cb(config->user_ctx, half_period_us);
+        if (!set_lines(bitbang, ESP_PANEL_SPI_BITBANG_LINE_SCL, scl_after)) {
+            return false;
+        }
+        config->delay_cb(config->user_ctx, half_period_us);
+    }
+
+    // SCL and SDA idle, then CS inactive
+    if (!set_lines(bitbang, ESP_PANEL_SPI_BITBANG_LINE_SCL | ESP_PANEL_SPI_BITBANG_LINE_SDA, idle)) {
+        return false;
+    }
+    config->delay_cb(config->user_ctx, half_period_us);
+    if (!set_lines(bitbang, ESP_PANEL_SPI_BITBANG_LINE_CS, idle)) {
+        return false;
+    }
+    config->delay_cb(config->user_ctx, half_period_us);
+
+    return true;
+}
+
+bool esp_panel_spi_bitbang_get_stats(esp_panel_spi_bitbang_t *bitbang, esp_panel_spi_bitbang_stats_t *stats, bool clear)
+{
+    if ((bitbang == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = bitbang->stats;
+    if (clear) {
+        bitbang->stats = (esp_panel_spi_bitbang_stats_t) {};
+    }
+
+    return true;
+}
@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_panel_spi_pack.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Masks of the lines, used by the write callback
+ *
+ */
+#define ESP_PANEL_SPI_BITBANG_LINE_CS       (1U << 0)
+#define ESP_PANEL_SPI_BITBANG_LINE_SCL      (1U << 1)
+#define ESP_PANEL_SPI_BITBANG_LINE_SDA      (1U << 2)
+
+/**
+ * @brief Value of `dc_bit` which means the package has no DC bit
+ *
+ */
+#define ESP_PANEL_SPI_BITBANG_NO_DC_BIT     ESP_PANEL_SPI_PACK_NO_DC_BIT
+
+/**
+ * @brief Callback to set the lines at once
+ *
+ * @param user_ctx User context
+ * @param mask     Mask of the lines to set, only the changed lines are included
+ * @param levels   Levels of the lines, the bit of a line is set if it's high
+ *
+ * @return true if success, otherwise false
+ */
+typedef bool (*esp_panel_spi_bitbang_write_cb_t)(void *user_ctx, uint32_t mask, uint32_t levels);
+
+/**
+ * @brief Callback to delay for the given microseconds
+ *
+ * @param user_ctx User context
+ * @param delay_us Delay in microseconds
+ */
+typedef void (*esp_panel_spi_bitbang_delay_cb_t)(void *user_ctx, uint32_t delay_us);
+
+/**
+ * @brief Configuration of the software SPI (CS, SCL and SDA lines)
+ *
+ */
+typedef struct {
+    uint32_t half_period_us;                    /*!< Half period of SCL in microseconds */
+    esp_panel_spi_bitbang_write_cb_t write_cb;  /*!< Callback to set the lines */
+    esp_panel_spi_bitbang_delay_cb_t delay_cb;  /*!< Callback to delay */
+    void *user_ctx;                             /*!< User context passed to the callbacks */
+    struct {
+        uint32_t cs_high_active: 1;             /*!< If this flag is enabled, CS line is high active */
+        uint32_t sda_scl_idle_high: 1;          /*!< If this flag is enabled, SDA and SCL line are high when idle */
+        uint32_t scl_active_rising_edge: 1;     /*!< If this flag is enabled, SCL line is active on rising edge */
+        uint32_t lsb_first: 1;                  /*!< If this flag is enabled, transmit LSB bit first */
+    } flags;
+} esp_panel_spi_bitbang_config_t;
+
+/**
+ * @brief Counters of the line writes
+ *
+ */
+typedef struct {
+    uint32_t writes;            /*!< Number of the calls of the write callback, like the expander transactions */
+    uint32_t toggles;           /*!< Number of the level changes of the lines */
+} esp_panel_spi_bitbang_stats_t;
+
+/**
+ * @brief Software SPI which writes the packages of the 3-wire SPI LCDs
+ *
+ * @note  The levels of the lines are tracked, so only the changed lines are written. The data line is changed together
+ *        with the inactive edge of SCL, which saves a write for every bit while the data is still set up for a half
+ *        period before the active edge
+ *
+ */
+typedef struct {
+    esp_panel_spi_bitbang_config_t config;
+    uint32_t levels;                        /*!< Current levels of the lines */
+    esp_panel_spi_bitbang_stats_t stats;
+} esp_panel_spi_bitbang_t;
+
+/**
+ * @brief Initialize the software SPI
+ *
+ * @note  The lines should be set to the idle levels before
+ *
+ * @param bitbang Pointer of the software SPI
+ * @param config  Pointer of the configuration
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_spi_bitbang_init(esp_panel_spi_bitbang_t *bitbang, const esp_panel_spi_bitbang_config_t *config);
+
+/**
+ * @brief Write a package, the bytes are sent from the most significant one
+ *
+ * @param bitbang Pointer of the software SPI
+ * @param dc_bit  DC bit sent before the first byte (0 or 1), `ESP_PANEL_SPI_BITBANG_NO_DC_BIT` means no DC bit
+ * @param data    Data of the package
+ * @param bytes   Number of the bytes (1 ~ 4)
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_spi_bitbang_write(esp_panel_spi_bitbang_t *bitbang, int dc_bit, uint32_t data, uint8_t bytes);
+
+/**
+ * @brief Get the counters of the line writes
+ *
+ * @param bitbang Pointer of the software SPI
+ * @param stats   Pointer to store the counters
+ * @param clear   Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_spi_bitbang_get_stats(esp_panel_spi_bitbang_t *bitbang, esp_panel_spi_bitbang_stats_t *stats, bool clear);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_panel_spi_pack.h"
+
+bool esp_panel_spi_pack_get_bit(int dc_bit, uint32_t data, uint8_t bytes, bool lsb_first, int index)
+{
+    int bits = esp_panel_spi_pack_get_package_bits(dc_bit, bytes);
+    if ((dc_bit != ESP_PANEL_SPI_PACK_NO_DC_BIT) && (index == 0)) {
+        return (dc_bit != 0);
+    }
+
+    int bit = index - bits + bytes * 8;
+    int byte = bytes - 1 - bit / 8;
+    int shift = lsb_first ? (bit % 8) : (7 - bit % 8);
+
+    return (data >> (byte * 8 + shift)) & 1;
+}
+
+bool esp_panel_spi_pack_init(esp_panel_spi_pack_t *pack, uint8_t *buf, size_t size, bool lsb_first)
+{
+    if ((pack == NULL) || (buf == NULL) || (size == 0)) {
+        return false;
+    }
+
+    pack->buf = buf;
+    pack->size = size;
+    pack->bits = 0;
+    pack->flags.lsb_first = lsb_first;
+    esp_panel_spi_pack_reset(pack);
+
+    return true;
+}
+
+bool esp_panel_spi_pack_push(esp_panel_spi_pack_t *pack, int dc_bit, uint32_t data, uint8_t bytes)
+{
+    if ((pack == NULL) || (bytes == 0) || (bytes > sizeof(uint32_t))) {
+        return false;
+    }
+
+    int bits = esp_panel_spi_pack_get_package_bits(dc_bit, bytes);
+    if (pack->bits + bits > pack->size * 8) {
+        return false;
+    }
+
+    /* The buffer is cleared beforehand, so only the high bits are set */
+    for (int i = 0; i < bits; i++) {
+        if (esp_panel_spi_pack_get_bit(dc_bit, data, bytes, pack->flags.lsb_first, i)) {
+            pack->buf[pack->bits / 8] |= 0x80 >> (pack->bits % 8);
+        }
+        pack->bits++;
+    }
+
+    return true;
+}
+
+void esp_panel_spi_pack_reset(esp_panel_spi_pack_t *pack)
+{
+    if (pack == NULL) {
+        return;
+    }
+
+    // Only the used bytes need to be cleared
+    memset(pack->buf, 0, (pack->bits == 0) ? pack->size : (pack->bits + 7) / 8);
+    pack->bits = 0;
+}
+
+size_t esp_panel_spi_pack_get_bits(const esp_panel_spi_pack_t *pack)
+{
+    return (pack == NULL) ? 0 : pack->bits;
+}
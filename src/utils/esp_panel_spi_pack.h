@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Value of `dc_bit` which means the package has no DC bit
+ *
+ */
+#define ESP_PANEL_SPI_PACK_NO_DC_BIT        (-1)
+
+/**
+ * @brief Packer of the 3-wire SPI packages, which puts the bits into a buffer in the order they are sent on the line
+ *
+ * @note  Every byte of the buffer is filled from its most significant bit, so the buffer can be sent by the SPI master
+ *        peripheral in the MSB first mode with the bit length of the transaction. The bit order of the LCD (`lsb_first`)
+ *        is applied while packing
+ *
+ */
+typedef struct {
+    uint8_t *buf;               /*!< Buffer of the packed bits */
+    size_t size;                /*!< Size of the buffer in bytes */
+    size_t bits;                /*!< Number of the packed bits */
+    struct {
+        uint32_t lsb_first: 1;  /*!< If this flag is enabled, transmit LSB bit first */
+    } flags;
+} esp_panel_spi_pack_t;
+
+/**
+ * @brief Get a bit of a package in the order it is sent
+ *
+ * @param dc_bit    DC bit sent before the first byte (0 or 1), `ESP_PANEL_SPI_PACK_NO_DC_BIT` means no DC bit
+ * @param data      Data of the package, the bytes are sent from the most significant one
+ * @param bytes     Number of the bytes (1 ~ 4)
+ * @param lsb_first Whether the LSB bit of every byte is sent first
+ * @param index     Index of the bit in the package
+ *
+ * @return true if the bit is high, otherwise false
+ */
+bool esp_panel_spi_pack_get_bit(int dc_bit, uint32_t data, uint8_t bytes, bool lsb_first, int index);
+
+/**
+ * @brief Get the number of bits of a package
+ *
+ * @param dc_bit DC bit, `ESP_PANEL_SPI_PACK_NO_DC_BIT` means no DC bit
+ * @param bytes  Number of the bytes
+ *
+ * @return Number of the bits
+ */
+static inline int esp_panel_spi_pack_get_package_bits(int dc_bit, uint8_t bytes)
+{
+    return bytes * 8 + ((dc_bit != ESP_PANEL_SPI_PACK_NO_DC_BIT) ? 1 : 0);
+}
+
+/**
+ * @brief Initialize the packer, the buffer is cleared
+ *
+ * @param pack      Pointer of the packer
+ * @param buf       Buffer to store the packed bits
+ * @param size      Size of the buffer in bytes
+ * @param lsb_first Whether the LSB bit of every byte is sent first
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_spi_pack_init(esp_panel_spi_pack_t *pack, uint8_t *buf, size_t size, bool lsb_first);
+
+/**
+ * @brief Append a package to the buffer
+ *
+ * @param pack   Pointer of the packer
+ * @param dc_bit DC bit sent before the first byte (0 or 1), `ESP_PANEL_SPI_PACK_NO_DC_BIT` means no DC bit
+ * @param data   Data of the package, the bytes are sent from the most significant one
+ * @param bytes  Number of the bytes (1 ~ 4)
+ *
+ * @return true if success, otherwise false (the arguments are invalid or the buffer is full, and nothing is appended)
+ */
+bool esp_panel_spi_pack_push(esp_panel_spi_pack_t *pack, int dc_bit, uint32_t data, uint8_t bytes);
+
+/**
+ * @brief Clear the packed bits, usually called after the buffer is sent
+ *
+ * @param pack Pointer of the packer
+ */
+void esp_panel_spi_pack_reset(esp_panel_spi_pack_t *pack);
+
+/**
+ * @brief Get the number of the packed bits, which is the bit length of the SPI transaction
+ *
+ * @param pack Pointer of the packer
+ *
+ * @return Number of the bits, 0 if the packer is NULL
+ */
+size_t esp_panel_spi_pack_get_bits(const esp_panel_spi_pack_t *pack);
+
+#ifdef __cplusplus
+}
+#endif
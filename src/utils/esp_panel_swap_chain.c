@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#else
+#define IRAM_ATTR
+#endif
+#include "esp_panel_swap_chain.h"
+
+/* The state word holds three 2-bit buffer indexes, `INDEX_NONE` means no buffer */
+#define INDEX_NONE          (3)
+#define FRONT_SHIFT         (0)
+#define PENDING_SHIFT       (2)
+#define ACQUIRED_SHIFT      (4)
+
+#define STATE_GET(state, shift)             (((state) >> (shift)) & 0x3)
+#define STATE_SET(state, shift, index)      (((state) & ~(0x3U << (shift))) | ((uint32_t)(index) << (shift)))
+
+struct esp_panel_swap_chain_t {
+    uint8_t num_bufs;
+    atomic_uint state;
+    atomic_uint presented;
+    atomic_uint shown;
+    atomic_uint dropped;
+    atomic_uint vsyncs;
+};
+
+esp_panel_swap_chain_handle_t esp_panel_swap_chain_new(const esp_panel_swap_chain_config_t *config)
+{
+    if ((config == NULL) || (config->num_bufs < ESP_PANEL_SWAP_CHAIN_BUF_NUM_MIN) ||
+            (config->num_bufs > ESP_PANEL_SWAP_CHAIN_BUF_NUM_MAX) || (config->front_index >= config->num_bufs)) {
+        return NULL;
+    }
+
+    struct esp_panel_swap_chain_t *chain = calloc(1, sizeof(struct esp_panel_swap_chain_t));
+    if (chain == NULL) {
+        return NULL;
+    }
+    chain->num_bufs = config->num_bufs;
+
+    uint32_t state = STATE_SET(0, FRONT_SHIFT, config->front_index);
+    state = STATE_SET(state, PENDING_SHIFT, INDEX_NONE);
+    state = STATE_SET(state, ACQUIRED_SHIFT, INDEX_NONE);
+    atomic_init(&chain->state, state);
+    atomic_init(&chain->presented, 0);
+    atomic_init(&chain->shown, 0);
+    atomic_init(&chain->dropped, 0);
+    atomic_init(&chain->vsyncs, 0);
+
+    return chain;
+}
+
+void esp_panel_swap_chain_del(esp_panel_swap_chain_handle_t chain)
+{
+    free(chain);
+}
+
+bool esp_panel_swap_chain_acquire(esp_panel_swap_chain_handle_t chain, uint8_t *index)
+{
+    if ((chain == NULL) || (index == NULL)) {
+        return false;
+    }
+
+    uint32_t state = atomic_load(&chain->state);
+    uint32_t new_state = 0;
+    uint8_t free_index = 0;
+    do {
+        if (STATE_GET(state, ACQUIRED_SHIFT) != INDEX_NONE) {
+            return false;
+        }
+        for (free_index = 0; free_index < chain->num_bufs; free_index++) {
+            if ((free_index != STATE_GET(state, FRONT_SHIFT)) && (free_index != STATE_GET(state, PENDING_SHIFT))) {
+                break;
+            }
+        }
+        if (free_index == chain->num_bufs) {
+            return false;
+        }
+        new_state = STATE_SET(state, ACQUIRED_SHIFT, free_index);
+    } while (!atomic_compare_exchange_weak(&chain->state, &state, new_state));
+    *index = free_index;
+
+    return true;
+}
+
+bool esp_panel_swap_chain_present(esp_panel_swap_chain_handle_t chain, uint8_t index)
+{
+    if ((chain == NULL) || (index >= chain->num_bufs)) {
+        return false;
+    }
+
+    uint32_t state = atomic_load(&chain->state);
+    uint32_t new_state = 0;
+    bool is_dropped = false;
+    do {
+        if (STATE_GET(state, ACQUIRED_SHIFT) != index) {
+            return false;
+        }
+        /* The pending buffer is replaced by the newer one, it is free again without being scanned out */
+        is_dropped = (STATE_GET(state, PENDING_SHIFT) != INDEX_NONE);
+        new_state = STATE_SET(state, ACQUIRED_SHIFT, INDEX_NONE);
+        new_state = STATE_SET(new_state, PENDING_SHIFT, index);
+    } while (!atomic_compare_exchange_weak(&chain->state, &state, new_state));
+    atomic_fetch_add(&chain->presented, 1);
+    if (is_dropped) {
+        atomic_fetch_add(&chain->dropped, 1);
+    }
+
+    return true;
+}
+
+bool esp_panel_swap_chain_release(esp_panel_swap_chain_handle_t chain, uint8_t index)
+{
+    if ((chain == NULL) || (index >= chain->num_bufs)) {
+        return false;
+    }
+
+    uint32_t state = atomic_load(&chain->state);
+    uint32_t new_state = 0;
+    do {
+        if (STATE_GET(state, ACQUIRED_SHIFT) != index) {
+            return false;
+        }
+        new_state = STATE_SET(state, ACQUIRED_SHIFT, INDEX_NONE);
+    } while (!atomic_compare_exchange_weak(&chain->state, &state, new_state));
+
+    return true;
+}
+
+IRAM_ATTR bool esp_panel_swap_chain_on_vsync(esp_panel_swap_chain_handle_t chain)
+{
+    if (chain == NULL) {
+        return false;
+    }
+
+    atomic_fetch_add(&chain->vsyncs, 1);
+    uint32_t state = atomic_load(&chain->state);
+    uint32_t new_state = 0;
+    do {
+        uint32_t pending = STATE_GET(state, PENDING_SHIFT);
+        if (pending == INDEX_NONE) {
+            return false;
+        }
+        new_state = STATE_SET(state, FRONT_SHIFT, pending);
+        new_state = STATE_SET(new_state, PENDING_SHIFT, INDEX_NONE);
+    } while (!atomic_compare_exchange_weak(&chain->state, &state, new_state));
+    atomic_fetch_add(&chain->shown, 1);
+
+    return true;
+}
+
+uint8_t esp_panel_swap_chain_get_front(esp_panel_swap_chain_handle_t chain)
+{
+    if (chain == NULL) {
+        return 0xFF;
+    }
+
+    return STATE_GET(atomic_load(&chain->state), FRONT_SHIFT);
+}
+
+bool esp_panel_swap_chain_get_stats(esp_panel_swap_chain_handle_t chain, esp_panel_swap_chain_stats_t *stats)
+{
+    if ((chain == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    stats->presented = atomic_load(&chain->presented);
+    stats->shown = atomic_load(&chain->shown);
+    stats->dropped = atomic_load(&chain->dropped);
+    stats->vsyncs = atomic_load(&chain->vsyncs);
+
+    return true;
+}
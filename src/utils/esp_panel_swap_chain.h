@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Minimum and maximum number of the buffers in a swap chain
+ *
+ */
+#define ESP_PANEL_SWAP_CHAIN_BUF_NUM_MIN    (2)
+#define ESP_PANEL_SWAP_CHAIN_BUF_NUM_MAX    (3)
+
+/**
+ * @brief Configuration of the swap chain
+ *
+ */
+typedef struct {
+    uint8_t num_bufs;       /*!< Number of the buffers, `2` or `3`. With 2 buffers, `acquire()` fails until the
+                                 presented buffer is shown (FIFO). With 3 buffers, a newer presented buffer replaces the
+                                 pending one, so a buffer is always free to render (mailbox) */
+    uint8_t front_index;    /*!< Index of the buffer which is scanned out at first */
+} esp_panel_swap_chain_config_t;
+
+/**
+ * @brief Counters of the swap chain
+ *
+ */
+typedef struct {
+    uint32_t presented;     /*!< Number of the presented buffers */
+    uint32_t shown;         /*!< Number of the presented buffers which have been scanned out */
+    uint32_t dropped;       /*!< Number of the presented buffers which are replaced before being scanned out */
+    uint32_t vsyncs;        /*!< Number of the vsync events */
+} esp_panel_swap_chain_stats_t;
+
+typedef struct esp_panel_swap_chain_t *esp_panel_swap_chain_handle_t;
+
+/**
+ * @brief Create a swap chain. It only tracks the ownership of the buffer indexes, the buffers are owned by the caller
+ *
+ * @note  The ownership is kept in a single atomic word, so `esp_panel_swap_chain_on_vsync()` can be called from an ISR
+ *        without any lock. The other functions should be called by the render task
+ *
+ * @param config Pointer of the configuration
+ *
+ * @return
+ *      - NULL:   if fail
+ *      - others: the handle of the swap chain
+ */
+esp_panel_swap_chain_handle_t esp_panel_swap_chain_new(const esp_panel_swap_chain_config_t *config);
+
+/**
+ * @brief Delete the swap chain
+ *
+ * @param chain Handle of the swap chain
+ */
+void esp_panel_swap_chain_del(esp_panel_swap_chain_handle_t chain);
+
+/**
+ * @brief Acquire a free buffer to render. It doesn't block
+ *
+ * @note  Only one buffer can be acquired at a time, it should be returned by `present()` or `release()`
+ *
+ * @param chain Handle of the swap chain
+ * @param index Pointer to store the index of the acquired buffer
+ *
+ * @return true if success, otherwise false (no buffer is free yet, or a buffer is already acquired)
+ */
+bool esp_panel_swap_chain_acquire(esp_panel_swap_chain_handle_t chain, uint8_t *index);
+
+/**
+ * @brief Queue the acquired buffer to be scanned out from the next vsync
+ *
+ * @note  The display should be switched to the buffer before calling this function. If the vsync comes in between,
+ *        the buffer is still treated as pending, so the buffer which is actually scanned out is never released early
+ *
+ * @param chain Handle of the swap chain
+ * @param index Index of the acquired buffer
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_swap_chain_present(esp_panel_swap_chain_handle_t chain, uint8_t index);
+
+/**
+ * @brief Return the acquired buffer without presenting it
+ *
+ * @param chain Handle of the swap chain
+ * @param index Index of the acquired buffer
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_swap_chain_release(esp_panel_swap_chain_handle_t chain, uint8_t index);
+
+/**
+ * @brief Handle a vsync event, the pending buffer (if any) becomes the front buffer and the old one is released
+ *
+ * @note  This function is lock-free and can be called from an ISR
+ *
+ * @param chain Handle of the swap chain
+ *
+ * @return true if a buffer is released, which means the waiters of `acquire()` should be woken up, otherwise false
+ */
+bool esp_panel_swap_chain_on_vsync(esp_panel_swap_chain_handle_t chain);
+
+/**
+ * @brief Get the index of the buffer which is scanned out
+ *
+ * @param chain Handle of the swap chain
+ *
+ * @return The index of the front buffer, or `0xFF` if the handle is invalid
+ */
+uint8_t esp_panel_swap_chain_get_front(esp_panel_swap_chain_handle_t chain);
+
+/**
+ * @brief Get the counters of the swap chain
+ *
+ * @param chain Handle of the swap chain
+ * @param stats Pointer to store the counters
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_swap_chain_get_stats(esp_panel_swap_chain_handle_t chain, esp_panel_swap_chain_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
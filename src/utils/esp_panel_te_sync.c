@@ -0,0 +1,213 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#else
+#define IRAM_ATTR
+#endif
+#include "esp_panel_te_sync.h"
+
+#define FRAME_PERIOD_NS_DEFAULT     (16666667)
+#define PERIOD_WARMUP_EDGES         (4)     // The first periods are taken directly, the initial estimation may be wrong
+#define PERIOD_MISSED_MAX           (16)    // A longer gap means the TE is stopped, it doesn't refine the period
+#define EDGE_STALE_PERIODS          (3)     // The last edge is too old to predict the scan line
+
+/* The TE state is written by the ISR only, and read by the task through a sequence lock */
+typedef struct {
+    int64_t last_te_us;
+    uint32_t period_ns;
+    uint32_t edges;
+} te_state_t;
+
+struct esp_panel_te_sync_t {
+    esp_panel_te_sync_config_t config;
+    te_state_t te;
+    atomic_uint te_seq;
+    atomic_uint te_count;
+    atomic_uint missed_te;
+    uint32_t unsynced;
+    uint32_t chunks;
+    uint32_t row_write_ns;
+};
+
+static void read_te_state(struct esp_panel_te_sync_t *sync, te_state_t *state)
+{
+    unsigned int seq = 0;
+    do {
+        seq = atomic_load_explicit(&sync->te_seq, memory_order_acquire);
+        *state = sync->te;
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || (seq != atomic_load_explicit(&sync->te_seq, memory_order_relaxed)));
+}
+
+esp_panel_te_sync_handle_t esp_panel_te_sync_new(const esp_panel_te_sync_config_t *config)
+{
+    if ((config == NULL) || (config->height == 0)) {
+        return NULL;
+    }
+
+    struct esp_panel_te_sync_t *sync = calloc(1, sizeof(struct esp_panel_te_sync_t));
+    if (sync == NULL) {
+        return NULL;
+    }
+    sync->config = *config;
+    sync->te.period_ns = (config->frame_period_us > 0) ? config->frame_period_us * 1000 : FRAME_PERIOD_NS_DEFAULT;
+    sync->row_write_ns = config->row_write_ns;
+    atomic_init(&sync->te_seq, 0);
+    atomic_init(&sync->te_count, 0);
+    atomic_init(&sync->missed_te, 0);
+
+    return sync;
+}
+
+void esp_panel_te_sync_del(esp_panel_te_sync_handle_t sync)
+{
+    free(sync);
+}
+
+IRAM_ATTR bool esp_panel_te_sync_on_te(esp_panel_te_sync_handle_t sync, int64_t time_us)
+{
+    if (sync == NULL) {
+        return false;
+    }
+
+    te_state_t state = sync->te;
+    if (state.edges > 0) {
+        int64_t dt_ns = (time_us - state.last_te_us) * 1000;
+        int64_t periods = (dt_ns + state.period_ns / 2) / state.period_ns;
+        if (state.edges < PERIOD_WARMUP_EDGES) {
+            state.period_ns = dt_ns;
+        } else if (periods == 0) {
+            /* A glitch on the TE line */
+            return true;
+        } else {
+            if (periods > 1) {
+                atomic_fetch_add(&sync->missed_te, periods - 1);
+            }
+            if (periods <= PERIOD_MISSED_MAX) {
+                int64_t sample_ns = dt_ns / periods;
+                state.period_ns += (sample_ns - (int64_t)state.period_ns) / 8;
+            }
+        }
+    }
+    state.last_te_us = time_us;
+    state.edges++;
+
+    atomic_fetch_add_explicit(&sync->te_seq, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    sync->te = state;
+    atomic_fetch_add_explicit(&sync->te_seq, 1, memory_order_release);
+    atomic_fetch_add(&sync->te_count, 1);
+
+    return true;
+}
+
+bool esp_panel_te_sync_plan(esp_panel_te_sync_handle_t sync, int64_t now_us, uint16_t y_start, uint16_t y_end,
+                            esp_panel_te_sync_chunk_t *chunk)
+{
+    if ((sync == NULL) || (chunk == NULL) || (y_start > y_end) || (y_end >= sync->config.height)) {
+        return false;
+    }
+
+    te_state_t state = {};
+    read_te_state(sync, &state);
+    sync->chunks++;
+
+    int64_t period = state.period_ns;
+    int64_t now_rel = (now_us - state.last_te_us) * 1000;
+    if ((state.edges == 0) || (now_rel > EDGE_STALE_PERIODS * period)) {
+        sync->unsynced++;
+        chunk->y_end = y_end;
+        chunk->start_us = now_us;
+        return true;
+    }
+
+    /* All the times below are in nanoseconds and relative to the last TE edge */
+    int64_t line = period / (sync->config.height + sync->config.vblank_lines);
+    line = (line > 0) ? line : 1;
+    int64_t row_write = (sync->row_write_ns > 0) ? sync->row_write_ns : line;
+    int64_t porch = sync->config.vblank_lines * line;
+    int64_t margin = sync->config.margin_lines * line;
+    int64_t drift = (row_write > line) ? (row_write - line) : (line - row_write);
+
+    /**
+     * The time between writing a row and the scan line passing it drifts by `drift` per row, so the chunk is limited
+     * to keep the drift of its rows inside a single frame
+     */
+    int a = y_start;
+    int b = y_end;
+    int64_t room = period - 2 * margin - row_write;
+    if (drift > 0) {
+        int64_t max_rows = (room > 0) ? (room / drift + 1) : 1;
+        if (b - a + 1 > max_rows) {
+            /* Keep at least one aligned unit, even if it exceeds the limit */
+            int y_align = (sync->config.y_align > 0) ? sync->config.y_align : 1;
+            max_rows -= max_rows % y_align;
+            max_rows = (max_rows > 0) ? max_rows : y_align;
+            b = (b - a + 1 > max_rows) ? (a + max_rows - 1) : b;
+        }
+    }
+    int64_t span = drift * (b - a) + row_write;
+
+    /* Offset from the start of writing to the earliest "write - scan" time of the chunk rows */
+    int64_t first = -(porch + a * line);
+    int64_t last = (b - a) * row_write - (porch + b * line);
+    int64_t offset = (first < last) ? first : last;
+
+    /* Start now if the chunk fits in the current frame, otherwise wait for the scan line to pass it */
+    int64_t phase = (now_rel + offset - margin) % period;
+    phase = (phase < 0) ? (phase + period) : phase;
+    int64_t start = now_rel;
+    if (phase > period - span - 2 * margin) {
+        start += period - phase;
+    }
+
+    chunk->y_end = b;
+    chunk->start_us = state.last_te_us + (start + 999) / 1000;
+
+    return true;
+}
+
+bool esp_panel_te_sync_report(esp_panel_te_sync_handle_t sync, uint16_t rows, uint32_t duration_us)
+{
+    if ((sync == NULL) || (rows == 0)) {
+        return false;
+    }
+
+    int64_t sample_ns = (int64_t)duration_us * 1000 / rows;
+    if (sync->row_write_ns == 0) {
+        sync->row_write_ns = sample_ns;
+    } else {
+        sync->row_write_ns += (sample_ns - (int64_t)sync->row_write_ns) / 4;
+    }
+
+    return true;
+}
+
+bool esp_panel_te_sync_get_stats(esp_panel_te_sync_handle_t sync, esp_panel_te_sync_stats_t *stats, bool clear)
+{
+    if ((sync == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    te_state_t state = {};
+    read_te_state(sync, &state);
+    stats->te_count = clear ? atomic_exchange(&sync->te_count, 0) : atomic_load(&sync->te_count);
+    stats->missed_te = clear ? atomic_exchange(&sync->missed_te, 0) : atomic_load(&sync->missed_te);
+    stats->unsynced = sync->unsynced;
+    stats->chunks = sync->chunks;
+    stats->frame_period_us = state.period_ns / 1000;
+    stats->row_write_ns = sync->row_write_ns;
+    if (clear) {
+        sync->unsynced = 0;
+        sync->chunks = 0;
+    }
+
+    return true;
+}
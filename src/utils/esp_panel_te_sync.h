@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the tearing effect (TE) synchronization
+ *
+ */
+typedef struct {
+    uint16_t height;            /*!< Number of the rows scanned by the panel */
+    uint16_t vblank_lines;      /*!< Number of the blanking lines between the TE edge and the scan of the first row */
+    uint16_t margin_lines;      /*!< Margin kept between the writing and the scan line, in lines */
+    uint32_t frame_period_us;   /*!< Initial estimation of the TE period, `0` means 60 Hz. It is measured from the TE
+                                     edges later */
+    uint32_t row_write_ns;      /*!< Initial estimation of the time to write a row, `0` means unknown. It is measured
+                                     from the reported transfers later */
+    uint8_t y_align;            /*!< Alignment of the chunk height in rows, like `y_coord_align` of the LCD, `0` is
+                                     treated as `1` */
+} esp_panel_te_sync_config_t;
+
+/**
+ * @brief Default configuration of the TE synchronization
+ *
+ */
+#define ESP_PANEL_TE_SYNC_CONFIG_DEFAULT(lcd_height)    \
+    {                                                   \
+        .height = lcd_height,                           \
+        .vblank_lines = 8,                              \
+        .margin_lines = 2,                              \
+        .frame_period_us = 0,                           \
+        .row_write_ns = 0,                              \
+        .y_align = 1,                                   \
+    }
+
+/**
+ * @brief Counters and estimations of the TE synchronization
+ *
+ */
+typedef struct {
+    uint32_t te_count;          /*!< Number of the received TE edges */
+    uint32_t missed_te;         /*!< Number of the TE edges which are expected from the period but not received */
+    uint32_t unsynced;          /*!< Number of the chunks which are planned without a recent TE edge */
+    uint32_t chunks;            /*!< Number of the planned chunks */
+    uint32_t frame_period_us;   /*!< Current estimation of the TE period */
+    uint32_t row_write_ns;      /*!< Current estimation of the time to write a row */
+} esp_panel_te_sync_stats_t;
+
+/**
+ * @brief A chunk of rows planned to be written without being crossed by the scan line
+ *
+ */
+typedef struct {
+    uint16_t y_end;             /*!< Last row of the chunk (inclusive) */
+    int64_t start_us;           /*!< Time to start writing the chunk, in the same clock as the TE edges */
+} esp_panel_te_sync_chunk_t;
+
+typedef struct esp_panel_te_sync_t *esp_panel_te_sync_handle_t;
+
+/**
+ * @brief Create a TE synchronization
+ *
+ * @note  The panel is modeled as a scan line which starts `vblank_lines` after the TE edge and moves by a row every
+ *        `period / (height + vblank_lines)`, while the bus writes a row every `row_write_ns`. A chunk of rows is
+ *        planned to be written between two consecutive passes of the scan line, so it is never shown half written.
+ *        If the bus is faster than the scan, it writes just after the scan line (ahead of the next pass), otherwise it
+ *        writes behind the scan line, and large areas are split into chunks which can't be caught up
+ *
+ * @param config Pointer of the configuration
+ *
+ * @return
+ *      - NULL:   if fail
+ *      - others: the handle of the TE synchronization
+ */
+esp_panel_te_sync_handle_t esp_panel_te_sync_new(const esp_panel_te_sync_config_t *config);
+
+/**
+ * @brief Delete the TE synchronization
+ *
+ * @param sync Handle of the TE synchronization
+ */
+void esp_panel_te_sync_del(esp_panel_te_sync_handle_t sync);
+
+/**
+ * @brief Handle a TE edge, the period is measured and the missed edges are counted
+ *
+ * @note  This function is lock-free and can be called from an ISR
+ *
+ * @param sync    Handle of the TE synchronization
+ * @param time_us Time of the TE edge in microseconds
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_te_sync_on_te(esp_panel_te_sync_handle_t sync, int64_t time_us);
+
+/**
+ * @brief Plan the next chunk of the rows `[y_start, y_end]`, it starts from `y_start`
+ *
+ * @note  If no TE edge is received recently, the whole rows are planned to be written immediately
+ * @note  If the rows are split, the height of the chunk is a multiple of `y_align` and at least `y_align`, so the chunks
+ *        are aligned as long as `y_start` is
+ *
+ * @param sync    Handle of the TE synchronization
+ * @param now_us  Current time in microseconds
+ * @param y_start First row (inclusive)
+ * @param y_end   Last row (inclusive)
+ * @param chunk   Pointer to store the planned chunk
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_te_sync_plan(esp_panel_te_sync_handle_t sync, int64_t now_us, uint16_t y_start, uint16_t y_end,
+                            esp_panel_te_sync_chunk_t *chunk);
+
+/**
+ * @brief Report the duration of a finished transfer, which refines the estimation of the time to write a row
+ *
+ * @param sync        Handle of the TE synchronization
+ * @param rows        Number of the written rows
+ * @param duration_us Duration of the transfer in microseconds
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_te_sync_report(esp_panel_te_sync_handle_t sync, uint16_t rows, uint32_t duration_us);
+
+/**
+ * @brief Get the counters and estimations of the TE synchronization
+ *
+ * @param sync  Handle of the TE synchronization
+ * @param stats Pointer to store the counters
+ * @param clear Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_te_sync_get_stats(esp_panel_te_sync_handle_t sync, esp_panel_te_sync_stats_t *stats, bool clear);
+
+#ifdef __cplusplus
+}
+#endif
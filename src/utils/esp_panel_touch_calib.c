@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <string.h>
+#include "esp_panel_touch_calib.h"
+
+#define Q16_ONE                 (65536.0)
+#define BLOB_MAGIC              "TCAL"
+#define BLOB_VERSION            (1)
+#define BLOB_MATRIX_OFFSET      (8)
+#define BLOB_CRC_OFFSET         (ESP_PANEL_TOUCH_CALIB_BLOB_SIZE - 4)
+/* The points are taken as on a line if the determinant is this small relative to the spreads of the axes */
+#define DET_EPSILON             (1e-6)
+
+static uint32_t get_crc32(const uint8_t *data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+
+    return ~crc;
+}
+
+static void put_u32(uint8_t *buf, uint32_t value)
+{
+    for (int i = 0; i < 4; i++) {
+        buf[i] = (uint8_t)(value >> (i * 8));
+    }
+}
+
+static uint32_t get_u32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static bool to_q16(double value, int32_t *out)
+{
+    double q = round(value * Q16_ONE);
+    if ((q > INT32_MAX) || (q < -INT32_MAX)) {
+        return false;
+    }
+    *out = (int32_t)q;
+
+    return true;
+}
+
+static uint16_t map_coord(int64_t value, uint16_t max)
+{
+    value = (value + (1 << 15)) >> 16;
+
+    return (value < 0) ? 0 : ((value > max) ? max : (uint16_t)value);
+}
+
+bool esp_panel_touch_calib_solve(const esp_panel_touch_calib_point_t *points, uint8_t num,
+                                 esp_panel_touch_calib_t *calib)
+{
+    if ((points == NULL) || (num < 3) || (calib == NULL)) {
+        return false;
+    }
+
+    /* Center the points first, so the normal equations of `x = a * raw_x + b * raw_y + c` are reduced to 2x2 */
+    double mean_raw_x = 0, mean_raw_y = 0, mean_x = 0, mean_y = 0;
+    for (int i = 0; i < num; i++) {
+        mean_raw_x += points[i].raw_x;
+        mean_raw_y += points[i].raw_y;
+        mean_x += points[i].x;
+        mean_y += points[i].y;
+    }
+    mean_raw_x /= num;
+    mean_raw_y /= num;
+    mean_x /= num;
+    mean_y /= num;
+
+    double sxx = 0, sxy = 0, syy = 0, sxu = 0, syu = 0, sxv = 0, syv = 0;
+    for (int i = 0; i < num; i++) {
+        double dx = points[i].raw_x - mean_raw_x;
+        double dy = points[i].raw_y - mean_raw_y;
+        double du = points[i].x - mean_x;
+        double dv = points[i].y - mean_y;
+        sxx += dx * dx;
+        sxy += dx * dy;
+        syy += dy * dy;
+        sxu += dx * du;
+        syu += dy * du;
+        sxv += dx * dv;
+        syv += dy * dv;
+    }
+    double det = sxx * syy - sxy * sxy;
+    if ((det <= 0) || (det <= DET_EPSILON * sxx * syy)) {
+        return false;
+    }
+
+    double a = (sxu * syy - syu * sxy) / det;
+    double b = (syu * sxx - sxu * sxy) / det;
+    double c = mean_x - a * mean_raw_x - b * mean_raw_y;
+    double d = (sxv * syy - syv * sxy) / det;
+    double e = (syv * sxx - sxv * sxy) / det;
+    double f = mean_y - d * mean_raw_x - e * mean_raw_y;
+    esp_panel_touch_calib_t result = {};
+    if (!to_q16(a, &result.a) || !to_q16(b, &result.b) || !to_q16(c, &result.c) ||
+            !to_q16(d, &result.d) || !to_q16(e, &result.e) || !to_q16(f, &result.f)) {
+        return false;
+    }
+    *calib = result;
+
+    return true;
+}
+
+void esp_panel_touch_calib_apply(const esp_panel_touch_calib_t *calib, uint16_t *x, uint16_t *y, uint8_t num,
+                                 uint16_t x_max, uint16_t y_max)
+{
+    if ((calib == NULL) || (x == NULL) || (y == NULL)) {
+        return;
+    }
+
+    for (int i = 0; i < num; i++) {
+        int64_t raw_x = x[i];
+        int64_t raw_y = y[i];
+        x[i] = map_coord(calib->a * raw_x + calib->b * raw_y + calib->c, x_max);
+        y[i] = map_coord(calib->d * raw_x + calib->e * raw_y + calib->f, y_max);
+    }
+}
+
+size_t esp_panel_touch_calib_save(const esp_panel_touch_calib_t *calib, uint8_t *blob, size_t size)
+{
+    if ((calib == NULL) || (blob == NULL) || (size < ESP_PANEL_TOUCH_CALIB_BLOB_SIZE)) {
+        return 0;
+    }
+
+    const int32_t matrix[6] = {calib->a, calib->b, calib->c, calib->d, calib->e, calib->f};
+    memset(blob, 0, ESP_PANEL_TOUCH_CALIB_BLOB_SIZE);
+    memcpy(blob, BLOB_MAGIC, 4);
+    blob[4] = BLOB_VERSION;
+    for (int i = 0; i < 6; i++) {
+        put_u32(blob + BLOB_MATRIX_OFFSET + i * 4, (uint32_t)matrix[i]);
+    }
+    put_u32(blob + BLOB_CRC_OFFSET, get_crc32(blob, BLOB_CRC_OFFSET));
+
+    return ESP_PANEL_TOUCH_CALIB_BLOB_SIZE;
+}
+
+bool esp_panel_touch_calib_load(esp_panel_touch_calib_t *calib, const uint8_t *blob, size_t size)
+{
+    if ((calib == NULL) || (blob == NULL) || (size != ESP_PANEL_TOUCH_CALIB_BLOB_SIZE) ||
+            (memcmp(blob, BLOB_MAGIC, 4) != 0) || (blob[4] != BLOB_VERSION) ||
+            (get_u32(blob + BLOB_CRC_OFFSET) != get_crc32(blob, BLOB_CRC_OFFSET))) {
+        return false;
+    }
+
+    int32_t matrix[6];
+    for (int i = 0; i < 6; i++) {
+        matrix[i] = (int32_t)get_u32(blob + BLOB_MATRIX_OFFSET + i * 4);
+    }
+    calib->a = matrix[0];
+    calib->b = matrix[1];
+    calib->c = matrix[2];
+    calib->d = matrix[3];
+    calib->e = matrix[4];
+    calib->f = matrix[5];
+
+    return true;
+}
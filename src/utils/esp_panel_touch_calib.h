@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of the blob of a calibration: magic, version, the matrix and a CRC32, in little endian
+ *
+ */
+#define ESP_PANEL_TOUCH_CALIB_BLOB_SIZE     (36)
+
+/**
+ * @brief Affine calibration, which maps a raw point to the screen:
+ *
+ *        x = (a * raw_x + b * raw_y + c) / 65536
+ *        y = (d * raw_x + e * raw_y + f) / 65536
+ *
+ * @note  All the coefficients are in Q16, so the offset and the skew between the axes are corrected as well as the
+ *        scale, with integer math only
+ *
+ */
+typedef struct {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t d;
+    int32_t e;
+    int32_t f;
+} esp_panel_touch_calib_t;
+
+/**
+ * @brief Calibration which keeps the points unchanged
+ *
+ */
+#define ESP_PANEL_TOUCH_CALIB_IDENTITY()    \
+    {                                       \
+        .a = 1 << 16,                       \
+        .b = 0,                             \
+        .c = 0,                             \
+        .d = 0,                             \
+        .e = 1 << 16,                       \
+        .f = 0,                             \
+    }
+
+/**
+ * @brief A reference point, read while a target is shown on the screen
+ *
+ */
+typedef struct {
+    int32_t raw_x;      /*!< Point read from the touch device */
+    int32_t raw_y;
+    int32_t x;          /*!< Position of the target on the screen */
+    int32_t y;
+} esp_panel_touch_calib_point_t;
+
+/**
+ * @brief Solve the calibration from the reference points
+ *
+ * @note  Three points give the exact solution, more points give the least-squares one, which averages the noise of
+ *        the reads. The points should be spread over the screen, like near three corners
+ * @note  It's solved in `double` once, only the mapping of the points is in integer
+ *
+ * @param points Array of the points
+ * @param num    Number of the points, at least 3
+ * @param calib  Pointer of the calibration
+ *
+ * @return true if success, false if the arguments are invalid or the points are (nearly) on a line
+ */
+bool esp_panel_touch_calib_solve(const esp_panel_touch_calib_point_t *points, uint8_t num,
+                                 esp_panel_touch_calib_t *calib);
+
+/**
+ * @brief Map the points by the calibration, and clamp them into the screen
+ *
+ * @param calib Pointer of the calibration
+ * @param x     Array of the X coordinates, which are replaced
+ * @param y     Array of the Y coordinates, which are replaced
+ * @param num   Number of the points
+ * @param x_max Largest X coordinate after the mapping
+ * @param y_max Largest Y coordinate after the mapping
+ */
+void esp_panel_touch_calib_apply(const esp_panel_touch_calib_t *calib, uint16_t *x, uint16_t *y, uint8_t num,
+                                 uint16_t x_max, uint16_t y_max);
+
+/**
+ * @brief Save the calibration into a blob, which can be kept by the user like in NVS
+ *
+ * @param calib Pointer of the calibration
+ * @param blob  Buffer of the blob
+ * @param size  Size of the buffer, at least `ESP_PANEL_TOUCH_CALIB_BLOB_SIZE`
+ *
+ * @return Size of the blob, `0` if the arguments are invalid
+ */
+size_t esp_panel_touch_calib_save(const esp_panel_touch_calib_t *calib, uint8_t *blob, size_t size);
+
+/**
+ * @brief Restore the calibration from a blob saved by `esp_panel_touch_calib_save()`
+ *
+ * @param calib Pointer of the calibration, which is unchanged if failed
+ * @param blob  The blob
+ * @param size  Size of the blob
+ *
+ * @return true if success, false if the blob is not valid
+ */
+bool esp_panel_touch_calib_load(esp_panel_touch_calib_t *calib, const uint8_t *blob, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_panel_touch_filter.h"
+
+#define Q8_SHIFT                (8)
+#define Q16_ONE                 (1 << 16)
+/* 2 * pi * 65536 / 1e9, to get `2 * pi * fc * dt` in Q16 from the cutoff in mHz and the interval in us */
+#define TWO_PI_Q16_PER_MHZ_US   (411775ULL)
+#define INTERVAL_MAX_US         (1000000)
+
+/* Weight of the new input of a first-order low-pass filter: `alpha = 1 / (1 + 1 / (2 * pi * fc * dt))`, in Q16 */
+static uint32_t get_alpha(uint32_t cutoff_mhz, uint32_t interval_us)
+{
+    uint64_t r = (uint64_t)cutoff_mhz * interval_us * TWO_PI_Q16_PER_MHZ_US / 1000000000ULL;
+
+    return (uint32_t)((r << 16) / (r + Q16_ONE));
+}
+
+static int32_t low_pass(int32_t value, int32_t input, uint32_t alpha)
+{
+    return value + (int32_t)((((int64_t)input - value) * alpha + (1 << 15)) >> 16);
+}
+
+static int32_t get_median(const int32_t *history, uint8_t history_num, uint8_t history_pos, uint8_t window)
+{
+    /* Use the newest odd number of the inputs before the window is filled */
+    uint8_t num = (history_num & 1) ? history_num : (history_num - 1);
+    int32_t sorted[ESP_PANEL_TOUCH_FILTER_MEDIAN_MAX];
+
+    for (int i = 0; i < num; i++) {
+        int32_t v = history[(history_pos + window - 1 - i) % window];
+        int j = i;
+        for (; (j > 0) && (sorted[j - 1] > v); j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+
+    return sorted[num / 2];
+}
+
+static void run_stage(const esp_panel_touch_filter_stage_t *stage, esp_panel_touch_filter_state_t *state,
+                      bool is_new, uint32_t interval_us, int32_t value[2])
+{
+    if (is_new) {
+        memset(state, 0, sizeof(esp_panel_touch_filter_state_t));
+    }
+
+    switch (stage->type) {
+    case ESP_PANEL_TOUCH_FILTER_MEDIAN:
+        for (int i = 0; i < 2; i++) {
+            state->history[i][state->history_pos] = value[i];
+        }
+        state->history_pos = (state->history_pos + 1) % stage->window;
+        if (state->history_num < stage->window) {
+            state->history_num++;
+        }
+        for (int i = 0; i < 2; i++) {
+            value[i] = get_median(state->history[i], state->history_num, state->history_pos, stage->window);
+        }
+        break;
+    case ESP_PANEL_TOUCH_FILTER_EMA: {
+        uint32_t alpha = get_alpha(stage->cutoff_mhz, interval_us);
+        for (int i = 0; i < 2; i++) {
+            state->value[i] = is_new ? value[i] : low_pass(state->value[i], value[i], alpha);
+            value[i] = state->value[i];
+        }
+        break;
+    }
+    case ESP_PANEL_TOUCH_FILTER_ONE_EURO: {
+        uint32_t d_alpha = get_alpha(stage->d_cutoff_mhz, interval_us);
+        for (int i = 0; i < 2; i++) {
+            if (is_new) {
+                state->value[i] = value[i];
+                continue;
+            }
+            /* The speed is taken from the last output, and smoothed before it raises the cutoff */
+            int64_t speed = (int64_t)(value[i] - state->value[i]) * 1000000 / interval_us;
+            speed = (speed > INT32_MAX) ? INT32_MAX : ((speed < -INT32_MAX) ? -INT32_MAX : speed);
+            state->speed[i] = low_pass(state->speed[i], (int32_t)speed, d_alpha);
+            uint32_t speed_abs = (state->speed[i] < 0) ? -state->speed[i] : state->speed[i];
+            uint64_t cutoff_mhz = stage->cutoff_mhz +
+                                  ((uint64_t)stage->beta_uhz * speed_abs >> Q8_SHIFT) / 1000;
+            cutoff_mhz = (cutoff_mhz > UINT32_MAX) ? UINT32_MAX : cutoff_mhz;
+            state->value[i] = low_pass(state->value[i], value[i], get_alpha((uint32_t)cutoff_mhz, interval_us));
+            value[i] = state->value[i];
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static uint16_t to_coord(int32_t value)
+{
+    value = (value + (1 << (Q8_SHIFT - 1))) >> Q8_SHIFT;
+
+    return (value < 0) ? 0 : ((value > UINT16_MAX) ? UINT16_MAX : value);
+}
+
+/* Find the nearest active track which is not matched yet, `-1` means none */
+static int find_track(const esp_panel_touch_filter_t *filter, uint32_t matched, uint16_t x, uint16_t y)
+{
+    int index = -1;
+    uint32_t min_distance = UINT32_MAX;
+
+    for (int i = 0; i < ESP_PANEL_TOUCH_FILTER_POINTS_MAX; i++) {
+        const esp_panel_touch_filter_track_t *track = &filter->tracks[i];
+        if (!track->is_active || (matched & (1 << i))) {
+            continue;
+        }
+        uint32_t distance = abs((int)x - track->x) + abs((int)y - track->y);
+        if ((distance < min_distance) && ((filter->track_distance == 0) || (distance <= filter->track_distance))) {
+            min_distance = distance;
+            index = i;
+        }
+    }
+
+    return index;
+}
+
+bool esp_panel_touch_filter_init(esp_panel_touch_filter_t *filter, const esp_panel_touch_filter_config_t *config)
+{
+    if ((filter == NULL) || (config == NULL) || ((config->stages == NULL) && (config->num_stages > 0)) ||
+            (config->num_stages > ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX)) {
+        return false;
+    }
+    for (int i = 0; i < config->num_stages; i++) {
+        const esp_panel_touch_filter_stage_t *stage = &config->stages[i];
+        if ((stage->type > ESP_PANEL_TOUCH_FILTER_ONE_EURO) ||
+                ((stage->type == ESP_PANEL_TOUCH_FILTER_MEDIAN) &&
+                 (!(stage->window & 1) || (stage->window > ESP_PANEL_TOUCH_FILTER_MEDIAN_MAX)))) {
+            return false;
+        }
+    }
+
+    memset(filter, 0, sizeof(esp_panel_touch_filter_t));
+    if (config->num_stages > 0) {
+        memcpy(filter->stages, config->stages, config->num_stages * sizeof(esp_panel_touch_filter_stage_t));
+    }
+    filter->num_stages = config->num_stages;
+    filter->track_distance = config->track_distance;
+
+    return true;
+}
+
+bool esp_panel_touch_filter_process(esp_panel_touch_filter_t *filter, int64_t timestamp_us, uint16_t *x, uint16_t *y,
+                                    uint8_t num)
+{
+    if ((filter == NULL) || ((num > 0) && ((x == NULL) || (y == NULL)))) {
+        return false;
+    }
+
+    uint32_t matched = 0;
+    for (int i = 0; i < num; i++) {
+        int index = find_track(filter, matched, x[i], y[i]);
+        bool is_new = (index < 0);
+        if (is_new) {
+            for (index = 0; (index < ESP_PANEL_TOUCH_FILTER_POINTS_MAX) &&
+                    (filter->tracks[index].is_active || (matched & (1 << index))); index++) {
+            }
+            /* No track left, pass the point through */
+            if (index == ESP_PANEL_TOUCH_FILTER_POINTS_MAX) {
+                continue;
+            }
+        }
+        matched |= 1 << index;
+
+        esp_panel_touch_filter_track_t *track = &filter->tracks[index];
+        int64_t interval_us = is_new ? 0 : (timestamp_us - track->timestamp_us);
+        interval_us = (interval_us < 1) ? 1 : ((interval_us > INTERVAL_MAX_US) ? INTERVAL_MAX_US : interval_us);
+        track->x = x[i];
+        track->y = y[i];
+        track->timestamp_us = timestamp_us;
+        int32_t value[2] = {(int32_t)x[i] << Q8_SHIFT, (int32_t)y[i] << Q8_SHIFT};
+        for (int j = 0; j < filter->num_stages; j++) {
+            run_stage(&filter->stages[j], &track->states[j], is_new, (uint32_t)interval_us, value);
+        }
+        x[i] = to_coord(value[0]);
+        y[i] = to_coord(value[1]);
+    }
+
+    /* The tracks which are not matched are released */
+    for (int i = 0; i < ESP_PANEL_TOUCH_FILTER_POINTS_MAX; i++) {
+        filter->tracks[i].is_active = (matched & (1 << i)) != 0;
+    }
+
+    return true;
+}
+
+void esp_panel_touch_filter_reset(esp_panel_touch_filter_t *filter)
+{
+    if (filter == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < ESP_PANEL_TOUCH_FILTER_POINTS_MAX; i++) {
+        filter->tracks[i].is_active = false;
+    }
+}
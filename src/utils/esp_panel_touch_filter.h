@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of the stages of a filter
+ *
+ */
+#define ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX    (4)
+
+/**
+ * @brief Maximum number of the points tracked by a filter, the other points are passed through
+ *
+ */
+#define ESP_PANEL_TOUCH_FILTER_POINTS_MAX       (5)
+
+/**
+ * @brief Maximum window of the median stage
+ *
+ */
+#define ESP_PANEL_TOUCH_FILTER_MEDIAN_MAX       (5)
+
+/**
+ * @brief Type of a filter stage
+ *
+ */
+typedef enum {
+    ESP_PANEL_TOUCH_FILTER_MEDIAN = 0,  /*!< Median of the last `window` samples, which removes the spikes. It delays
+                                             the points by `(window - 1) / 2` samples */
+    ESP_PANEL_TOUCH_FILTER_EMA,         /*!< Exponential moving average with a fixed cutoff frequency */
+    ESP_PANEL_TOUCH_FILTER_ONE_EURO,    /*!< One-Euro filter, whose cutoff frequency rises with the speed, so it smooths
+                                             the holding finger and follows the moving one */
+} esp_panel_touch_filter_type_t;
+
+/**
+ * @brief Configuration of a filter stage
+ *
+ * @note  The cutoff frequencies make the smoothing independent of the sample rate, since the weights are calculated
+ *        from the intervals between the samples
+ *
+ */
+typedef struct {
+    esp_panel_touch_filter_type_t type;
+    uint8_t window;             /*!< MEDIAN: number of the samples, an odd number up to
+                                     `ESP_PANEL_TOUCH_FILTER_MEDIAN_MAX` */
+    uint32_t cutoff_mhz;        /*!< EMA: cutoff frequency. ONE_EURO: cutoff frequency at rest. In mHz */
+    uint32_t beta_uhz;          /*!< ONE_EURO: increase of the cutoff frequency per 1 px/s of the speed, in uHz */
+    uint32_t d_cutoff_mhz;      /*!< ONE_EURO: cutoff frequency of the speed, in mHz */
+} esp_panel_touch_filter_stage_t;
+
+/**
+ * @brief Macros to create the stages
+ *
+ */
+#define ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(_window)        \
+    {                                                       \
+        .type = ESP_PANEL_TOUCH_FILTER_MEDIAN,              \
+        .window = _window,                                  \
+        .cutoff_mhz = 0,                                    \
+        .beta_uhz = 0,                                      \
+        .d_cutoff_mhz = 0,                                  \
+    }
+#define ESP_PANEL_TOUCH_FILTER_STAGE_EMA(_cutoff_mhz)       \
+    {                                                       \
+        .type = ESP_PANEL_TOUCH_FILTER_EMA,                 \
+        .window = 0,                                        \
+        .cutoff_mhz = _cutoff_mhz,                          \
+        .beta_uhz = 0,                                      \
+        .d_cutoff_mhz = 0,                                  \
+    }
+#define ESP_PANEL_TOUCH_FILTER_STAGE_ONE_EURO(_min_cutoff_mhz, _beta_uhz, _d_cutoff_mhz)    \
+    {                                                       \
+        .type = ESP_PANEL_TOUCH_FILTER_ONE_EURO,            \
+        .window = 0,                                        \
+        .cutoff_mhz = _min_cutoff_mhz,                      \
+        .beta_uhz = _beta_uhz,                              \
+        .d_cutoff_mhz = _d_cutoff_mhz,                      \
+    }
+
+/**
+ * @brief State of a stage for a tracked point, the values are Q8 pixels
+ *
+ */
+typedef struct {
+    int32_t value[2];           /*!< Filtered X and Y */
+    int32_t speed[2];           /*!< Filtered speed of X and Y in Q8 px/s, only used by ONE_EURO */
+    int32_t history[2][ESP_PANEL_TOUCH_FILTER_MEDIAN_MAX];  /*!< Last inputs, only used by MEDIAN */
+    uint8_t history_num;
+    uint8_t history_pos;
+} esp_panel_touch_filter_state_t;
+
+/**
+ * @brief A tracked point
+ *
+ */
+typedef struct {
+    bool is_active;
+    uint16_t x;                 /*!< Last input X, used to match the points of the next sample */
+    uint16_t y;                 /*!< Last input Y */
+    int64_t timestamp_us;       /*!< Time of the last sample */
+    esp_panel_touch_filter_state_t states[ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX];
+} esp_panel_touch_filter_track_t;
+
+/**
+ * @brief Configuration of a filter
+ *
+ */
+typedef struct {
+    const esp_panel_touch_filter_stage_t *stages;   /*!< Stages applied in order */
+    uint8_t num_stages;
+    uint16_t track_distance;    /*!< A point farther than it from all the tracked points starts a new track instead of
+                                     continuing the nearest one, `0` means no limit */
+} esp_panel_touch_filter_config_t;
+
+/**
+ * @brief Filter of the touch points, which runs the stages on every tracked point
+ *
+ * @note  The points of a sample are matched with the tracked points by the nearest distance, since the drivers don't
+ *        report the track IDs. A new point starts without smoothing, and a released point is forgotten
+ *
+ */
+typedef struct {
+    esp_panel_touch_filter_stage_t stages[ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX];
+    uint8_t num_stages;
+    uint16_t track_distance;
+    esp_panel_touch_filter_track_t tracks[ESP_PANEL_TOUCH_FILTER_POINTS_MAX];
+} esp_panel_touch_filter_t;
+
+/**
+ * @brief Initialize the filter
+ *
+ * @param filter Pointer of the filter
+ * @param config Pointer of the configuration, the stages are copied
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_touch_filter_init(esp_panel_touch_filter_t *filter, const esp_panel_touch_filter_config_t *config);
+
+/**
+ * @brief Filter the points of a sample in place
+ *
+ * @note  It can be called from `process_coordinates` of `esp_lcd_touch_config_t`, which has the same arrays
+ *
+ * @param filter       Pointer of the filter
+ * @param timestamp_us Time when the sample is read
+ * @param x            Array of X
+ * @param y            Array of Y
+ * @param num          Number of the points, `0` means released
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_touch_filter_process(esp_panel_touch_filter_t *filter, int64_t timestamp_us, uint16_t *x, uint16_t *y,
+                                    uint8_t num);
+
+/**
+ * @brief Forget all the tracked points
+ *
+ * @param filter Pointer of the filter
+ */
+void esp_panel_touch_filter_reset(esp_panel_touch_filter_t *filter);
+
+#ifdef __cplusplus
+}
+#endif
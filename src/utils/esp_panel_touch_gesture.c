@@ -0,0 +1,495 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_panel_touch_gesture.h"
+
+#define FINGERS_MAX         (ESP_PANEL_TOUCH_RING_POINTS_MAX)
+#define ANGLE_HALF_MDEG     (180000)
+#define ANGLE_FULL_MDEG     (360000)
+#define CORDIC_SHIFT        (8)
+
+typedef struct {
+    esp_panel_touch_gesture_event_t *events;
+    int max_events;
+    int num;
+} event_list_t;
+
+/* atan(2^-i) in millidegrees */
+static const int32_t cordic_angles_mdeg[] = {
+    45000, 26565, 14036, 7125, 3576, 1790, 895, 448, 224, 112, 56, 28, 14, 7, 3, 2,
+};
+
+/* Angle of the vector in millidegrees (-180000, 180000], by the CORDIC in the vectoring mode */
+static int32_t get_angle_mdeg(int32_t x, int32_t y)
+{
+    int32_t angle = 0;
+
+    if ((x == 0) && (y == 0)) {
+        return 0;
+    }
+    /* Turn the left half to the right half first, since the CORDIC only converges within 90 degrees */
+    if (x < 0) {
+        angle = (y >= 0) ? ANGLE_HALF_MDEG : -ANGLE_HALF_MDEG;
+        x = -x;
+        y = -y;
+    }
+    /* Scale by multiplying, since `y` may be negative here */
+    x *= 1 << CORDIC_SHIFT;
+    y *= 1 << CORDIC_SHIFT;
+    for (int i = 0; i < (int)(sizeof(cordic_angles_mdeg) / sizeof(cordic_angles_mdeg[0])); i++) {
+        int32_t dx = x >> i;
+        int32_t dy = y >> i;
+        if (y > 0) {
+            x += dy;
+            y -= dx;
+            angle += cordic_angles_mdeg[i];
+        } else {
+            x -= dy;
+            y += dx;
+            angle -= cordic_angles_mdeg[i];
+        }
+    }
+
+    return (angle <= -ANGLE_HALF_MDEG) ? (angle + ANGLE_FULL_MDEG) : angle;
+}
+
+static uint32_t get_sqrt(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+static uint32_t get_distance(int32_t dx, int32_t dy)
+{
+    return get_sqrt((uint64_t)((int64_t)dx * dx + (int64_t)dy * dy));
+}
+
+static esp_panel_touch_gesture_event_t *add_event(event_list_t *list, esp_panel_touch_gesture_type_t type,
+        int64_t timestamp_us, uint16_t x, uint16_t y)
+{
+    if (list->num >= list->max_events) {
+        return NULL;
+    }
+
+    esp_panel_touch_gesture_event_t *event = &list->events[list->num++];
+    memset(event, 0, sizeof(esp_panel_touch_gesture_event_t));
+    event->type = type;
+    event->phase = ESP_PANEL_TOUCH_GESTURE_PHASE_END;
+    event->timestamp_us = timestamp_us;
+    event->x = x;
+    event->y = y;
+
+    return event;
+}
+
+static bool is_ms_passed(int64_t from_us, int64_t to_us, uint16_t ms)
+{
+    return (to_us - from_us) > (int64_t)ms * 1000;
+}
+
+static uint16_t get_last_x(const esp_panel_touch_gesture_finger_t *finger)
+{
+    return finger->history[finger->history_num - 1].x;
+}
+
+static uint16_t get_last_y(const esp_panel_touch_gesture_finger_t *finger)
+{
+    return finger->history[finger->history_num - 1].y;
+}
+
+static void push_history(esp_panel_touch_gesture_finger_t *finger, uint16_t x, uint16_t y, int64_t timestamp_us)
+{
+    if (finger->history_num == ESP_PANEL_TOUCH_GESTURE_HISTORY_NUM) {
+        memmove(&finger->history[0], &finger->history[1], sizeof(finger->history[0]) * (finger->history_num - 1));
+        finger->history_num--;
+    }
+    finger->history[finger->history_num].x = x;
+    finger->history[finger->history_num].y = y;
+    finger->history[finger->history_num].timestamp_us = timestamp_us;
+    finger->history_num++;
+}
+
+/* Report the pending tap, unless the only finger may still be its second tap */
+static void update_pending_tap(esp_panel_touch_gesture_t *gesture, int64_t now_us, event_list_t *list)
+{
+    if (!gesture->flags.is_pending) {
+        return;
+    }
+
+    bool is_second_tap = false;
+    if ((gesture->fingers_num == 1) && (gesture->fingers_max == 1)) {
+        for (int i = 0; i < FINGERS_MAX; i++) {
+            const esp_panel_touch_gesture_finger_t *finger = &gesture->fingers[i];
+            if (finger->state != ESP_PANEL_TOUCH_GESTURE_FINGER_UP) {
+                is_second_tap = (finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_DOWN) &&
+                                !is_ms_passed(gesture->tap.timestamp_us, finger->start_us, gesture->config.double_tap_ms);
+                break;
+            }
+        }
+    }
+    if (is_second_tap || ((gesture->fingers_num == 0) &&
+                          !is_ms_passed(gesture->tap.timestamp_us, now_us, gesture->config.double_tap_ms))) {
+        return;
+    }
+
+    add_event(list, ESP_PANEL_TOUCH_GESTURE_TAP, gesture->tap.timestamp_us, gesture->tap.x, gesture->tap.y);
+    gesture->flags.is_pending = 0;
+}
+
+static void update_long_press(esp_panel_touch_gesture_t *gesture, int64_t now_us, event_list_t *list)
+{
+    if ((gesture->config.long_press_ms == 0) || (gesture->fingers_max != 1)) {
+        return;
+    }
+
+    for (int i = 0; i < FINGERS_MAX; i++) {
+        esp_panel_touch_gesture_finger_t *finger = &gesture->fingers[i];
+        if ((finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_DOWN) &&
+                ((now_us - finger->start_us) >= (int64_t)gesture->config.long_press_ms * 1000)) {
+            finger->state = ESP_PANEL_TOUCH_GESTURE_FINGER_LONG_PRESSED;
+            update_pending_tap(gesture, now_us, list);
+            add_event(list, ESP_PANEL_TOUCH_GESTURE_LONG_PRESS, now_us, get_last_x(finger), get_last_y(finger));
+        }
+    }
+}
+
+static void release_tap(esp_panel_touch_gesture_t *gesture, const esp_panel_touch_gesture_finger_t *finger,
+                        int64_t now_us, event_list_t *list)
+{
+    uint16_t x = get_last_x(finger);
+    uint16_t y = get_last_y(finger);
+
+    if (gesture->config.double_tap_ms == 0) {
+        add_event(list, ESP_PANEL_TOUCH_GESTURE_TAP, now_us, x, y);
+        return;
+    }
+    if (gesture->flags.is_pending) {
+        if (get_distance(x - gesture->tap.x, y - gesture->tap.y) <= gesture->config.double_tap_slop_px) {
+            add_event(list, ESP_PANEL_TOUCH_GESTURE_DOUBLE_TAP, now_us, x, y);
+            gesture->flags.is_pending = 0;
+            return;
+        }
+        /* Too far for a double tap, so the previous one is a tap */
+        add_event(list, ESP_PANEL_TOUCH_GESTURE_TAP, gesture->tap.timestamp_us, gesture->tap.x, gesture->tap.y);
+    }
+    gesture->flags.is_pending = 1;
+    gesture->tap.x = x;
+    gesture->tap.y = y;
+    gesture->tap.timestamp_us = now_us;
+}
+
+static void release_swipe(esp_panel_touch_gesture_t *gesture, const esp_panel_touch_gesture_finger_t *finger,
+                          int64_t now_us, event_list_t *list)
+{
+    const esp_panel_touch_gesture_config_t *config = &gesture->config;
+    int32_t distance_x = get_last_x(finger) - finger->start_x;
+    int32_t distance_y = get_last_y(finger) - finger->start_y;
+    int32_t velocity_x = 0;
+    int32_t velocity_y = 0;
+    int64_t interval_us = finger->history[finger->history_num - 1].timestamp_us - finger->history[0].timestamp_us;
+
+    if (interval_us > 0) {
+        velocity_x = (int32_t)((get_last_x(finger) - finger->history[0].x) * 1000000LL / interval_us);
+        velocity_y = (int32_t)((get_last_y(finger) - finger->history[0].y) * 1000000LL / interval_us);
+    }
+    if ((get_distance(distance_x, distance_y) < config->swipe_min_px) ||
+            (get_distance(velocity_x, velocity_y) < config->swipe_min_speed)) {
+        return;
+    }
+
+    esp_panel_touch_gesture_event_t *event = add_event(list, ESP_PANEL_TOUCH_GESTURE_SWIPE, now_us, finger->start_x,
+            finger->start_y);
+    if (event == NULL) {
+        return;
+    }
+    if (abs(distance_x) >= abs(distance_y)) {
+        event->direction = (distance_x < 0) ? ESP_PANEL_TOUCH_GESTURE_DIR_LEFT : ESP_PANEL_TOUCH_GESTURE_DIR_RIGHT;
+    } else {
+        event->direction = (distance_y < 0) ? ESP_PANEL_TOUCH_GESTURE_DIR_UP : ESP_PANEL_TOUCH_GESTURE_DIR_DOWN;
+    }
+    event->distance_x = distance_x;
+    event->distance_y = distance_y;
+    event->velocity_x = velocity_x;
+    event->velocity_y = velocity_y;
+}
+
+static void get_pair(const esp_panel_touch_gesture_t *gesture, uint32_t *distance, int32_t *angle_mdeg, uint16_t *x,
+                     uint16_t *y)
+{
+    const esp_panel_touch_gesture_finger_t *first = &gesture->fingers[gesture->pair.index[0]];
+    const esp_panel_touch_gesture_finger_t *second = &gesture->fingers[gesture->pair.index[1]];
+    int32_t dx = get_last_x(second) - get_last_x(first);
+    int32_t dy = get_last_y(second) - get_last_y(first);
+
+    *distance = get_distance(dx, dy);
+    *angle_mdeg = get_angle_mdeg(dx, dy);
+    *x = (get_last_x(first) + get_last_x(second)) / 2;
+    *y = (get_last_y(first) + get_last_y(second)) / 2;
+}
+
+static void end_pair(esp_panel_touch_gesture_t *gesture, int64_t now_us, event_list_t *list)
+{
+    esp_panel_touch_gesture_event_t *event = NULL;
+
+    if (gesture->flags.is_pinching) {
+        event = add_event(list, ESP_PANEL_TOUCH_GESTURE_PINCH, now_us, gesture->pair.x, gesture->pair.y);
+        if (event != NULL) {
+            event->scale_q16 = gesture->pair.scale_q16;
+        }
+    }
+    if (gesture->flags.is_rotating) {
+        event = add_event(list, ESP_PANEL_TOUCH_GESTURE_ROTATE, now_us, gesture->pair.x, gesture->pair.y);
+        if (event != NULL) {
+            event->angle_mdeg = gesture->pair.angle_mdeg;
+        }
+    }
+    gesture->flags.is_paired = 0;
+    gesture->flags.is_pinching = 0;
+    gesture->flags.is_rotating = 0;
+}
+
+static void update_pair(esp_panel_touch_gesture_t *gesture, int64_t now_us, event_list_t *list)
+{
+    uint32_t distance = 0;
+    int32_t angle_mdeg = 0;
+    uint16_t x = 0;
+    uint16_t y = 0;
+
+    if (!gesture->flags.is_paired) {
+        if (gesture->fingers_num < 2) {
+            return;
+        }
+        /* Pair the first two fingers */
+        for (int i = 0, num = 0; (i < FINGERS_MAX) && (num < 2); i++) {
+            if (gesture->fingers[i].state != ESP_PANEL_TOUCH_GESTURE_FINGER_UP) {
+                gesture->pair.index[num++] = i;
+            }
+        }
+        get_pair(gesture, &distance, &angle_mdeg, &x, &y);
+        gesture->pair.start_distance = (distance > 0) ? distance : 1;
+        gesture->pair.start_angle_mdeg = angle_mdeg;
+        gesture->pair.scale_q16 = 1 << 16;
+        gesture->pair.angle_mdeg = 0;
+        gesture->pair.x = x;
+        gesture->pair.y = y;
+        gesture->flags.is_paired = 1;
+        return;
+    }
+
+    get_pair(gesture, &distance, &angle_mdeg, &x, &y);
+    uint32_t scale_q16 = (uint32_t)(((uint64_t)distance << 16) / gesture->pair.start_distance);
+    int32_t turn_mdeg = angle_mdeg - gesture->pair.start_angle_mdeg;
+    turn_mdeg += (turn_mdeg > ANGLE_HALF_MDEG) ? -ANGLE_FULL_MDEG :
+                 ((turn_mdeg <= -ANGLE_HALF_MDEG) ? ANGLE_FULL_MDEG : 0);
+    bool is_moved = (x != gesture->pair.x) || (y != gesture->pair.y);
+    gesture->pair.x = x;
+    gesture->pair.y = y;
+
+    esp_panel_touch_gesture_event_t *event = NULL;
+    if (gesture->flags.is_pinching ? ((scale_q16 != gesture->pair.scale_q16) || is_moved) :
+            ((uint32_t)abs((int32_t)distance - (int32_t)gesture->pair.start_distance) >= gesture->config.pinch_min_px)) {
+        event = add_event(list, ESP_PANEL_TOUCH_GESTURE_PINCH, now_us, x, y);
+        if (event != NULL) {
+            event->phase = gesture->flags.is_pinching ? ESP_PANEL_TOUCH_GESTURE_PHASE_UPDATE :
+                           ESP_PANEL_TOUCH_GESTURE_PHASE_BEGIN;
+            event->scale_q16 = scale_q16;
+        }
+        gesture->pair.scale_q16 = scale_q16;
+        gesture->flags.is_pinching = 1;
+    }
+    if (gesture->flags.is_rotating ? ((turn_mdeg != gesture->pair.angle_mdeg) || is_moved) :
+            (abs(turn_mdeg) >= gesture->config.rotate_min_mdeg)) {
+        event = add_event(list, ESP_PANEL_TOUCH_GESTURE_ROTATE, now_us, x, y);
+        if (event != NULL) {
+            event->phase = gesture->flags.is_rotating ? ESP_PANEL_TOUCH_GESTURE_PHASE_UPDATE :
+                           ESP_PANEL_TOUCH_GESTURE_PHASE_BEGIN;
+            event->angle_mdeg = turn_mdeg;
+        }
+        gesture->pair.angle_mdeg = turn_mdeg;
+        gesture->flags.is_rotating = 1;
+    }
+}
+
+/* Find the nearest touched finger which is not matched yet, `-1` means none */
+static int find_finger(const esp_panel_touch_gesture_t *gesture, uint32_t matched, uint16_t x, uint16_t y)
+{
+    int index = -1;
+    uint32_t min_distance = UINT32_MAX;
+
+    for (int i = 0; i < FINGERS_MAX; i++) {
+        const esp_panel_touch_gesture_finger_t *finger = &gesture->fingers[i];
+        if ((finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_UP) || (matched & (1 << i))) {
+            continue;
+        }
+        uint32_t distance = abs((int)x - get_last_x(finger)) + abs((int)y - get_last_y(finger));
+        if (distance < min_distance) {
+            min_distance = distance;
+            index = i;
+        }
+    }
+
+    return index;
+}
+
+bool esp_panel_touch_gesture_init(esp_panel_touch_gesture_t *gesture, const esp_panel_touch_gesture_config_t *config)
+{
+    const esp_panel_touch_gesture_config_t default_config = ESP_PANEL_TOUCH_GESTURE_CONFIG_DEFAULT();
+
+    if (gesture == NULL) {
+        return false;
+    }
+
+    memset(gesture, 0, sizeof(esp_panel_touch_gesture_t));
+    gesture->config = (config == NULL) ? default_config : *config;
+
+    return true;
+}
+
+int esp_panel_touch_gesture_process(esp_panel_touch_gesture_t *gesture, const esp_panel_touch_sample_t *sample,
+                                    esp_panel_touch_gesture_event_t *events, int max_events)
+{
+    if ((gesture == NULL) || (sample == NULL) || ((events == NULL) && (max_events > 0))) {
+        return -1;
+    }
+
+    event_list_t list = {
+        .events = events,
+        .max_events = max_events,
+        .num = 0,
+    };
+    int64_t now_us = sample->timestamp_us;
+    uint8_t points_num = (sample->points_num > FINGERS_MAX) ? FINGERS_MAX : sample->points_num;
+    uint32_t matched = 0;
+    int indexes[FINGERS_MAX];
+
+    update_pending_tap(gesture, now_us, &list);
+
+    /* Move the touched fingers */
+    for (int i = 0; i < points_num; i++) {
+        const esp_panel_touch_ring_point_t *point = &sample->points[i];
+        indexes[i] = find_finger(gesture, matched, point->x, point->y);
+        if (indexes[i] < 0) {
+            continue;
+        }
+        matched |= 1 << indexes[i];
+
+        esp_panel_touch_gesture_finger_t *finger = &gesture->fingers[indexes[i]];
+        push_history(finger, point->x, point->y, now_us);
+        if ((finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_DOWN) &&
+                (get_distance(point->x - finger->start_x, point->y - finger->start_y) > gesture->config.tap_slop_px)) {
+            finger->state = ESP_PANEL_TOUCH_GESTURE_FINGER_MOVED;
+        }
+    }
+    update_pending_tap(gesture, now_us, &list);
+    update_long_press(gesture, now_us, &list);
+
+    /* Release the fingers which are not in the sample */
+    for (int i = 0; i < FINGERS_MAX; i++) {
+        esp_panel_touch_gesture_finger_t *finger = &gesture->fingers[i];
+        if ((finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_UP) || (matched & (1 << i))) {
+            continue;
+        }
+        if (gesture->flags.is_paired && ((gesture->pair.index[0] == i) || (gesture->pair.index[1] == i))) {
+            end_pair(gesture, now_us, &list);
+        }
+        if ((finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_DOWN) &&
+                !is_ms_passed(finger->start_us, now_us, gesture->config.tap_max_ms)) {
+            release_tap(gesture, finger, now_us, &list);
+        } else if (finger->state == ESP_PANEL_TOUCH_GESTURE_FINGER_MOVED) {
+            release_swipe(gesture, finger, now_us, &list);
+        }
+        finger->state = ESP_PANEL_TOUCH_GESTURE_FINGER_UP;
+        gesture->fingers_num--;
+    }
+
+    /* Touch the new fingers */
+    for (int i = 0; i < points_num; i++) {
+        if (indexes[i] >= 0) {
+            continue;
+        }
+        int index = 0;
+        for (; (index < FINGERS_MAX) && (gesture->fingers[index].state != ESP_PANEL_TOUCH_GESTURE_FINGER_UP); index++) {
+        }
+        if (index == FINGERS_MAX) {
+            break;
+        }
+
+        esp_panel_touch_gesture_finger_t *finger = &gesture->fingers[index];
+        memset(finger, 0, sizeof(esp_panel_touch_gesture_finger_t));
+        finger->state = ESP_PANEL_TOUCH_GESTURE_FINGER_DOWN;
+        finger->start_x = sample->points[i].x;
+        finger->start_y = sample->points[i].y;
+        finger->start_us = now_us;
+        push_history(finger, finger->start_x, finger->start_y, now_us);
+        gesture->fingers_max = (gesture->fingers_num == 0) ? 0 : gesture->fingers_max;
+        gesture->fingers_num++;
+        if (gesture->fingers_num > gesture->fingers_max) {
+            gesture->fingers_max = gesture->fingers_num;
+        }
+    }
+    /* No single-finger gesture with more fingers */
+    if (gesture->fingers_max > 1) {
+        for (int i = 0; i < FINGERS_MAX; i++) {
+            if (gesture->fingers[i].state != ESP_PANEL_TOUCH_GESTURE_FINGER_UP) {
+                gesture->fingers[i].state = ESP_PANEL_TOUCH_GESTURE_FINGER_CANCELED;
+            }
+        }
+    }
+
+    update_pair(gesture, now_us, &list);
+    update_pending_tap(gesture, now_us, &list);
+    gesture->last_us = now_us;
+
+    return list.num;
+}
+
+int esp_panel_touch_gesture_tick(esp_panel_touch_gesture_t *gesture, int64_t now_us,
+                                 esp_panel_touch_gesture_event_t *events, int max_events)
+{
+    if ((gesture == NULL) || ((events == NULL) && (max_events > 0))) {
+        return -1;
+    }
+
+    event_list_t list = {
+        .events = events,
+        .max_events = max_events,
+        .num = 0,
+    };
+    /* The time can't go back before the last sample */
+    now_us = (now_us < gesture->last_us) ? gesture->last_us : now_us;
+    update_pending_tap(gesture, now_us, &list);
+    update_long_press(gesture, now_us, &list);
+    gesture->last_us = now_us;
+
+    return list.num;
+}
+
+void esp_panel_touch_gesture_reset(esp_panel_touch_gesture_t *gesture)
+{
+    if (gesture == NULL) {
+        return;
+    }
+
+    esp_panel_touch_gesture_config_t config = gesture->config;
+    esp_panel_touch_gesture_init(gesture, &config);
+}
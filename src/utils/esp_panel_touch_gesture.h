@@ -0,0 +1,229 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_panel_touch_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of the positions kept by a finger to measure its speed
+ *
+ */
+#define ESP_PANEL_TOUCH_GESTURE_HISTORY_NUM     (4)
+
+/**
+ * @brief Type of a gesture event
+ *
+ */
+typedef enum {
+    ESP_PANEL_TOUCH_GESTURE_TAP = 0,        /*!< A short touch without moving. With double tap enabled, it is reported
+                                                 after the window of the double tap is over */
+    ESP_PANEL_TOUCH_GESTURE_DOUBLE_TAP,     /*!< A tap soon after the previous one, which is not reported as a tap */
+    ESP_PANEL_TOUCH_GESTURE_LONG_PRESS,     /*!< A touch held without moving, reported once when it's long enough */
+    ESP_PANEL_TOUCH_GESTURE_SWIPE,          /*!< A fast move of a finger, reported when it's released */
+    ESP_PANEL_TOUCH_GESTURE_PINCH,          /*!< Two fingers moving apart or closer */
+    ESP_PANEL_TOUCH_GESTURE_ROTATE,         /*!< Two fingers turning around their center */
+} esp_panel_touch_gesture_type_t;
+
+/**
+ * @brief Phase of a continuous gesture (pinch and rotate), the other gestures are always `END`
+ *
+ */
+typedef enum {
+    ESP_PANEL_TOUCH_GESTURE_PHASE_BEGIN = 0,    /*!< The threshold is crossed */
+    ESP_PANEL_TOUCH_GESTURE_PHASE_UPDATE,       /*!< The fingers moved */
+    ESP_PANEL_TOUCH_GESTURE_PHASE_END,          /*!< A finger is released */
+} esp_panel_touch_gesture_phase_t;
+
+/**
+ * @brief Direction of a swipe, by the axis with the larger move
+ *
+ */
+typedef enum {
+    ESP_PANEL_TOUCH_GESTURE_DIR_NONE = 0,
+    ESP_PANEL_TOUCH_GESTURE_DIR_LEFT,
+    ESP_PANEL_TOUCH_GESTURE_DIR_RIGHT,
+    ESP_PANEL_TOUCH_GESTURE_DIR_UP,
+    ESP_PANEL_TOUCH_GESTURE_DIR_DOWN,
+} esp_panel_touch_gesture_dir_t;
+
+/**
+ * @brief A gesture event
+ *
+ */
+typedef struct {
+    esp_panel_touch_gesture_type_t type;
+    esp_panel_touch_gesture_phase_t phase;
+    int64_t timestamp_us;       /*!< Time of the sample which completes the gesture, like the release of a tap */
+    uint16_t x;                 /*!< Position of the touch, or the center of the two fingers */
+    uint16_t y;
+    esp_panel_touch_gesture_dir_t direction;    /*!< SWIPE: direction */
+    int16_t distance_x;         /*!< SWIPE: move from the touch to the release */
+    int16_t distance_y;
+    int32_t velocity_x;         /*!< SWIPE: speed at the release, in px/s */
+    int32_t velocity_y;
+    uint32_t scale_q16;         /*!< PINCH: distance between the fingers over the one at the start, in Q16 */
+    int32_t angle_mdeg;         /*!< ROTATE: turn since the start in millidegrees, clockwise on the screen is positive */
+} esp_panel_touch_gesture_event_t;
+
+/**
+ * @brief Thresholds of the gestures
+ *
+ */
+typedef struct {
+    uint16_t tap_slop_px;           /*!< A finger moving farther than it is not a tap or a long press */
+    uint16_t tap_max_ms;            /*!< Longest touch of a tap */
+    uint16_t double_tap_ms;         /*!< Longest time from the release of a tap to the touch of the next one, `0` means
+                                         the double tap is disabled and the taps are reported at once */
+    uint16_t double_tap_slop_px;    /*!< Longest distance between the two taps of a double tap */
+    uint16_t long_press_ms;         /*!< Shortest touch of a long press, `0` means disabled */
+    uint16_t swipe_min_px;          /*!< Shortest move of a swipe */
+    uint16_t swipe_min_speed;       /*!< Lowest speed of a swipe at the release, in px/s */
+    uint16_t pinch_min_px;          /*!< Change of the distance between the fingers to begin a pinch */
+    uint16_t rotate_min_mdeg;       /*!< Turn of the fingers to begin a rotation, in millidegrees */
+} esp_panel_touch_gesture_config_t;
+
+/**
+ * @brief Default thresholds of the gestures
+ *
+ */
+#define ESP_PANEL_TOUCH_GESTURE_CONFIG_DEFAULT()    \
+    {                                               \
+        .tap_slop_px = 10,                          \
+        .tap_max_ms = 250,                          \
+        .double_tap_ms = 300,                       \
+        .double_tap_slop_px = 40,                   \
+        .long_press_ms = 500,                       \
+        .swipe_min_px = 50,                         \
+        .swipe_min_speed = 300,                     \
+        .pinch_min_px = 20,                         \
+        .rotate_min_mdeg = 10000,                   \
+    }
+
+/**
+ * @brief State of a finger
+ *
+ */
+typedef enum {
+    ESP_PANEL_TOUCH_GESTURE_FINGER_UP = 0,      /*!< Not touched */
+    ESP_PANEL_TOUCH_GESTURE_FINGER_DOWN,        /*!< Touched and not moved, a tap or a long press is possible */
+    ESP_PANEL_TOUCH_GESTURE_FINGER_LONG_PRESSED,/*!< The long press is reported */
+    ESP_PANEL_TOUCH_GESTURE_FINGER_MOVED,       /*!< Moved farther than the slop, a swipe is possible */
+    ESP_PANEL_TOUCH_GESTURE_FINGER_CANCELED,    /*!< Part of a two-finger gesture, no single-finger gesture is possible */
+} esp_panel_touch_gesture_finger_state_t;
+
+/**
+ * @brief A tracked finger
+ *
+ */
+typedef struct {
+    esp_panel_touch_gesture_finger_state_t state;
+    uint16_t start_x;
+    uint16_t start_y;
+    int64_t start_us;
+    struct {
+        uint16_t x;
+        uint16_t y;
+        int64_t timestamp_us;
+    } history[ESP_PANEL_TOUCH_GESTURE_HISTORY_NUM]; /*!< Last positions, `history_num - 1` is the newest one */
+    uint8_t history_num;
+} esp_panel_touch_gesture_finger_t;
+
+/**
+ * @brief Gesture engine, which turns the touch samples into the gesture events
+ *
+ * @note  Every finger has its own state machine, and the points of a sample are matched with the fingers by the
+ *        nearest distance. The state is only changed by the samples and `esp_panel_touch_gesture_tick()`, so the
+ *        result only depends on their timestamps
+ * @note  The engine doesn't allocate any memory
+ *
+ */
+typedef struct {
+    esp_panel_touch_gesture_config_t config;
+    esp_panel_touch_gesture_finger_t fingers[ESP_PANEL_TOUCH_RING_POINTS_MAX];
+    uint8_t fingers_num;            /*!< Number of the touched fingers */
+    uint8_t fingers_max;            /*!< Largest number of the touched fingers since the first one is touched */
+    struct {
+        uint8_t is_pending: 1;      /*!< A tap is waiting for the next one */
+        uint8_t is_paired: 1;       /*!< Two fingers are tracked as a pair */
+        uint8_t is_pinching: 1;
+        uint8_t is_rotating: 1;
+    } flags;
+    struct {
+        uint16_t x;
+        uint16_t y;
+        int64_t timestamp_us;       /*!< Time of the release */
+    } tap;                          /*!< The pending tap */
+    struct {
+        uint8_t index[2];           /*!< Indexes of the fingers */
+        uint32_t start_distance;
+        int32_t start_angle_mdeg;
+        uint32_t scale_q16;         /*!< Last reported values */
+        int32_t angle_mdeg;
+        uint16_t x;
+        uint16_t y;
+    } pair;                         /*!< The two-finger gesture of the first two touched fingers */
+    int64_t last_us;                /*!< Time of the last sample or tick */
+} esp_panel_touch_gesture_t;
+
+/**
+ * @brief Initialize the gesture engine
+ *
+ * @param gesture Pointer of the engine
+ * @param config  Pointer of the thresholds, NULL means `ESP_PANEL_TOUCH_GESTURE_CONFIG_DEFAULT()`
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_touch_gesture_init(esp_panel_touch_gesture_t *gesture, const esp_panel_touch_gesture_config_t *config);
+
+/**
+ * @brief Feed a touch sample, like the ones popped from the background sampler of `ESP_PanelTouch`
+ *
+ * @note  The samples should be fed in the order of their timestamps, and a released sample (no point) should be fed
+ *        after the touch
+ *
+ * @param gesture    Pointer of the engine
+ * @param sample     Pointer of the sample
+ * @param events     Array to store the events
+ * @param max_events Size of the array, the extra events are dropped
+ *
+ * @return Number of the events, `-1` if the arguments are invalid
+ */
+int esp_panel_touch_gesture_process(esp_panel_touch_gesture_t *gesture, const esp_panel_touch_sample_t *sample,
+                                    esp_panel_touch_gesture_event_t *events, int max_events);
+
+/**
+ * @brief Report the gestures which are completed by the time, like a long press without a new sample or a tap
+ *        without a second one
+ *
+ * @note  It's only needed when no sample comes for a while, like the sampler which only reads on interrupts
+ *
+ * @param gesture    Pointer of the engine
+ * @param now_us     Current time, in the same clock as the timestamps of the samples
+ * @param events     Array to store the events
+ * @param max_events Size of the array, the extra events are dropped
+ *
+ * @return Number of the events, `-1` if the arguments are invalid
+ */
+int esp_panel_touch_gesture_tick(esp_panel_touch_gesture_t *gesture, int64_t now_us,
+                                 esp_panel_touch_gesture_event_t *events, int max_events);
+
+/**
+ * @brief Forget all the fingers and the pending tap
+ *
+ * @param gesture Pointer of the engine
+ */
+void esp_panel_touch_gesture_reset(esp_panel_touch_gesture_t *gesture);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_touch_ring.h"
+
+#define RING_SIZE_MAX   (65536)
+
+typedef enum {
+    SLOT_READ_OK = 0,
+    SLOT_READ_NOT_READY,
+    SLOT_READ_OVERWRITTEN,
+} slot_read_result_t;
+
+/* Copy the `index`th sample from its slot, the copy is retried if the producer writes the slot at the same time */
+static slot_read_result_t read_slot(esp_panel_touch_ring_t *ring, uint32_t index, esp_panel_touch_sample_t *sample)
+{
+    esp_panel_touch_ring_slot_t *slot = &ring->slots[index & (ring->size - 1)];
+    uint32_t expect = 2 * index + 2;
+
+    while (true) {
+        uint32_t stamp = __atomic_load_n(&slot->stamp, __ATOMIC_ACQUIRE);
+        if (stamp != expect) {
+            return ((int32_t)(stamp - expect) > 0) ? SLOT_READ_OVERWRITTEN : SLOT_READ_NOT_READY;
+        }
+        *sample = slot->sample;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->stamp, __ATOMIC_RELAXED) == stamp) {
+            return SLOT_READ_OK;
+        }
+        ring->stats.retries++;
+    }
+}
+
+bool esp_panel_touch_ring_init(esp_panel_touch_ring_t *ring, esp_panel_touch_ring_slot_t *slots, uint32_t size,
+                               esp_panel_touch_ring_policy_t policy)
+{
+    if ((ring == NULL) || (slots == NULL) || (size < 2) || (size > RING_SIZE_MAX) || (size & (size - 1)) ||
+            (policy > ESP_PANEL_TOUCH_RING_DROP_NEWEST)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < size; i++) {
+        slots[i].stamp = 0;
+    }
+    *ring = (esp_panel_touch_ring_t) {
+        .slots = slots,
+        .size = size,
+        .policy = policy,
+    };
+
+    return true;
+}
+
+bool esp_panel_touch_ring_push(esp_panel_touch_ring_t *ring, const esp_panel_touch_sample_t *sample)
+{
+    if ((ring == NULL) || (sample == NULL)) {
+        return false;
+    }
+
+    uint32_t head = ring->head;
+    if (ring->policy == ESP_PANEL_TOUCH_RING_DROP_NEWEST) {
+        uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        if (head - tail >= ring->size) {
+            ring->stats.dropped++;
+            return false;
+        }
+    }
+
+    /* The odd stamp is visible before the sample is changed, and the even one after it is written */
+    esp_panel_touch_ring_slot_t *slot = &ring->slots[head & (ring->size - 1)];
+    __atomic_store_n(&slot->stamp, 2 * head + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->sample = *sample;
+    slot->sample.seq = head;
+    __atomic_store_n(&slot->stamp, 2 * head + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    ring->stats.pushed++;
+
+    return true;
+}
+
+bool esp_panel_touch_ring_pop(esp_panel_touch_ring_t *ring, esp_panel_touch_sample_t *sample)
+{
+    if ((ring == NULL) || (sample == NULL)) {
+        return false;
+    }
+
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    bool is_popped = false;
+    while (!is_popped && (tail != head)) {
+        /* Skip the samples which have been overwritten */
+        if (head - tail > ring->size) {
+            ring->stats.lost += head - tail - ring->size;
+            tail = head - ring->size;
+        }
+        if (read_slot(ring, tail, sample) == SLOT_READ_OK) {
+            ring->stats.popped++;
+            is_popped = true;
+        } else {
+            ring->stats.lost++;
+            head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        }
+        tail++;
+    }
+    __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+
+    return is_popped;
+}
+
+bool esp_panel_touch_ring_get_latest(esp_panel_touch_ring_t *ring, esp_panel_touch_sample_t *sample)
+{
+    if ((ring == NULL) || (sample == NULL)) {
+        return false;
+    }
+
+    while (true) {
+        uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        if (head == 0) {
+            return false;
+        }
+        /* The latest slot is only overwritten after more samples are pushed, then read the new latest one */
+        if (read_slot(ring, head - 1, sample) == SLOT_READ_OK) {
+            return true;
+        }
+    }
+}
+
+void esp_panel_touch_ring_flush(esp_panel_touch_ring_t *ring)
+{
+    if (ring == NULL) {
+        return;
+    }
+
+    __atomic_store_n(&ring->tail, __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+uint32_t esp_panel_touch_ring_get_count(esp_panel_touch_ring_t *ring)
+{
+    if (ring == NULL) {
+        return 0;
+    }
+
+    uint32_t count = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - ring->tail;
+
+    return (count > ring->size) ? ring->size : count;
+}
+
+bool esp_panel_touch_ring_get_stats(esp_panel_touch_ring_t *ring, esp_panel_touch_ring_stats_t *stats, bool clear)
+{
+    if ((ring == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = ring->stats;
+    if (clear) {
+        ring->stats = (esp_panel_touch_ring_stats_t) {};
+    }
+
+    return true;
+}
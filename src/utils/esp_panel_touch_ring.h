@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of the points of a sample
+ *
+ */
+#define ESP_PANEL_TOUCH_RING_POINTS_MAX     (5)
+
+/**
+ * @brief Policy when the ring is full
+ *
+ */
+typedef enum {
+    ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST = 0,  /*!< The new sample overwrites the oldest one, which is lost by the
+                                                     consumer. The latest sample is always available */
+    ESP_PANEL_TOUCH_RING_DROP_NEWEST,           /*!< The new sample is dropped, so the consumer gets a gapless history
+                                                     until it catches up */
+} esp_panel_touch_ring_policy_t;
+
+/**
+ * @brief A touch point of a sample
+ *
+ */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t strength;
+} esp_panel_touch_ring_point_t;
+
+/**
+ * @brief A timestamped sample of the touch points
+ *
+ */
+typedef struct {
+    int64_t timestamp_us;       /*!< Time when the sample is read */
+    uint32_t seq;               /*!< Sequence number, set by the ring. It increases by 1 for every pushed sample, so
+                                     the gaps show the lost samples */
+    uint8_t points_num;         /*!< Number of the points, `0` means released */
+    esp_panel_touch_ring_point_t points[ESP_PANEL_TOUCH_RING_POINTS_MAX];
+} esp_panel_touch_sample_t;
+
+/**
+ * @brief Slot of the ring, `stamp` is `2 * n + 1` while the `n`th sample is being written, and `2 * n + 2` after it
+ *        is written
+ *
+ */
+typedef struct {
+    uint32_t stamp;
+    esp_panel_touch_sample_t sample;
+} esp_panel_touch_ring_slot_t;
+
+/**
+ * @brief Counters of the ring
+ *
+ */
+typedef struct {
+    uint32_t pushed;            /*!< Number of the pushed samples */
+    uint32_t dropped;           /*!< Number of the samples dropped by the producer, with `DROP_NEWEST` policy */
+    uint32_t popped;            /*!< Number of the samples popped by the consumer */
+    uint32_t lost;              /*!< Number of the samples overwritten before the consumer pops them, with
+                                     `OVERWRITE_OLDEST` policy */
+    uint32_t retries;           /*!< Number of the reads retried because the producer was writing the same slot */
+} esp_panel_touch_ring_stats_t;
+
+/**
+ * @brief Lock-free ring of the touch samples, for a single producer (like the sampler task) and a single consumer
+ *        (like LVGL)
+ *
+ * @note  The producer never waits for the consumer. Every slot has a stamp which is changed before and after the
+ *        sample is written, so the consumer detects a slot overwritten while reading it and retries
+ * @note  The indexes increase without wrapping around the size, and they are only written by their owners
+ *
+ */
+typedef struct {
+    esp_panel_touch_ring_slot_t *slots;
+    uint32_t size;                      /*!< Number of the slots, a power of 2 */
+    esp_panel_touch_ring_policy_t policy;
+    uint32_t head;                      /*!< Number of the pushed samples, only written by the producer */
+    uint32_t tail;                      /*!< Number of the consumed samples, only written by the consumer */
+    esp_panel_touch_ring_stats_t stats;
+} esp_panel_touch_ring_t;
+
+/**
+ * @brief Get the buffer size of the slots for the given number of the samples
+ *
+ * @param size Number of the slots, a power of 2
+ *
+ * @return Buffer size in bytes
+ */
+static inline size_t esp_panel_touch_ring_get_buf_size(uint32_t size)
+{
+    return size * sizeof(esp_panel_touch_ring_slot_t);
+}
+
+/**
+ * @brief Initialize the ring
+ *
+ * @param ring   Pointer of the ring
+ * @param slots  Buffer of the slots, its size should be `esp_panel_touch_ring_get_buf_size(size)`
+ * @param size   Number of the slots, a power of 2 (2 ~ 65536)
+ * @param policy Policy when the ring is full
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_touch_ring_init(esp_panel_touch_ring_t *ring, esp_panel_touch_ring_slot_t *slots, uint32_t size,
+                               esp_panel_touch_ring_policy_t policy);
+
+/**
+ * @brief Push a sample, only called by the producer
+ *
+ * @param ring   Pointer of the ring
+ * @param sample Pointer of the sample, `seq` is ignored and set by the ring
+ *
+ * @return true if success, false if the sample is dropped or the arguments are invalid
+ */
+bool esp_panel_touch_ring_push(esp_panel_touch_ring_t *ring, const esp_panel_touch_sample_t *sample);
+
+/**
+ * @brief Pop the oldest sample which is not consumed, only called by the consumer
+ *
+ * @note  With `OVERWRITE_OLDEST` policy, the overwritten samples are skipped and counted as lost
+ *
+ * @param ring   Pointer of the ring
+ * @param sample Pointer to store the sample
+ *
+ * @return true if a sample is popped, false if the ring is empty or the arguments are invalid
+ */
+bool esp_panel_touch_ring_pop(esp_panel_touch_ring_t *ring, esp_panel_touch_sample_t *sample);
+
+/**
+ * @brief Get the latest sample without consuming it
+ *
+ * @note  This function is only called by the consumer, and the samples which are not consumed are kept
+ *
+ * @param ring   Pointer of the ring
+ * @param sample Pointer to store the sample
+ *
+ * @return true if success, false if no sample has been pushed or the arguments are invalid
+ */
+bool esp_panel_touch_ring_get_latest(esp_panel_touch_ring_t *ring, esp_panel_touch_sample_t *sample);
+
+/**
+ * @brief Drop all the samples which are not consumed, only called by the consumer
+ *
+ * @param ring Pointer of the ring
+ */
+void esp_panel_touch_ring_flush(esp_panel_touch_ring_t *ring);
+
+/**
+ * @brief Get the number of the samples which are not consumed
+ *
+ * @param ring Pointer of the ring
+ *
+ * @return Number of the samples, up to the size of the ring
+ */
+uint32_t esp_panel_touch_ring_get_count(esp_panel_touch_ring_t *ring);
+
+/**
+ * @brief Get the counters of the ring
+ *
+ * @note  The counters of the producer are not synchronized with the consumer, so clear them when the producer is
+ *        stopped to get the exact values
+ *
+ * @param ring  Pointer of the ring
+ * @param stats Pointer to store the counters
+ * @param clear Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_touch_ring_get_stats(esp_panel_touch_ring_t *ring, esp_panel_touch_ring_stats_t *stats, bool clear);
+
+#ifdef __cplusplus
+}
+#endif
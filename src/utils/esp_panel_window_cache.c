@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include "esp_panel_window_cache.h"
+
+static bool check_range(esp_panel_window_cache_t *cache, uint16_t range[2], bool is_valid, int start, int end)
+{
+    if (is_valid && (range[0] == start) && (range[1] == end)) {
+        cache->stats.elided++;
+        return false;
+    }
+    range[0] = start;
+    range[1] = end;
+    cache->stats.sent++;
+
+    return true;
+}
+
+bool esp_panel_window_cache_check_column(esp_panel_window_cache_t *cache, int start, int end)
+{
+    if (cache == NULL) {
+        return true;
+    }
+
+    bool is_changed = check_range(cache, cache->column, cache->flags.column_valid, start, end);
+    cache->flags.column_valid = 1;
+
+    return is_changed;
+}
+
+bool esp_panel_window_cache_check_row(esp_panel_window_cache_t *cache, int start, int end)
+{
+    if (cache == NULL) {
+        return true;
+    }
+
+    bool is_changed = check_range(cache, cache->row, cache->flags.row_valid, start, end);
+    cache->flags.row_valid = 1;
+
+    return is_changed;
+}
+
+void esp_panel_window_cache_invalidate(esp_panel_window_cache_t *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+
+    cache->flags.column_valid = 0;
+    cache->flags.row_valid = 0;
+    cache->stats.invalidations++;
+}
+
+bool esp_panel_window_cache_get_stats(esp_panel_window_cache_t *cache, esp_panel_window_cache_stats_t *stats, bool clear)
+{
+    if ((cache == NULL) || (stats == NULL)) {
+        return false;
+    }
+
+    *stats = cache->stats;
+    if (clear) {
+        cache->stats = (esp_panel_window_cache_stats_t) {};
+    }
+
+    return true;
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Counters of the address window commands (CASET/RASET)
+ *
+ */
+typedef struct {
+    uint32_t sent;              /*!< Number of the window commands which are sent */
+    uint32_t elided;            /*!< Number of the window commands which are skipped since the range is unchanged */
+    uint32_t invalidations;     /*!< Number of the invalidations, such as mirror, swap, gap, reset or display on/off */
+} esp_panel_window_cache_stats_t;
+
+/**
+ * @brief Last address window written to the panel
+ *
+ * @note  The MIPI-DCS panels keep the column and row ranges until they are written again, and `RAMWR` always restarts
+ *        from the start of the window. So the window commands can be skipped if their ranges are unchanged
+ *
+ */
+typedef struct {
+    uint16_t column[2];         /*!< Last sent column range (inclusive), valid if `flags.column_valid` is set */
+    uint16_t row[2];            /*!< Last sent row range (inclusive), valid if `flags.row_valid` is set */
+    struct {
+        unsigned int column_valid: 1;
+        unsigned int row_valid: 1;
+    } flags;
+    esp_panel_window_cache_stats_t stats;
+} esp_panel_window_cache_t;
+
+/**
+ * @brief Check whether the column range (CASET) should be sent, and record it as the current one
+ *
+ * @note  If the command fails to be sent, `esp_panel_window_cache_invalidate()` should be called
+ *
+ * @param cache Pointer of the cache, `NULL` means the window commands are never skipped
+ * @param start First column (inclusive), including the gap
+ * @param end   Last column (inclusive), including the gap
+ *
+ * @return true if the command should be sent, otherwise false
+ */
+bool esp_panel_window_cache_check_column(esp_panel_window_cache_t *cache, int start, int end);
+
+/**
+ * @brief Check whether the row range (RASET) should be sent, and record it as the current one
+ *
+ * @note  If the command fails to be sent, `esp_panel_window_cache_invalidate()` should be called
+ *
+ * @param cache Pointer of the cache, `NULL` means the window commands are never skipped
+ * @param start First row (inclusive), including the gap
+ * @param end   Last row (inclusive), including the gap
+ *
+ * @return true if the command should be sent, otherwise false
+ */
+bool esp_panel_window_cache_check_row(esp_panel_window_cache_t *cache, int start, int end);
+
+/**
+ * @brief Invalidate the cache, so the next window commands are always sent
+ *
+ * @note  This function should be called when the window of the panel may be changed by others, such as the mirror, swap,
+ *        gap, reset, initialization, display on/off, or the commands sent through the panel IO directly
+ *
+ * @param cache Pointer of the cache, `NULL` is ignored
+ */
+void esp_panel_window_cache_invalidate(esp_panel_window_cache_t *cache);
+
+/**
+ * @brief Get the counters of the cache
+ *
+ * @param cache Pointer of the cache
+ * @param stats Pointer to store the counters
+ * @param clear Whether to clear the counters after reading
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_window_cache_get_stats(esp_panel_window_cache_t *cache, esp_panel_window_cache_stats_t *stats, bool clear);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_panel_xpt2046_batch.h"
+
+/* Control bytes: start bit, channel, 12-bit mode and differential reference, without the power-down bits */
+#define CONTROL_Z1          (0xB0)
+#define CONTROL_Z2          (0xC0)
+#define CONTROL_X           (0xD0)
+#define CONTROL_Y           (0x90)
+#define PD_BITS_MASK        (0x03)
+
+/* Index of the first X/Y conversion, after Z1, Z2 and the discarded X */
+#define SAMPLE_START        (3)
+
+/* The result of the conversion `index` follows its control byte, after one busy clock, and 3 zero bits follow it */
+static uint16_t get_conversion(const uint8_t *rx, int index)
+{
+    return (((uint16_t)rx[index * 2 + 1] << 8) | rx[index * 2 + 2]) >> 3;
+}
+
+static uint16_t get_median(uint16_t *values, uint8_t num)
+{
+    for (int i = 1; i < num; i++) {
+        uint16_t v = values[i];
+        int j = i;
+        for (; (j > 0) && (values[j - 1] > v); j--) {
+            values[j] = values[j - 1];
+        }
+        values[j] = v;
+    }
+
+    return (num & 1) ? values[num / 2] : (uint16_t)((values[num / 2 - 1] + values[num / 2] + 1) / 2);
+}
+
+static bool is_in_range(uint16_t value)
+{
+    return (value >= ESP_PANEL_XPT2046_BATCH_ADC_MARGIN) &&
+           (value <= ESP_PANEL_XPT2046_BATCH_ADC_LIMIT - ESP_PANEL_XPT2046_BATCH_ADC_MARGIN);
+}
+
+size_t esp_panel_xpt2046_batch_build(uint8_t samples, uint8_t pd_bits, uint8_t *tx, size_t size)
+{
+    if ((samples == 0) || (samples > ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX) || (tx == NULL) ||
+            (size < ESP_PANEL_XPT2046_BATCH_SIZE(samples))) {
+        return 0;
+    }
+
+    size_t length = ESP_PANEL_XPT2046_BATCH_SIZE(samples);
+    pd_bits &= PD_BITS_MASK;
+    memset(tx, 0, length);
+    tx[0] = CONTROL_Z1 | pd_bits;
+    tx[2] = CONTROL_Z2 | pd_bits;
+    /* The first X conversion is usually not settled, it's discarded */
+    tx[4] = CONTROL_X | pd_bits;
+    for (int i = 0; i < samples; i++) {
+        tx[(SAMPLE_START + i * 2) * 2] = CONTROL_X | pd_bits;
+        tx[(SAMPLE_START + i * 2 + 1) * 2] = CONTROL_Y | pd_bits;
+    }
+
+    return length;
+}
+
+bool esp_panel_xpt2046_batch_decode(uint8_t samples, const uint8_t *rx, size_t size,
+                                    esp_panel_xpt2046_batch_result_t *result)
+{
+    if ((samples == 0) || (samples > ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX) || (rx == NULL) || (result == NULL) ||
+            (size != ESP_PANEL_XPT2046_BATCH_SIZE(samples))) {
+        return false;
+    }
+
+    uint16_t x[ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX];
+    uint16_t y[ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX];
+    uint8_t num = 0;
+    for (int i = 0; i < samples; i++) {
+        uint16_t x_adc = get_conversion(rx, SAMPLE_START + i * 2);
+        uint16_t y_adc = get_conversion(rx, SAMPLE_START + i * 2 + 1);
+        if (is_in_range(x_adc) && is_in_range(y_adc)) {
+            x[num] = x_adc;
+            y[num] = y_adc;
+            num++;
+        }
+    }
+
+    result->z = get_conversion(rx, 0) + (ESP_PANEL_XPT2046_BATCH_ADC_LIMIT - get_conversion(rx, 1));
+    result->x = (num > 0) ? get_median(x, num) : 0;
+    result->y = (num > 0) ? get_median(y, num) : 0;
+    result->valid_num = num;
+
+    return true;
+}
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Largest number of the X/Y samples of a batch
+ *
+ */
+#define ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX     (16)
+
+/**
+ * @brief Range of the 12-bit conversions
+ *
+ */
+#define ESP_PANEL_XPT2046_BATCH_ADC_LIMIT       (4096)
+
+/**
+ * @brief Samples closer than this to the edges of the range are invalid, as the driver did with the single reads
+ *
+ */
+#define ESP_PANEL_XPT2046_BATCH_ADC_MARGIN      (50)
+
+/**
+ * @brief Size of the transaction of a batch, in bytes
+ *
+ * @note  A batch converts Z1, Z2, a discarded X and then `samples` pairs of X and Y. Every conversion takes 16 clocks,
+ *        as its control byte is sent while the low bits of the previous one are shifted out, and one more byte is
+ *        needed for the last result
+ *
+ */
+#define ESP_PANEL_XPT2046_BATCH_SIZE(samples)   ((size_t)(3 + 2 * (samples)) * 2 + 1)
+
+/**
+ * @brief Result of a batch
+ *
+ */
+typedef struct {
+    uint16_t z;             /*!< Pressure, `Z1 + 4096 - Z2` */
+    uint16_t x;             /*!< Median of the valid X samples, `0` if there is none */
+    uint16_t y;             /*!< Median of the valid Y samples, `0` if there is none */
+    uint8_t valid_num;      /*!< Number of the X/Y pairs in the range */
+} esp_panel_xpt2046_batch_result_t;
+
+/**
+ * @brief Write the control bytes of a batch to the transmit buffer
+ *
+ * @param samples Number of the X/Y samples, in 1..`ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX`
+ * @param pd_bits Power-down bits (PD1 and PD0) of every control byte
+ * @param tx      Transmit buffer
+ * @param size    Size of the buffer, at least `ESP_PANEL_XPT2046_BATCH_SIZE(samples)`
+ *
+ * @return Size of the transaction, `0` if the arguments are invalid
+ */
+size_t esp_panel_xpt2046_batch_build(uint8_t samples, uint8_t pd_bits, uint8_t *tx, size_t size);
+
+/**
+ * @brief Decode the bytes received during a batch
+ *
+ * @note  The X and Y samples are only used in pairs, a pair is dropped if any of them is out of the range. The median
+ *        is taken instead of the mean, so a single spike can't move the point
+ *
+ * @param samples Number of the X/Y samples of the batch
+ * @param rx      Receive buffer
+ * @param size    Size of the received data, must be `ESP_PANEL_XPT2046_BATCH_SIZE(samples)`
+ * @param result  Pointer of the result
+ *
+ * @return true if success, otherwise false
+ */
+bool esp_panel_xpt2046_batch_decode(uint8_t samples, const uint8_t *rx, size_t size,
+                                    esp_panel_xpt2046_batch_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,10 @@
 #include "lvgl_port_v8.h"
 
 #define LVGL_PORT_ENABLE_ROTATION_OPTIMIZED     (1)
+// Split the rotation by row bands between the LVGL task and a worker on the other core, only for dual-core SoCs
+#define LVGL_PORT_ENABLE_ROTATION_PARALLEL      (0)
+// Benchmark the rotation block sizes with the real frame buffers at startup and use the fastest one
+#define LVGL_PORT_ENABLE_ROTATION_AUTOTUNE      (0)
 #define LVGL_PORT_BUFFER_NUM_MAX       (2)
 
 static const char *TAG = "lvgl_port";
@@ -16,6 +20,10 @@ static esp_timer_handle_t lvgl_tick_timer = NULL;
 static void *lvgl_buf[LVGL_PORT_BUFFER_NUM_MAX] = {};
 
 #if LVGL_PORT_ROTATION_DEGREE != 0
+#if LVGL_PORT_ENABLE_ROTATION_PARALLEL
+static esp_panel_pixel_worker_handle_t lvgl_rotate_worker = NULL;
+#endif
+
 static void *get_next_frame_buffer(ESP_PanelLcd *lcd)
 {
     static void *next_fb = NULL;
@@ -32,191 +40,118 @@ static void *get_next_frame_buffer(ESP_PanelLcd *lcd)
     return next_fb;
 }
 
-__attribute__((always_inline))
-static inline void copy_pixel_8bpp(uint8_t *to, const uint8_t *from)
-{
-    *to++ = *from++;
-}
-
-__attribute__((always_inline))
-static inline void copy_pixel_16bpp(uint8_t *to, const uint8_t *from)
-{
-    *(uint16_t *)to++ = *(const uint16_t *)from++;
-}
-
-__attribute__((always_inline))
-static inline void copy_pixel_24bpp(uint8_t *to, const uint8_t *from)
-{
-    *to++ = *from++;
-    *to++ = *from++;
-    *to++ = *from++;
-}
-
-#define _COPY_PIXEL(_bpp, to, from) copy_pixel_##_bpp##bpp(to, from)
-#define COPY_PIXEL(_bpp, to, from)  _COPY_PIXEL(_bpp, to, from)
-
-#define ROTATE_90_ALL_BPP() \
-    { \
-        to_bytes_per_line = h * to_bytes_per_piexl; \
-        to_index_const = (w - x_start - 1) * to_bytes_per_line; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
-            to_index = to_index_const + from_y * to_bytes_per_piexl; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index -= to_bytes_per_line; \
-            } \
-        } \
-    }
-
 /**
- * @brief Optimized transpose function for RGB565 format.
+ * @brief Rotate and copy the dirty area by the pixel kernels in `utils/esp_panel_pixel.h`
  *
- * @note  ESP32-P4 1024x600 full-screen: 738ms -> 34ms
- * @note  ESP32-S3 480x480  full-screen: 380ms -> 37ms
+ * @note  The optimized kernels only work with RGB565/RGB888 formats, others fall back to the pixel-by-pixel copy.
+ * @note  RGB565 full-screen, blocked transpose: ESP32-P4 1024x600 738ms -> 34ms, ESP32-S3 480x480 380ms -> 37ms
+ * @note  If `LVGL_PORT_ENABLE_ROTATION_PARALLEL` is enabled, the area is split into row bands and the worker on the
+ *        other core rotates half of them. The function returns after both halves are finished
  *
  */
-#define ROTATE_90_OPTIMIZED_16BPP(block_w, block_h) \
-    { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = (i + block_h > h) ? h : (i + block_h); \
-            for (int j = 0; j < w; j += block_w) { \
-                max_width = (j + block_w > w) ? w : (j + block_w); \
-                start_y = w - 1 - j;   \
-                for (int x = i; x < max_height; x++) { \
-                    from_next = (uint16_t *)from + x * w; \
-                    for (int y = j, mirrored_y = start_y; y < max_width; y += 4, mirrored_y -= 4) { \
-                        ((uint16_t *)to)[(mirrored_y) * h + x] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 1) * h + x] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 2) * h + x] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
-                        ((uint16_t *)to)[(mirrored_y - 3) * h + x] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
-                    } \
-                } \
-            } \
-        } \
-    }
-
-#define ROTATE_180_ALL_BPP() \
-    { \
-        to_bytes_per_line = w * to_bytes_per_piexl; \
-        to_index_const = (h - 1) * to_bytes_per_line + (w - x_start - 1) * to_bytes_per_piexl; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + x_start * from_bytes_per_piexl; \
-            to_index = to_index_const - from_y * to_bytes_per_line; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index -= to_bytes_per_piexl; \
-            } \
-        } \
-    }
-
-#define ROTATE_270_OPTIMIZED_16BPP(block_w, block_h) \
-    { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = i + block_h > h ? h : i + block_h; \
-            for (int j = 0; j < w; j += block_w) { \
-                max_width = j + block_w > w ? w : j + block_w; \
-                for (int x = i; x < max_height; x++) { \
-                    from_next = (uint16_t *)from + x * w; \
-                    for (int y = j; y < max_width; y += 4) { \
-                        ((uint16_t *)to)[y * h + (h - 1 - x)] = *((uint32_t *)(from_next + y)) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 1) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y)) >> 16) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 2) * h + (h - 1 - x)] = *((uint32_t *)(from_next + y + 2)) & 0xFFFF; \
-                        ((uint16_t *)to)[(y + 3) * h + (h - 1 - x)] = (*((uint32_t *)(from_next + y + 2)) >> 16) & 0xFFFF; \
-                    } \
-                } \
-            } \
-        } \
-    }
-
-#define ROTATE_270_ALL_BPP() \
-    { \
-        to_bytes_per_line = h * to_bytes_per_piexl; \
-        from_index_const = x_start * from_bytes_per_piexl; \
-        to_index_const = x_start * to_bytes_per_line + (h - 1) * to_bytes_per_piexl; \
-        for (int from_y = y_start; from_y < y_end + 1; from_y++) { \
-            from_index = from_y * from_bytes_per_line + from_index_const; \
-            to_index = to_index_const - from_y * to_bytes_per_piexl; \
-            for (int from_x = x_start; from_x < x_end + 1; from_x++) { \
-                COPY_PIXEL(LV_COLOR_DEPTH, to + to_index, from + from_index); \
-                from_index += from_bytes_per_piexl; \
-                to_index += to_bytes_per_line; \
-            } \
-        } \
-    }
-
 __attribute__((always_inline))
 IRAM_ATTR static inline void rotate_copy_pixel(
     const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
     uint16_t h, uint16_t rotate
 )
 {
-    int from_bytes_per_piexl = sizeof(lv_color_t);
-    int from_bytes_per_line = w * from_bytes_per_piexl;
-    int from_index = 0;
-    int from_index_const = 0;
-
-    int to_bytes_per_piexl = LV_COLOR_DEPTH >> 3;
-    int to_bytes_per_line;
-    int to_index = 0;
-    int to_index_const = 0;
-
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-    int max_height = 0;
-    int max_width = 0;
-    int start_y = 0;
-    uint16_t *from_next = NULL;
-#endif
-
     // uint32_t time = esp_log_timestamp();
-    switch (rotate) {
-    case 90:
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-        ROTATE_90_OPTIMIZED_16BPP(32, 256);
-#else
-        ROTATE_90_ALL_BPP();
-#endif
-        break;
-    case 180:
-        ROTATE_180_ALL_BPP();
-        break;
-    case 270:
-#if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
-        ROTATE_270_OPTIMIZED_16BPP(32, 256);
+#if LVGL_PORT_ENABLE_ROTATION_OPTIMIZED && LVGL_PORT_ENABLE_ROTATION_PARALLEL
+    esp_panel_pixel_worker_rotate_copy(
+        lvgl_rotate_worker, from, to, x_start, y_start, x_end, y_end, w, h, rotate, LV_COLOR_DEPTH >> 3
+    );
+#elif LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
+    esp_panel_pixel_rotate_copy(from, to, x_start, y_start, x_end, y_end, w, h, rotate, LV_COLOR_DEPTH >> 3);
 #else
-        ROTATE_270_ALL_BPP();
+    esp_panel_pixel_rotate_copy_ref(from, to, x_start, y_start, x_end, y_end, w, h, rotate, LV_COLOR_DEPTH >> 3);
 #endif
-        break;
-    default:
-        break;
-    }
     // ESP_LOGI(TAG, "rotate: end, time used:%d", (int)(esp_log_timestamp() - time));
 }
 #endif /* LVGL_PORT_ROTATION_DEGREE */
 
 #if LVGL_PORT_AVOID_TEAR
-#if LVGL_PORT_DIRECT_MODE
 #if LVGL_PORT_ROTATION_DEGREE != 0
 typedef struct {
-    uint16_t inv_p;
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
+    uint16_t num;
+    esp_panel_pixel_rect_t rects[ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX];
 } lv_port_dirty_area_t;
 
-static lv_port_dirty_area_t dirty_area;
+// Cost model of copying the dirty areas between the frame buffers, see `utils/esp_panel_pixel_region.h`
+static const esp_panel_pixel_region_cost_t dirty_area_cost = ESP_PANEL_PIXEL_REGION_COST_DEFAULT(LV_COLOR_DEPTH >> 3);
+
+/**
+ * @brief Append the areas and coalesce them by `esp_panel_pixel_region_coalesce()`
+ *
+ * @note  The overlapping and adjacent areas are merged, and a near-full update becomes a single full-screen copy. So
+ *        fewer bytes are copied than replaying LVGL's `inv_areas` one by one
+ *
+ */
+static void flush_dirty_append(lv_port_dirty_area_t *dirty_area, const esp_panel_pixel_rect_t *rects, int num)
+{
+    for (int i = 0; i < num; i++) {
+        if (dirty_area->num == ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX) {
+            dirty_area->num = esp_panel_pixel_region_coalesce(
+                                  &dirty_area_cost, dirty_area->rects, dirty_area->num, ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX
+                              );
+        }
+        if (dirty_area->num == ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX) {
+            /* Still full, grow the last area to cover the new one */
+            esp_panel_pixel_rect_t *last = &dirty_area->rects[dirty_area->num - 1];
+            last->x1 = LV_MIN(last->x1, rects[i].x1);
+            last->y1 = LV_MIN(last->y1, rects[i].y1);
+            last->x2 = LV_MAX(last->x2, rects[i].x2);
+            last->y2 = LV_MAX(last->y2, rects[i].y2);
+        } else {
+            dirty_area->rects[dirty_area->num++] = rects[i];
+        }
+    }
+    if (dirty_area->num > 0) {
+        dirty_area->num = esp_panel_pixel_region_coalesce(
+                              &dirty_area_cost, dirty_area->rects, dirty_area->num, ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX
+                          );
+    }
+}
 
 static void flush_dirty_save(lv_port_dirty_area_t *dirty_area)
 {
     lv_disp_t *disp = _lv_refr_get_disp_refreshing();
-    dirty_area->inv_p = disp->inv_p;
+    esp_panel_pixel_rect_t rects[LV_INV_BUF_SIZE];
+    int num = 0;
+
+    /* Only save the unjoined areas */
     for (int i = 0; i < disp->inv_p; i++) {
-        dirty_area->inv_area_joined[i] = disp->inv_area_joined[i];
-        dirty_area->inv_areas[i] = disp->inv_areas[i];
+        if (disp->inv_area_joined[i] == 0) {
+            rects[num++] = {
+                (uint16_t)disp->inv_areas[i].x1, (uint16_t)disp->inv_areas[i].y1, (uint16_t)disp->inv_areas[i].x2,
+                (uint16_t)disp->inv_areas[i].y2
+            };
+        }
     }
+    dirty_area->num = 0;
+    flush_dirty_append(dirty_area, rects, num);
 }
 
+/**
+ * @brief Copy dirty area
+ *
+ * @note This function is used to avoid tearing effect, and only work with LVGL direct-mode.
+ *
+ */
+static void flush_dirty_copy(void *dst, void *src, lv_port_dirty_area_t *dirty_area)
+{
+    for (int i = 0; i < dirty_area->num; i++) {
+        rotate_copy_pixel(
+            (uint8_t *)src, (uint8_t *)dst, dirty_area->rects[i].x1, dirty_area->rects[i].y1, dirty_area->rects[i].x2,
+            dirty_area->rects[i].y2, LV_HOR_RES, LV_VER_RES, LVGL_PORT_ROTATION_DEGREE
+        );
+    }
+}
+#endif /* LVGL_PORT_ROTATION_DEGREE */
+
+#if LVGL_PORT_DIRECT_MODE
+#if LVGL_PORT_ROTATION_DEGREE != 0
+static lv_port_dirty_area_t dirty_area;
+
 typedef enum {
     FLUSH_STATUS_PART,
     FLUSH_STATUS_FULL
@@ -272,31 +207,6 @@ static inline void *flush_get_next_buf(ESP_PanelLcd *lcd)
     return get_next_frame_buffer(lcd);
 }
 
-/**
- * @brief Copy dirty area
- *
- * @note This function is used to avoid tearing effect, and only work with LVGL direct-mode.
- *
- */
-static void flush_dirty_copy(void *dst, void *src, lv_port_dirty_area_t *dirty_area)
-{
-    lv_coord_t x_start, x_end, y_start, y_end;
-    for (int i = 0; i < dirty_area->inv_p; i++) {
-        /* Refresh the unjoined areas*/
-        if (dirty_area->inv_area_joined[i] == 0) {
-            x_start = dirty_area->inv_areas[i].x1;
-            x_end = dirty_area->inv_areas[i].x2;
-            y_start = dirty_area->inv_areas[i].y1;
-            y_end = dirty_area->inv_areas[i].y2;
-
-            rotate_copy_pixel(
-                (uint8_t *)src, (uint8_t *)dst, x_start, y_start, x_end, y_end, LV_HOR_RES, LV_VER_RES,
-                LVGL_PORT_ROTATION_DEGREE
-            );
-        }
-    }
-}
-
 static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     ESP_PanelLcd *lcd = (ESP_PanelLcd *)drv->user_data;
@@ -423,26 +333,41 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
 static void *lvgl_port_lcd_last_buf = NULL;
 static void *lvgl_port_lcd_next_buf = NULL;
 static void *lvgl_port_flush_next_buf = NULL;
+#else
+static lv_port_dirty_area_t dirty_area_cur;
+static lv_port_dirty_area_t dirty_area_prev;
+static lv_port_dirty_area_t dirty_area_copy;
 #endif
 
 void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     ESP_PanelLcd *lcd = (ESP_PanelLcd *)drv->user_data;
-    const int offsetx1 = area->x1;
-    const int offsetx2 = area->x2;
-    const int offsety1 = area->y1;
-    const int offsety2 = area->y2;
 
 #if LVGL_PORT_ROTATION_DEGREE != 0
-    void *next_fb = get_next_frame_buffer(lcd);
+    /**
+     * LVGL works in direct-mode with the third frame buffer here, so only the dirty areas are rendered. Since the two
+     * LCD frame buffers are used alternately, each of them misses the dirty areas of the previous frame. So both the
+     * dirty areas of the previous and the current frame are rotated into the next LCD frame buffer, instead of the
+     * whole screen. They are coalesced together, so the areas updated in both frames are only rotated once.
+     */
+    if (lv_disp_flush_is_last(drv)) {
+        void *next_fb = get_next_frame_buffer(lcd);
 
-    /* Rotate and copy dirty area from the current LVGL's buffer to the next LCD frame buffer */
-    rotate_copy_pixel((lv_color_t *)color_map, (lv_color_t *)next_fb, offsetx1, offsety1, offsetx2, offsety2, LV_HOR_RES,
-                      LV_VER_RES, LVGL_PORT_ROTATION_DEGREE);
+        flush_dirty_save(&dirty_area_cur);
+        dirty_area_copy = dirty_area_prev;
+        flush_dirty_append(&dirty_area_copy, dirty_area_cur.rects, dirty_area_cur.num);
+        flush_dirty_copy(next_fb, color_map, &dirty_area_copy);
+        dirty_area_prev = dirty_area_cur;
 
-    /* Switch the current LCD frame buffer to `next_fb` */
-    lcd->drawBitmap(offsetx1, offsety1, offsetx2 - offsetx1 + 1, offsety2 - offsety1 + 1, (const uint8_t *)next_fb);
+        /* Switch the current LCD frame buffer to `next_fb` */
+        lcd->drawBitmap(0, 0, LVGL_PORT_DISP_WIDTH, LVGL_PORT_DISP_HEIGHT, (const uint8_t *)next_fb);
+    }
 #else
+    const int offsetx1 = area->x1;
+    const int offsetx2 = area->x2;
+    const int offsety1 = area->y1;
+    const int offsety2 = area->y2;
+
     drv->draw_buf->buf1 = color_map;
     drv->draw_buf->buf2 = lvgl_port_flush_next_buf;
     lvgl_port_flush_next_buf = color_map;
@@ -551,6 +476,43 @@ void rounder_callback(lv_disp_drv_t *drv, lv_area_t *area)
     }
 }
 
+#if LVGL_PORT_AVOID_TEAR && LVGL_PORT_ENABLE_ROTATION_AUTOTUNE && \
+    ((LVGL_PORT_ROTATION_DEGREE == 90) || (LVGL_PORT_ROTATION_DEGREE == 270))
+/**
+ * @brief Find out the fastest block size for the rotation from the LVGL's buffer to the LCD frame buffer
+ *
+ * @note  The measured timings are printed, so the best size can be hard-coded by
+ *        `esp_panel_pixel_set_rotate_block_size()` to skip tuning on every boot
+ *
+ */
+static void rotation_autotune(const void *from, void *to)
+{
+    esp_panel_pixel_tune_config_t config = {
+        .from = (const uint8_t *)from,
+        .to = (uint8_t *)to,
+        .w = LVGL_PORT_DISP_HEIGHT,
+        .h = LVGL_PORT_DISP_WIDTH,
+        .rotate = LVGL_PORT_ROTATION_DEGREE,
+        .bytes_per_pixel = LV_COLOR_DEPTH >> 3,
+        .loops = 2,
+        .flags = {
+            .apply_best = 1,
+        },
+    };
+    static esp_panel_pixel_tune_result_t results[ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM];
+    esp_panel_pixel_tune_result_t best = {};
+
+    if (!esp_panel_pixel_tune_rotate_block(&config, results, &best)) {
+        ESP_LOGE(TAG, "Tune rotation block size failed");
+        return;
+    }
+    for (int i = 0; i < ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM; i++) {
+        ESP_LOGI(TAG, "Rotation block %dx%d: %d us", results[i].block_w, results[i].block_h, (int)results[i].time_us);
+    }
+    ESP_LOGI(TAG, "Rotation block size: %dx%d (%d us)", best.block_w, best.block_h, (int)best.time_us);
+}
+#endif
+
 static lv_disp_t *display_init(ESP_PanelLcd *lcd)
 {
     ESP_PANEL_CHECK_FALSE_RET(lcd != nullptr, nullptr, "Invalid LCD device");
@@ -587,6 +549,10 @@ static lv_disp_t *display_init(ESP_PanelLcd *lcd)
 #elif (LVGL_PORT_DISP_BUFFER_NUM >= 3) && (LVGL_PORT_ROTATION_DEGREE != 0)
 
     lvgl_buf[0] = lcd->getFrameBufferByIndex(2);
+#if LVGL_PORT_ENABLE_ROTATION_AUTOTUNE && ((LVGL_PORT_ROTATION_DEGREE == 90) || (LVGL_PORT_ROTATION_DEGREE == 270))
+    // The frame buffer 1 is not displayed yet and will be fully redrawn by the first frame
+    rotation_autotune(lvgl_buf[0], lcd->getFrameBufferByIndex(1));
+#endif
 
 #elif LVGL_PORT_DISP_BUFFER_NUM >= 2
 
@@ -611,7 +577,10 @@ static lv_disp_t *display_init(ESP_PanelLcd *lcd)
     disp_drv.ver_res = LVGL_PORT_DISP_HEIGHT;
 #endif
 #if LVGL_PORT_AVOID_TEAR    // Only available when the tearing effect is enabled
-#if LVGL_PORT_FULL_REFRESH
+#if LVGL_PORT_FULL_REFRESH && (LVGL_PORT_DISP_BUFFER_NUM >= 3) && (LVGL_PORT_ROTATION_DEGREE != 0)
+    // Only render the dirty areas, they will be rotated into the LCD frame buffers by `flush_callback()`
+    disp_drv.direct_mode = 1;
+#elif LVGL_PORT_FULL_REFRESH
     disp_drv.full_refresh = 1;
 #elif LVGL_PORT_DIRECT_MODE
     disp_drv.direct_mode = 1;
@@ -780,6 +749,15 @@ bool lvgl_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *tp)
     lvgl_mux = xSemaphoreCreateRecursiveMutex();
     ESP_PANEL_CHECK_NULL_RET(lvgl_mux, false, "Create LVGL mutex failed");
 
+#if (LVGL_PORT_ROTATION_DEGREE != 0) && LVGL_PORT_ENABLE_ROTATION_PARALLEL && !CONFIG_FREERTOS_UNICORE
+    ESP_LOGD(TAG, "Create rotation worker");
+    esp_panel_pixel_worker_config_t worker_config = ESP_PANEL_PIXEL_WORKER_CONFIG_DEFAULT();
+    // Pin the worker to the core which is not used by the LVGL task
+    worker_config.core_id = (LVGL_PORT_TASK_CORE == 0) ? 1 : 0;
+    lvgl_rotate_worker = esp_panel_pixel_worker_new(&worker_config);
+    ESP_PANEL_CHECK_NULL_RET(lvgl_rotate_worker, false, "Create rotation worker failed");
+#endif
+
     ESP_LOGD(TAG, "Create LVGL task");
     BaseType_t core_id = (LVGL_PORT_TASK_CORE < 0) ? tskNO_AFFINITY : LVGL_PORT_TASK_CORE;
     BaseType_t ret = xTaskCreatePinnedToCore(lvgl_port_task, "lvgl", LVGL_PORT_TASK_STACK_SIZE, NULL,
@@ -823,6 +801,11 @@ bool lvgl_port_deinit(void)
     }
     ESP_PANEL_CHECK_FALSE_RET(lvgl_port_unlock(), false, "Unlock LVGL failed");
 
+#if (LVGL_PORT_ROTATION_DEGREE != 0) && LVGL_PORT_ENABLE_ROTATION_PARALLEL
+    esp_panel_pixel_worker_del(lvgl_rotate_worker);
+    lvgl_rotate_worker = NULL;
+#endif
+
 #if LV_ENABLE_GC || !LV_MEM_CUSTOM
     lv_deinit();
 #endif
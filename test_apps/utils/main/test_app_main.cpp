@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <stdio.h>
+#include "unity.h"
+#include "unity_test_runner.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+extern "C" void app_main(void)
+{
+    /**
+     *  __    __  ________  ______  __         ______
+     * |  \  |  \|        \|      \|  \       /      \
+     * | $$  | $$ \$$$$$$$$ \$$$$$$| $$      |  $$$$$$\
+     * | $$  | $$   | $$     | $$  | $$      | $$___\$$
+     * | $$  | $$   | $$     | $$  | $$       \$$    \
+     * | $$  | $$   | $$     | $$  | $$       _\$$$$$$\
+     * | $$__/ $$   | $$    _| $$_ | $$_____ |  \__| $$
+     *  \$$    $$   | $$   |   $$ \| $$     \ \$$    $$
+     *   \$$$$$$     \$$    \$$$$$$ \$$$$$$$$  \$$$$$$
+     */
+    printf(" __    __  ________  ______  __         ______\r\n");
+    printf("|  \\  |  \\|        \\|      \\|  \\       /      \\\r\n");
+    printf("| $$  | $$ \\$$$$$$$$ \\$$$$$$| $$      |  $$$$$$\\\r\n");
+    printf("| $$  | $$   | $$     | $$  | $$      | $$___\\$$\r\n");
+    printf("| $$  | $$   | $$     | $$  | $$       \\$$    \\\r\n");
+    printf("| $$  | $$   | $$     | $$  | $$       _\\$$$$$$\\\r\n");
+    printf("| $$__/ $$   | $$    _| $$_ | $$_____ |  \\__| $$\r\n");
+    printf(" \\$$    $$   | $$   |   $$ \\| $$     \\ \\$$    $$\r\n");
+    printf("  \\$$$$$$     \\$$    \\$$$$$$ \\$$$$$$$$  \\$$$$$$\r\n");
+    unity_run_menu();
+}
@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_boot.h"
+
+using namespace std;
+
+// A simulated millisecond, so the delays of the drivers are kept in proportion while the tests stay short
+#define TEST_MS_US          (200)
+#define TEST_RANDOM_NUM     (50)
+
+#define TEST_BUS_I2C0       (1UL << 0)
+#define TEST_BUS_SPI2       (1UL << 1)
+#define TEST_BUS_RGB        (1UL << 2)
+
+/**
+ * Simulated device: it waits like the resets of the drivers, and checks no other step is using its buses at the same
+ * time
+ */
+typedef struct {
+    uint32_t delay_ms;
+    bool result;
+    uint32_t buses;
+    atomic<uint32_t> *busy_buses;
+    atomic<int> *running;
+    int max_running;
+    bool is_conflicted;
+} test_device_t;
+
+static bool test_device_begin(void *ctx)
+{
+    test_device_t *device = (test_device_t *)ctx;
+
+    if (device->busy_buses->fetch_or(device->buses) & device->buses) {
+        device->is_conflicted = true;
+    }
+    device->max_running = ++(*device->running);
+    this_thread::sleep_for(chrono::microseconds(device->delay_ms * TEST_MS_US));
+    (*device->running)--;
+    device->busy_buses->fetch_and(~device->buses);
+
+    return device->result;
+}
+
+typedef struct {
+    atomic<uint32_t> busy_buses;
+    atomic<int> running;
+    test_device_t devices[ESP_PANEL_BOOT_STEP_NUM_MAX];
+    esp_panel_boot_step_t steps[ESP_PANEL_BOOT_STEP_NUM_MAX];
+    uint8_t num;
+} test_board_t;
+
+static void board_add(test_board_t &board, const char *name, uint32_t delay_ms, uint32_t buses, uint32_t deps,
+                      bool result = true)
+{
+    test_device_t *device = &board.devices[board.num];
+    device->delay_ms = delay_ms;
+    device->result = result;
+    device->buses = buses;
+    device->busy_buses = &board.busy_buses;
+    device->running = &board.running;
+    board.steps[board.num] = {name, test_device_begin, device, deps, buses};
+    board.num++;
+}
+
+/**
+ * Same steps as `ESP_Panel::begin()` on a board with an SPI LCD (like GC9A01: resets for 40 ms, waits 100 ms and
+ * sends the sequence with 140 ms delays) and an I2C touch (like CST816S: resets for 400 ms) sharing the I2C bus with
+ * the IO expander
+ */
+static void board_init(test_board_t &board)
+{
+    board_add(board, "expander", 5, TEST_BUS_I2C0, 0);
+    board_add(board, "lcd", 280, TEST_BUS_SPI2, ESP_PANEL_BOOT_STEP(0));
+    board_add(board, "touch", 400, TEST_BUS_I2C0, ESP_PANEL_BOOT_STEP(0));
+    board_add(board, "backlight", 1, 0, ESP_PANEL_BOOT_STEP(1));
+}
+
+static void check_timeline(const test_board_t &board, const esp_panel_boot_timeline_t &timeline)
+{
+    TEST_ASSERT_EQUAL(board.num, timeline.num);
+    for (int i = 0; i < board.num; i++) {
+        const esp_panel_boot_record_t &record = timeline.records[i];
+        TEST_ASSERT_FALSE(board.devices[i].is_conflicted);
+        if (!record.flags.is_run) {
+            continue;
+        }
+        TEST_ASSERT_TRUE(record.start_us <= record.end_us);
+        TEST_ASSERT_TRUE(record.end_us <= timeline.total_us);
+        for (int j = 0; j < board.num; j++) {
+            const esp_panel_boot_record_t &other = timeline.records[j];
+            // Started after the dependencies are done
+            if (board.steps[i].deps & ESP_PANEL_BOOT_STEP(j)) {
+                TEST_ASSERT_TRUE(other.flags.is_run && other.flags.is_ok);
+                TEST_ASSERT_TRUE(other.end_us <= record.start_us);
+            }
+            // Never overlapped with the steps sharing a bus
+            if ((j != i) && other.flags.is_run && (board.steps[i].buses & board.steps[j].buses)) {
+                TEST_ASSERT_TRUE((other.end_us <= record.start_us) || (record.end_us <= other.start_us));
+            }
+        }
+    }
+}
+
+static void print_timeline(const esp_panel_boot_timeline_t &timeline)
+{
+    printf("| step | worker | start (ms) | end (ms) |\n");
+    for (int i = 0; i < timeline.num; i++) {
+        const esp_panel_boot_record_t &record = timeline.records[i];
+        printf("| %s | %6d | %10.1f | %8.1f |\n", record.name, record.worker, (double)record.start_us / TEST_MS_US,
+               (double)record.end_us / TEST_MS_US);
+    }
+    printf("total %.1f ms, busy %.1f ms\n", (double)timeline.total_us / TEST_MS_US,
+           (double)timeline.busy_us / TEST_MS_US);
+}
+
+TEST_CASE("Test boot runs the steps in order without helper threads", "[utils][boot]")
+{
+    test_board_t board = {};
+    board_init(board);
+    esp_panel_boot_timeline_t timeline = {};
+
+    TEST_ASSERT_TRUE(esp_panel_boot_run(NULL, board.steps, board.num, &timeline));
+    check_timeline(board, timeline);
+    TEST_ASSERT_EQUAL(-1, timeline.failed_step);
+    for (int i = 0; i < board.num; i++) {
+        TEST_ASSERT_TRUE(timeline.records[i].flags.is_ok);
+        TEST_ASSERT_EQUAL(0, timeline.records[i].worker);
+        TEST_ASSERT_EQUAL(1, board.devices[i].max_running);
+        if (i > 0) {
+            TEST_ASSERT_TRUE(timeline.records[i - 1].end_us <= timeline.records[i].start_us);
+        }
+    }
+}
+
+TEST_CASE("Test boot overlaps the steps on different buses", "[utils][boot]")
+{
+    test_board_t board = {};
+    board_init(board);
+    esp_panel_boot_config_t config = ESP_PANEL_BOOT_CONFIG_DEFAULT();
+    config.num_workers = 2;
+    esp_panel_boot_timeline_t timeline = {};
+
+    TEST_ASSERT_TRUE(esp_panel_boot_run(&config, board.steps, board.num, &timeline));
+    check_timeline(board, timeline);
+    print_timeline(timeline);
+    // The LCD and the touch run at the same time, so the whole bring-up takes about the time of the touch
+    TEST_ASSERT_TRUE(timeline.records[2].start_us < timeline.records[1].end_us);
+    TEST_ASSERT_TRUE(timeline.records[1].start_us < timeline.records[2].end_us);
+    TEST_ASSERT_TRUE(timeline.total_us < timeline.busy_us * 3 / 4);
+}
+
+TEST_CASE("Test boot keeps the constraints of the random graphs", "[utils][boot]")
+{
+    srand(20);
+    for (int n = 0; n < TEST_RANDOM_NUM; n++) {
+        test_board_t board = {};
+        int num = 1 + rand() % ESP_PANEL_BOOT_STEP_NUM_MAX;
+        int fail_index = (rand() % 4 == 0) ? (rand() % num) : -1;
+        for (int i = 0; i < num; i++) {
+            uint32_t deps = (i > 0) ? (rand() & (ESP_PANEL_BOOT_STEP(i) - 1) & rand()) : 0;
+            board_add(board, "step", rand() % 4, rand() & 0x7, deps, i != fail_index);
+        }
+        esp_panel_boot_config_t config = ESP_PANEL_BOOT_CONFIG_DEFAULT();
+        config.num_workers = rand() % (ESP_PANEL_BOOT_WORKER_NUM_MAX + 1);
+        esp_panel_boot_timeline_t timeline = {};
+
+        TEST_ASSERT_EQUAL(fail_index < 0, esp_panel_boot_run(&config, board.steps, board.num, &timeline));
+        check_timeline(board, timeline);
+        if (fail_index < 0) {
+            TEST_ASSERT_EQUAL(-1, timeline.failed_step);
+            for (int i = 0; i < num; i++) {
+                TEST_ASSERT_TRUE(timeline.records[i].flags.is_run);
+            }
+        } else {
+            TEST_ASSERT_EQUAL(fail_index, timeline.failed_step);
+            // No step starts after the failure
+            for (int i = 0; i < num; i++) {
+                if (timeline.records[i].flags.is_run) {
+                    TEST_ASSERT_TRUE(timeline.records[i].start_us <= timeline.records[fail_index].end_us);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test boot stops at the failed step", "[utils][boot]")
+{
+    test_board_t board = {};
+    board_add(board, "expander", 1, TEST_BUS_I2C0, 0);
+    board_add(board, "lcd", 1, TEST_BUS_SPI2, ESP_PANEL_BOOT_STEP(0), false);
+    board_add(board, "backlight", 1, 0, ESP_PANEL_BOOT_STEP(1));
+    esp_panel_boot_timeline_t timeline = {};
+
+    TEST_ASSERT_FALSE(esp_panel_boot_run(NULL, board.steps, board.num, &timeline));
+    TEST_ASSERT_EQUAL(1, timeline.failed_step);
+    TEST_ASSERT_TRUE(timeline.records[1].flags.is_run);
+    TEST_ASSERT_FALSE(timeline.records[1].flags.is_ok);
+    TEST_ASSERT_FALSE(timeline.records[2].flags.is_run);
+
+    // The dependencies must be the previous steps
+    esp_panel_boot_config_t config = ESP_PANEL_BOOT_CONFIG_DEFAULT();
+    board.steps[1].deps = ESP_PANEL_BOOT_STEP(2);
+    TEST_ASSERT_FALSE(esp_panel_boot_run(&config, board.steps, board.num, NULL));
+    board.steps[1].deps = ESP_PANEL_BOOT_STEP(1);
+    TEST_ASSERT_FALSE(esp_panel_boot_run(&config, board.steps, board.num, NULL));
+    board.steps[1].deps = 0;
+    board.steps[1].func = NULL;
+    TEST_ASSERT_FALSE(esp_panel_boot_run(&config, board.steps, board.num, NULL));
+    config.num_workers = ESP_PANEL_BOOT_WORKER_NUM_MAX + 1;
+    TEST_ASSERT_FALSE(esp_panel_boot_run(&config, board.steps, 0, NULL));
+    TEST_ASSERT_FALSE(esp_panel_boot_run(NULL, NULL, 1, NULL));
+    TEST_ASSERT_TRUE(esp_panel_boot_run(NULL, NULL, 0, NULL));
+}
+
+TEST_CASE("Benchmark boot in order and in parallel", "[utils][boot][benchmark]")
+{
+    printf("| board | in order (ms) | parallel (ms) |\n");
+    for (int kind = 0; kind < 3; kind++) {
+        uint32_t total_us[2] = {};
+        const char *name = "";
+        for (int parallel = 0; parallel < 2; parallel++) {
+            test_board_t board = {};
+            if (kind == 0) {
+                name = "SPI LCD + I2C touch + expander";
+                board_init(board);
+            } else if (kind == 1) {
+                // RGB LCD with a 3-wire SPI through the expander (like ST7701), and a GT911 touch on the same I2C
+                name = "RGB LCD (3-wire on expander) + I2C touch";
+                board_add(board, "expander", 5, TEST_BUS_I2C0, 0);
+                board_add(board, "lcd", 250, TEST_BUS_RGB | TEST_BUS_I2C0, ESP_PANEL_BOOT_STEP(0));
+                board_add(board, "touch", 210, TEST_BUS_I2C0, ESP_PANEL_BOOT_STEP(0));
+                board_add(board, "backlight", 1, 0, ESP_PANEL_BOOT_STEP(1));
+            } else {
+                // QSPI LCD (like SPD2010: 120 ms sleep-out) and a touch on the I2C without an expander
+                name = "QSPI LCD + I2C touch";
+                board_add(board, "lcd", 300, TEST_BUS_SPI2, 0);
+                board_add(board, "touch", 250, TEST_BUS_I2C0, 0);
+                board_add(board, "backlight", 1, 0, ESP_PANEL_BOOT_STEP(0));
+            }
+            esp_panel_boot_config_t config = ESP_PANEL_BOOT_CONFIG_DEFAULT();
+            config.num_workers = parallel ? 2 : 0;
+            esp_panel_boot_timeline_t timeline = {};
+            TEST_ASSERT_TRUE(esp_panel_boot_run(&config, board.steps, board.num, &timeline));
+            check_timeline(board, timeline);
+            total_us[parallel] = timeline.total_us;
+        }
+        printf("| %s | %13.1f | %13.1f |\n", name, (double)total_us[0] / TEST_MS_US, (double)total_us[1] / TEST_MS_US);
+    }
+}
@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_color_stream.h"
+
+using namespace std;
+
+#define TEST_BUF_SIZE           (1000)
+#define TEST_STREAM_SIZE        (320 * 240 * 2 + 77)
+#define TEST_CMD                (0x2C)
+#define TEST_CONTINUE_CMD       (0x3C)
+#define TEST_QUEUE_DEPTH        (4)
+
+/**
+ * Loopback panel IO: the transfers are queued and "sent" in order by another thread, which reads the buffer at the end
+ * of the transfer like DMA, so a buffer overwritten in flight corrupts the received data
+ */
+typedef struct {
+    int cmd;
+    const uint8_t *data;
+    size_t size;
+} test_trans_t;
+
+class TestLoopbackIO {
+public:
+    TestLoopbackIO(int trans_time_us):
+        stream(NULL), _trans_time_us(trans_time_us), _is_running(true)
+    {
+        _thread = thread([this]() {
+            this->run();
+        });
+    }
+
+    ~TestLoopbackIO()
+    {
+        {
+            lock_guard<mutex> lock(_mutex);
+            _is_running = false;
+        }
+        _cv.notify_all();
+        _thread.join();
+    }
+
+    static bool send(void *user_ctx, int cmd, const void *data, size_t size)
+    {
+        TestLoopbackIO *io = (TestLoopbackIO *)user_ctx;
+        unique_lock<mutex> lock(io->_mutex);
+        io->_cv.wait(lock, [io]() {
+            return io->_trans.size() < TEST_QUEUE_DEPTH;
+        });
+        io->_trans.push_back({cmd, (const uint8_t *)data, size});
+        io->_cv.notify_all();
+
+        return true;
+    }
+
+    static bool wait(void *user_ctx, uint32_t token)
+    {
+        TestLoopbackIO *io = (TestLoopbackIO *)user_ctx;
+        unique_lock<mutex> lock(io->_mutex);
+        io->_cv.wait(lock, [io, token]() {
+            return esp_panel_color_stream_is_done(io->stream, token);
+        });
+
+        return true;
+    }
+
+    esp_panel_color_stream_handle_t stream;
+    vector<uint8_t> received;
+    vector<int> cmds;
+
+private:
+    void run(void)
+    {
+        unique_lock<mutex> lock(_mutex);
+        while (true) {
+            _cv.wait(lock, [this]() {
+                return !_trans.empty() || !_is_running;
+            });
+            if (_trans.empty()) {
+                break;
+            }
+            test_trans_t trans = _trans.front();
+            lock.unlock();
+            this_thread::sleep_for(chrono::microseconds(_trans_time_us));
+            lock.lock();
+            _trans.pop_front();
+            received.insert(received.end(), trans.data, trans.data + trans.size);
+            cmds.push_back(trans.cmd);
+            esp_panel_color_stream_on_done(stream);
+            _cv.notify_all();
+        }
+    }
+
+    int _trans_time_us;
+    bool _is_running;
+    deque<test_trans_t> _trans;
+    mutex _mutex;
+    condition_variable _cv;
+    thread _thread;
+};
+
+static void run_stream(int trans_time_us, int continue_cmd, esp_panel_color_stream_stats_t &stats)
+{
+    vector<uint8_t> bufs[ESP_PANEL_COLOR_STREAM_BUF_NUM];
+    TestLoopbackIO io(trans_time_us);
+    esp_panel_color_stream_config_t config = {};
+    for (int i = 0; i < ESP_PANEL_COLOR_STREAM_BUF_NUM; i++) {
+        bufs[i].resize(TEST_BUF_SIZE);
+        config.bufs[i] = bufs[i].data();
+    }
+    config.buf_size = TEST_BUF_SIZE;
+    config.tx_cb = TestLoopbackIO::send;
+    config.wait_cb = TestLoopbackIO::wait;
+    config.user_ctx = &io;
+    io.stream = esp_panel_color_stream_new(&config);
+    TEST_ASSERT_NOT_NULL(io.stream);
+
+    // The pixels are produced in pieces of random sizes from a reused scratch buffer, like lines of a decoder
+    vector<uint8_t> source(TEST_STREAM_SIZE);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = rand();
+    }
+    vector<uint8_t> scratch(3 * TEST_BUF_SIZE);
+    TEST_ASSERT_TRUE(esp_panel_color_stream_begin(io.stream, TEST_CMD, continue_cmd));
+    TEST_ASSERT_FALSE(esp_panel_color_stream_begin(io.stream, TEST_CMD, continue_cmd));
+    size_t offset = 0;
+    while (offset < source.size()) {
+        size_t size = min((size_t)(rand() % scratch.size()), source.size() - offset);
+        memcpy(scratch.data(), source.data() + offset, size);
+        TEST_ASSERT_TRUE(esp_panel_color_stream_write(io.stream, scratch.data(), size));
+        memset(scratch.data(), 0, size);
+        offset += size;
+    }
+    TEST_ASSERT_TRUE(esp_panel_color_stream_end(io.stream));
+    TEST_ASSERT_FALSE(esp_panel_color_stream_end(io.stream));
+    TEST_ASSERT_FALSE(esp_panel_color_stream_write(io.stream, source.data(), 1));
+
+    // All the data is received in order after the stream is ended
+    TEST_ASSERT_EQUAL(source.size(), io.received.size());
+    TEST_ASSERT_EQUAL(0, memcmp(source.data(), io.received.data(), source.size()));
+    TEST_ASSERT_EQUAL(TEST_CMD, io.cmds[0]);
+    for (size_t i = 1; i < io.cmds.size(); i++) {
+        TEST_ASSERT_EQUAL(continue_cmd, io.cmds[i]);
+    }
+
+    TEST_ASSERT_TRUE(esp_panel_color_stream_get_stats(io.stream, &stats, true));
+    TEST_ASSERT_EQUAL(source.size(), stats.bytes);
+    TEST_ASSERT_EQUAL(io.cmds.size(), stats.transfers);
+    TEST_ASSERT_EQUAL((TEST_STREAM_SIZE + TEST_BUF_SIZE - 1) / TEST_BUF_SIZE, stats.transfers);
+    TEST_ASSERT_EQUAL(1, stats.streams);
+    esp_panel_color_stream_del(io.stream);
+}
+
+TEST_CASE("Test color stream sends the pieces in order through the buffers", "[utils][color_stream]")
+{
+    esp_panel_color_stream_stats_t stats = {};
+
+    srand(13);
+    run_stream(0, -1, stats);
+    // A slow bus makes the writing wait for the buffers
+    run_stream(200, TEST_CONTINUE_CMD, stats);
+    TEST_ASSERT_NOT_EQUAL(0, stats.stalls);
+}
+
+TEST_CASE("Test color stream checks the arguments", "[utils][color_stream]")
+{
+    uint8_t buf[4] = {};
+    esp_panel_color_stream_config_t config = {};
+    TEST_ASSERT_NULL(esp_panel_color_stream_new(NULL));
+    TEST_ASSERT_NULL(esp_panel_color_stream_new(&config));
+    config.bufs[0] = buf;
+    config.bufs[1] = buf;
+    config.buf_size = sizeof(buf);
+    config.tx_cb = TestLoopbackIO::send;
+    TEST_ASSERT_NULL(esp_panel_color_stream_new(&config));
+
+    TEST_ASSERT_FALSE(esp_panel_color_stream_begin(NULL, TEST_CMD, -1));
+    TEST_ASSERT_FALSE(esp_panel_color_stream_write(NULL, buf, 1));
+    TEST_ASSERT_FALSE(esp_panel_color_stream_end(NULL));
+    TEST_ASSERT_FALSE(esp_panel_color_stream_is_active(NULL));
+}
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_draw_bounce.h"
+#include "utils/esp_panel_draw_queue.h"
+
+using namespace std;
+
+#define TEST_LCD_WIDTH          (320)
+#define TEST_LCD_HEIGHT         (240)
+#define TEST_BYTES_PER_PIXEL    (2)
+#define TEST_BUF_SIZE           (8192)
+#define TEST_QUEUE_DEPTH        (10)
+
+typedef struct {
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t x_end;
+    uint16_t y_end;
+    const uint8_t *data;
+    bool is_last;
+} test_band_t;
+
+/**
+ * Mock panel: the bands are sent in order by another thread, which reads the buffer at the end of the transfer like
+ * DMA and writes the rows into the frame, so a buffer overwritten in flight corrupts the frame
+ */
+class TestBouncePanel {
+public:
+    TestBouncePanel(int line_time_us):
+        frame(TEST_LCD_WIDTH * TEST_LCD_HEIGHT * TEST_BYTES_PER_PIXEL), notify_count(0), queue{},
+        _line_time_us(line_time_us), _is_running(true)
+    {
+        _thread = thread([this]() {
+            this->run();
+        });
+    }
+
+    ~TestBouncePanel()
+    {
+        {
+            lock_guard<mutex> lock(_mutex);
+            _is_running = false;
+        }
+        _cv.notify_all();
+        _thread.join();
+    }
+
+    static bool draw(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                     const void *data, bool is_last, uint32_t *token)
+    {
+        TestBouncePanel *panel = (TestBouncePanel *)user_ctx;
+        unique_lock<mutex> lock(panel->_mutex);
+        panel->_cv.wait(lock, [panel]() {
+            return panel->_bands.size() < TEST_QUEUE_DEPTH;
+        });
+        *token = esp_panel_draw_queue_prepare(&panel->queue, is_last);
+        panel->_bands.push_back({x_start, y_start, x_end, y_end, (const uint8_t *)data, is_last});
+        esp_panel_draw_queue_commit(&panel->queue, *token);
+        panel->bands.push_back(panel->_bands.back());
+        panel->_cv.notify_all();
+
+        return true;
+    }
+
+    static bool wait(void *user_ctx, uint32_t token)
+    {
+        TestBouncePanel *panel = (TestBouncePanel *)user_ctx;
+        unique_lock<mutex> lock(panel->_mutex);
+        panel->_cv.wait(lock, [panel, token]() {
+            return esp_panel_draw_queue_is_done(&panel->queue, token);
+        });
+
+        return true;
+    }
+
+    void waitAll(void)
+    {
+        wait(this, queue.submit_seq);
+    }
+
+    static int64_t getTimeUs(void)
+    {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    vector<uint8_t> frame;
+    vector<test_band_t> bands;
+    int notify_count;
+    esp_panel_draw_queue_t queue;
+
+private:
+    void run(void)
+    {
+        unique_lock<mutex> lock(_mutex);
+        while (true) {
+            _cv.wait(lock, [this]() {
+                return !_bands.empty() || !_is_running;
+            });
+            if (_bands.empty()) {
+                break;
+            }
+            test_band_t band = _bands.front();
+            lock.unlock();
+            this_thread::sleep_for(chrono::microseconds(_line_time_us * (band.y_end - band.y_start)));
+            size_t line_size = (band.x_end - band.x_start) * TEST_BYTES_PER_PIXEL;
+            for (int y = band.y_start; y < band.y_end; y++) {
+                memcpy(frame.data() + (y * TEST_LCD_WIDTH + band.x_start) * TEST_BYTES_PER_PIXEL,
+                       band.data + (y - band.y_start) * line_size, line_size);
+            }
+            lock.lock();
+            _bands.pop_front();
+            notify_count += esp_panel_draw_queue_on_done(&queue) ? 1 : 0;
+            _cv.notify_all();
+        }
+    }
+
+    int _line_time_us;
+    bool _is_running;
+    deque<test_band_t> _bands;
+    mutex _mutex;
+    condition_variable _cv;
+    thread _thread;
+};
+
+static esp_panel_draw_bounce_handle_t create_bounce(TestBouncePanel &panel, vector<uint8_t> *bufs)
+{
+    esp_panel_draw_bounce_config_t config = {};
+    for (int i = 0; i < ESP_PANEL_DRAW_BOUNCE_BUF_NUM; i++) {
+        bufs[i].resize(TEST_BUF_SIZE);
+        config.bufs[i] = bufs[i].data();
+    }
+    config.buf_size = TEST_BUF_SIZE;
+    config.draw_cb = TestBouncePanel::draw;
+    config.wait_cb = TestBouncePanel::wait;
+    config.get_time_us = TestBouncePanel::getTimeUs;
+    config.user_ctx = &panel;
+    esp_panel_draw_bounce_handle_t bounce = esp_panel_draw_bounce_new(&config);
+    TEST_ASSERT_NOT_NULL(bounce);
+
+    return bounce;
+}
+
+static void test_bounce_area(TestBouncePanel &panel, esp_panel_draw_bounce_handle_t bounce, uint16_t x_start,
+                             uint16_t y_start, uint16_t width, uint16_t height, uint8_t y_align)
+{
+    vector<uint8_t> bitmap((size_t)width * height * TEST_BYTES_PER_PIXEL);
+    for (auto &byte : bitmap) {
+        byte = rand();
+    }
+    vector<uint8_t> expect = bitmap;
+    size_t band_index = panel.bands.size();
+    int notify_count = panel.notify_count;
+
+    TEST_ASSERT_TRUE(esp_panel_draw_bounce_bitmap(
+                         bounce, x_start, y_start, x_start + width, y_start + height, bitmap.data(),
+                         TEST_BYTES_PER_PIXEL, y_align, true
+                     ));
+    // The bitmap can be reused once the function returns
+    memset(bitmap.data(), 0, bitmap.size());
+    panel.waitAll();
+
+    size_t line_size = (size_t)width * TEST_BYTES_PER_PIXEL;
+    for (int y = 0; y < height; y++) {
+        TEST_ASSERT_EQUAL(0, memcmp(
+                              panel.frame.data() + ((y_start + y) * TEST_LCD_WIDTH + x_start) * TEST_BYTES_PER_PIXEL,
+                              expect.data() + y * line_size, line_size
+                          ));
+    }
+    uint16_t y = y_start;
+    for (size_t i = band_index; i < panel.bands.size(); i++) {
+        const test_band_t &band = panel.bands[i];
+        TEST_ASSERT_EQUAL(y, band.y_start);
+        TEST_ASSERT_TRUE((size_t)(band.y_end - band.y_start) * line_size <= TEST_BUF_SIZE);
+        TEST_ASSERT_EQUAL(i == panel.bands.size() - 1, band.is_last);
+        if (!band.is_last) {
+            TEST_ASSERT_EQUAL(0, (band.y_end - band.y_start) % y_align);
+        }
+        y = band.y_end;
+    }
+    TEST_ASSERT_EQUAL(y_start + height, y);
+    TEST_ASSERT_EQUAL(notify_count + 1, panel.notify_count);
+}
+
+TEST_CASE("Test draw bounce copies the bitmap band by band", "[utils][draw_bounce]")
+{
+    vector<uint8_t> bufs[ESP_PANEL_DRAW_BOUNCE_BUF_NUM];
+    TestBouncePanel panel(20);
+    esp_panel_draw_bounce_handle_t bounce = create_bounce(panel, bufs);
+    esp_panel_draw_bounce_stats_t stats = {};
+
+    srand(14);
+    test_bounce_area(panel, bounce, 0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT, 1);
+    test_bounce_area(panel, bounce, 10, 20, 100, 3, 1);
+    test_bounce_area(panel, bounce, 2, 4, 202, 180, 2);
+    test_bounce_area(panel, bounce, 0, 0, TEST_LCD_WIDTH, TEST_LCD_HEIGHT, 6);
+
+    TEST_ASSERT_TRUE(esp_panel_draw_bounce_get_stats(bounce, &stats, true));
+    TEST_ASSERT_EQUAL(4, stats.frames);
+    TEST_ASSERT_EQUAL(panel.bands.size(), stats.bands);
+    // The bus is slower than the copies here, so the copies wait for the buffers
+    TEST_ASSERT_TRUE(stats.wait_us > stats.copy_us);
+    TEST_ASSERT_TRUE(stats.frame_us >= stats.wait_us + stats.copy_us);
+    printf("| frames | bands | copy (us) | wait (us) | frame (us) |\n");
+    printf("| %6d | %5d | %9d | %9d | %10d |\n", (int)stats.frames, (int)stats.bands, (int)stats.copy_us,
+           (int)stats.wait_us, (int)stats.frame_us);
+    TEST_ASSERT_TRUE(esp_panel_draw_bounce_get_stats(bounce, &stats, false));
+    TEST_ASSERT_EQUAL(0, stats.frames);
+
+    // The buffers can't hold the aligned lines
+    uint8_t data[4] = {};
+    TEST_ASSERT_FALSE(esp_panel_draw_bounce_bitmap(bounce, 0, 0, 4000, 2, data, TEST_BYTES_PER_PIXEL, 2, true));
+    TEST_ASSERT_FALSE(esp_panel_draw_bounce_bitmap(bounce, 0, 0, 0, 2, data, TEST_BYTES_PER_PIXEL, 1, true));
+    TEST_ASSERT_FALSE(esp_panel_draw_bounce_bitmap(bounce, 0, 0, 1, 1, NULL, TEST_BYTES_PER_PIXEL, 1, true));
+    esp_panel_draw_bounce_del(bounce);
+}
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_draw_queue.h"
+
+using namespace std;
+
+#define TEST_BUS_QUEUE_DEPTH    (4)
+#define TEST_DRAW_NUM           (1000)
+#define TEST_BAND_NUM           (40)
+#define TEST_BAND_TIME_US       (300)
+
+/**
+ * Simulated panel IO: the transactions are queued with a limited depth and finished in order by another thread, which
+ * calls the finish "ISR" like the DMA done interrupt
+ */
+class TestPanelIO {
+public:
+    TestPanelIO(esp_panel_draw_queue_t &queue, int trans_time_us):
+        _queue(queue), _trans_time_us(trans_time_us), _is_running(true), _notify_count(0), _order_error(0)
+    {
+        _thread = thread([this]() {
+            this->run();
+        });
+    }
+
+    ~TestPanelIO()
+    {
+        {
+            lock_guard<mutex> lock(_mutex);
+            _is_running = false;
+        }
+        _cv.notify_all();
+        _thread.join();
+    }
+
+    // Like `esp_lcd_panel_draw_bitmap()`, it blocks only when the transaction queue is full
+    void draw(uint32_t token)
+    {
+        unique_lock<mutex> lock(_mutex);
+        _cv.wait(lock, [this]() {
+            return _trans.size() < TEST_BUS_QUEUE_DEPTH;
+        });
+        _trans.push_back(token);
+        _cv.notify_all();
+    }
+
+    // Like `waitDrawBitmapFinish()`, the semaphore is replaced by the condition variable
+    void wait(uint32_t token)
+    {
+        unique_lock<mutex> lock(_mutex);
+        _cv.wait(lock, [this, token]() {
+            return esp_panel_draw_queue_is_done(&_queue, token);
+        });
+    }
+
+    int getNotifyCount(void)
+    {
+        return _notify_count;
+    }
+
+    int getOrderError(void)
+    {
+        return _order_error;
+    }
+
+private:
+    void run(void)
+    {
+        unique_lock<mutex> lock(_mutex);
+        while (true) {
+            _cv.wait(lock, [this]() {
+                return !_trans.empty() || !_is_running;
+            });
+            if (_trans.empty()) {
+                break;
+            }
+            uint32_t token = _trans.front();
+            lock.unlock();
+            if (_trans_time_us > 0) {
+                this_thread::sleep_for(chrono::microseconds(_trans_time_us));
+            }
+            lock.lock();
+            _trans.pop_front();
+            // The oldest transaction is finished, so the done sequence should reach its token
+            if (esp_panel_draw_queue_on_done(&_queue)) {
+                _notify_count++;
+            }
+            if (_queue.done_seq != token) {
+                _order_error++;
+            }
+            _cv.notify_all();
+        }
+    }
+
+    esp_panel_draw_queue_t &_queue;
+    int _trans_time_us;
+    bool _is_running;
+    int _notify_count;
+    int _order_error;
+    deque<uint32_t> _trans;
+    mutex _mutex;
+    condition_variable _cv;
+    thread _thread;
+};
+
+static uint32_t submit_draw(esp_panel_draw_queue_t &queue, TestPanelIO &io, bool notify)
+{
+    uint32_t token = esp_panel_draw_queue_prepare(&queue, notify);
+    io.draw(token);
+    esp_panel_draw_queue_commit(&queue, token);
+
+    return token;
+}
+
+static void test_draw_queue_order(uint32_t start_seq)
+{
+    esp_panel_draw_queue_t queue = {};
+    queue.submit_seq = start_seq;
+    queue.done_seq = start_seq;
+    int expect_notify = 0;
+    uint32_t last_token = start_seq;
+
+    {
+        TestPanelIO io(queue, 0);
+        vector<uint32_t> tokens;
+        for (int i = 0; i < TEST_DRAW_NUM; i++) {
+            // Split drawings only notify at their last part
+            bool notify = ((i % 3) == 2);
+            uint32_t token = submit_draw(queue, io, notify);
+            TEST_ASSERT_EQUAL_UINT32(last_token + 1, token);
+            last_token = token;
+            expect_notify += notify ? 1 : 0;
+            tokens.push_back(token);
+
+            // Waiting for a token means all the drawings before it are finished, and none after it is reported
+            if ((i % 7) == 0) {
+                uint32_t wait_token = tokens[tokens.size() / 2];
+                io.wait(wait_token);
+                for (auto t : tokens) {
+                    if ((int32_t)(t - wait_token) <= 0) {
+                        TEST_ASSERT_TRUE(esp_panel_draw_queue_is_done(&queue, t));
+                    }
+                }
+                TEST_ASSERT_FALSE(esp_panel_draw_queue_is_done(&queue, last_token + 1));
+                TEST_ASSERT_TRUE(esp_panel_draw_queue_get_pending(&queue) <= TEST_BUS_QUEUE_DEPTH);
+            }
+        }
+        io.wait(last_token);
+        TEST_ASSERT_EQUAL(0, esp_panel_draw_queue_get_pending(&queue));
+        TEST_ASSERT_EQUAL(expect_notify, io.getNotifyCount());
+        TEST_ASSERT_EQUAL(0, io.getOrderError());
+    }
+    TEST_ASSERT_EQUAL_UINT32(start_seq + TEST_DRAW_NUM, queue.done_seq);
+}
+
+TEST_CASE("Test draw queue finishes the tokens in order", "[utils][draw_queue]")
+{
+    test_draw_queue_order(0);
+}
+
+TEST_CASE("Test draw queue tokens wrap around", "[utils][draw_queue]")
+{
+    test_draw_queue_order(UINT32_MAX - TEST_DRAW_NUM / 2);
+}
+
+TEST_CASE("Test draw queue handles a drawing finished before it is committed", "[utils][draw_queue]")
+{
+    esp_panel_draw_queue_t queue = {};
+
+    uint32_t token = esp_panel_draw_queue_prepare(&queue, true);
+    TEST_ASSERT_FALSE(esp_panel_draw_queue_is_done(&queue, token));
+    TEST_ASSERT_TRUE(esp_panel_draw_queue_on_done(&queue));
+    TEST_ASSERT_TRUE(esp_panel_draw_queue_is_done(&queue, token));
+    TEST_ASSERT_EQUAL(0, esp_panel_draw_queue_get_pending(&queue));
+    esp_panel_draw_queue_commit(&queue, token);
+    TEST_ASSERT_EQUAL(0, esp_panel_draw_queue_get_pending(&queue));
+
+    // A silent drawing doesn't notify even if its slot was used by a notifying one before
+    token = esp_panel_draw_queue_prepare(&queue, false);
+    esp_panel_draw_queue_commit(&queue, token);
+    TEST_ASSERT_EQUAL(1, esp_panel_draw_queue_get_pending(&queue));
+    TEST_ASSERT_FALSE(esp_panel_draw_queue_on_done(&queue));
+    for (int i = 0; i < ESP_PANEL_DRAW_QUEUE_DEPTH_MAX; i++) {
+        token = esp_panel_draw_queue_prepare(&queue, true);
+        esp_panel_draw_queue_commit(&queue, token);
+        TEST_ASSERT_TRUE(esp_panel_draw_queue_on_done(&queue));
+    }
+}
+
+static void render_band(void)
+{
+    auto end = chrono::steady_clock::now() + chrono::microseconds(TEST_BAND_TIME_US);
+    while (chrono::steady_clock::now() < end) {
+    }
+}
+
+TEST_CASE("Benchmark draw queue pipelined bands against waiting each", "[utils][draw_queue][benchmark]")
+{
+    esp_panel_draw_queue_t queue = {};
+    TestPanelIO io(queue, TEST_BAND_TIME_US);
+
+    // Render a band, then wait for it to be sent before rendering the next one into the same buffer
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < TEST_BAND_NUM; i++) {
+        render_band();
+        io.wait(submit_draw(queue, io, true));
+    }
+    auto sync_us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    // Render into two buffers, and only wait for the token of the band which used the buffer before
+    uint32_t buf_tokens[2] = {queue.submit_seq, queue.submit_seq};
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < TEST_BAND_NUM; i++) {
+        io.wait(buf_tokens[i % 2]);
+        render_band();
+        buf_tokens[i % 2] = submit_draw(queue, io, true);
+    }
+    io.wait(queue.submit_seq);
+    auto async_us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    printf("| bands | wait each (us) | pipelined (us) | speedup |\n");
+    printf("| %5d | %14d | %14d | %7.2f |\n", TEST_BAND_NUM, (int)sync_us, (int)async_us,
+           (double)sync_us / async_us);
+    TEST_ASSERT_TRUE(async_us < sync_us);
+}
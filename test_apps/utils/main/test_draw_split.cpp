@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_draw_queue.h"
+#include "utils/esp_panel_draw_split.h"
+
+using namespace std;
+
+#define TEST_MAX_TRANSFER_SIZE  ((1 << 18) >> 3)
+
+typedef struct {
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t x_end;
+    uint16_t y_end;
+    const uint8_t *data;
+    bool is_last;
+} test_band_t;
+
+/**
+ * Mock bus: every band is a single transfer queued with its token, and only the bands marked as last notify
+ */
+typedef struct {
+    vector<test_band_t> bands;
+    esp_panel_draw_queue_t queue;
+    size_t max_size;
+    uint8_t bytes_per_pixel;
+} test_bus_t;
+
+static bool test_bus_draw(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                          const void *data, bool is_last)
+{
+    test_bus_t *bus = (test_bus_t *)user_ctx;
+    size_t size = (size_t)(x_end - x_start) * (y_end - y_start) * bus->bytes_per_pixel;
+    TEST_ASSERT_TRUE(size <= bus->max_size);
+
+    uint32_t token = esp_panel_draw_queue_prepare(&bus->queue, is_last);
+    esp_panel_draw_queue_commit(&bus->queue, token);
+    bus->bands.push_back({x_start, y_start, x_end, y_end, (const uint8_t *)data, is_last});
+
+    return true;
+}
+
+static int test_bus_finish_all(test_bus_t &bus)
+{
+    int notify_count = 0;
+    while (esp_panel_draw_queue_get_pending(&bus.queue) > 0) {
+        notify_count += esp_panel_draw_queue_on_done(&bus.queue) ? 1 : 0;
+    }
+
+    return notify_count;
+}
+
+static void test_split(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, uint8_t bytes_per_pixel,
+                       uint8_t x_align, uint8_t y_align)
+{
+    test_bus_t bus = {};
+    bus.max_size = TEST_MAX_TRANSFER_SIZE;
+    bus.bytes_per_pixel = bytes_per_pixel;
+    size_t line_size = (size_t)width * bytes_per_pixel;
+    vector<uint8_t> bitmap(line_size * height);
+
+    TEST_ASSERT_TRUE(esp_panel_draw_split_bitmap(
+                         x_start, y_start, x_start + width, y_start + height, bitmap.data(), bytes_per_pixel,
+                         bus.max_size, y_align, test_bus_draw, &bus
+                     ));
+
+    // The bands cover the bitmap from top to bottom, and only the last one is marked
+    uint16_t y = y_start;
+    for (size_t i = 0; i < bus.bands.size(); i++) {
+        const test_band_t &band = bus.bands[i];
+        TEST_ASSERT_EQUAL(x_start, band.x_start);
+        TEST_ASSERT_EQUAL(x_start + width, band.x_end);
+        TEST_ASSERT_EQUAL(y, band.y_start);
+        TEST_ASSERT_EQUAL_PTR(bitmap.data() + (y - y_start) * line_size, band.data);
+        TEST_ASSERT_EQUAL(i == bus.bands.size() - 1, band.is_last);
+        // The coordinates sent to the panel keep the alignment
+        TEST_ASSERT_EQUAL(0, band.x_start % x_align);
+        TEST_ASSERT_EQUAL(0, band.x_end % x_align);
+        TEST_ASSERT_EQUAL(0, band.y_start % y_align);
+        TEST_ASSERT_EQUAL(0, band.y_end % y_align);
+        y = band.y_end;
+    }
+    TEST_ASSERT_EQUAL(y_start + height, y);
+    if (line_size * height > bus.max_size) {
+        TEST_ASSERT_TRUE(bus.bands.size() > 1);
+    } else {
+        TEST_ASSERT_EQUAL(1, bus.bands.size());
+    }
+
+    // The whole drawing is notified once
+    TEST_ASSERT_EQUAL(1, test_bus_finish_all(bus));
+}
+
+TEST_CASE("Test draw split keeps the bands in the transfer size", "[utils][draw_split]")
+{
+    // A full 320x240 RGB565 frame doesn't fit in a single transfer
+    test_split(0, 0, 320, 240, 2, 1, 1);
+    test_split(0, 0, 240, 320, 3, 1, 1);
+    test_split(10, 7, 100, 50, 2, 1, 1);
+    test_split(0, 0, 466, 466, 2, 2, 2);
+    test_split(12, 30, 368, 448, 2, 4, 1);
+    test_split(0, 0, 480, 480, 2, 1, 8);
+}
+
+TEST_CASE("Test draw split handles the corner cases", "[utils][draw_split]")
+{
+    uint8_t data[4] = {};
+    test_bus_t bus = {};
+    bus.max_size = SIZE_MAX;
+    bus.bytes_per_pixel = 2;
+
+    // The lines of a band are aligned down, but at least the alignment
+    TEST_ASSERT_EQUAL(64, esp_panel_draw_split_get_lines(512, 32768, 1));
+    TEST_ASSERT_EQUAL(60, esp_panel_draw_split_get_lines(512, 32768, 6));
+    TEST_ASSERT_EQUAL(2, esp_panel_draw_split_get_lines(40000, 32768, 2));
+    TEST_ASSERT_EQUAL(64, esp_panel_draw_split_get_lines(512, 32768, 0));
+    TEST_ASSERT_EQUAL(0, esp_panel_draw_split_get_lines(512, 0, 1));
+
+    // No limit means a single band
+    TEST_ASSERT_TRUE(esp_panel_draw_split_bitmap(0, 0, 1000, 1000, data, 2, 0, 1, test_bus_draw, &bus));
+    TEST_ASSERT_EQUAL(1, bus.bands.size());
+    TEST_ASSERT_TRUE(bus.bands[0].is_last);
+
+    TEST_ASSERT_FALSE(esp_panel_draw_split_bitmap(0, 0, 0, 1, data, 2, 0, 1, test_bus_draw, &bus));
+    TEST_ASSERT_FALSE(esp_panel_draw_split_bitmap(0, 1, 1, 1, data, 2, 0, 1, test_bus_draw, &bus));
+    TEST_ASSERT_FALSE(esp_panel_draw_split_bitmap(0, 0, 1, 1, NULL, 2, 0, 1, test_bus_draw, &bus));
+    TEST_ASSERT_FALSE(esp_panel_draw_split_bitmap(0, 0, 1, 1, data, 2, 0, 1, NULL, &bus));
+}
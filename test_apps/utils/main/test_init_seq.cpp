@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_init_seq.h"
+
+using namespace std;
+
+// Default initialization sequence of ST7701, in the table and the bytecode
+static const esp_panel_init_seq_cmd_t test_init_cmds[] = {
+//  {cmd, { data }, data_size, delay_ms}
+    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x13}, 5, 0},
+    {0xEF, (uint8_t []){0x08}, 1, 0},
+    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x10}, 5, 0},
+    {0xC0, (uint8_t []){0x3B, 0x00}, 2, 0},
+    {0xC1, (uint8_t []){0x10, 0x02}, 2, 0},
+    {0xC2, (uint8_t []){0x20, 0x06}, 2, 0},
+    {0xCC, (uint8_t []){0x10}, 1, 0},
+    {0xB0, (uint8_t []){0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF}, 16, 0},
+    {0xB1, (uint8_t []){0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B, 0x73, 0xFF}, 16, 0},
+    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x11}, 5, 0},
+    {0xB0, (uint8_t []){0x8D}, 1, 0},
+    {0xB1, (uint8_t []){0x48}, 1, 0},
+    {0xB2, (uint8_t []){0x89}, 1, 0},
+    {0xB3, (uint8_t []){0x80}, 1, 0},
+    {0xB5, (uint8_t []){0x49}, 1, 0},
+    {0xB7, (uint8_t []){0x85}, 1, 0},
+    {0xB8, (uint8_t []){0x32}, 1, 0},
+    {0xC1, (uint8_t []){0x78}, 1, 0},
+    {0xC2, (uint8_t []){0x78}, 1, 0},
+    {0xD0, (uint8_t []){0x88}, 1, 100},
+    {0xE0, (uint8_t []){0x00, 0x00, 0x02}, 3, 0},
+    {0xE1, (uint8_t []){0x05, 0xC0, 0x07, 0xC0, 0x04, 0xC0, 0x06, 0xC0, 0x00, 0x44, 0x44}, 11, 0},
+    {0xE2, (uint8_t []){0x00, 0x00, 0x33, 0x33, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00}, 13, 0},
+    {0xE3, (uint8_t []){0x00, 0x00, 0x11, 0x11}, 4, 0},
+    {0xE4, (uint8_t []){0x44, 0x44}, 2, 0},
+    {0xE5, (uint8_t []){0x0D, 0xF1, 0x10, 0x98, 0x0F, 0xF3, 0x10, 0x98, 0x09, 0xED, 0x10, 0x98, 0x0B, 0xEF, 0x10, 0x98}, 16, 0},
+    {0xE6, (uint8_t []){0x00, 0x00, 0x11, 0x11}, 4, 0},
+    {0xE7, (uint8_t []){0x44, 0x44}, 2, 0},
+    {0xE8, (uint8_t []){0x0C, 0xF0, 0x10, 0x98, 0x0E, 0xF2, 0x10, 0x98, 0x08, 0xEC, 0x10, 0x98, 0x0A, 0xEE, 0x10, 0x98}, 16, 0},
+    {0xEB, (uint8_t []){0x00, 0x01, 0xE4, 0xE4, 0x44, 0x88, 0x00}, 7, 0},
+    {0xED, (uint8_t []){0xFF, 0x04, 0x56, 0x7F, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xF7, 0x65, 0x40, 0xFF}, 16, 0},
+    {0xEF, (uint8_t []){0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F}, 6, 0},
+    {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x00}, 5, 0},
+    {0x11, (uint8_t []){0x00}, 0, 120},
+    {0x29, (uint8_t []){0x00}, 0, 0},
+};
+
+static const uint8_t test_init_seq[] = {
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x13),
+    ESP_PANEL_INIT_SEQ_CMD(0xEF, 0x08),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xC0, 0x3B, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x10, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x20, 0x06),
+    ESP_PANEL_INIT_SEQ_CMD(0xCC, 0x10),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B,
+            0x73, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x00, 0x13, 0x5A, 0x0F, 0x12, 0x07, 0x09, 0x08, 0x08, 0x24, 0x07, 0x13, 0x12, 0x6B,
+            0x73, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xB0, 0x8D),
+    ESP_PANEL_INIT_SEQ_CMD(0xB1, 0x48),
+    ESP_PANEL_INIT_SEQ_CMD(0xB2, 0x89),
+    ESP_PANEL_INIT_SEQ_CMD(0xB3, 0x80),
+    ESP_PANEL_INIT_SEQ_CMD(0xB5, 0x49),
+    ESP_PANEL_INIT_SEQ_CMD(0xB7, 0x85),
+    ESP_PANEL_INIT_SEQ_CMD(0xB8, 0x32),
+    ESP_PANEL_INIT_SEQ_CMD(0xC1, 0x78),
+    ESP_PANEL_INIT_SEQ_CMD(0xC2, 0x78),
+    ESP_PANEL_INIT_SEQ_CMD(0xD0, 0x88), ESP_PANEL_INIT_SEQ_DELAY(100),
+    ESP_PANEL_INIT_SEQ_CMD(0xE0, 0x00, 0x00, 0x02),
+    ESP_PANEL_INIT_SEQ_CMD(0xE1, 0x05, 0xC0, 0x07, 0xC0, 0x04, 0xC0, 0x06, 0xC0, 0x00, 0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0xE2, 0x00, 0x00, 0x33, 0x33, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xE3, 0x00, 0x00, 0x11, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xE4, 0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0xE5, 0x0D, 0xF1, 0x10, 0x98, 0x0F, 0xF3, 0x10, 0x98, 0x09, 0xED, 0x10, 0x98, 0x0B, 0xEF,
+            0x10, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0xE6, 0x00, 0x00, 0x11, 0x11),
+    ESP_PANEL_INIT_SEQ_CMD(0xE7, 0x44, 0x44),
+    ESP_PANEL_INIT_SEQ_CMD(0xE8, 0x0C, 0xF0, 0x10, 0x98, 0x0E, 0xF2, 0x10, 0x98, 0x08, 0xEC, 0x10, 0x98, 0x0A, 0xEE,
+            0x10, 0x98),
+    ESP_PANEL_INIT_SEQ_CMD(0xEB, 0x00, 0x01, 0xE4, 0xE4, 0x44, 0x88, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD(0xED, 0xFF, 0x04, 0x56, 0x7F, 0xBA, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAB, 0xF7, 0x65,
+            0x40, 0xFF),
+    ESP_PANEL_INIT_SEQ_CMD(0xEF, 0x10, 0x0D, 0x04, 0x08, 0x3F, 0x1F),
+    ESP_PANEL_INIT_SEQ_CMD(0xFF, 0x77, 0x01, 0x00, 0x00, 0x00),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11), ESP_PANEL_INIT_SEQ_DELAY(120),
+    ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x29),
+};
+
+#define TEST_CMDS_NUM   (sizeof(test_init_cmds) / sizeof(test_init_cmds[0]))
+
+/**
+ * Mock panel IO: the sent bytes are recorded with the command as a separator, and every `tx_param()` and delay call
+ * is counted
+ */
+typedef struct {
+    vector<int> bytes;
+    uint32_t tx_calls;
+    uint32_t delay_calls;
+    uint32_t delay_ms;
+} test_io_t;
+
+static void test_tx_param(test_io_t &io, const esp_panel_init_seq_cmd_t &cmd)
+{
+    io.tx_calls++;
+    io.bytes.push_back(-1 - cmd.cmd);
+    for (size_t i = 0; i < cmd.data_bytes; i++) {
+        io.bytes.push_back(((const uint8_t *)cmd.data)[i]);
+    }
+}
+
+static void test_delay(test_io_t &io, uint32_t delay_ms)
+{
+    io.delay_calls++;
+    io.delay_ms += delay_ms;
+}
+
+// Original loop of the drivers
+static void replay_table(test_io_t &io, const esp_panel_init_seq_cmd_t *cmds, size_t num)
+{
+    for (size_t i = 0; i < num; i++) {
+        test_tx_param(io, cmds[i]);
+        test_delay(io, cmds[i].delay_ms);
+    }
+}
+
+// Loop of the drivers with the interpreter
+static void replay_seq(test_io_t &io, esp_panel_init_seq_t &seq)
+{
+    esp_panel_init_seq_cmd_t cmd = {};
+    while (esp_panel_init_seq_next(&seq, &cmd)) {
+        test_tx_param(io, cmd);
+        if (cmd.delay_ms > 0) {
+            test_delay(io, cmd.delay_ms);
+        }
+    }
+    TEST_ASSERT_TRUE(esp_panel_init_seq_is_end(&seq));
+}
+
+TEST_CASE("Test init sequence sends the same commands as the table", "[utils][init_seq]")
+{
+    test_io_t expect = {};
+    replay_table(expect, test_init_cmds, TEST_CMDS_NUM);
+
+    // The bytecode written by macros is the same as the compiled one
+    uint8_t code[sizeof(test_init_seq)];
+    TEST_ASSERT_EQUAL(sizeof(test_init_seq), esp_panel_init_seq_compile(test_init_cmds, TEST_CMDS_NUM, NULL, 0));
+    TEST_ASSERT_EQUAL(sizeof(test_init_seq), esp_panel_init_seq_compile(test_init_cmds, TEST_CMDS_NUM, code,
+                      sizeof(code)));
+    TEST_ASSERT_EQUAL_MEMORY(test_init_seq, code, sizeof(code));
+    TEST_ASSERT_EQUAL(0, esp_panel_init_seq_compile(test_init_cmds, TEST_CMDS_NUM, code, sizeof(code) - 1));
+
+    esp_panel_init_seq_t seq = {};
+    esp_panel_init_seq_stats_t stats = {};
+    for (int from_cmds = 0; from_cmds < 2; from_cmds++) {
+        if (from_cmds) {
+            TEST_ASSERT_TRUE(esp_panel_init_seq_init_from_cmds(&seq, test_init_cmds, TEST_CMDS_NUM));
+        } else {
+            TEST_ASSERT_TRUE(esp_panel_init_seq_init(&seq, test_init_seq, sizeof(test_init_seq)));
+        }
+        test_io_t actual = {};
+        replay_seq(actual, seq);
+        TEST_ASSERT_EQUAL(expect.bytes.size(), actual.bytes.size());
+        TEST_ASSERT_EQUAL_MEMORY(expect.bytes.data(), actual.bytes.data(), expect.bytes.size() * sizeof(int));
+        TEST_ASSERT_EQUAL(expect.tx_calls, actual.tx_calls);
+        TEST_ASSERT_EQUAL(expect.delay_ms, actual.delay_ms);
+        // Only the non-zero delays are called
+        TEST_ASSERT_EQUAL(2, actual.delay_calls);
+
+        TEST_ASSERT_TRUE(esp_panel_init_seq_get_stats(&seq, &stats, true));
+        TEST_ASSERT_EQUAL(TEST_CMDS_NUM, stats.commands);
+        TEST_ASSERT_EQUAL(3, stats.batches);
+        TEST_ASSERT_EQUAL(2, stats.delays);
+        TEST_ASSERT_EQUAL(220, stats.delay_ms);
+    }
+}
+
+TEST_CASE("Test init sequence merges and splits the delays", "[utils][init_seq]")
+{
+    // The adjacent delays are merged into one
+    const uint8_t code[] = {
+        ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x01), ESP_PANEL_INIT_SEQ_DELAY(5), ESP_PANEL_INIT_SEQ_DELAY(300),
+        ESP_PANEL_INIT_SEQ_CMD(0x3A, 0x55), ESP_PANEL_INIT_SEQ_DELAY(0),
+        ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x29),
+    };
+    esp_panel_init_seq_t seq = {};
+    esp_panel_init_seq_cmd_t cmd = {};
+    TEST_ASSERT_TRUE(esp_panel_init_seq_init(&seq, code, sizeof(code)));
+    TEST_ASSERT_TRUE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_EQUAL(0x01, cmd.cmd);
+    TEST_ASSERT_NULL(cmd.data);
+    TEST_ASSERT_EQUAL(305, cmd.delay_ms);
+    TEST_ASSERT_TRUE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_EQUAL(0x3A, cmd.cmd);
+    TEST_ASSERT_EQUAL(1, cmd.data_bytes);
+    TEST_ASSERT_EQUAL(0x55, ((const uint8_t *)cmd.data)[0]);
+    TEST_ASSERT_EQUAL(0, cmd.delay_ms);
+    TEST_ASSERT_TRUE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_FALSE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_TRUE(esp_panel_init_seq_is_end(&seq));
+
+    // A long delay is split by the compiler, and merged by the interpreter
+    const esp_panel_init_seq_cmd_t cmds[] = {
+        {0x11, NULL, 0, 70000},
+        {0x29, NULL, 0, 0},
+    };
+    uint8_t buf[16];
+    size_t len = esp_panel_init_seq_compile(cmds, 2, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL(2 + 3 * 2 + 2, len);
+    TEST_ASSERT_TRUE(esp_panel_init_seq_init(&seq, buf, len));
+    TEST_ASSERT_TRUE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_EQUAL(70000, cmd.delay_ms);
+}
+
+TEST_CASE("Test init sequence rejects the broken bytecode", "[utils][init_seq]")
+{
+    esp_panel_init_seq_t seq = {};
+    esp_panel_init_seq_cmd_t cmd = {};
+
+    // A delay without a command before it
+    const uint8_t leading_delay[] = {ESP_PANEL_INIT_SEQ_DELAY(10), ESP_PANEL_INIT_SEQ_CMD_NO_PARAM(0x11)};
+    TEST_ASSERT_TRUE(esp_panel_init_seq_init(&seq, leading_delay, sizeof(leading_delay)));
+    TEST_ASSERT_FALSE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_FALSE(esp_panel_init_seq_is_end(&seq));
+
+    // Truncated parameters or delay
+    const uint8_t code[] = {ESP_PANEL_INIT_SEQ_CMD(0x2A, 0x00, 0x00, 0x00, 0xEF), ESP_PANEL_INIT_SEQ_DELAY(10)};
+    for (size_t size = 1; size < sizeof(code); size++) {
+        if (size == 6) {
+            continue;
+        }
+        TEST_ASSERT_TRUE(esp_panel_init_seq_init(&seq, code, size));
+        TEST_ASSERT_FALSE(esp_panel_init_seq_next(&seq, &cmd));
+        TEST_ASSERT_FALSE(esp_panel_init_seq_is_end(&seq));
+        TEST_ASSERT_FALSE(esp_panel_init_seq_next(&seq, &cmd));
+    }
+
+    // The commands can't be compiled
+    const esp_panel_init_seq_cmd_t wide_cmd[] = {{0x1234, NULL, 0, 0}};
+    const esp_panel_init_seq_cmd_t no_data[] = {{0x2A, NULL, 4, 0}};
+    TEST_ASSERT_EQUAL(0, esp_panel_init_seq_compile(wide_cmd, 1, NULL, 0));
+    TEST_ASSERT_EQUAL(0, esp_panel_init_seq_compile(no_data, 1, NULL, 0));
+
+    TEST_ASSERT_FALSE(esp_panel_init_seq_init(NULL, code, sizeof(code)));
+    TEST_ASSERT_FALSE(esp_panel_init_seq_init(&seq, NULL, sizeof(code)));
+    TEST_ASSERT_FALSE(esp_panel_init_seq_init_from_cmds(&seq, NULL, 1));
+    TEST_ASSERT_TRUE(esp_panel_init_seq_init_from_cmds(&seq, NULL, 0));
+    TEST_ASSERT_FALSE(esp_panel_init_seq_next(&seq, &cmd));
+    TEST_ASSERT_TRUE(esp_panel_init_seq_is_end(&seq));
+}
+
+TEST_CASE("Benchmark init sequence against the table", "[utils][init_seq][benchmark]")
+{
+    /**
+     * On ESP32 series, every table entry takes 16 bytes plus its data array (at least 1 byte). The original loop calls
+     * `vTaskDelay()` for every entry, and `vTaskDelay(0)` yields to the other ready tasks of the same priority, which
+     * takes a tick (1 ms) in the worst case
+     */
+    const size_t entry_bytes = 16;
+    const double tick_ms = 1;
+    size_t table_bytes = 0;
+    for (size_t i = 0; i < TEST_CMDS_NUM; i++) {
+        table_bytes += entry_bytes + ((test_init_cmds[i].data_bytes > 0) ? test_init_cmds[i].data_bytes : 1);
+    }
+
+    test_io_t naive = {};
+    replay_table(naive, test_init_cmds, TEST_CMDS_NUM);
+    test_io_t fast = {};
+    esp_panel_init_seq_t seq = {};
+    esp_panel_init_seq_init(&seq, test_init_seq, sizeof(test_init_seq));
+    replay_seq(fast, seq);
+
+    double naive_ms = naive.delay_ms + (naive.delay_calls - fast.delay_calls) * tick_ms;
+    printf("| format | flash (bytes) | tx calls | delay calls | worst init delay (ms) |\n");
+    printf("| table | %13d | %8d | %11d | %21.1f |\n", (int)table_bytes, (int)naive.tx_calls, (int)naive.delay_calls,
+           naive_ms);
+    printf("| bytecode | %13d | %8d | %11d | %21.1f |\n", (int)sizeof(test_init_seq), (int)fast.tx_calls,
+           (int)fast.delay_calls, (double)fast.delay_ms);
+    TEST_ASSERT_TRUE(sizeof(test_init_seq) * 2 < table_bytes);
+}
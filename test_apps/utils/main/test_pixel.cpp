@@ -0,0 +1,381 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel.h"
+
+using namespace std;
+
+#define TEST_RECT_NUM           (50)
+#define TEST_BENCHMARK_LOOPS    (5)
+
+typedef struct {
+    uint16_t w;
+    uint16_t h;
+} test_frame_size_t;
+
+static const uint16_t test_rotations[] = {0, 90, 180, 270};
+static const uint8_t test_bytes_per_pixel[] = {2, 3};
+
+static void fill_random(vector<uint8_t> &buf)
+{
+    for (auto &byte : buf) {
+        byte = rand() & 0xFF;
+    }
+}
+
+// The SIMD kernels of ESP32-S3/P4 only take the frames which start at a 16-byte boundary, so the buffers are 16 bytes
+// larger than the frames and the frames start at the first aligned byte
+static uint8_t *get_aligned_frame(vector<uint8_t> &buf)
+{
+    return (uint8_t *)(((uintptr_t)buf.data() + 15) & ~(uintptr_t)15);
+}
+
+static void check_rect(const vector<uint8_t> &src, uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                       uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate, uint8_t bytes_per_pixel)
+{
+    // Both destinations start with the same garbage, so pixels outside the region are also compared
+    vector<uint8_t> dst_ref(src.size());
+    fill_random(dst_ref);
+    vector<uint8_t> dst_opt(dst_ref);
+
+    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_ref(
+                         src.data(), dst_ref.data(), x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel
+                     ));
+    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy(
+                         src.data(), dst_opt.data(), x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel
+                     ));
+    if (memcmp(dst_ref.data(), dst_opt.data(), dst_ref.size()) != 0) {
+        printf("Mismatch: frame %dx%d, rect (%d, %d) - (%d, %d), rotate %d, bpp %d\n", w, h, x_start, y_start,
+               x_end, y_end, rotate, bytes_per_pixel * 8);
+        TEST_FAIL_MESSAGE("Optimized kernel is not bit-exact with the reference");
+    }
+}
+
+TEST_CASE("Test pixel rotation kernels are bit-exact with the reference", "[utils][pixel]")
+{
+    const test_frame_size_t sizes[] = {
+        {480, 480}, {320, 240}, {466, 466}, {360, 360}, {123, 77}, {2, 2}, {1, 9},
+    };
+
+    srand(0);
+    for (auto size : sizes) {
+        for (auto bytes_per_pixel : test_bytes_per_pixel) {
+            vector<uint8_t> src(size.w * size.h * bytes_per_pixel);
+            fill_random(src);
+            for (auto rotate : test_rotations) {
+                // Full frame
+                check_rect(src, 0, 0, size.w - 1, size.h - 1, size.w, size.h, rotate, bytes_per_pixel);
+                // Random rectangles, including the odd borders and single lines
+                for (int i = 0; i < TEST_RECT_NUM; i++) {
+                    uint16_t x1 = rand() % size.w;
+                    uint16_t x2 = rand() % size.w;
+                    uint16_t y1 = rand() % size.h;
+                    uint16_t y2 = rand() % size.h;
+                    check_rect(src, min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2), size.w, size.h, rotate,
+                               bytes_per_pixel);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test pixel rotation kernels on 16-byte aligned frames", "[utils][pixel]")
+{
+    const test_frame_size_t sizes[] = {
+        {480, 480}, {320, 240}, {64, 40}, {16, 8},
+    };
+
+    srand(4);
+    for (auto size : sizes) {
+        for (auto bytes_per_pixel : test_bytes_per_pixel) {
+            size_t frame_size = size.w * size.h * bytes_per_pixel;
+            vector<uint8_t> src_buf(frame_size + 16);
+            vector<uint8_t> dst_ref_buf(frame_size + 16);
+            fill_random(src_buf);
+            uint8_t *src = get_aligned_frame(src_buf);
+            for (auto rotate : test_rotations) {
+                for (int i = 0; i <= TEST_RECT_NUM; i++) {
+                    // The first one is the full frame
+                    uint16_t x1 = (i == 0) ? 0 : rand() % size.w;
+                    uint16_t x2 = (i == 0) ? (size.w - 1) : rand() % size.w;
+                    uint16_t y1 = (i == 0) ? 0 : rand() % size.h;
+                    uint16_t y2 = (i == 0) ? (size.h - 1) : rand() % size.h;
+                    fill_random(dst_ref_buf);
+                    vector<uint8_t> dst_opt_buf(dst_ref_buf);
+                    uint8_t *dst_ref = get_aligned_frame(dst_ref_buf);
+                    uint8_t *dst_opt = get_aligned_frame(dst_opt_buf);
+                    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_ref(
+                                         src, dst_ref, min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2), size.w,
+                                         size.h, rotate, bytes_per_pixel
+                                     ));
+                    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy(
+                                         src, dst_opt, min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2), size.w,
+                                         size.h, rotate, bytes_per_pixel
+                                     ));
+                    TEST_ASSERT_EQUAL_MEMORY(dst_ref, dst_opt, frame_size);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test pixel rotation with invalid arguments", "[utils][pixel]")
+{
+    uint8_t src[16] = {};
+    uint8_t dst[16] = {};
+
+    TEST_ASSERT_FALSE(esp_panel_pixel_rotate_copy(NULL, dst, 0, 0, 1, 1, 2, 2, 90, 2));
+    TEST_ASSERT_FALSE(esp_panel_pixel_rotate_copy(src, dst, 0, 0, 2, 1, 2, 2, 90, 2));
+    TEST_ASSERT_FALSE(esp_panel_pixel_rotate_copy(src, dst, 1, 0, 0, 1, 2, 2, 90, 2));
+    TEST_ASSERT_FALSE(esp_panel_pixel_rotate_copy(src, dst, 0, 0, 1, 1, 2, 2, 45, 2));
+    TEST_ASSERT_FALSE(esp_panel_pixel_rotate_copy(src, dst, 0, 0, 1, 1, 2, 2, 90, 5));
+}
+
+TEST_CASE("Test rotating only the dirty rects matches a full frame rotation", "[utils][pixel]")
+{
+    const test_frame_size_t sizes[] = {
+        {480, 480}, {320, 240}, {123, 77},
+    };
+
+    srand(1);
+    for (auto size : sizes) {
+        for (auto bytes_per_pixel : test_bytes_per_pixel) {
+            for (auto rotate : test_rotations) {
+                vector<uint8_t> src(size.w * size.h * bytes_per_pixel);
+                vector<uint8_t> dst(src.size());
+                vector<uint8_t> dst_ref(src.size());
+                fill_random(src);
+                TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy(
+                                     src.data(), dst.data(), 0, 0, size.w - 1, size.h - 1, size.w, size.h, rotate,
+                                     bytes_per_pixel
+                                 ));
+                // Simulate several frames, each of them only changes a few rects of the source frame
+                for (int frame = 0; frame < 10; frame++) {
+                    for (int i = 0; i < 5; i++) {
+                        uint16_t x1 = rand() % size.w;
+                        uint16_t x2 = rand() % size.w;
+                        uint16_t y1 = rand() % size.h;
+                        uint16_t y2 = rand() % size.h;
+                        uint16_t x_start = min(x1, x2);
+                        uint16_t x_end = max(x1, x2);
+                        uint16_t y_start = min(y1, y2);
+                        uint16_t y_end = max(y1, y2);
+                        for (int y = y_start; y <= y_end; y++) {
+                            for (int k = x_start * bytes_per_pixel; k < (x_end + 1) * bytes_per_pixel; k++) {
+                                src[y * size.w * bytes_per_pixel + k] = rand() & 0xFF;
+                            }
+                        }
+                        TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy(
+                                             src.data(), dst.data(), x_start, y_start, x_end, y_end, size.w, size.h,
+                                             rotate, bytes_per_pixel
+                                         ));
+                    }
+                    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_ref(
+                                         src.data(), dst_ref.data(), 0, 0, size.w - 1, size.h - 1, size.w, size.h,
+                                         rotate, bytes_per_pixel
+                                     ));
+                    TEST_ASSERT_EQUAL_MEMORY(dst_ref.data(), dst.data(), dst.size());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test rotated area matches the pixels written by the rotation", "[utils][pixel]")
+{
+    const uint16_t w = 37;
+    const uint16_t h = 21;
+    const uint8_t bytes_per_pixel = 2;
+
+    srand(2);
+    for (auto rotate : test_rotations) {
+        uint16_t dst_w = ((rotate == 90) || (rotate == 270)) ? h : w;
+        vector<uint8_t> src(w * h * bytes_per_pixel, 0xFF);
+        for (int i = 0; i < TEST_RECT_NUM; i++) {
+            uint16_t x1 = rand() % w;
+            uint16_t x2 = rand() % w;
+            uint16_t y1 = rand() % h;
+            uint16_t y2 = rand() % h;
+            uint16_t x_start = min(x1, x2);
+            uint16_t x_end = max(x1, x2);
+            uint16_t y_start = min(y1, y2);
+            uint16_t y_end = max(y1, y2);
+            vector<uint8_t> dst(src.size(), 0);
+            TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy(
+                                 src.data(), dst.data(), x_start, y_start, x_end, y_end, w, h, rotate, bytes_per_pixel
+                             ));
+            TEST_ASSERT_TRUE(esp_panel_pixel_rotate_area(w, h, rotate, &x_start, &y_start, &x_end, &y_end));
+            // Exactly the pixels inside the rotated area should be written
+            for (int k = 0; k < (int)dst.size() / bytes_per_pixel; k++) {
+                int x = k % dst_w;
+                int y = k / dst_w;
+                bool inside = (x >= x_start) && (x <= x_end) && (y >= y_start) && (y <= y_end);
+                TEST_ASSERT_EQUAL(inside ? 0xFF : 0, dst[k * bytes_per_pixel]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Test pixel mirror and transpose kernels", "[utils][pixel]")
+{
+    const test_frame_size_t sizes[] = {
+        {480, 480}, {123, 77}, {1, 9},
+    };
+
+    srand(3);
+    for (auto size : sizes) {
+        for (auto bytes_per_pixel : test_bytes_per_pixel) {
+            vector<uint8_t> src(size.w * size.h * bytes_per_pixel);
+            fill_random(src);
+            for (int i = 0; i < TEST_RECT_NUM; i++) {
+                uint16_t x1 = rand() % size.w;
+                uint16_t x2 = rand() % size.w;
+                uint16_t y1 = rand() % size.h;
+                uint16_t y2 = rand() % size.h;
+                uint16_t x_start = min(x1, x2);
+                uint16_t x_end = max(x1, x2);
+                uint16_t y_start = min(y1, y2);
+                uint16_t y_end = max(y1, y2);
+                for (int mode = 0; mode < 5; mode++) {
+                    bool mirror_x = mode & 1;
+                    bool mirror_y = mode & 2;
+                    bool transpose = (mode == 4);
+                    vector<uint8_t> dst(src.size());
+                    fill_random(dst);
+                    vector<uint8_t> dst_ref(dst);
+                    if (transpose) {
+                        TEST_ASSERT_TRUE(esp_panel_pixel_transpose_copy(
+                                             src.data(), dst.data(), x_start, y_start, x_end, y_end, size.w, size.h,
+                                             bytes_per_pixel
+                                         ));
+                    } else {
+                        TEST_ASSERT_TRUE(esp_panel_pixel_mirror_copy(
+                                             src.data(), dst.data(), x_start, y_start, x_end, y_end, size.w, size.h,
+                                             mirror_x, mirror_y, bytes_per_pixel
+                                         ));
+                    }
+                    for (int y = y_start; y <= y_end; y++) {
+                        for (int x = x_start; x <= x_end; x++) {
+                            int to_x = mirror_x ? (size.w - 1 - x) : x;
+                            int to_y = mirror_y ? (size.h - 1 - y) : y;
+                            int to_index = transpose ? (x * size.h + y) : (to_y * size.w + to_x);
+                            memcpy(&dst_ref[to_index * bytes_per_pixel], &src[(y * size.w + x) * bytes_per_pixel],
+                                   bytes_per_pixel);
+                        }
+                    }
+                    TEST_ASSERT_EQUAL_MEMORY(dst_ref.data(), dst.data(), dst.size());
+                }
+            }
+        }
+    }
+}
+
+/**
+ * The 16bpp 90/270 degree path which `lvgl_port_v8.cpp` used before, with the fixed 32x256 blocks. It only rotates the
+ * full frame and needs the width to be a multiple of 4.
+ *
+ */
+static void rotate_blocked_16bpp_old(const uint8_t *from, uint8_t *to, uint16_t w, uint16_t h, uint16_t rotate)
+{
+    const int block_w = 32;
+    const int block_h = 256;
+
+    for (int i = 0; i < h; i += block_h) {
+        int max_height = (i + block_h > h) ? h : (i + block_h);
+        for (int j = 0; j < w; j += block_w) {
+            int max_width = (j + block_w > w) ? w : (j + block_w);
+            for (int x = i; x < max_height; x++) {
+                const uint16_t *from_next = (const uint16_t *)from + x * w;
+                for (int y = j; y < max_width; y += 4) {
+                    uint32_t a = *(const uint32_t *)(from_next + y);
+                    uint32_t b = *(const uint32_t *)(from_next + y + 2);
+                    if (rotate == 90) {
+                        ((uint16_t *)to)[(w - 1 - y) * h + x] = a & 0xFFFF;
+                        ((uint16_t *)to)[(w - 2 - y) * h + x] = a >> 16;
+                        ((uint16_t *)to)[(w - 3 - y) * h + x] = b & 0xFFFF;
+                        ((uint16_t *)to)[(w - 4 - y) * h + x] = b >> 16;
+                    } else {
+                        ((uint16_t *)to)[y * h + (h - 1 - x)] = a & 0xFFFF;
+                        ((uint16_t *)to)[(y + 1) * h + (h - 1 - x)] = a >> 16;
+                        ((uint16_t *)to)[(y + 2) * h + (h - 1 - x)] = b & 0xFFFF;
+                        ((uint16_t *)to)[(y + 3) * h + (h - 1 - x)] = b >> 16;
+                    }
+                }
+            }
+        }
+    }
+}
+
+typedef enum {
+    BENCHMARK_REFERENCE,
+    BENCHMARK_BLOCKED_OLD,
+    BENCHMARK_OPTIMIZED,
+} benchmark_kernel_t;
+
+static uint32_t benchmark_us(benchmark_kernel_t kernel, const uint8_t *src, uint8_t *dst, uint16_t w, uint16_t h,
+                             uint16_t rotate, uint8_t bytes_per_pixel)
+{
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+        switch (kernel) {
+        case BENCHMARK_REFERENCE:
+            esp_panel_pixel_rotate_copy_ref(src, dst, 0, 0, w - 1, h - 1, w, h, rotate, bytes_per_pixel);
+            break;
+        case BENCHMARK_BLOCKED_OLD:
+            rotate_blocked_16bpp_old(src, dst, w, h, rotate);
+            break;
+        default:
+            esp_panel_pixel_rotate_copy(src, dst, 0, 0, w - 1, h - 1, w, h, rotate, bytes_per_pixel);
+            break;
+        }
+    }
+    auto end = chrono::steady_clock::now();
+
+    return chrono::duration_cast<chrono::microseconds>(end - start).count() / TEST_BENCHMARK_LOOPS;
+}
+
+TEST_CASE("Benchmark pixel rotation kernels", "[utils][pixel][benchmark]")
+{
+    const test_frame_size_t sizes[] = {
+        {480, 480}, {1024, 600},
+    };
+
+    // "blocked 32x256" is the old 16bpp 90/270 degree path of the LVGL port, the other cases only had the reference
+    printf("| size     | bpp | rotate | reference (us) | blocked 32x256 (us) | optimized (us) |\n");
+    for (auto size : sizes) {
+        for (auto bytes_per_pixel : test_bytes_per_pixel) {
+            size_t frame_size = size.w * size.h * bytes_per_pixel;
+            vector<uint8_t> src_buf(frame_size + 16);
+            vector<uint8_t> dst_ref_buf(frame_size + 16);
+            vector<uint8_t> dst_buf(frame_size + 16);
+            fill_random(src_buf);
+            uint8_t *src = get_aligned_frame(src_buf);
+            uint8_t *dst_ref = get_aligned_frame(dst_ref_buf);
+            uint8_t *dst = get_aligned_frame(dst_buf);
+            for (auto rotate : test_rotations) {
+                uint32_t ref_us = benchmark_us(BENCHMARK_REFERENCE, src, dst_ref, size.w, size.h, rotate,
+                                               bytes_per_pixel);
+                char old_us[16] = "-";
+                if ((bytes_per_pixel == 2) && ((rotate == 90) || (rotate == 270))) {
+                    snprintf(old_us, sizeof(old_us), "%d", (int)benchmark_us(
+                                 BENCHMARK_BLOCKED_OLD, src, dst, size.w, size.h, rotate, bytes_per_pixel
+                             ));
+                    TEST_ASSERT_EQUAL_MEMORY(dst_ref, dst, frame_size);
+                }
+                uint32_t opt_us = benchmark_us(BENCHMARK_OPTIMIZED, src, dst, size.w, size.h, rotate, bytes_per_pixel);
+                printf("| %4dx%-4d| %3d | %6d | %14d | %19s | %14d |\n", size.w, size.h, bytes_per_pixel * 8, rotate,
+                       (int)ref_us, old_us, (int)opt_us);
+                TEST_ASSERT_EQUAL_MEMORY(dst_ref, dst, frame_size);
+            }
+        }
+    }
+}
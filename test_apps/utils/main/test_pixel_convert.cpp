@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel.h"
+#include "utils/esp_panel_pixel_convert.h"
+
+using namespace std;
+
+#define TEST_RECT_NUM           (30)
+#define TEST_BENCHMARK_LOOPS    (5)
+
+static const uint16_t test_rotations[] = {0, 90, 180, 270};
+static const esp_panel_pixel_format_t test_from_formats[] = {
+    ESP_PANEL_PIXEL_FORMAT_RGB565, ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP,
+};
+static const esp_panel_pixel_format_t test_to_formats[] = {
+    ESP_PANEL_PIXEL_FORMAT_RGB565, ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP, ESP_PANEL_PIXEL_FORMAT_RGB666,
+    ESP_PANEL_PIXEL_FORMAT_RGB888,
+};
+
+// Reference conversion of a single pixel, written in terms of 8-bit components
+static void convert_pixel_ref(const uint8_t *from, uint8_t *to, esp_panel_pixel_format_t from_format,
+                              esp_panel_pixel_format_t to_format)
+{
+    uint16_t value = (from_format == ESP_PANEL_PIXEL_FORMAT_RGB565) ? (from[0] | (from[1] << 8)) :
+                     ((from[0] << 8) | from[1]);
+    uint8_t r5 = (value >> 11) & 0x1F;
+    uint8_t g6 = (value >> 5) & 0x3F;
+    uint8_t b5 = value & 0x1F;
+    uint8_t r8 = (r5 << 3) | (r5 >> 2);
+    uint8_t g8 = (g6 << 2) | (g6 >> 4);
+    uint8_t b8 = (b5 << 3) | (b5 >> 2);
+
+    switch (to_format) {
+    case ESP_PANEL_PIXEL_FORMAT_RGB565:
+        to[0] = value & 0xFF;
+        to[1] = value >> 8;
+        break;
+    case ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP:
+        to[0] = value >> 8;
+        to[1] = value & 0xFF;
+        break;
+    case ESP_PANEL_PIXEL_FORMAT_RGB666:
+        // The 6-bit components are the MSBs of the 8-bit ones
+        to[0] = r8 & 0xFC;
+        to[1] = g8 & 0xFC;
+        to[2] = b8 & 0xFC;
+        break;
+    default:
+        to[0] = r8;
+        to[1] = g8;
+        to[2] = b8;
+        break;
+    }
+}
+
+// Reference pipeline: rotate the whole frame, crop the rotated region, then convert pixel by pixel
+static vector<uint8_t> convert_copy_ref(const vector<uint8_t> &src, uint16_t x_start, uint16_t y_start, uint16_t x_end,
+                                        uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotate,
+                                        esp_panel_pixel_format_t from_format, esp_panel_pixel_format_t to_format)
+{
+    vector<uint8_t> rotated(src.size());
+    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_ref(src.data(), rotated.data(), 0, 0, w - 1, h - 1, w, h, rotate, 2));
+    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_area(w, h, rotate, &x_start, &y_start, &x_end, &y_end));
+
+    uint16_t rotated_w = ((rotate == 90) || (rotate == 270)) ? h : w;
+    uint8_t to_bpp = esp_panel_pixel_format_get_bytes(to_format);
+    vector<uint8_t> out;
+    for (int y = y_start; y <= y_end; y++) {
+        for (int x = x_start; x <= x_end; x++) {
+            uint8_t pixel[3] = {};
+            convert_pixel_ref(&rotated[(y * rotated_w + x) * 2], pixel, from_format, to_format);
+            out.insert(out.end(), pixel, pixel + to_bpp);
+        }
+    }
+
+    return out;
+}
+
+TEST_CASE("Test fused rotate and convert kernels match the reference pipeline", "[utils][pixel][convert]")
+{
+    const uint16_t w = 53;
+    const uint16_t h = 37;
+
+    srand(6);
+    vector<uint8_t> src(w * h * 2);
+    for (auto &byte : src) {
+        byte = rand() & 0xFF;
+    }
+    for (auto rotate : test_rotations) {
+        for (auto from_format : test_from_formats) {
+            for (auto to_format : test_to_formats) {
+                for (int i = 0; i < TEST_RECT_NUM; i++) {
+                    uint16_t x1 = rand() % w;
+                    uint16_t x2 = rand() % w;
+                    uint16_t y1 = rand() % h;
+                    uint16_t y2 = rand() % h;
+                    uint16_t x_start = (i == 0) ? 0 : min(x1, x2);
+                    uint16_t x_end = (i == 0) ? (w - 1) : max(x1, x2);
+                    uint16_t y_start = (i == 0) ? 0 : min(y1, y2);
+                    uint16_t y_end = (i == 0) ? (h - 1) : max(y1, y2);
+
+                    vector<uint8_t> ref = convert_copy_ref(
+                                              src, x_start, y_start, x_end, y_end, w, h, rotate, from_format, to_format
+                                          );
+                    // One more pixel to catch the overflow
+                    vector<uint8_t> out(ref.size() + 3, 0xEE);
+                    TEST_ASSERT_TRUE(esp_panel_pixel_convert_copy(
+                                         src.data(), out.data(), x_start, y_start, x_end, y_end, w, h, rotate,
+                                         from_format, to_format
+                                     ));
+                    TEST_ASSERT_EQUAL_MEMORY(ref.data(), out.data(), ref.size());
+                    TEST_ASSERT_EQUAL_HEX8(0xEE, out[ref.size()]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test fused rotate and convert with invalid arguments", "[utils][pixel][convert]")
+{
+    uint8_t src[16] = {};
+    uint8_t dst[32] = {};
+
+    TEST_ASSERT_EQUAL(2, esp_panel_pixel_format_get_bytes(ESP_PANEL_PIXEL_FORMAT_RGB565_SWAP));
+    TEST_ASSERT_EQUAL(3, esp_panel_pixel_format_get_bytes(ESP_PANEL_PIXEL_FORMAT_RGB666));
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_format_get_bytes(ESP_PANEL_PIXEL_FORMAT_MAX));
+    TEST_ASSERT_FALSE(esp_panel_pixel_convert_copy(
+                          NULL, dst, 0, 0, 1, 1, 2, 2, 90, ESP_PANEL_PIXEL_FORMAT_RGB565, ESP_PANEL_PIXEL_FORMAT_RGB666
+                      ));
+    TEST_ASSERT_FALSE(esp_panel_pixel_convert_copy(
+                          src, dst, 0, 0, 2, 1, 2, 2, 90, ESP_PANEL_PIXEL_FORMAT_RGB565, ESP_PANEL_PIXEL_FORMAT_RGB666
+                      ));
+    TEST_ASSERT_FALSE(esp_panel_pixel_convert_copy(
+                          src, dst, 0, 0, 1, 1, 2, 2, 45, ESP_PANEL_PIXEL_FORMAT_RGB565, ESP_PANEL_PIXEL_FORMAT_RGB666
+                      ));
+    TEST_ASSERT_FALSE(esp_panel_pixel_convert_copy(
+                          src, dst, 0, 0, 1, 1, 2, 2, 90, ESP_PANEL_PIXEL_FORMAT_RGB888, ESP_PANEL_PIXEL_FORMAT_RGB666
+                      ));
+}
+
+TEST_CASE("Benchmark fused rotate and convert kernels", "[utils][pixel][convert][benchmark]")
+{
+    const uint16_t w = 480;
+    const uint16_t h = 480;
+
+    vector<uint8_t> src(w * h * 2, 0x5A);
+    vector<uint8_t> rotated(src.size());
+    vector<uint8_t> out(w * h * 3);
+
+    printf("| rotate | to format | two passes (us) | fused (us) |\n");
+    for (auto rotate : test_rotations) {
+        for (auto to_format : test_to_formats) {
+            // Two passes: rotate into a frame, then convert the frame
+            auto start = chrono::steady_clock::now();
+            for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+                esp_panel_pixel_rotate_copy(src.data(), rotated.data(), 0, 0, w - 1, h - 1, w, h, rotate, 2);
+                esp_panel_pixel_convert_copy(
+                    rotated.data(), out.data(), 0, 0, w - 1, h - 1, w, h, 0, ESP_PANEL_PIXEL_FORMAT_RGB565, to_format
+                );
+            }
+            auto end = chrono::steady_clock::now();
+            int two_pass_us = chrono::duration_cast<chrono::microseconds>(end - start).count() / TEST_BENCHMARK_LOOPS;
+
+            start = chrono::steady_clock::now();
+            for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+                esp_panel_pixel_convert_copy(
+                    src.data(), out.data(), 0, 0, w - 1, h - 1, w, h, rotate, ESP_PANEL_PIXEL_FORMAT_RGB565, to_format
+                );
+            }
+            end = chrono::steady_clock::now();
+            int fused_us = chrono::duration_cast<chrono::microseconds>(end - start).count() / TEST_BENCHMARK_LOOPS;
+
+            printf("| %6d | %9d | %15d | %10d |\n", rotate, to_format, two_pass_us, fused_us);
+        }
+    }
+}
@@ -0,0 +1,286 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel_diff.h"
+
+using namespace std;
+
+#define TEST_RANDOM_ROUNDS      (400)
+#define TEST_BENCHMARK_FRAMES   (60)
+// Bus model of the benchmark: 40 MHz SPI, and the cost of CASET/RASET/RAMWR for every window
+#define TEST_BUS_BYTES_PER_US   (5)
+#define TEST_BUS_WINDOW_US      (20)
+
+// Mock panel, which receives the changed rectangles and writes them into its GRAM
+typedef struct {
+    uint16_t w;
+    uint8_t bytes_per_pixel;
+    vector<uint8_t> gram;
+    // The bitmap being drawn
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t width;
+    const uint8_t *bitmap;
+    // Records
+    vector<esp_panel_pixel_rect_t> rects;
+    int last_num;
+    size_t bytes;
+} test_mock_panel_t;
+
+static bool test_mock_panel_draw(void *user_ctx, const esp_panel_pixel_rect_t *rect, bool is_last)
+{
+    test_mock_panel_t *panel = (test_mock_panel_t *)user_ctx;
+
+    TEST_ASSERT_TRUE((rect->x1 >= panel->x_start) && (rect->x2 < panel->x_start + panel->width));
+    TEST_ASSERT_TRUE(rect->y1 >= panel->y_start);
+    size_t line_size = (rect->x2 - rect->x1 + 1) * panel->bytes_per_pixel;
+    for (int y = rect->y1; y <= rect->y2; y++) {
+        const uint8_t *src = panel->bitmap +
+                             ((y - panel->y_start) * panel->width + (rect->x1 - panel->x_start)) * panel->bytes_per_pixel;
+        memcpy(&panel->gram[(y * panel->w + rect->x1) * panel->bytes_per_pixel], src, line_size);
+    }
+    panel->rects.push_back(*rect);
+    panel->last_num += is_last ? 1 : 0;
+    panel->bytes += line_size * (rect->y2 - rect->y1 + 1);
+
+    return true;
+}
+
+// Crop the area of the frame as a bitmap, and draw it through the diff
+static void draw_area(esp_panel_pixel_diff_handle_t diff, test_mock_panel_t *panel, const vector<uint8_t> &frame,
+                      uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, vector<uint8_t> &bitmap)
+{
+    uint8_t bpp = panel->bytes_per_pixel;
+    bitmap.resize(width * height * bpp);
+    for (int y = 0; y < height; y++) {
+        memcpy(&bitmap[y * width * bpp], &frame[((y_start + y) * panel->w + x_start) * bpp], width * bpp);
+    }
+
+    panel->x_start = x_start;
+    panel->y_start = y_start;
+    panel->width = width;
+    panel->bitmap = bitmap.data();
+    panel->rects.clear();
+    panel->last_num = 0;
+    TEST_ASSERT_TRUE(esp_panel_pixel_diff_draw(diff, x_start, y_start, width, height, bitmap.data(),
+                                               test_mock_panel_draw, panel));
+    TEST_ASSERT_EQUAL(panel->rects.empty() ? 0 : 1, panel->last_num);
+}
+
+static esp_panel_pixel_diff_handle_t create_diff(uint16_t w, uint16_t h, uint8_t tile_size, uint8_t bytes_per_pixel)
+{
+    esp_panel_pixel_diff_config_t config = {
+        .width = w,
+        .height = h,
+        .tile_size = tile_size,
+        .bytes_per_pixel = bytes_per_pixel,
+    };
+    esp_panel_pixel_diff_handle_t diff = esp_panel_pixel_diff_new(&config);
+    TEST_ASSERT_NOT_NULL(diff);
+
+    return diff;
+}
+
+TEST_CASE("Test tile diff only skips the unchanged tiles", "[utils][pixel][diff]")
+{
+    const uint16_t w = 100;
+    const uint16_t h = 70;
+    const uint8_t bpp = 2;
+
+    esp_panel_pixel_diff_handle_t diff = create_diff(w, h, 16, bpp);
+    test_mock_panel_t panel = {};
+    panel.w = w;
+    panel.bytes_per_pixel = bpp;
+    panel.gram.assign(w * h * bpp, 0);
+    vector<uint8_t> frame(w * h * bpp, 0x11);
+    vector<uint8_t> bitmap;
+    esp_panel_pixel_diff_stats_t stats = {};
+
+    // The first drawing sends everything as a single window
+    draw_area(diff, &panel, frame, 3, 5, 50, 30, bitmap);
+    TEST_ASSERT_EQUAL(1, panel.rects.size());
+    TEST_ASSERT_EQUAL(3, panel.rects[0].x1);
+    TEST_ASSERT_EQUAL(5, panel.rects[0].y1);
+    TEST_ASSERT_EQUAL(52, panel.rects[0].x2);
+    TEST_ASSERT_EQUAL(34, panel.rects[0].y2);
+
+    // Redrawing the same pixels sends nothing, even the partial tiles on the edges
+    draw_area(diff, &panel, frame, 3, 5, 50, 30, bitmap);
+    TEST_ASSERT_TRUE(panel.rects.empty());
+    TEST_ASSERT_TRUE(esp_panel_pixel_diff_get_stats(diff, &stats, true));
+    TEST_ASSERT_EQUAL(stats.misses, stats.hits);
+    TEST_ASSERT_EQUAL(stats.bytes_sent, stats.bytes_skipped);
+    TEST_ASSERT_EQUAL(50 * 30 * bpp, stats.bytes_sent);
+
+    // A single changed pixel only sends its tile
+    frame[(20 * w + 40) * bpp] = 0x22;
+    draw_area(diff, &panel, frame, 3, 5, 50, 30, bitmap);
+    TEST_ASSERT_EQUAL(1, panel.rects.size());
+    TEST_ASSERT_EQUAL(32, panel.rects[0].x1);
+    TEST_ASSERT_EQUAL(16, panel.rects[0].y1);
+    TEST_ASSERT_EQUAL(47, panel.rects[0].x2);
+    TEST_ASSERT_EQUAL(31, panel.rects[0].y2);
+
+    // A different area over the same tiles is sent, since only the same part of a tile can be skipped
+    draw_area(diff, &panel, frame, 4, 5, 49, 30, bitmap);
+    TEST_ASSERT_FALSE(panel.rects.empty());
+
+    // Invalidated tiles are sent again
+    draw_area(diff, &panel, frame, 4, 5, 49, 30, bitmap);
+    TEST_ASSERT_TRUE(panel.rects.empty());
+    TEST_ASSERT_TRUE(esp_panel_pixel_diff_invalidate(diff, 0, 0, 0, 0));
+    draw_area(diff, &panel, frame, 4, 5, 49, 30, bitmap);
+    TEST_ASSERT_EQUAL(1, panel.rects.size());
+
+    TEST_ASSERT_FALSE(esp_panel_pixel_diff_draw(diff, 90, 0, 11, 1, bitmap.data(), test_mock_panel_draw, &panel));
+    esp_panel_pixel_diff_config_t config = {w, h, 2, bpp};
+    TEST_ASSERT_NULL(esp_panel_pixel_diff_new(&config));
+    esp_panel_pixel_diff_del(diff);
+}
+
+TEST_CASE("Test tile diff keeps the panel in sync with random updates", "[utils][pixel][diff]")
+{
+    const uint16_t w = 96;
+    const uint16_t h = 64;
+
+    srand(8);
+    for (uint8_t bpp = 2; bpp <= 3; bpp++) {
+        for (uint8_t tile_size : {
+                    4, 8, 13, 32
+                }) {
+            esp_panel_pixel_diff_handle_t diff = create_diff(w, h, tile_size, bpp);
+            test_mock_panel_t panel = {};
+            panel.w = w;
+            panel.bytes_per_pixel = bpp;
+            panel.gram.assign(w * h * bpp, 0);
+            vector<uint8_t> frame(w * h * bpp, 0);
+            vector<uint8_t> bitmap;
+
+            for (int round = 0; round < TEST_RANDOM_ROUNDS; round++) {
+                // Change a few pixels, then draw a random area
+                for (int i = rand() % 4; i > 0; i--) {
+                    frame[rand() % frame.size()] = rand() & 0xFF;
+                }
+                uint16_t x_start = rand() % w;
+                uint16_t y_start = rand() % h;
+                uint16_t width = 1 + rand() % (w - x_start);
+                uint16_t height = 1 + rand() % (h - y_start);
+                draw_area(diff, &panel, frame, x_start, y_start, width, height, bitmap);
+
+                // The drawn area on the panel always matches the frame, and the sent windows never overlap
+                for (int y = y_start; y < y_start + height; y++) {
+                    TEST_ASSERT_EQUAL_MEMORY(&frame[(y * w + x_start) * bpp], &panel.gram[(y * w + x_start) * bpp],
+                                             width * bpp);
+                }
+                for (size_t i = 0; i < panel.rects.size(); i++) {
+                    for (size_t j = i + 1; j < panel.rects.size(); j++) {
+                        auto &a = panel.rects[i];
+                        auto &b = panel.rects[j];
+                        TEST_ASSERT_FALSE((a.x1 <= b.x2) && (b.x1 <= a.x2) && (a.y1 <= b.y2) && (b.y1 <= a.y2));
+                    }
+                }
+            }
+            esp_panel_pixel_diff_del(diff);
+        }
+    }
+}
+
+TEST_CASE("Benchmark tile diff with synthetic UI updates", "[utils][pixel][diff][benchmark]")
+{
+    const uint16_t w = 320;
+    const uint16_t h = 240;
+    const uint8_t bpp = 2;
+    struct {
+        const char *name;
+        uint16_t x_start;
+        uint16_t y_start;
+        uint16_t width;
+        uint16_t height;
+        // Change the frame before the drawing of frame `n`
+        void (*update)(vector<uint8_t> &frame, int n);
+    } traces[] = {
+        {
+            // A label redrawn with the same text, like a `lv_label_set_text()` every frame
+            "same label", 20, 20, 120, 24, [](vector<uint8_t> &, int)
+            {
+            }
+        },
+        {
+            // A clock, only the seconds digits change every frame
+            "clock", 100, 90, 120, 40, [](vector<uint8_t> &frame, int n)
+            {
+                for (int y = 95; y < 125; y++) {
+                    memset(&frame[(y * 320 + 190) * 2], n & 0xFF, 20 * 2);
+                }
+            }
+        },
+        {
+            // A progress bar, which grows 2 pixels every frame
+            "progress bar", 10, 200, 300, 16, [](vector<uint8_t> &frame, int n)
+            {
+                for (int y = 202; y < 214; y++) {
+                    memset(&frame[(y * 320 + 12 + n * 2) * 2], 0xA5, 2 * 2);
+                }
+            }
+        },
+        {
+            // A scrolling list, every pixel changes
+            "scroll list", 0, 40, 320, 160, [](vector<uint8_t> &frame, int n)
+            {
+                for (int y = 40; y < 200; y++) {
+                    memset(&frame[y * 320 * 2], (y + n) & 0xFF, 320 * 2);
+                }
+            }
+        },
+    };
+
+    printf("| trace        | hits | misses | windows | KB sent (raw/diff) | bus us (raw/diff) | hash us |\n");
+    for (auto &trace : traces) {
+        esp_panel_pixel_diff_handle_t diff = create_diff(w, h, ESP_PANEL_PIXEL_DIFF_TILE_SIZE_DEFAULT, bpp);
+        test_mock_panel_t panel = {};
+        panel.w = w;
+        panel.bytes_per_pixel = bpp;
+        panel.gram.assign(w * h * bpp, 0);
+        vector<uint8_t> frame(w * h * bpp);
+        for (size_t i = 0; i < frame.size(); i++) {
+            frame[i] = i * 7;
+        }
+        vector<uint8_t> bitmap;
+        size_t raw_bytes = 0;
+        size_t windows = 0;
+        int64_t diff_us = 0;
+
+        // The first frame fills the panel, it isn't counted
+        draw_area(diff, &panel, frame, trace.x_start, trace.y_start, trace.width, trace.height, bitmap);
+        esp_panel_pixel_diff_stats_t stats = {};
+        esp_panel_pixel_diff_get_stats(diff, &stats, true);
+        panel.bytes = 0;
+        for (int n = 0; n < TEST_BENCHMARK_FRAMES; n++) {
+            trace.update(frame, n);
+            auto start = chrono::steady_clock::now();
+            draw_area(diff, &panel, frame, trace.x_start, trace.y_start, trace.width, trace.height, bitmap);
+            auto end = chrono::steady_clock::now();
+            diff_us += chrono::duration_cast<chrono::microseconds>(end - start).count();
+            raw_bytes += trace.width * trace.height * bpp;
+            windows += panel.rects.size();
+        }
+        esp_panel_pixel_diff_get_stats(diff, &stats, false);
+        TEST_ASSERT_EQUAL(panel.bytes, stats.bytes_sent);
+
+        int raw_bus_us = raw_bytes / TEST_BUS_BYTES_PER_US + TEST_BENCHMARK_FRAMES * TEST_BUS_WINDOW_US;
+        int diff_bus_us = panel.bytes / TEST_BUS_BYTES_PER_US + windows * TEST_BUS_WINDOW_US;
+        printf("| %-12s | %4d | %6d | %7d | %8d / %-7d | %8d / %-6d | %7d |\n", trace.name, (int)stats.hits,
+               (int)stats.misses, (int)windows, (int)(raw_bytes / 1024), (int)(panel.bytes / 1024),
+               raw_bus_us / TEST_BENCHMARK_FRAMES, diff_bus_us / TEST_BENCHMARK_FRAMES,
+               (int)(diff_us / TEST_BENCHMARK_FRAMES));
+        esp_panel_pixel_diff_del(diff);
+    }
+}
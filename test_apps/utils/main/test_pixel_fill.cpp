@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel_fill.h"
+
+using namespace std;
+
+typedef struct {
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t x_end;
+    uint16_t y_end;
+} test_window_t;
+
+// Mock bus which records the windows and the transmitted bytes, and paints them into a frame
+typedef struct {
+    uint16_t w;
+    uint8_t bytes_per_pixel;
+    const uint8_t *buf;
+    vector<test_window_t> windows;
+    vector<size_t> byte_counts;
+    vector<uint8_t> frame;
+} test_mock_bus_t;
+
+static bool test_mock_bus_draw(void *user_ctx, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                               const void *data)
+{
+    test_mock_bus_t *bus = (test_mock_bus_t *)user_ctx;
+    TEST_ASSERT_EQUAL_PTR(bus->buf, data);
+
+    size_t line_size = (x_end - x_start) * bus->bytes_per_pixel;
+    const uint8_t *src = (const uint8_t *)data;
+    for (int y = y_start; y < y_end; y++) {
+        memcpy(&bus->frame[(y * bus->w + x_start) * bus->bytes_per_pixel], src, line_size);
+        src += line_size;
+    }
+    bus->windows.push_back({x_start, y_start, x_end, y_end});
+    bus->byte_counts.push_back(line_size * (y_end - y_start));
+
+    return true;
+}
+
+TEST_CASE("Test fill buffer repeats the pixel", "[utils][pixel][fill]")
+{
+    const uint8_t pixel[] = {0x12, 0x34, 0x56, 0x78};
+
+    for (uint8_t bytes_per_pixel = 1; bytes_per_pixel <= 4; bytes_per_pixel++) {
+        // The tail which can't hold a whole pixel should be untouched
+        vector<uint8_t> buf(103, 0xEE);
+        size_t num = esp_panel_pixel_fill_buffer(buf.data(), buf.size(), pixel, bytes_per_pixel);
+        TEST_ASSERT_EQUAL(buf.size() / bytes_per_pixel, num);
+        for (size_t i = 0; i < num * bytes_per_pixel; i++) {
+            TEST_ASSERT_EQUAL_HEX8(pixel[i % bytes_per_pixel], buf[i]);
+        }
+        for (size_t i = num * bytes_per_pixel; i < buf.size(); i++) {
+            TEST_ASSERT_EQUAL_HEX8(0xEE, buf[i]);
+        }
+    }
+
+    uint8_t buf[4] = {};
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_fill_buffer(buf, sizeof(buf), pixel, 0));
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_fill_buffer(buf, sizeof(buf), pixel, 5));
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_fill_buffer(buf, 2, pixel, 3));
+}
+
+TEST_CASE("Test fill rect emits aligned bands through the mock bus", "[utils][pixel][fill]")
+{
+    const uint16_t w = 100;
+    const uint16_t h = 60;
+    const uint8_t pixel[] = {0xA1, 0xB2, 0xC3};
+    const struct {
+        uint16_t x_start;
+        uint16_t y_start;
+        uint16_t width;
+        uint16_t height;
+        uint8_t y_align;
+        size_t buf_size;
+    } cases[] = {
+        {0, 0, w, h, 1, 1024},      // Full screen
+        {10, 5, 33, 41, 1, 500},    // Partial band at the end
+        {10, 4, 33, 40, 2, 500},    // Band height rounded down to the alignment
+        {99, 59, 1, 1, 1, 16},      // Single pixel
+        {0, 0, w, h, 0, 10000},     // Single band
+    };
+
+    for (uint8_t bytes_per_pixel = 2; bytes_per_pixel <= 3; bytes_per_pixel++) {
+        for (auto &c : cases) {
+            vector<uint8_t> buf(c.buf_size);
+            TEST_ASSERT_NOT_EQUAL(0, esp_panel_pixel_fill_buffer(buf.data(), buf.size(), pixel, bytes_per_pixel));
+
+            test_mock_bus_t bus = {};
+            bus.w = w;
+            bus.bytes_per_pixel = bytes_per_pixel;
+            bus.buf = buf.data();
+            bus.frame.assign(w * h * bytes_per_pixel, 0);
+            TEST_ASSERT_TRUE(esp_panel_pixel_fill_rect(
+                                 buf.data(), buf.size(), c.x_start, c.y_start, c.width, c.height, bytes_per_pixel,
+                                 c.y_align, test_mock_bus_draw, &bus
+                             ));
+
+            // Every band covers the full width, holds as many lines as the buffer allows and follows the previous one
+            uint8_t y_align = (c.y_align == 0) ? 1 : c.y_align;
+            size_t line_size = c.width * bytes_per_pixel;
+            int band_lines = (c.buf_size / line_size) / y_align * y_align;
+            int y = c.y_start;
+            size_t total_bytes = 0;
+            for (size_t i = 0; i < bus.windows.size(); i++) {
+                auto &window = bus.windows[i];
+                int lines = min(band_lines, c.y_start + c.height - y);
+                TEST_ASSERT_EQUAL(c.x_start, window.x_start);
+                TEST_ASSERT_EQUAL(c.x_start + c.width, window.x_end);
+                TEST_ASSERT_EQUAL(y, window.y_start);
+                TEST_ASSERT_EQUAL(y + lines, window.y_end);
+                TEST_ASSERT_EQUAL(line_size * lines, bus.byte_counts[i]);
+                TEST_ASSERT_TRUE(bus.byte_counts[i] <= c.buf_size);
+                y += lines;
+                total_bytes += bus.byte_counts[i];
+            }
+            TEST_ASSERT_EQUAL(c.y_start + c.height, y);
+            TEST_ASSERT_EQUAL(line_size * c.height, total_bytes);
+            TEST_ASSERT_EQUAL((c.height + band_lines - 1) / band_lines, bus.windows.size());
+
+            // Only the rectangle is painted, with the solid color
+            for (int py = 0; py < h; py++) {
+                for (int px = 0; px < w; px++) {
+                    bool inside = (px >= c.x_start) && (px < c.x_start + c.width) && (py >= c.y_start) &&
+                                  (py < c.y_start + c.height);
+                    for (int k = 0; k < bytes_per_pixel; k++) {
+                        TEST_ASSERT_EQUAL_HEX8(inside ? pixel[k] : 0, bus.frame[(py * w + px) * bytes_per_pixel + k]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Test fill rect with invalid arguments", "[utils][pixel][fill]")
+{
+    uint8_t buf[64] = {};
+    test_mock_bus_t bus = {};
+
+    // The buffer can't hold a single line or the aligned lines
+    TEST_ASSERT_FALSE(esp_panel_pixel_fill_rect(buf, sizeof(buf), 0, 0, 40, 4, 2, 1, test_mock_bus_draw, &bus));
+    TEST_ASSERT_FALSE(esp_panel_pixel_fill_rect(buf, sizeof(buf), 0, 0, 20, 4, 2, 2, test_mock_bus_draw, &bus));
+    TEST_ASSERT_FALSE(esp_panel_pixel_fill_rect(buf, sizeof(buf), 0, 0, 0, 4, 2, 1, test_mock_bus_draw, &bus));
+    TEST_ASSERT_FALSE(esp_panel_pixel_fill_rect(buf, sizeof(buf), 0, 0, 4, 4, 2, 1, NULL, &bus));
+    TEST_ASSERT_TRUE(bus.windows.empty());
+}
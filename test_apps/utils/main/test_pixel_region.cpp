@@ -0,0 +1,263 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel_region.h"
+
+using namespace std;
+
+#define TEST_RANDOM_ROUNDS      (300)
+#define TEST_BENCHMARK_LOOPS    (20)
+
+static const esp_panel_pixel_region_cost_t test_cost = ESP_PANEL_PIXEL_REGION_COST_DEFAULT(2);
+
+// Every pixel of the input should be covered by the output, and the output should stay in the bounding box of the input
+static void check_coverage(const vector<esp_panel_pixel_rect_t> &in, const esp_panel_pixel_rect_t *out, size_t out_num,
+                           uint16_t w, uint16_t h)
+{
+    vector<uint8_t> in_map(w * h, 0);
+    vector<uint8_t> out_map(w * h, 0);
+    esp_panel_pixel_rect_t bbox = in[0];
+
+    for (auto &rect : in) {
+        bbox.x1 = min(bbox.x1, rect.x1);
+        bbox.y1 = min(bbox.y1, rect.y1);
+        bbox.x2 = max(bbox.x2, rect.x2);
+        bbox.y2 = max(bbox.y2, rect.y2);
+        for (int y = rect.y1; y <= rect.y2; y++) {
+            memset(&in_map[y * w + rect.x1], 1, rect.x2 - rect.x1 + 1);
+        }
+    }
+    for (size_t i = 0; i < out_num; i++) {
+        TEST_ASSERT_TRUE(out[i].x1 <= out[i].x2);
+        TEST_ASSERT_TRUE(out[i].y1 <= out[i].y2);
+        TEST_ASSERT_TRUE((out[i].x1 >= bbox.x1) && (out[i].x2 <= bbox.x2));
+        TEST_ASSERT_TRUE((out[i].y1 >= bbox.y1) && (out[i].y2 <= bbox.y2));
+        for (int y = out[i].y1; y <= out[i].y2; y++) {
+            memset(&out_map[y * w + out[i].x1], 1, out[i].x2 - out[i].x1 + 1);
+        }
+    }
+    for (int i = 0; i < w * h; i++) {
+        TEST_ASSERT_TRUE(out_map[i] >= in_map[i]);
+    }
+}
+
+static size_t coalesce(vector<esp_panel_pixel_rect_t> &rects, size_t max_num)
+{
+    size_t num = rects.size();
+    rects.resize(max_num);
+    num = esp_panel_pixel_region_coalesce(&test_cost, rects.data(), num, max_num);
+    rects.resize(num);
+
+    return num;
+}
+
+TEST_CASE("Test region coalescer on typical layouts", "[utils][pixel][region]")
+{
+    // Same rectangle twice, or one inside another
+    vector<esp_panel_pixel_rect_t> rects = {{10, 10, 99, 49}, {10, 10, 99, 49}, {20, 20, 30, 30}};
+    size_t num = esp_panel_pixel_region_coalesce(&test_cost, rects.data(), rects.size(), rects.size());
+    TEST_ASSERT_EQUAL(1, num);
+    TEST_ASSERT_EQUAL(10, rects[0].x1);
+    TEST_ASSERT_EQUAL(49, rects[0].y2);
+
+    // Stacked rows of the same width are copied at once
+    rects = {{0, 0, 479, 9}, {0, 10, 479, 19}, {0, 20, 479, 29}};
+    num = esp_panel_pixel_region_coalesce(&test_cost, rects.data(), rects.size(), rects.size());
+    TEST_ASSERT_EQUAL(1, num);
+    TEST_ASSERT_EQUAL(0, rects[0].y1);
+    TEST_ASSERT_EQUAL(29, rects[0].y2);
+
+    // Two small areas in the opposite corners stay apart
+    rects = {{0, 0, 15, 15}, {460, 460, 479, 479}};
+    num = esp_panel_pixel_region_coalesce(&test_cost, rects.data(), rects.size(), rects.size());
+    TEST_ASSERT_EQUAL(2, num);
+
+    // A near-full update becomes a single full-screen copy
+    rects = {{0, 0, 479, 199}, {0, 200, 229, 479}, {250, 200, 479, 479}, {230, 200, 249, 469}};
+    num = esp_panel_pixel_region_coalesce(&test_cost, rects.data(), rects.size(), rects.size());
+    TEST_ASSERT_EQUAL(1, num);
+    TEST_ASSERT_EQUAL(0, rects[0].x1);
+    TEST_ASSERT_EQUAL(479, rects[0].x2);
+    TEST_ASSERT_EQUAL(479, rects[0].y2);
+
+    // A cross: the bounding box wastes a lot, so the overlap is cut off instead of copied twice
+    vector<esp_panel_pixel_rect_t> cross = {{0, 200, 479, 279}, {200, 0, 279, 479}};
+    rects = cross;
+    uint32_t cost_in = esp_panel_pixel_region_get_cost(&test_cost, rects.data(), rects.size());
+    num = coalesce(rects, 8);
+    TEST_ASSERT_TRUE(num > 2);
+    TEST_ASSERT_TRUE(esp_panel_pixel_region_get_cost(&test_cost, rects.data(), num) < cost_in);
+    check_coverage(cross, rects.data(), num, 480, 480);
+    for (size_t i = 0; i < num; i++) {
+        for (size_t j = i + 1; j < num; j++) {
+            bool overlap = (rects[i].x1 <= rects[j].x2) && (rects[j].x1 <= rects[i].x2) &&
+                           (rects[i].y1 <= rects[j].y2) && (rects[j].y1 <= rects[i].y2);
+            TEST_ASSERT_FALSE(overlap);
+        }
+    }
+
+    // Invalid arguments
+    esp_panel_pixel_rect_t invalid = {10, 10, 9, 10};
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_region_coalesce(&test_cost, &invalid, 1, 1));
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_region_coalesce(NULL, &invalid, 1, 1));
+    TEST_ASSERT_EQUAL(0, esp_panel_pixel_region_coalesce(&test_cost, &invalid, 2, 1));
+}
+
+TEST_CASE("Test region coalescer covers random regions with less cost", "[utils][pixel][region]")
+{
+    const uint16_t w = 160;
+    const uint16_t h = 120;
+
+    srand(7);
+    for (int round = 0; round < TEST_RANDOM_ROUNDS; round++) {
+        size_t in_num = 1 + rand() % 16;
+        vector<esp_panel_pixel_rect_t> in;
+        for (size_t i = 0; i < in_num; i++) {
+            uint16_t x1 = rand() % w;
+            uint16_t y1 = rand() % h;
+            uint16_t x2 = min(w - 1, x1 + rand() % 60);
+            uint16_t y2 = min(h - 1, y1 + rand() % 40);
+            in.push_back({x1, y1, x2, y2});
+        }
+
+        vector<esp_panel_pixel_rect_t> rects = in;
+        size_t max_num = in_num * 2;
+        size_t num = coalesce(rects, max_num);
+        TEST_ASSERT_TRUE((num > 0) && (num <= max_num));
+        TEST_ASSERT_TRUE(esp_panel_pixel_region_get_cost(&test_cost, rects.data(), num) <=
+                         esp_panel_pixel_region_get_cost(&test_cost, in.data(), in.size()));
+        check_coverage(in, rects.data(), num, w, h);
+    }
+}
+
+/**
+ * Representative LVGL v8 invalidation traces on a 480x480 screen, one frame per line and the unjoined `inv_areas` of
+ * the frame in order. They cover the typical patterns: a spinner (overlapping arcs), a scrolling list (content and
+ * scrollbar), a label grid (many small areas), a keyboard (key, text area and cursor) and a page transition (near-full
+ * bands).
+ */
+typedef struct {
+    const char *name;
+    vector<vector<esp_panel_pixel_rect_t>> frames;
+} test_trace_t;
+
+static const test_trace_t test_traces[] = {
+    {
+        "spinner", {
+            {{200, 200, 279, 239}, {230, 200, 279, 279}, {200, 240, 259, 279}},
+            {{220, 200, 279, 259}, {200, 230, 279, 279}, {200, 200, 239, 249}},
+            {{200, 220, 279, 279}, {200, 200, 259, 259}, {240, 200, 279, 239}},
+            {{200, 200, 279, 249}, {210, 240, 279, 279}, {200, 210, 229, 279}},
+        }
+    },
+    {
+        "scroll list", {
+            {{20, 60, 459, 459}, {462, 60, 469, 459}},
+            {{20, 60, 459, 459}, {462, 70, 469, 459}},
+            {{20, 60, 459, 459}, {462, 80, 469, 459}, {0, 0, 479, 47}},
+            {{20, 60, 459, 459}, {462, 90, 469, 459}},
+        }
+    },
+    {
+        "label grid", {
+            {{10, 10, 69, 29}, {130, 10, 189, 29}, {250, 10, 309, 29}, {370, 10, 429, 29}, {10, 130, 69, 149},
+             {130, 130, 189, 149}, {250, 130, 309, 149}, {370, 130, 429, 149}, {10, 250, 69, 269}, {130, 250, 189, 269},
+             {250, 250, 309, 269}, {370, 250, 429, 269}},
+            {{10, 10, 69, 29}, {12, 10, 71, 29}, {130, 10, 189, 29}, {250, 10, 309, 29}, {252, 10, 311, 29},
+             {370, 10, 429, 29}},
+            {{10, 10, 69, 29}, {10, 30, 69, 49}, {10, 50, 69, 69}, {10, 70, 69, 89}, {10, 90, 69, 109}},
+        }
+    },
+    {
+        "keyboard", {
+            {{0, 240, 479, 479}, {20, 40, 459, 199}},
+            {{64, 300, 121, 349}, {20, 40, 459, 199}, {310, 150, 312, 179}},
+            {{122, 300, 179, 349}, {64, 300, 121, 349}, {310, 150, 330, 179}},
+            {{310, 150, 312, 179}, {330, 150, 332, 179}},
+        }
+    },
+    {
+        "transition", {
+            {{0, 0, 479, 119}, {0, 120, 479, 239}, {0, 240, 479, 359}, {0, 360, 479, 469}},
+            {{0, 0, 469, 479}, {470, 0, 479, 459}},
+            {{0, 0, 479, 479}},
+        }
+    },
+};
+
+TEST_CASE("Benchmark region coalescer with LVGL invalidation traces", "[utils][pixel][region][benchmark]")
+{
+    const uint16_t w = 480;
+    const uint16_t h = 480;
+    const uint8_t bytes_per_pixel = 2;
+
+    vector<uint8_t> src(w * h * bytes_per_pixel, 0x5A);
+    vector<uint8_t> dst(src.size());
+    auto copy_rects = [&](const esp_panel_pixel_rect_t * rects, size_t num) {
+        for (size_t i = 0; i < num; i++) {
+            size_t line_size = (rects[i].x2 - rects[i].x1 + 1) * bytes_per_pixel;
+            for (int y = rects[i].y1; y <= rects[i].y2; y++) {
+                size_t offset = (y * w + rects[i].x1) * bytes_per_pixel;
+                memcpy(&dst[offset], &src[offset], line_size);
+            }
+        }
+    };
+
+    printf("| trace       | rects (raw/merged) | cost KB (raw/merged) | copy us (raw/merged) | coalesce us |\n");
+    for (auto &trace : test_traces) {
+        size_t raw_num = 0;
+        size_t merged_num = 0;
+        uint32_t raw_cost = 0;
+        uint32_t merged_cost = 0;
+        int64_t raw_us = 0;
+        int64_t merged_us = 0;
+        int64_t coalesce_us = 0;
+
+        for (auto &frame : trace.frames) {
+            vector<esp_panel_pixel_rect_t> rects = frame;
+            rects.resize(ESP_PANEL_PIXEL_REGION_RECT_NUM_MAX);
+
+            auto start = chrono::steady_clock::now();
+            size_t num = 0;
+            for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+                copy(frame.begin(), frame.end(), rects.begin());
+                num = esp_panel_pixel_region_coalesce(&test_cost, rects.data(), frame.size(), rects.size());
+            }
+            auto end = chrono::steady_clock::now();
+            coalesce_us += chrono::duration_cast<chrono::microseconds>(end - start).count();
+            TEST_ASSERT_NOT_EQUAL(0, num);
+            check_coverage(frame, rects.data(), num, w, h);
+
+            start = chrono::steady_clock::now();
+            for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+                copy_rects(frame.data(), frame.size());
+            }
+            end = chrono::steady_clock::now();
+            raw_us += chrono::duration_cast<chrono::microseconds>(end - start).count();
+
+            start = chrono::steady_clock::now();
+            for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+                copy_rects(rects.data(), num);
+            }
+            end = chrono::steady_clock::now();
+            merged_us += chrono::duration_cast<chrono::microseconds>(end - start).count();
+
+            raw_num += frame.size();
+            merged_num += num;
+            raw_cost += esp_panel_pixel_region_get_cost(&test_cost, frame.data(), frame.size());
+            merged_cost += esp_panel_pixel_region_get_cost(&test_cost, rects.data(), num);
+        }
+        TEST_ASSERT_TRUE(merged_cost <= raw_cost);
+        printf("| %-11s | %8d / %-7d | %9d / %-8d | %9d / %-8d | %11d |\n", trace.name, (int)raw_num, (int)merged_num,
+               (int)(raw_cost / 1024), (int)(merged_cost / 1024), (int)(raw_us / TEST_BENCHMARK_LOOPS),
+               (int)(merged_us / TEST_BENCHMARK_LOOPS), (int)(coalesce_us / TEST_BENCHMARK_LOOPS));
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel.h"
+#include "utils/esp_panel_pixel_tune.h"
+
+using namespace std;
+
+TEST_CASE("Test block size kernels are bit-exact with the reference", "[utils][pixel][tune]")
+{
+    const uint16_t w = 124;
+    const uint16_t h = 76;
+    const uint16_t block_sizes[] = {1, 2, 3, 4, 7, 8, 64, 1000};
+
+    srand(5);
+    for (uint8_t bytes_per_pixel = 2; bytes_per_pixel <= 3; bytes_per_pixel++) {
+        vector<uint8_t> src(w * h * bytes_per_pixel);
+        for (auto &byte : src) {
+            byte = rand() & 0xFF;
+        }
+        for (uint16_t rotate = 90; rotate <= 270; rotate += 180) {
+            vector<uint8_t> dst_ref(src.size());
+            TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_ref(
+                                 src.data(), dst_ref.data(), 0, 0, w - 1, h - 1, w, h, rotate, bytes_per_pixel
+                             ));
+            for (auto block_w : block_sizes) {
+                for (auto block_h : block_sizes) {
+                    vector<uint8_t> dst(src.size());
+                    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_with_block(
+                                         src.data(), dst.data(), 0, 0, w - 1, h - 1, w, h, rotate, bytes_per_pixel,
+                                         block_w, block_h
+                                     ));
+                    TEST_ASSERT_EQUAL_MEMORY(dst_ref.data(), dst.data(), dst.size());
+                }
+            }
+        }
+    }
+
+    uint8_t buf[16] = {};
+    TEST_ASSERT_FALSE(esp_panel_pixel_rotate_copy_with_block(buf, buf, 0, 0, 1, 1, 2, 2, 90, 2, 0, 8));
+}
+
+TEST_CASE("Test block size autotuner applies the fastest candidate", "[utils][pixel][tune]")
+{
+    const uint16_t w = 240;
+    const uint16_t h = 160;
+    uint16_t block_w = 0;
+    uint16_t block_h = 0;
+
+    for (uint8_t bytes_per_pixel = 2; bytes_per_pixel <= 3; bytes_per_pixel++) {
+        vector<uint8_t> src(w * h * bytes_per_pixel, 0xA5);
+        vector<uint8_t> dst(src.size());
+        esp_panel_pixel_tune_config_t config = {
+            .from = src.data(),
+            .to = dst.data(),
+            .w = w,
+            .h = h,
+            .rotate = 90,
+            .bytes_per_pixel = bytes_per_pixel,
+            .loops = 2,
+            .flags = {
+                .apply_best = 1,
+            },
+        };
+        esp_panel_pixel_tune_result_t results[ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM] = {};
+        esp_panel_pixel_tune_result_t best = {};
+
+        TEST_ASSERT_TRUE(esp_panel_pixel_tune_rotate_block(&config, results, &best));
+        for (auto &result : results) {
+            TEST_ASSERT_NOT_EQUAL(0, result.block_w);
+            TEST_ASSERT_NOT_EQUAL(0, result.block_h);
+            TEST_ASSERT_TRUE(best.time_us <= result.time_us);
+        }
+        TEST_ASSERT_TRUE(esp_panel_pixel_get_rotate_block_size(bytes_per_pixel, &block_w, &block_h));
+        TEST_ASSERT_EQUAL(best.block_w, block_w);
+        TEST_ASSERT_EQUAL(best.block_h, block_h);
+    }
+
+    // Restore the default size for the other tests
+    for (uint8_t bytes_per_pixel = 2; bytes_per_pixel <= 3; bytes_per_pixel++) {
+        TEST_ASSERT_TRUE(esp_panel_pixel_set_rotate_block_size(
+                             bytes_per_pixel, ESP_PANEL_PIXEL_ROTATE_BLOCK_W_DEFAULT,
+                             ESP_PANEL_PIXEL_ROTATE_BLOCK_H_DEFAULT
+                         ));
+    }
+    TEST_ASSERT_FALSE(esp_panel_pixel_set_rotate_block_size(4, 8, 8));
+    TEST_ASSERT_FALSE(esp_panel_pixel_set_rotate_block_size(2, 0, 8));
+}
+
+TEST_CASE("Benchmark rotation block sizes", "[utils][pixel][tune][benchmark]")
+{
+    const struct {
+        uint16_t w;
+        uint16_t h;
+    } sizes[] = {
+        {480, 480}, {1024, 600},
+    };
+
+    for (auto size : sizes) {
+        for (uint8_t bytes_per_pixel = 2; bytes_per_pixel <= 3; bytes_per_pixel++) {
+            vector<uint8_t> src(size.w * size.h * bytes_per_pixel, 0x5A);
+            vector<uint8_t> dst(src.size());
+            esp_panel_pixel_tune_config_t config = {
+                .from = src.data(),
+                .to = dst.data(),
+                .w = size.w,
+                .h = size.h,
+                .rotate = 90,
+                .bytes_per_pixel = bytes_per_pixel,
+                .loops = 3,
+                .flags = {},
+            };
+            esp_panel_pixel_tune_result_t results[ESP_PANEL_PIXEL_TUNE_CANDIDATE_NUM] = {};
+            esp_panel_pixel_tune_result_t best = {};
+
+            TEST_ASSERT_TRUE(esp_panel_pixel_tune_rotate_block(&config, results, &best));
+            printf("%dx%d %dbpp, best: %dx%d (%d us)\n", size.w, size.h, bytes_per_pixel * 8, best.block_w,
+                   best.block_h, (int)best.time_us);
+            printf("| block     | time (us) |\n");
+            for (auto &result : results) {
+                printf("| %4dx%-4d | %9d |\n", result.block_w, result.block_h, (int)result.time_us);
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_pixel.h"
+#include "utils/esp_panel_pixel_worker.h"
+
+using namespace std;
+
+#define TEST_WORKER_NUM_MAX     (3)
+#define TEST_RECT_NUM           (30)
+#define TEST_BENCHMARK_LOOPS    (10)
+
+static const uint16_t test_rotations[] = {0, 90, 180, 270};
+static const uint8_t test_bytes_per_pixel[] = {2, 3};
+
+static esp_panel_pixel_worker_handle_t create_worker(uint8_t num_workers)
+{
+    esp_panel_pixel_worker_config_t config = ESP_PANEL_PIXEL_WORKER_CONFIG_DEFAULT();
+    config.num_workers = num_workers;
+
+    esp_panel_pixel_worker_handle_t worker = esp_panel_pixel_worker_new(&config);
+    TEST_ASSERT_NOT_NULL(worker);
+
+    return worker;
+}
+
+typedef struct {
+    atomic<int> rows;
+    vector<uint8_t> hits;
+} test_band_ctx_t;
+
+static void test_band_func(void *ctx, uint16_t y_start, uint16_t y_end)
+{
+    test_band_ctx_t *band_ctx = (test_band_ctx_t *)ctx;
+    for (int y = y_start; y <= y_end; y++) {
+        band_ctx->hits[y]++;
+    }
+    band_ctx->rows += y_end - y_start + 1;
+}
+
+TEST_CASE("Test pixel worker covers every row exactly once", "[utils][pixel][worker]")
+{
+    for (int num_workers = 1; num_workers <= TEST_WORKER_NUM_MAX; num_workers++) {
+        esp_panel_pixel_worker_handle_t worker = create_worker(num_workers);
+        for (int y_start = 0; y_start < 9; y_start++) {
+            for (int y_end = y_start; y_end < 64; y_end += 7) {
+                for (uint8_t align : {
+                            1, 2, 4
+                        }) {
+                    test_band_ctx_t ctx;
+                    ctx.rows = 0;
+                    ctx.hits.assign(64, 0);
+                    TEST_ASSERT_TRUE(esp_panel_pixel_worker_run(worker, test_band_func, &ctx, y_start, y_end, align));
+                    TEST_ASSERT_EQUAL(y_end - y_start + 1, ctx.rows.load());
+                    for (int y = 0; y < 64; y++) {
+                        TEST_ASSERT_EQUAL(((y >= y_start) && (y <= y_end)) ? 1 : 0, ctx.hits[y]);
+                    }
+                }
+            }
+        }
+        esp_panel_pixel_worker_del(worker);
+    }
+
+    TEST_ASSERT_FALSE(esp_panel_pixel_worker_run(NULL, test_band_func, NULL, 2, 1, 1));
+    TEST_ASSERT_FALSE(esp_panel_pixel_worker_run(NULL, NULL, NULL, 0, 1, 1));
+}
+
+TEST_CASE("Test parallel pixel rotation is bit-exact with the reference", "[utils][pixel][worker]")
+{
+    const uint16_t w = 124;
+    const uint16_t h = 76;
+
+    srand(4);
+    for (int num_workers = 1; num_workers <= TEST_WORKER_NUM_MAX; num_workers++) {
+        esp_panel_pixel_worker_handle_t worker = create_worker(num_workers);
+        for (auto bytes_per_pixel : test_bytes_per_pixel) {
+            vector<uint8_t> src(w * h * bytes_per_pixel);
+            for (auto &byte : src) {
+                byte = rand() & 0xFF;
+            }
+            for (auto rotate : test_rotations) {
+                for (int i = 0; i < TEST_RECT_NUM; i++) {
+                    uint16_t x1 = rand() % w;
+                    uint16_t x2 = rand() % w;
+                    uint16_t y1 = rand() % h;
+                    uint16_t y2 = rand() % h;
+                    uint16_t x_start = (i == 0) ? 0 : min(x1, x2);
+                    uint16_t x_end = (i == 0) ? (w - 1) : max(x1, x2);
+                    uint16_t y_start = (i == 0) ? 0 : min(y1, y2);
+                    uint16_t y_end = (i == 0) ? (h - 1) : max(y1, y2);
+                    vector<uint8_t> dst_ref(src.size(), 0);
+                    vector<uint8_t> dst(src.size(), 0);
+                    TEST_ASSERT_TRUE(esp_panel_pixel_rotate_copy_ref(
+                                         src.data(), dst_ref.data(), x_start, y_start, x_end, y_end, w, h, rotate,
+                                         bytes_per_pixel
+                                     ));
+                    TEST_ASSERT_TRUE(esp_panel_pixel_worker_rotate_copy(
+                                         worker, src.data(), dst.data(), x_start, y_start, x_end, y_end, w, h, rotate,
+                                         bytes_per_pixel
+                                     ));
+                    TEST_ASSERT_EQUAL_MEMORY(dst_ref.data(), dst.data(), dst.size());
+                }
+            }
+        }
+        esp_panel_pixel_worker_del(worker);
+    }
+}
+
+TEST_CASE("Benchmark parallel pixel rotation", "[utils][pixel][worker][benchmark]")
+{
+    const uint16_t w = 1024;
+    const uint16_t h = 600;
+    const uint8_t bytes_per_pixel = 2;
+
+    vector<uint8_t> src(w * h * bytes_per_pixel, 0x5A);
+    vector<uint8_t> dst(src.size());
+
+    printf("| workers | rotate | time (us) | speedup |\n");
+    for (auto rotate : test_rotations) {
+        uint32_t serial_us = 0;
+        for (int num_workers = 0; num_workers <= TEST_WORKER_NUM_MAX; num_workers++) {
+            esp_panel_pixel_worker_handle_t worker = (num_workers > 0) ? create_worker(num_workers) : NULL;
+            auto start = chrono::steady_clock::now();
+            for (int i = 0; i < TEST_BENCHMARK_LOOPS; i++) {
+                TEST_ASSERT_TRUE(esp_panel_pixel_worker_rotate_copy(
+                                     worker, src.data(), dst.data(), 0, 0, w - 1, h - 1, w, h, rotate, bytes_per_pixel
+                                 ));
+            }
+            auto end = chrono::steady_clock::now();
+            uint32_t time_us = chrono::duration_cast<chrono::microseconds>(end - start).count() / TEST_BENCHMARK_LOOPS;
+            if (num_workers == 0) {
+                serial_us = time_us;
+            }
+            printf("| %7d | %6d | %9d | %6.2fx |\n", num_workers, rotate, (int)time_us,
+                   (float)serial_us / (time_us ? time_us : 1));
+            esp_panel_pixel_worker_del(worker);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_scroll.h"
+
+using namespace std;
+
+#define TEST_MEMORY_LINES       (320)
+#define TEST_GAP                (20)
+#define TEST_TOP_FIXED          (16)
+#define TEST_BOTTOM_FIXED       (24)
+#define TEST_SCROLL_HEIGHT      (TEST_MEMORY_LINES - TEST_GAP - TEST_TOP_FIXED - TEST_BOTTOM_FIXED)
+#define TEST_STEP_NUM           (500)
+
+typedef struct {
+    int cmd;
+    vector<uint8_t> param;
+} test_cmd_t;
+
+/**
+ * Mock panel IO of a MIPI-DCS panel: it records the command stream, and the panel shows the frame memory following
+ * VSCRDEF and VSCRSADD. Every line of the frame memory holds the ID of the content line
+ */
+typedef struct {
+    vector<test_cmd_t> cmds;
+    vector<int> memory;
+    int tfa;
+    int vsa;
+    int bfa;
+    int vsp;
+    int drawn_lines;
+} test_panel_t;
+
+static bool test_tx_param(void *user_ctx, int cmd, const void *param, size_t size)
+{
+    test_panel_t *panel = (test_panel_t *)user_ctx;
+    const uint8_t *bytes = (const uint8_t *)param;
+    panel->cmds.push_back({cmd, vector<uint8_t>(bytes, bytes + size)});
+    if (cmd == ESP_PANEL_SCROLL_CMD_VSCRDEF) {
+        TEST_ASSERT_EQUAL(6, size);
+        panel->tfa = (bytes[0] << 8) | bytes[1];
+        panel->vsa = (bytes[2] << 8) | bytes[3];
+        panel->bfa = (bytes[4] << 8) | bytes[5];
+        TEST_ASSERT_EQUAL(TEST_MEMORY_LINES, panel->tfa + panel->vsa + panel->bfa);
+    } else if (cmd == ESP_PANEL_SCROLL_CMD_VSCRSADD) {
+        TEST_ASSERT_EQUAL(2, size);
+        panel->vsp = (bytes[0] << 8) | bytes[1];
+        TEST_ASSERT_TRUE((panel->vsp >= panel->tfa) && (panel->vsp < panel->tfa + panel->vsa));
+    }
+
+    return true;
+}
+
+static bool test_draw(void *user_ctx, uint16_t y_start, uint16_t y_end, const void *data)
+{
+    test_panel_t *panel = (test_panel_t *)user_ctx;
+    const int *ids = (const int *)data;
+    TEST_ASSERT_TRUE(y_start < y_end);
+    TEST_ASSERT_TRUE(TEST_GAP + y_end <= TEST_MEMORY_LINES);
+    for (int y = y_start; y < y_end; y++) {
+        panel->memory[TEST_GAP + y] = ids[y - y_start];
+    }
+    panel->drawn_lines += y_end - y_start;
+
+    return true;
+}
+
+// The content line shown at the line of the screen
+static int test_panel_show(const test_panel_t &panel, int line)
+{
+    if ((line < panel.tfa) || (line >= panel.tfa + panel.vsa)) {
+        return panel.memory[line];
+    }
+
+    return panel.memory[panel.tfa + (panel.vsp - panel.tfa + line - panel.tfa) % panel.vsa];
+}
+
+TEST_CASE("Test scroll draws only the exposed lines", "[utils][scroll]")
+{
+    test_panel_t panel = {};
+    panel.memory.assign(TEST_MEMORY_LINES, -1);
+    esp_panel_scroll_t scroll = {};
+
+    TEST_ASSERT_TRUE(esp_panel_scroll_config_area(
+                         &scroll, TEST_GAP, TEST_TOP_FIXED, TEST_SCROLL_HEIGHT, TEST_BOTTOM_FIXED, test_tx_param, &panel
+                     ));
+    TEST_ASSERT_EQUAL(2, panel.cmds.size());
+    TEST_ASSERT_EQUAL(ESP_PANEL_SCROLL_CMD_VSCRDEF, panel.cmds[0].cmd);
+    TEST_ASSERT_EQUAL(ESP_PANEL_SCROLL_CMD_VSCRSADD, panel.cmds[1].cmd);
+    TEST_ASSERT_EQUAL(TEST_GAP + TEST_TOP_FIXED, panel.vsp);
+
+    // The log view shows the content lines `[first, first + height)`
+    vector<int> ids(TEST_SCROLL_HEIGHT);
+    for (int i = 0; i < TEST_SCROLL_HEIGHT; i++) {
+        ids[i] = i;
+    }
+    TEST_ASSERT_TRUE(test_draw(&panel, TEST_TOP_FIXED, TEST_TOP_FIXED + TEST_SCROLL_HEIGHT, ids.data()));
+    panel.drawn_lines = 0;
+
+    srand(15);
+    int first = 0;
+    int moved_lines = 0;
+    for (int step = 0; step < TEST_STEP_NUM; step++) {
+        int lines = (rand() % 41) - 15;
+        if (first + lines < 0) {
+            lines = -first;
+        }
+        // The new lines are given from top to bottom
+        int count = abs(lines);
+        int new_first = first + lines;
+        int new_start = (lines > 0) ? (new_first + TEST_SCROLL_HEIGHT - count) : new_first;
+        for (int i = 0; i < count; i++) {
+            ids[i] = new_start + i;
+        }
+        size_t cmd_num = panel.cmds.size();
+        TEST_ASSERT_TRUE(esp_panel_scroll_lines(&scroll, lines, ids.data(), sizeof(int), test_tx_param, test_draw,
+                                                &panel));
+        first = new_first;
+        moved_lines += count;
+
+        // Only the start address is sent
+        TEST_ASSERT_EQUAL(cmd_num + ((lines != 0) ? 1 : 0), panel.cmds.size());
+        for (int line = 0; line < TEST_SCROLL_HEIGHT; line++) {
+            TEST_ASSERT_EQUAL(first + line, test_panel_show(panel, TEST_GAP + TEST_TOP_FIXED + line));
+        }
+    }
+    TEST_ASSERT_EQUAL(moved_lines, panel.drawn_lines);
+    printf("| steps | drawn lines (scroll) | drawn lines (full redraw) |\n");
+    printf("| %5d | %20d | %25d |\n", TEST_STEP_NUM, panel.drawn_lines, TEST_STEP_NUM * TEST_SCROLL_HEIGHT);
+}
+
+TEST_CASE("Test scroll checks the arguments", "[utils][scroll]")
+{
+    test_panel_t panel = {};
+    esp_panel_scroll_t scroll = {};
+    int ids[4] = {};
+
+    TEST_ASSERT_FALSE(esp_panel_scroll_to(&scroll, 0, test_tx_param, &panel));
+    TEST_ASSERT_FALSE(esp_panel_scroll_config_area(&scroll, 0, 0, 0, 0, test_tx_param, &panel));
+    TEST_ASSERT_FALSE(esp_panel_scroll_config_area(&scroll, 0, 0, 10, 0, NULL, &panel));
+    TEST_ASSERT_TRUE(esp_panel_scroll_config_area(&scroll, 0, 0, 10, TEST_MEMORY_LINES - 10, test_tx_param, &panel));
+
+    // The start address wraps around the scroll area
+    TEST_ASSERT_TRUE(esp_panel_scroll_to(&scroll, 23, test_tx_param, &panel));
+    TEST_ASSERT_EQUAL(3, scroll.offset);
+    TEST_ASSERT_EQUAL(9, esp_panel_scroll_get_memory_line(&scroll, 6));
+    TEST_ASSERT_FALSE(esp_panel_scroll_lines(&scroll, 11, ids, sizeof(int), test_tx_param, test_draw, &panel));
+    TEST_ASSERT_FALSE(esp_panel_scroll_lines(&scroll, 1, NULL, sizeof(int), test_tx_param, test_draw, &panel));
+    TEST_ASSERT_TRUE(esp_panel_scroll_lines(&scroll, 0, NULL, sizeof(int), test_tx_param, test_draw, &panel));
+}
@@ -0,0 +1,235 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_spi_bitbang.h"
+
+using namespace std;
+
+#define TEST_HALF_PERIOD_US     (1)
+#define TEST_PACKAGE_NUM        (200)
+
+/**
+ * Mock GPIOs on a virtual clock: every write is recorded with the levels after it, and the delays advance the clock
+ */
+typedef struct {
+    uint32_t levels;
+    uint32_t now_us;
+    uint32_t writes;        // Calls which set a line, like `gpio_set_level()`
+    uint32_t transactions;  // Calls which change a level, like the IO expander skipping the unchanged output
+    uint32_t toggles;
+    vector<uint32_t> times;
+    vector<uint32_t> states;
+} test_lines_t;
+
+static bool test_write_lines(void *user_ctx, uint32_t mask, uint32_t levels)
+{
+    test_lines_t *lines = (test_lines_t *)user_ctx;
+    uint32_t changed = (lines->levels ^ levels) & mask;
+    lines->writes++;
+    if (changed) {
+        lines->transactions++;
+        lines->toggles += __builtin_popcount(changed);
+        lines->levels ^= changed;
+        lines->times.push_back(lines->now_us);
+        lines->states.push_back(lines->levels);
+    }
+
+    return true;
+}
+
+static void test_delay(void *user_ctx, uint32_t delay_us)
+{
+    ((test_lines_t *)user_ctx)->now_us += delay_us;
+}
+
+static void set_line(test_lines_t &lines, uint32_t line, uint32_t level)
+{
+    test_write_lines(&lines, line, level ? line : 0);
+}
+
+// Original waveform of `esp_lcd_panel_io_3wire_spi.c`, which sets a line at a time
+static void reference_write(test_lines_t &lines, const esp_panel_spi_bitbang_config_t &config, int dc_bit, uint32_t data,
+                            uint8_t bytes)
+{
+    uint32_t cs_idle = config.flags.cs_high_active ? 0 : 1;
+    uint32_t idle = config.flags.sda_scl_idle_high ? 1 : 0;
+    uint32_t scl_before = config.flags.scl_active_rising_edge ? 0 : 1;
+    uint32_t mask = config.flags.lsb_first ? 0x01 : 0x80;
+    uint32_t swap = __builtin_bswap32(data << (32 - bytes * 8));
+
+    set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_CS, !cs_idle);
+    test_delay(&lines, config.half_period_us);
+    set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SCL, scl_before);
+    for (int i = 0; i < bytes; i++) {
+        uint16_t byte = swap & 0xff;
+        int bits = ((i == 0) && (dc_bit != ESP_PANEL_SPI_BITBANG_NO_DC_BIT)) ? 9 : 8;
+        for (int j = 0; j < bits; j++) {
+            if ((bits == 9) && (j == 0)) {
+                set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SDA, dc_bit);
+            } else {
+                set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SDA, byte & mask);
+                byte = (mask == 0x01) ? (byte >> 1) : (byte << 1);
+            }
+            set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SCL, scl_before);
+            test_delay(&lines, config.half_period_us);
+            set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SCL, !scl_before);
+            test_delay(&lines, config.half_period_us);
+        }
+        swap >>= 8;
+    }
+    set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SCL, idle);
+    set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_SDA, idle);
+    test_delay(&lines, config.half_period_us);
+    set_line(lines, ESP_PANEL_SPI_BITBANG_LINE_CS, cs_idle);
+    test_delay(&lines, config.half_period_us);
+}
+
+/**
+ * Decode the bits sampled by the panel on the active SCL edges while CS is active, and check the SDA is stable for a
+ * half period around every active edge. Every package starts with a marker bit `2`
+ */
+static vector<int> decode(const test_lines_t &lines, const esp_panel_spi_bitbang_config_t &config, uint32_t init_levels)
+{
+    vector<int> bits;
+    uint32_t prev = init_levels;
+    uint32_t cs_active = config.flags.cs_high_active ? ESP_PANEL_SPI_BITBANG_LINE_CS : 0;
+    uint32_t scl_after = config.flags.scl_active_rising_edge ? ESP_PANEL_SPI_BITBANG_LINE_SCL : 0;
+    uint32_t last_sda_us = 0;
+    long last_edge_us = -1;
+
+    for (size_t i = 0; i < lines.states.size(); i++) {
+        uint32_t state = lines.states[i];
+        uint32_t changed = state ^ prev;
+        uint32_t now = lines.times[i];
+        bool is_selected = (state & ESP_PANEL_SPI_BITBANG_LINE_CS) == cs_active;
+        if ((changed & ESP_PANEL_SPI_BITBANG_LINE_CS) && is_selected) {
+            bits.push_back(2);
+        }
+        if (changed & ESP_PANEL_SPI_BITBANG_LINE_SDA) {
+            // Hold time after the last active edge
+            TEST_ASSERT_TRUE((last_edge_us < 0) || (now - last_edge_us >= config.half_period_us));
+            last_sda_us = now;
+        }
+        if ((changed & ESP_PANEL_SPI_BITBANG_LINE_SCL) && ((state & ESP_PANEL_SPI_BITBANG_LINE_SCL) == scl_after) &&
+                is_selected) {
+            // The data must not change with the active edge, and it's set up for a half period
+            TEST_ASSERT_FALSE(changed & ESP_PANEL_SPI_BITBANG_LINE_SDA);
+            TEST_ASSERT_TRUE(now - last_sda_us >= config.half_period_us);
+            bits.push_back((state & ESP_PANEL_SPI_BITBANG_LINE_SDA) ? 1 : 0);
+            last_edge_us = now;
+        }
+        prev = state;
+    }
+
+    return bits;
+}
+
+static uint32_t idle_levels(const esp_panel_spi_bitbang_config_t &config)
+{
+    return (config.flags.cs_high_active ? 0 : ESP_PANEL_SPI_BITBANG_LINE_CS) |
+           (config.flags.sda_scl_idle_high ? (ESP_PANEL_SPI_BITBANG_LINE_SCL | ESP_PANEL_SPI_BITBANG_LINE_SDA) : 0);
+}
+
+static void run_packages(const esp_panel_spi_bitbang_config_t &base, uint8_t bytes, int dc_bit, test_lines_t &naive,
+                         test_lines_t &fast)
+{
+    esp_panel_spi_bitbang_config_t config = base;
+    config.write_cb = test_write_lines;
+    config.delay_cb = test_delay;
+    config.user_ctx = &fast;
+    fast.levels = naive.levels = idle_levels(config);
+
+    esp_panel_spi_bitbang_t bitbang = {};
+    TEST_ASSERT_TRUE(esp_panel_spi_bitbang_init(&bitbang, &config));
+    for (int i = 0; i < TEST_PACKAGE_NUM; i++) {
+        uint32_t data = ((uint32_t)rand() << 16) ^ rand();
+        data &= (bytes == 4) ? 0xffffffff : ((1U << (bytes * 8)) - 1);
+        int dc = (dc_bit == ESP_PANEL_SPI_BITBANG_NO_DC_BIT) ? dc_bit : (rand() & 1);
+        reference_write(naive, config, dc, data, bytes);
+        TEST_ASSERT_TRUE(esp_panel_spi_bitbang_write(&bitbang, dc, data, bytes));
+    }
+    TEST_ASSERT_EQUAL(idle_levels(config), fast.levels);
+
+    esp_panel_spi_bitbang_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_spi_bitbang_get_stats(&bitbang, &stats, true));
+    TEST_ASSERT_EQUAL(fast.transactions, stats.writes);
+    TEST_ASSERT_EQUAL(fast.toggles, stats.toggles);
+}
+
+TEST_CASE("Test SPI bitbang keeps the waveform of the line-by-line writes", "[utils][spi_bitbang]")
+{
+    srand(17);
+    for (int mode = 0; mode < 16; mode++) {
+        for (uint8_t bytes = 1; bytes <= 4; bytes++) {
+            for (int dc_bit : {ESP_PANEL_SPI_BITBANG_NO_DC_BIT, 0}) {
+                esp_panel_spi_bitbang_config_t config = {};
+                config.half_period_us = TEST_HALF_PERIOD_US;
+                config.flags.sda_scl_idle_high = mode & 0x1;
+                // Same as the SPI mode of `esp_lcd_panel_io_3wire_spi.c`
+                if (config.flags.sda_scl_idle_high) {
+                    config.flags.scl_active_rising_edge = (mode & 0x2) ? 1 : 0;
+                } else {
+                    config.flags.scl_active_rising_edge = (mode & 0x2) ? 0 : 1;
+                }
+                config.flags.lsb_first = (mode >> 2) & 0x1;
+                config.flags.cs_high_active = (mode >> 3) & 0x1;
+
+                test_lines_t naive = {};
+                test_lines_t fast = {};
+                run_packages(config, bytes, dc_bit, naive, fast);
+                vector<int> expect = decode(naive, config, idle_levels(config));
+                vector<int> actual = decode(fast, config, idle_levels(config));
+                TEST_ASSERT_EQUAL(TEST_PACKAGE_NUM * (bytes * 8 + (dc_bit == 0 ? 1 : 0) + 1), expect.size());
+                TEST_ASSERT_EQUAL(expect.size(), actual.size());
+                TEST_ASSERT_EQUAL_MEMORY(expect.data(), actual.data(), expect.size() * sizeof(int));
+                // The same edges with fewer writes, and never slower
+                TEST_ASSERT_EQUAL(naive.toggles, fast.toggles);
+                TEST_ASSERT_TRUE(fast.transactions < naive.transactions);
+                TEST_ASSERT_EQUAL(naive.now_us, fast.now_us);
+            }
+        }
+    }
+}
+
+TEST_CASE("Test SPI bitbang checks the arguments", "[utils][spi_bitbang]")
+{
+    test_lines_t lines = {};
+    esp_panel_spi_bitbang_t bitbang = {};
+    esp_panel_spi_bitbang_config_t config = {};
+    esp_panel_spi_bitbang_stats_t stats = {};
+
+    TEST_ASSERT_FALSE(esp_panel_spi_bitbang_init(&bitbang, &config));
+    config.write_cb = test_write_lines;
+    config.delay_cb = test_delay;
+    config.user_ctx = &lines;
+    TEST_ASSERT_FALSE(esp_panel_spi_bitbang_init(NULL, &config));
+    TEST_ASSERT_TRUE(esp_panel_spi_bitbang_init(&bitbang, &config));
+    TEST_ASSERT_FALSE(esp_panel_spi_bitbang_write(&bitbang, 0, 0, 0));
+    TEST_ASSERT_FALSE(esp_panel_spi_bitbang_write(&bitbang, 0, 0, 5));
+    TEST_ASSERT_FALSE(esp_panel_spi_bitbang_get_stats(&bitbang, NULL, false));
+    TEST_ASSERT_TRUE(esp_panel_spi_bitbang_get_stats(&bitbang, &stats, false));
+    TEST_ASSERT_EQUAL(0, stats.writes);
+}
+
+TEST_CASE("Benchmark SPI bitbang writes against the line-by-line writes", "[utils][spi_bitbang][benchmark]")
+{
+    // Like the initialization of ST7701 through 9-bit 3-wire SPI: 1-byte packages with a DC bit
+    esp_panel_spi_bitbang_config_t config = {};
+    config.half_period_us = TEST_HALF_PERIOD_US;
+    test_lines_t naive = {};
+    test_lines_t fast = {};
+
+    srand(17);
+    run_packages(config, 1, 0, naive, fast);
+    printf("| path | line writes | expander transactions | toggles |\n");
+    printf("| line by line | %11d | %21d | %7d |\n", (int)naive.writes, (int)naive.transactions, (int)naive.toggles);
+    printf("| merged edges | %11d | %21d | %7d |\n", (int)fast.writes, (int)fast.transactions, (int)fast.toggles);
+    printf("expander transactions per package: %.1f -> %.1f\n", (double)naive.transactions / TEST_PACKAGE_NUM,
+           (double)fast.transactions / TEST_PACKAGE_NUM);
+}
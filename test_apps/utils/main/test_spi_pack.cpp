@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_spi_bitbang.h"
+#include "utils/esp_panel_spi_pack.h"
+
+using namespace std;
+
+#define TEST_PACKAGE_NUM        (300)
+#define TEST_BUFFER_SIZE        (64)
+
+/**
+ * Mock lines which record the SDA level on every active SCL edge while CS is active
+ */
+typedef struct {
+    uint32_t levels;
+    uint32_t cs_active;
+    uint32_t scl_after;
+    vector<int> bits;
+} test_lines_t;
+
+static bool test_write_lines(void *user_ctx, uint32_t mask, uint32_t levels)
+{
+    test_lines_t *lines = (test_lines_t *)user_ctx;
+    uint32_t changed = (lines->levels ^ levels) & mask;
+    lines->levels ^= changed;
+    if ((changed & ESP_PANEL_SPI_BITBANG_LINE_SCL) &&
+            ((lines->levels & ESP_PANEL_SPI_BITBANG_LINE_SCL) == lines->scl_after) &&
+            ((lines->levels & ESP_PANEL_SPI_BITBANG_LINE_CS) == lines->cs_active)) {
+        lines->bits.push_back((lines->levels & ESP_PANEL_SPI_BITBANG_LINE_SDA) ? 1 : 0);
+    }
+
+    return true;
+}
+
+static void test_delay(void *user_ctx, uint32_t delay_us)
+{
+}
+
+// Bits of the SPI master peripheral in the MSB first mode, which sends `length` bits from the start of the buffer
+static void shift_out(const uint8_t *buf, size_t length, vector<int> &bits)
+{
+    for (size_t i = 0; i < length; i++) {
+        bits.push_back((buf[i / 8] >> (7 - i % 8)) & 1);
+    }
+}
+
+TEST_CASE("Test SPI pack sends the same bits as the bitbang", "[utils][spi_pack]")
+{
+    srand(18);
+    for (int mode = 0; mode < 4; mode++) {
+        for (uint8_t bytes = 1; bytes <= 4; bytes++) {
+            for (int dc_bit : {ESP_PANEL_SPI_PACK_NO_DC_BIT, 0}) {
+                esp_panel_spi_bitbang_config_t config = {};
+                config.write_cb = test_write_lines;
+                config.delay_cb = test_delay;
+                config.flags.sda_scl_idle_high = mode & 0x1;
+                config.flags.scl_active_rising_edge = !config.flags.sda_scl_idle_high;
+                config.flags.lsb_first = (mode >> 1) & 0x1;
+                test_lines_t lines = {};
+                lines.levels = ESP_PANEL_SPI_BITBANG_LINE_CS |
+                               (config.flags.sda_scl_idle_high ?
+                                (ESP_PANEL_SPI_BITBANG_LINE_SCL | ESP_PANEL_SPI_BITBANG_LINE_SDA) : 0);
+                lines.scl_after = config.flags.scl_active_rising_edge ? ESP_PANEL_SPI_BITBANG_LINE_SCL : 0;
+                config.user_ctx = &lines;
+                esp_panel_spi_bitbang_t bitbang = {};
+                TEST_ASSERT_TRUE(esp_panel_spi_bitbang_init(&bitbang, &config));
+
+                uint8_t buf[TEST_BUFFER_SIZE];
+                esp_panel_spi_pack_t pack = {};
+                TEST_ASSERT_TRUE(esp_panel_spi_pack_init(&pack, buf, sizeof(buf), config.flags.lsb_first));
+                vector<int> actual;
+                int flushes = 0;
+                for (int i = 0; i < TEST_PACKAGE_NUM; i++) {
+                    uint32_t data = ((uint32_t)rand() << 16) ^ rand();
+                    data &= (bytes == 4) ? 0xffffffff : ((1U << (bytes * 8)) - 1);
+                    int dc = (dc_bit == ESP_PANEL_SPI_PACK_NO_DC_BIT) ? dc_bit : (rand() & 1);
+                    TEST_ASSERT_TRUE(esp_panel_spi_bitbang_write(&bitbang, dc, data, bytes));
+                    // Flush the buffer when it's full, like a transaction of the driver
+                    if (!esp_panel_spi_pack_push(&pack, dc, data, bytes)) {
+                        shift_out(buf, esp_panel_spi_pack_get_bits(&pack), actual);
+                        esp_panel_spi_pack_reset(&pack);
+                        flushes++;
+                        TEST_ASSERT_TRUE(esp_panel_spi_pack_push(&pack, dc, data, bytes));
+                    }
+                }
+                shift_out(buf, esp_panel_spi_pack_get_bits(&pack), actual);
+
+                TEST_ASSERT_EQUAL(TEST_PACKAGE_NUM * esp_panel_spi_pack_get_package_bits(dc_bit, bytes),
+                                  lines.bits.size());
+                TEST_ASSERT_EQUAL(lines.bits.size(), actual.size());
+                TEST_ASSERT_EQUAL_MEMORY(lines.bits.data(), actual.data(), actual.size() * sizeof(int));
+                TEST_ASSERT_NOT_EQUAL(0, flushes);
+            }
+        }
+    }
+}
+
+TEST_CASE("Test SPI pack packs the 9-bit packages", "[utils][spi_pack]")
+{
+    uint8_t buf[4] = {0xff, 0xff, 0xff, 0xff};
+    esp_panel_spi_pack_t pack = {};
+
+    // The buffer is cleared by the initialization
+    TEST_ASSERT_TRUE(esp_panel_spi_pack_init(&pack, buf, sizeof(buf), false));
+    TEST_ASSERT_EQUAL(0, buf[3]);
+    // Command 0x11 (DC = 0) and parameter 0xA5 (DC = 1): 0 0001 0001 1 1010 0101, sent from the MSB of the first byte
+    TEST_ASSERT_TRUE(esp_panel_spi_pack_push(&pack, 0, 0x11, 1));
+    TEST_ASSERT_TRUE(esp_panel_spi_pack_push(&pack, 1, 0xA5, 1));
+    TEST_ASSERT_EQUAL(18, esp_panel_spi_pack_get_bits(&pack));
+    const uint8_t expect[] = {0x08, 0xE9, 0x40, 0x00};
+    TEST_ASSERT_EQUAL_MEMORY(expect, buf, sizeof(expect));
+    // 18 + 9 bits fit in 32 bits, but the next package doesn't
+    TEST_ASSERT_TRUE(esp_panel_spi_pack_push(&pack, 1, 0xff, 1));
+    TEST_ASSERT_FALSE(esp_panel_spi_pack_push(&pack, 1, 0xff, 1));
+    TEST_ASSERT_EQUAL(27, esp_panel_spi_pack_get_bits(&pack));
+
+    // The LSB first order and no DC bit
+    esp_panel_spi_pack_reset(&pack);
+    TEST_ASSERT_EQUAL(0, esp_panel_spi_pack_get_bits(&pack));
+    TEST_ASSERT_TRUE(esp_panel_spi_pack_init(&pack, buf, sizeof(buf), true));
+    TEST_ASSERT_TRUE(esp_panel_spi_pack_push(&pack, ESP_PANEL_SPI_PACK_NO_DC_BIT, 0x1234, 2));
+    const uint8_t expect_lsb[] = {0x48, 0x2C, 0x00, 0x00};
+    TEST_ASSERT_EQUAL_MEMORY(expect_lsb, buf, sizeof(expect_lsb));
+
+    TEST_ASSERT_FALSE(esp_panel_spi_pack_init(NULL, buf, sizeof(buf), false));
+    TEST_ASSERT_FALSE(esp_panel_spi_pack_init(&pack, NULL, sizeof(buf), false));
+    TEST_ASSERT_FALSE(esp_panel_spi_pack_push(&pack, 0, 0, 0));
+    TEST_ASSERT_FALSE(esp_panel_spi_pack_push(&pack, 0, 0, 5));
+    TEST_ASSERT_EQUAL(0, esp_panel_spi_pack_get_bits(NULL));
+}
+
+TEST_CASE("Benchmark bus time of the 3-wire SPI initialization", "[utils][spi_pack][benchmark]")
+{
+    /**
+     * Like the initialization of ST7701: about 300 9-bit packages in 60 commands. The bitbang takes a whole SCL period
+     * per bit plus about a period around CS of every package at 500 KHz (the fastest software clock). The SPI master sends a
+     * transaction per command with the parameters, and about 10 us is counted for the setup of every transaction
+     */
+    const int package_num = 300;
+    const int cmd_num = 60;
+    const double bitbang_clk_hz = 500 * 1000;
+    const double host_clk_hz = 5 * 1000 * 1000;
+    const double host_transaction_us = 10;
+
+    uint8_t buf[TEST_BUFFER_SIZE];
+    esp_panel_spi_pack_t pack = {};
+    esp_panel_spi_pack_init(&pack, buf, sizeof(buf), false);
+    size_t bits = 0;
+    int transactions = 0;
+    for (int c = 0; c < cmd_num; c++) {
+        esp_panel_spi_pack_push(&pack, 0, c, 1);
+        for (int p = 0; p < package_num / cmd_num - 1; p++) {
+            if (!esp_panel_spi_pack_push(&pack, 1, p, 1)) {
+                bits += esp_panel_spi_pack_get_bits(&pack);
+                transactions++;
+                esp_panel_spi_pack_reset(&pack);
+                esp_panel_spi_pack_push(&pack, 1, p, 1);
+            }
+        }
+        bits += esp_panel_spi_pack_get_bits(&pack);
+        transactions++;
+        esp_panel_spi_pack_reset(&pack);
+    }
+    TEST_ASSERT_EQUAL(package_num * 9, bits);
+
+    double bitbang_us = (bits + package_num) * 1e6 / bitbang_clk_hz;
+    double host_bus_us = bits * 1e6 / host_clk_hz;
+    double host_us = host_bus_us + transactions * host_transaction_us;
+    printf("| backend | transactions | bus time (us) | with setup (us) |\n");
+    printf("| bitbang @500KHz | %12d | %13.1f | %15.1f |\n", package_num, bitbang_us, bitbang_us);
+    printf("| SPI master @5MHz | %12d | %13.1f | %15.1f |\n", transactions, host_bus_us, host_us);
+    TEST_ASSERT_TRUE(host_bus_us < 1000);
+    TEST_ASSERT_TRUE(host_us < bitbang_us / 4);
+}
@@ -0,0 +1,201 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_swap_chain.h"
+
+using namespace std;
+
+#define TEST_FRAME_SIZE         (4096)
+#define TEST_FRAME_NUM          (300)
+
+static esp_panel_swap_chain_handle_t create_chain(uint8_t num_bufs)
+{
+    esp_panel_swap_chain_config_t config = {
+        .num_bufs = num_bufs,
+        .front_index = 0,
+    };
+    esp_panel_swap_chain_handle_t chain = esp_panel_swap_chain_new(&config);
+    TEST_ASSERT_NOT_NULL(chain);
+
+    return chain;
+}
+
+TEST_CASE("Test double-buffer swap chain waits for the vsync", "[utils][swap_chain]")
+{
+    esp_panel_swap_chain_handle_t chain = create_chain(2);
+    esp_panel_swap_chain_stats_t stats = {};
+    uint8_t index = 0;
+
+    TEST_ASSERT_EQUAL(0, esp_panel_swap_chain_get_front(chain));
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_acquire(chain, &index));
+    TEST_ASSERT_EQUAL(1, index);
+    // Only one buffer can be acquired at a time
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_acquire(chain, &index));
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_present(chain, 0));
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_present(chain, 1));
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_present(chain, 1));
+
+    // The front buffer is still scanned out and the other one is pending
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_acquire(chain, &index));
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_on_vsync(chain));
+    TEST_ASSERT_EQUAL(1, esp_panel_swap_chain_get_front(chain));
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_on_vsync(chain));
+
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_acquire(chain, &index));
+    TEST_ASSERT_EQUAL(0, index);
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_release(chain, 1));
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_release(chain, 0));
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_present(chain, 0));
+    TEST_ASSERT_FALSE(esp_panel_swap_chain_present(chain, 3));
+
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_get_stats(chain, &stats));
+    TEST_ASSERT_EQUAL(1, stats.presented);
+    TEST_ASSERT_EQUAL(1, stats.shown);
+    TEST_ASSERT_EQUAL(0, stats.dropped);
+    TEST_ASSERT_EQUAL(2, stats.vsyncs);
+    esp_panel_swap_chain_del(chain);
+
+    esp_panel_swap_chain_config_t config = {
+        .num_bufs = 4,
+        .front_index = 0,
+    };
+    TEST_ASSERT_NULL(esp_panel_swap_chain_new(&config));
+    config.num_bufs = 2;
+    config.front_index = 2;
+    TEST_ASSERT_NULL(esp_panel_swap_chain_new(&config));
+}
+
+TEST_CASE("Test triple-buffer swap chain never stalls the renderer", "[utils][swap_chain]")
+{
+    esp_panel_swap_chain_handle_t chain = create_chain(3);
+    esp_panel_swap_chain_stats_t stats = {};
+    uint8_t index = 0;
+
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(esp_panel_swap_chain_acquire(chain, &index));
+        TEST_ASSERT_NOT_EQUAL(esp_panel_swap_chain_get_front(chain), index);
+        TEST_ASSERT_TRUE(esp_panel_swap_chain_present(chain, index));
+    }
+    // Only the newest presented buffer is scanned out
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_on_vsync(chain));
+    TEST_ASSERT_EQUAL(index, esp_panel_swap_chain_get_front(chain));
+
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_get_stats(chain, &stats));
+    TEST_ASSERT_EQUAL(10, stats.presented);
+    TEST_ASSERT_EQUAL(1, stats.shown);
+    TEST_ASSERT_EQUAL(9, stats.dropped);
+    esp_panel_swap_chain_del(chain);
+}
+
+typedef struct {
+    uint32_t vsync_period_us;
+    uint32_t render_us;
+    uint32_t frames_shown;
+    uint32_t wait_us;
+} test_simulation_t;
+
+/**
+ * The display thread simulates the vsync ISR and checks the scanned out buffer is complete, while the render thread
+ * writes the frame number into every byte of the acquired buffer
+ */
+static void run_simulation(uint8_t num_bufs, test_simulation_t &sim)
+{
+    esp_panel_swap_chain_handle_t chain = create_chain(num_bufs);
+    vector<vector<uint32_t>> bufs(num_bufs, vector<uint32_t>(TEST_FRAME_SIZE / sizeof(uint32_t), 0));
+    atomic<bool> exit(false);
+    atomic<int> errors(0);
+    uint32_t last_frame = 0;
+
+    thread display([&] {
+        while (!exit) {
+            this_thread::sleep_for(chrono::microseconds(sim.vsync_period_us));
+            esp_panel_swap_chain_on_vsync(chain);
+            // The front buffer is never written by the renderer, so it must hold a single frame
+            const vector<uint32_t> &front = bufs[esp_panel_swap_chain_get_front(chain)];
+            uint32_t frame = front[0];
+            for (auto value : front) {
+                if (value != frame) {
+                    errors++;
+                    break;
+                }
+            }
+            if (frame < last_frame) {
+                errors++;
+            }
+            last_frame = frame;
+        }
+    });
+
+    uint64_t wait_us = 0;
+    for (uint32_t frame = 1; frame <= TEST_FRAME_NUM; frame++) {
+        uint8_t index = 0;
+        auto start = chrono::steady_clock::now();
+        while (!esp_panel_swap_chain_acquire(chain, &index)) {
+            this_thread::yield();
+        }
+        wait_us += chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+        vector<uint32_t> &buf = bufs[index];
+        auto render_end = chrono::steady_clock::now() + chrono::microseconds(sim.render_us);
+        do {
+            for (auto &value : buf) {
+                value = frame;
+            }
+        } while (chrono::steady_clock::now() < render_end);
+        TEST_ASSERT_TRUE(esp_panel_swap_chain_present(chain, index));
+    }
+    exit = true;
+    display.join();
+
+    esp_panel_swap_chain_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_swap_chain_get_stats(chain, &stats));
+    TEST_ASSERT_EQUAL(0, errors.load());
+    TEST_ASSERT_EQUAL(TEST_FRAME_NUM, stats.presented);
+    TEST_ASSERT_TRUE(stats.shown + stats.dropped <= stats.presented);
+    sim.frames_shown = stats.shown;
+    sim.wait_us = wait_us;
+    esp_panel_swap_chain_del(chain);
+}
+
+TEST_CASE("Test swap chain with a simulated vsync source", "[utils][swap_chain]")
+{
+    for (uint8_t num_bufs = ESP_PANEL_SWAP_CHAIN_BUF_NUM_MIN; num_bufs <= ESP_PANEL_SWAP_CHAIN_BUF_NUM_MAX; num_bufs++) {
+        test_simulation_t sim = {
+            .vsync_period_us = 200,
+            .render_us = 0,
+            .frames_shown = 0,
+            .wait_us = 0,
+        };
+        run_simulation(num_bufs, sim);
+    }
+}
+
+TEST_CASE("Benchmark swap chain render stalls", "[utils][swap_chain][benchmark]")
+{
+    const uint32_t render_us[] = {500, 1000, 1500};
+
+    printf("| buffers | render/vsync | shown frames | render wait (us/frame) |\n");
+    for (auto render : render_us) {
+        for (uint8_t num_bufs = ESP_PANEL_SWAP_CHAIN_BUF_NUM_MIN; num_bufs <= ESP_PANEL_SWAP_CHAIN_BUF_NUM_MAX;
+                num_bufs++) {
+            test_simulation_t sim = {
+                .vsync_period_us = 1000,
+                .render_us = render,
+                .frames_shown = 0,
+                .wait_us = 0,
+            };
+            run_simulation(num_bufs, sim);
+            printf("| %7d | %12.1f | %12d | %22d |\n", num_bufs, render / 1000.0f, (int)sim.frames_shown,
+                   (int)(sim.wait_us / TEST_FRAME_NUM));
+        }
+    }
+}
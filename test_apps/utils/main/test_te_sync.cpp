@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "unity.h"
+#include "utils/esp_panel_te_sync.h"
+
+#define TEST_LCD_HEIGHT     (480)
+#define TEST_VBLANK_LINES   (10)
+#define TEST_DRAW_NUM       (200)
+
+/**
+ * Mock panel and bus on a virtual clock: the panel raises TE every `period_us` and scans a row every
+ * `period_us / (height + vblank)` after the blanking lines, while the bus writes a row every `row_write_us`
+ */
+typedef struct {
+    double period_us;
+    double row_write_us;
+    int drop_te_every;          // Drop every N-th TE edge, `0` means no drop
+    bool use_sync;
+    double now_us;
+    int te_index;
+    int dropped_te;
+    int torn_chunks;
+    int chunks;
+} test_model_t;
+
+static double model_line_us(const test_model_t &model)
+{
+    return model.period_us / (TEST_LCD_HEIGHT + TEST_VBLANK_LINES);
+}
+
+// Deliver the TE edges up to the current time, like the GPIO ISR
+static void model_deliver_te(test_model_t &model, esp_panel_te_sync_handle_t sync)
+{
+    while (model.te_index * model.period_us <= model.now_us) {
+        if ((model.drop_te_every > 0) && (model.te_index > 0) && ((model.te_index % model.drop_te_every) == 0)) {
+            model.dropped_te++;
+        } else {
+            esp_panel_te_sync_on_te(sync, (int64_t)(model.te_index * model.period_us));
+        }
+        model.te_index++;
+    }
+}
+
+// Write the rows `[a, b]` from the current time, and check no scan line passes them in the middle
+static void model_write_chunk(test_model_t &model, int a, int b)
+{
+    double line = model_line_us(model);
+    double porch = TEST_VBLANK_LINES * line;
+    long frame = 0;
+
+    for (int r = a; r <= b; r++) {
+        double write_start = model.now_us + (r - a) * model.row_write_us;
+        double write_end = write_start + model.row_write_us;
+        double scan = porch + r * line;
+        // Index of the last scan pass before the row is written, all the rows should be shown by the same next pass
+        long k = (long)floor((write_start - scan) / model.period_us);
+        bool is_crossed = (write_end > scan + (k + 1) * model.period_us);
+        if (is_crossed || ((r > a) && (k != frame))) {
+            model.torn_chunks++;
+            break;
+        }
+        frame = k;
+    }
+    model.now_us += (b - a + 1) * model.row_write_us;
+    model.chunks++;
+}
+
+static void model_draw(test_model_t &model, esp_panel_te_sync_handle_t sync, int y_start, int y_end)
+{
+    int a = y_start;
+    while (a <= y_end) {
+        model_deliver_te(model, sync);
+        esp_panel_te_sync_chunk_t chunk = {};
+        if (model.use_sync) {
+            TEST_ASSERT_TRUE(esp_panel_te_sync_plan(sync, (int64_t)ceil(model.now_us), a, y_end, &chunk));
+            TEST_ASSERT_TRUE((chunk.y_end >= a) && (chunk.y_end <= y_end));
+            TEST_ASSERT_TRUE(chunk.start_us >= (int64_t)model.now_us);
+            model.now_us = chunk.start_us;
+        } else {
+            chunk.y_end = y_end;
+        }
+        double start_us = model.now_us;
+        model_write_chunk(model, a, chunk.y_end);
+        TEST_ASSERT_TRUE(esp_panel_te_sync_report(sync, chunk.y_end - a + 1, (uint32_t)(model.now_us - start_us)));
+        a = chunk.y_end + 1;
+    }
+    // The renderer prepares the next frame
+    model.now_us += rand() % 5000;
+}
+
+static esp_panel_te_sync_handle_t create_sync(void)
+{
+    esp_panel_te_sync_config_t config = ESP_PANEL_TE_SYNC_CONFIG_DEFAULT(TEST_LCD_HEIGHT);
+    config.vblank_lines = TEST_VBLANK_LINES;
+    esp_panel_te_sync_handle_t sync = esp_panel_te_sync_new(&config);
+    TEST_ASSERT_NOT_NULL(sync);
+
+    return sync;
+}
+
+static void run_model(test_model_t &model)
+{
+    esp_panel_te_sync_handle_t sync = create_sync();
+
+    srand(10);
+    // Let the period and the row time be measured first
+    for (int i = 0; i < 10; i++) {
+        model_draw(model, sync, 0, 0);
+        model.now_us += model.period_us;
+    }
+    model.torn_chunks = 0;
+    model.chunks = 0;
+    for (int i = 0; i < TEST_DRAW_NUM; i++) {
+        int y1 = rand() % TEST_LCD_HEIGHT;
+        int y2 = rand() % TEST_LCD_HEIGHT;
+        bool is_full = ((i % 4) == 0);
+        model_draw(model, sync, is_full ? 0 : std::min(y1, y2), is_full ? (TEST_LCD_HEIGHT - 1) : std::max(y1, y2));
+    }
+
+    esp_panel_te_sync_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_te_sync_get_stats(sync, &stats, false));
+    TEST_ASSERT_EQUAL(model.dropped_te, stats.missed_te);
+    TEST_ASSERT_TRUE(fabs(stats.frame_period_us - model.period_us) < model.period_us / 100);
+    esp_panel_te_sync_del(sync);
+}
+
+TEST_CASE("Test TE sync keeps every chunk away from the scan line", "[utils][te_sync]")
+{
+    // A fast bus stays ahead of the scan line, and a slow one is split into chunks behind it
+    const double row_write_us[] = {10, 30, 60, 140};
+    const double period_us[] = {16667, 25000};
+
+    for (auto period : period_us) {
+        for (auto row_write : row_write_us) {
+            test_model_t model = {};
+            model.period_us = period;
+            model.row_write_us = row_write;
+            model.use_sync = true;
+            run_model(model);
+            TEST_ASSERT_EQUAL(0, model.torn_chunks);
+        }
+    }
+}
+
+// Height of the first chunk of a full screen draw just after a TE edge, with the given alignment and row time
+static int plan_first_rows(uint8_t y_align, uint32_t row_write_ns)
+{
+    esp_panel_te_sync_config_t config = ESP_PANEL_TE_SYNC_CONFIG_DEFAULT(TEST_LCD_HEIGHT);
+    config.vblank_lines = TEST_VBLANK_LINES;
+    config.frame_period_us = 16667;
+    config.row_write_ns = row_write_ns;
+    config.y_align = y_align;
+    esp_panel_te_sync_handle_t sync = esp_panel_te_sync_new(&config);
+    TEST_ASSERT_NOT_NULL(sync);
+
+    esp_panel_te_sync_chunk_t chunk = {};
+    TEST_ASSERT_TRUE(esp_panel_te_sync_on_te(sync, 0));
+    TEST_ASSERT_TRUE(esp_panel_te_sync_on_te(sync, 16667));
+    TEST_ASSERT_TRUE(esp_panel_te_sync_plan(sync, 16700, 10, TEST_LCD_HEIGHT - 1, &chunk));
+    esp_panel_te_sync_del(sync);
+
+    return chunk.y_end - 10 + 1;
+}
+
+TEST_CASE("Test TE sync aligns the chunk height", "[utils][te_sync]")
+{
+    // Find a slow bus whose drift limits the chunk to an odd number of rows
+    uint32_t row_write_ns = 60000;
+    int rows = plan_first_rows(1, row_write_ns);
+    while ((rows % 2) == 0) {
+        row_write_ns += 1000;
+        rows = plan_first_rows(1, row_write_ns);
+    }
+    TEST_ASSERT_TRUE(rows < TEST_LCD_HEIGHT - 10);
+    TEST_ASSERT_EQUAL(rows - 1, plan_first_rows(2, row_write_ns));
+    TEST_ASSERT_EQUAL(rows, plan_first_rows(0, row_write_ns));
+
+    // A single aligned unit is kept even if the drift only allows one row
+    TEST_ASSERT_EQUAL(1, plan_first_rows(1, 40000000));
+    TEST_ASSERT_EQUAL(2, plan_first_rows(2, 40000000));
+    TEST_ASSERT_EQUAL(4, plan_first_rows(4, 40000000));
+}
+
+TEST_CASE("Test TE sync counts the missed TE edges", "[utils][te_sync]")
+{
+    test_model_t model = {};
+    model.period_us = 16667;
+    model.row_write_us = 60;
+    model.drop_te_every = 7;
+    model.use_sync = true;
+    run_model(model);
+    TEST_ASSERT_NOT_EQUAL(0, model.dropped_te);
+    TEST_ASSERT_EQUAL(0, model.torn_chunks);
+
+    // Without TE edges, the rows are written at once
+    esp_panel_te_sync_handle_t sync = create_sync();
+    esp_panel_te_sync_chunk_t chunk = {};
+    esp_panel_te_sync_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_te_sync_plan(sync, 1000, 0, TEST_LCD_HEIGHT - 1, &chunk));
+    TEST_ASSERT_EQUAL(TEST_LCD_HEIGHT - 1, chunk.y_end);
+    TEST_ASSERT_EQUAL(1000, chunk.start_us);
+    TEST_ASSERT_TRUE(esp_panel_te_sync_get_stats(sync, &stats, true));
+    TEST_ASSERT_EQUAL(1, stats.unsynced);
+    TEST_ASSERT_FALSE(esp_panel_te_sync_plan(sync, 1000, 0, TEST_LCD_HEIGHT, &chunk));
+    TEST_ASSERT_FALSE(esp_panel_te_sync_plan(sync, 1000, 2, 1, &chunk));
+    esp_panel_te_sync_del(sync);
+}
+
+TEST_CASE("Benchmark TE sync against unsynchronized writes", "[utils][te_sync][benchmark]")
+{
+    const double row_write_us[] = {10, 30, 60, 140};
+
+    printf("| row write (us) | torn chunks (no TE) | torn chunks (TE) | chunks (TE) | time (TE / no TE) |\n");
+    for (auto row_write : row_write_us) {
+        test_model_t naive = {};
+        naive.period_us = 16667;
+        naive.row_write_us = row_write;
+        run_model(naive);
+
+        test_model_t synced = {};
+        synced.period_us = 16667;
+        synced.row_write_us = row_write;
+        synced.use_sync = true;
+        run_model(synced);
+
+        printf("| %14.0f | %19d | %16d | %11d | %17.2f |\n", row_write, naive.torn_chunks, synced.torn_chunks,
+               synced.chunks, synced.now_us / naive.now_us);
+    }
+}
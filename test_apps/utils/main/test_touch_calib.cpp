@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_touch_calib.h"
+
+using namespace std;
+
+#define TEST_SCREEN_WIDTH       (320)
+#define TEST_SCREEN_HEIGHT      (240)
+#define TEST_GRID_STEP          (8)
+#define TEST_TRIAL_NUM          (200)
+
+/**
+ * A resistive panel with swapped axes, offsets and a slight skew: the raw point read at the screen point (x, y)
+ */
+static void test_get_raw(double x, double y, int32_t &raw_x, int32_t &raw_y)
+{
+    raw_x = (int32_t)lround(250 + 0.35 * x + 15.1 * y);
+    raw_y = (int32_t)lround(3850 - 11.4 * x + 0.2 * y);
+}
+
+static int32_t test_get_noise(int noise)
+{
+    return (noise > 0) ? (rand() % (noise * 2 + 1) - noise) : 0;
+}
+
+static vector<esp_panel_touch_calib_point_t> test_get_points(const vector<pair<int, int>> &targets, int noise)
+{
+    vector<esp_panel_touch_calib_point_t> points;
+    for (auto &target : targets) {
+        esp_panel_touch_calib_point_t point = {};
+        point.x = target.first;
+        point.y = target.second;
+        test_get_raw(point.x, point.y, point.raw_x, point.raw_y);
+        point.raw_x += test_get_noise(noise);
+        point.raw_y += test_get_noise(noise);
+        points.push_back(point);
+    }
+
+    return points;
+}
+
+// Largest and mean distance between the mapped raw points and the screen points, over a grid of the screen
+static void test_get_error(const esp_panel_touch_calib_t &calib, double &max_error, double &mean_error)
+{
+    int num = 0;
+    max_error = 0;
+    mean_error = 0;
+    for (int y = 0; y < TEST_SCREEN_HEIGHT; y += TEST_GRID_STEP) {
+        for (int x = 0; x < TEST_SCREEN_WIDTH; x += TEST_GRID_STEP) {
+            int32_t raw_x, raw_y;
+            test_get_raw(x, y, raw_x, raw_y);
+            uint16_t mapped_x = raw_x;
+            uint16_t mapped_y = raw_y;
+            esp_panel_touch_calib_apply(&calib, &mapped_x, &mapped_y, 1, TEST_SCREEN_WIDTH - 1, TEST_SCREEN_HEIGHT - 1);
+            double error = hypot((double)mapped_x - x, (double)mapped_y - y);
+            max_error = (error > max_error) ? error : max_error;
+            mean_error += error;
+            num++;
+        }
+    }
+    mean_error /= num;
+}
+
+static const vector<pair<int, int>> three_targets = {{32, 24}, {288, 120}, {160, 216}};
+static const vector<pair<int, int>> five_targets = {{32, 24}, {288, 24}, {160, 120}, {32, 216}, {288, 216}};
+static const vector<pair<int, int>> nine_targets = {
+    {32, 24}, {160, 24}, {288, 24}, {32, 120}, {160, 120}, {288, 120}, {32, 216}, {160, 216}, {288, 216},
+};
+
+TEST_CASE("Test touch calibration solves three points exactly", "[utils][touch_calib]")
+{
+    vector<esp_panel_touch_calib_point_t> points = test_get_points(three_targets, 0);
+    esp_panel_touch_calib_t calib = {};
+
+    TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(points.data(), points.size(), &calib));
+    for (auto &point : points) {
+        uint16_t x = point.raw_x;
+        uint16_t y = point.raw_y;
+        esp_panel_touch_calib_apply(&calib, &x, &y, 1, TEST_SCREEN_WIDTH - 1, TEST_SCREEN_HEIGHT - 1);
+        TEST_ASSERT_INT_WITHIN(1, point.x, x);
+        TEST_ASSERT_INT_WITHIN(1, point.y, y);
+    }
+
+    double max_error, mean_error;
+    test_get_error(calib, max_error, mean_error);
+    printf("Max error %.2f px, mean error %.2f px\n", max_error, mean_error);
+    TEST_ASSERT_TRUE(max_error < 1.5);
+
+    // A solved identity stays the identity
+    esp_panel_touch_calib_point_t identity_points[] = {{0, 0, 0, 0}, {100, 0, 100, 0}, {0, 100, 0, 100}};
+    esp_panel_touch_calib_t identity = ESP_PANEL_TOUCH_CALIB_IDENTITY();
+    TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(identity_points, 3, &calib));
+    TEST_ASSERT_EQUAL_MEMORY(&identity, &calib, sizeof(calib));
+}
+
+TEST_CASE("Test touch calibration rejects the invalid points", "[utils][touch_calib]")
+{
+    esp_panel_touch_calib_t calib = ESP_PANEL_TOUCH_CALIB_IDENTITY();
+    esp_panel_touch_calib_t origin = calib;
+    vector<esp_panel_touch_calib_point_t> points = test_get_points(three_targets, 0);
+
+    TEST_ASSERT_FALSE(esp_panel_touch_calib_solve(points.data(), 2, &calib));
+    TEST_ASSERT_FALSE(esp_panel_touch_calib_solve(NULL, 3, &calib));
+    TEST_ASSERT_FALSE(esp_panel_touch_calib_solve(points.data(), 3, NULL));
+
+    // The raw points are on a line
+    esp_panel_touch_calib_point_t line_points[] = {
+        {100, 100, 10, 10}, {200, 200, 100, 20}, {300, 300, 200, 200}, {400, 400, 5, 100},
+    };
+    TEST_ASSERT_FALSE(esp_panel_touch_calib_solve(line_points, 4, &calib));
+    // The same point read three times
+    esp_panel_touch_calib_point_t same_points[] = {{100, 100, 10, 10}, {100, 100, 100, 20}, {100, 100, 200, 200}};
+    TEST_ASSERT_FALSE(esp_panel_touch_calib_solve(same_points, 3, &calib));
+    TEST_ASSERT_EQUAL_MEMORY(&origin, &calib, sizeof(calib));
+}
+
+TEST_CASE("Test touch calibration clamps the points into the screen", "[utils][touch_calib]")
+{
+    esp_panel_touch_calib_t calib = {};
+    calib.a = -(1 << 16);
+    calib.c = 100 << 16;
+    calib.e = 2 << 16;
+    calib.f = -(10 << 16);
+    uint16_t x[] = {0, 50, 200, 100};
+    uint16_t y[] = {0, 20, 60, 5};
+
+    esp_panel_touch_calib_apply(&calib, x, y, 4, 99, 99);
+    const uint16_t expect_x[] = {99, 50, 0, 0};
+    const uint16_t expect_y[] = {0, 30, 99, 0};
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(expect_x, x, 4);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(expect_y, y, 4);
+}
+
+TEST_CASE("Test touch calibration clamps the points into the swapped screen", "[utils][touch_calib]")
+{
+    // A 240x320 panel (`x_max` = 240, `y_max` = 320) used in landscape by `swapXY()`, the points read are 320x240
+    const uint16_t panel_x_max = TEST_SCREEN_HEIGHT;
+    const uint16_t panel_y_max = TEST_SCREEN_WIDTH;
+    const bool swap_xy = true;
+    const uint16_t x_max = (swap_xy ? panel_y_max : panel_x_max) - 1;
+    const uint16_t y_max = (swap_xy ? panel_x_max : panel_y_max) - 1;
+    TEST_ASSERT_EQUAL(TEST_SCREEN_WIDTH - 1, x_max);
+    TEST_ASSERT_EQUAL(TEST_SCREEN_HEIGHT - 1, y_max);
+
+    vector<esp_panel_touch_calib_point_t> points = test_get_points(nine_targets, 0);
+    esp_panel_touch_calib_t calib = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(points.data(), points.size(), &calib));
+
+    // The right part of the screen beyond the panel width is reachable, and the points out of it are clamped
+    const pair<int, int> targets[] = {{288, 120}, {319, 239}, {340, 260}, {-10, 200}};
+    const uint16_t expect_x[] = {288, 319, 319, 0};
+    const uint16_t expect_y[] = {120, 239, 239, 200};
+    for (int i = 0; i < 4; i++) {
+        int32_t raw_x, raw_y;
+        test_get_raw(targets[i].first, targets[i].second, raw_x, raw_y);
+        uint16_t x = raw_x;
+        uint16_t y = raw_y;
+        esp_panel_touch_calib_apply(&calib, &x, &y, 1, x_max, y_max);
+        TEST_ASSERT_INT_WITHIN(1, expect_x[i], x);
+        TEST_ASSERT_INT_WITHIN(1, expect_y[i], y);
+    }
+}
+
+TEST_CASE("Test touch calibration averages the noise with more points", "[utils][touch_calib]")
+{
+    srand(25);
+    double three_mean = 0;
+    double nine_mean = 0;
+
+    for (int i = 0; i < TEST_TRIAL_NUM; i++) {
+        esp_panel_touch_calib_t calib = {};
+        double max_error, mean_error;
+        vector<esp_panel_touch_calib_point_t> points = test_get_points(three_targets, 30);
+        TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(points.data(), points.size(), &calib));
+        test_get_error(calib, max_error, mean_error);
+        three_mean += mean_error / TEST_TRIAL_NUM;
+
+        points = test_get_points(nine_targets, 30);
+        TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(points.data(), points.size(), &calib));
+        test_get_error(calib, max_error, mean_error);
+        nine_mean += mean_error / TEST_TRIAL_NUM;
+    }
+    printf("Mean error of 3 points %.2f px, 9 points %.2f px\n", three_mean, nine_mean);
+    TEST_ASSERT_TRUE(nine_mean < three_mean * 0.8);
+}
+
+TEST_CASE("Test touch calibration restores from the saved blob", "[utils][touch_calib]")
+{
+    vector<esp_panel_touch_calib_point_t> points = test_get_points(five_targets, 0);
+    esp_panel_touch_calib_t calib = {};
+    uint8_t blob[ESP_PANEL_TOUCH_CALIB_BLOB_SIZE + 4];
+
+    TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(points.data(), points.size(), &calib));
+    TEST_ASSERT_EQUAL(0, esp_panel_touch_calib_save(&calib, blob, ESP_PANEL_TOUCH_CALIB_BLOB_SIZE - 1));
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_CALIB_BLOB_SIZE, esp_panel_touch_calib_save(&calib, blob, sizeof(blob)));
+
+    esp_panel_touch_calib_t restored = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_calib_load(&restored, blob, ESP_PANEL_TOUCH_CALIB_BLOB_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(&calib, &restored, sizeof(calib));
+    // The layout is fixed: the magic, then the coefficients in little endian
+    TEST_ASSERT_EQUAL_MEMORY("TCAL", blob, 4);
+    TEST_ASSERT_EQUAL_HEX8(calib.a & 0xFF, blob[8]);
+    TEST_ASSERT_EQUAL_HEX8((calib.f >> 24) & 0xFF, blob[31]);
+
+    // Any changed byte is detected
+    restored = {};
+    TEST_ASSERT_FALSE(esp_panel_touch_calib_load(&restored, blob, ESP_PANEL_TOUCH_CALIB_BLOB_SIZE - 1));
+    for (int i = 0; i < ESP_PANEL_TOUCH_CALIB_BLOB_SIZE; i++) {
+        blob[i] ^= 0x10;
+        TEST_ASSERT_FALSE(esp_panel_touch_calib_load(&restored, blob, ESP_PANEL_TOUCH_CALIB_BLOB_SIZE));
+        blob[i] ^= 0x10;
+    }
+    esp_panel_touch_calib_t empty = {};
+    TEST_ASSERT_EQUAL_MEMORY(&empty, &restored, sizeof(restored));
+}
+
+TEST_CASE("Benchmark touch calibration error against the number of points", "[utils][touch_calib][benchmark]")
+{
+    const struct {
+        const char *name;
+        const vector<pair<int, int>> *targets;
+    } cases[] = {
+        {"3 points", &three_targets},
+        {"5 points", &five_targets},
+        {"9 points", &nine_targets},
+    };
+    const int noises[] = {0, 10, 30};
+    srand(25);
+
+    printf("%dx%d screen, raw noise uniform in +/- the given counts, %d trials\n", TEST_SCREEN_WIDTH,
+           TEST_SCREEN_HEIGHT, TEST_TRIAL_NUM);
+    printf("| points   | noise (counts) | mean error (px) | max error (px) |\n");
+    printf("|----------|----------------|-----------------|----------------|\n");
+    for (auto &calib_case : cases) {
+        for (auto noise : noises) {
+            double mean_sum = 0;
+            double max_sum = 0;
+            for (int i = 0; i < TEST_TRIAL_NUM; i++) {
+                vector<esp_panel_touch_calib_point_t> points = test_get_points(*calib_case.targets, noise);
+                esp_panel_touch_calib_t calib = {};
+                double max_error, mean_error;
+                TEST_ASSERT_TRUE(esp_panel_touch_calib_solve(points.data(), points.size(), &calib));
+                test_get_error(calib, max_error, mean_error);
+                mean_sum += mean_error;
+                max_sum += max_error;
+            }
+            printf("| %-8s | %14d | %15.2f | %14.2f |\n", calib_case.name, noise, mean_sum / TEST_TRIAL_NUM,
+                   max_sum / TEST_TRIAL_NUM);
+        }
+    }
+}
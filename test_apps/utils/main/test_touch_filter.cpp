@@ -0,0 +1,318 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_touch_filter.h"
+
+using namespace std;
+
+#define TEST_TRACE_MS           (1000)
+#define TEST_SETTLE_MS          (200)
+#define TEST_HOLD_X             (160)
+#define TEST_HOLD_Y             (120)
+#define TEST_SWIPE_SPEED        (400)       // px/s
+#define TEST_NOISE_PX           (3)
+#define TEST_SPIKE_PX           (40)
+#define TEST_SPIKE_PERMILLE     (20)
+
+typedef struct {
+    int64_t timestamp_us;
+    double x;                   // Position of the finger
+    double y;
+    uint16_t read_x;            // Position read from the controller
+    uint16_t read_y;
+} trace_sample_t;
+
+typedef struct {
+    const char *name;
+    vector<esp_panel_touch_filter_stage_t> stages;
+} filter_case_t;
+
+static uint32_t rand_state;
+
+static uint32_t next_rand(void)
+{
+    rand_state = rand_state * 1103515245 + 12345;
+    return (rand_state >> 8) & 0xffff;
+}
+
+// Noise of a resistive panel: about normal distributed, with some spikes while the pressure changes
+static double make_noise(void)
+{
+    double sum = 0;
+    for (int i = 0; i < 4; i++) {
+        sum += next_rand() / 65536.0 - 0.5;
+    }
+    double noise = sum * TEST_NOISE_PX * sqrt(3.0);
+    if ((next_rand() % 1000) < TEST_SPIKE_PERMILLE) {
+        noise += (next_rand() & 1) ? TEST_SPIKE_PX : -TEST_SPIKE_PX;
+    }
+
+    return noise;
+}
+
+static uint16_t to_read(double value)
+{
+    value = round(value);
+    return (value < 0) ? 0 : ((value > UINT16_MAX) ? UINT16_MAX : (uint16_t)value);
+}
+
+// A finger holding still, or swiping to the right at a constant speed
+static vector<trace_sample_t> make_trace(bool is_swipe, uint32_t period_ms)
+{
+    vector<trace_sample_t> trace;
+
+    rand_state = 2025;
+    for (uint32_t t = 0; t < TEST_TRACE_MS; t += period_ms) {
+        trace_sample_t sample = {};
+        sample.timestamp_us = (int64_t)t * 1000;
+        sample.x = TEST_HOLD_X + (is_swipe ? TEST_SWIPE_SPEED * t / 1000.0 : 0);
+        sample.y = TEST_HOLD_Y;
+        sample.read_x = to_read(sample.x + make_noise());
+        sample.read_y = to_read(sample.y + make_noise());
+        trace.push_back(sample);
+    }
+
+    return trace;
+}
+
+// Replay the trace, then get the RMS error across the motion (jitter) and the mean delay along it (lag)
+static void replay_trace(const filter_case_t &filter_case, const vector<trace_sample_t> &trace, double &jitter_px,
+                         double &lag_ms)
+{
+    esp_panel_touch_filter_t filter;
+    esp_panel_touch_filter_config_t config = {
+        .stages = filter_case.stages.data(),
+        .num_stages = (uint8_t)filter_case.stages.size(),
+        .track_distance = 0,
+    };
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_init(&filter, &config));
+
+    double error_y_sum = 0;
+    double delay_x_sum = 0;
+    int num = 0;
+    for (const auto &sample : trace) {
+        uint16_t x = sample.read_x;
+        uint16_t y = sample.read_y;
+        TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, sample.timestamp_us, &x, &y, 1));
+        if (sample.timestamp_us < TEST_SETTLE_MS * 1000) {
+            continue;
+        }
+        error_y_sum += (y - sample.y) * (y - sample.y);
+        delay_x_sum += sample.x - x;
+        num++;
+    }
+    jitter_px = sqrt(error_y_sum / num);
+    lag_ms = delay_x_sum / num * 1000 / TEST_SWIPE_SPEED;
+}
+
+static double get_jitter(const filter_case_t &filter_case, uint32_t period_ms)
+{
+    double jitter_px = 0;
+    double lag_ms = 0;
+    replay_trace(filter_case, make_trace(false, period_ms), jitter_px, lag_ms);
+
+    return jitter_px;
+}
+
+static double get_lag(const filter_case_t &filter_case, uint32_t period_ms)
+{
+    double jitter_px = 0;
+    double lag_ms = 0;
+    replay_trace(filter_case, make_trace(true, period_ms), jitter_px, lag_ms);
+
+    return lag_ms;
+}
+
+static const filter_case_t raw_case = {"raw", {}};
+static const filter_case_t median_case = {"median(5)", {ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(5)}};
+static const filter_case_t ema_case = {"ema(3 Hz)", {ESP_PANEL_TOUCH_FILTER_STAGE_EMA(3000)}};
+static const filter_case_t one_euro_case = {
+    "one-euro(1 Hz, 0.005)", {ESP_PANEL_TOUCH_FILTER_STAGE_ONE_EURO(1000, 5000, 1000)}
+};
+static const filter_case_t median_one_euro_case = {
+    "median(3) + one-euro(1 Hz, 0.005)", {
+        ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3), ESP_PANEL_TOUCH_FILTER_STAGE_ONE_EURO(1000, 5000, 1000)
+    }
+};
+
+TEST_CASE("Test touch filter checks the arguments", "[utils][touch_filter]")
+{
+    esp_panel_touch_filter_t filter;
+    esp_panel_touch_filter_stage_t stages[ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX + 1] = {
+        ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3), ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3),
+        ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3), ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3),
+        ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3),
+    };
+    esp_panel_touch_filter_config_t config = {
+        .stages = stages,
+        .num_stages = ESP_PANEL_TOUCH_FILTER_STAGE_NUM_MAX + 1,
+        .track_distance = 0,
+    };
+    uint16_t x = 0;
+    uint16_t y = 0;
+
+    TEST_ASSERT_FALSE(esp_panel_touch_filter_init(&filter, &config));
+    config.num_stages = 1;
+    stages[0].window = 4;
+    TEST_ASSERT_FALSE(esp_panel_touch_filter_init(&filter, &config));
+    stages[0].window = ESP_PANEL_TOUCH_FILTER_MEDIAN_MAX + 2;
+    TEST_ASSERT_FALSE(esp_panel_touch_filter_init(&filter, &config));
+    stages[0].window = 3;
+    TEST_ASSERT_FALSE(esp_panel_touch_filter_init(NULL, &config));
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_init(&filter, &config));
+    TEST_ASSERT_FALSE(esp_panel_touch_filter_process(NULL, 0, &x, &y, 1));
+    TEST_ASSERT_FALSE(esp_panel_touch_filter_process(&filter, 0, NULL, &y, 1));
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 0, NULL, NULL, 0));
+
+    // An empty chain needs no stages, and keeps the points unchanged
+    config.stages = NULL;
+    config.num_stages = 0;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_init(&filter, &config));
+    x = 123;
+    y = 45;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 0, &x, &y, 1));
+    TEST_ASSERT_EQUAL(123, x);
+    TEST_ASSERT_EQUAL(45, y);
+}
+
+TEST_CASE("Test touch filter median removes the spikes", "[utils][touch_filter]")
+{
+    const esp_panel_touch_filter_stage_t stages[] = {ESP_PANEL_TOUCH_FILTER_STAGE_MEDIAN(3)};
+    esp_panel_touch_filter_config_t config = {
+        .stages = stages,
+        .num_stages = 1,
+        .track_distance = 0,
+    };
+    esp_panel_touch_filter_t filter;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_init(&filter, &config));
+
+    const uint16_t inputs[] = {100, 101, 300, 102, 101, 0, 103};
+    const uint16_t expects[] = {100, 101, 101, 102, 102, 101, 101};
+    for (int i = 0; i < (int)(sizeof(inputs) / sizeof(inputs[0])); i++) {
+        uint16_t x = inputs[i];
+        uint16_t y = 50;
+        TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, i * 10000, &x, &y, 1));
+        TEST_ASSERT_EQUAL(expects[i], x);
+        TEST_ASSERT_EQUAL(50, y);
+    }
+}
+
+TEST_CASE("Test touch filter EMA is independent of the sample rate", "[utils][touch_filter]")
+{
+    const esp_panel_touch_filter_stage_t stages[] = {ESP_PANEL_TOUCH_FILTER_STAGE_EMA(5000)};
+    esp_panel_touch_filter_config_t config = {
+        .stages = stages,
+        .num_stages = 1,
+        .track_distance = 0,
+    };
+    uint16_t results[2] = {};
+    const uint32_t periods_ms[2] = {5, 20};
+
+    // Step from 0 to 1000 after the first sample, then check the response at 40 ms
+    for (int i = 0; i < 2; i++) {
+        esp_panel_touch_filter_t filter;
+        TEST_ASSERT_TRUE(esp_panel_touch_filter_init(&filter, &config));
+        uint16_t x = 0;
+        uint16_t y = 0;
+        for (uint32_t t = 0; t <= 40; t += periods_ms[i]) {
+            x = (t == 0) ? 0 : 1000;
+            y = 0;
+            TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, t * 1000, &x, &y, 1));
+        }
+        results[i] = x;
+    }
+    printf("EMA(5 Hz) step response at 40 ms: %d (200 Hz), %d (50 Hz), ideal %d\n", results[0], results[1],
+           (int)round(1000 * (1 - exp(-2 * M_PI * 5 * 0.04))));
+    TEST_ASSERT_INT_WITHIN(150, 718, results[0]);
+    TEST_ASSERT_INT_WITHIN(150, 718, results[1]);
+}
+
+TEST_CASE("Test touch filter tracks every point", "[utils][touch_filter]")
+{
+    const esp_panel_touch_filter_stage_t stages[] = {ESP_PANEL_TOUCH_FILTER_STAGE_EMA(1000)};
+    esp_panel_touch_filter_config_t config = {
+        .stages = stages,
+        .num_stages = 1,
+        .track_distance = 50,
+    };
+    esp_panel_touch_filter_t filter;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_init(&filter, &config));
+
+    // The new points are not smoothed
+    uint16_t x[2] = {100, 400};
+    uint16_t y[2] = {100, 200};
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 0, x, y, 2));
+    TEST_ASSERT_EQUAL(100, x[0]);
+    TEST_ASSERT_EQUAL(400, x[1]);
+
+    // The order of the points is changed by the controller, but each of them keeps its own state
+    x[0] = 410;
+    y[0] = 200;
+    x[1] = 110;
+    y[1] = 100;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 10000, x, y, 2));
+    TEST_ASSERT_TRUE((x[0] > 400) && (x[0] < 410));
+    TEST_ASSERT_TRUE((x[1] > 100) && (x[1] < 110));
+    TEST_ASSERT_EQUAL(200, y[0]);
+    TEST_ASSERT_EQUAL(100, y[1]);
+
+    // A point too far from the tracked ones starts a new track
+    x[0] = 200;
+    y[0] = 200;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 20000, x, y, 1));
+    TEST_ASSERT_EQUAL(200, x[0]);
+
+    // After the release, the next point starts a new track
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 30000, x, y, 0));
+    x[0] = 220;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 40000, x, y, 1));
+    TEST_ASSERT_EQUAL(220, x[0]);
+
+    // So does the point after the reset
+    esp_panel_touch_filter_reset(&filter);
+    x[0] = 230;
+    TEST_ASSERT_TRUE(esp_panel_touch_filter_process(&filter, 50000, x, y, 1));
+    TEST_ASSERT_EQUAL(230, x[0]);
+}
+
+TEST_CASE("Test touch filter one-euro trades the jitter against the lag", "[utils][touch_filter]")
+{
+    double raw_jitter = get_jitter(raw_case, 10);
+    double ema_jitter = get_jitter(ema_case, 10);
+    double one_euro_jitter = get_jitter(one_euro_case, 10);
+    double ema_lag = get_lag(ema_case, 10);
+    double one_euro_lag = get_lag(one_euro_case, 10);
+
+    // Holding still, the one-euro filter smooths more than the EMA, and it follows the swipe with less lag
+    TEST_ASSERT_TRUE(one_euro_jitter < ema_jitter);
+    TEST_ASSERT_TRUE(ema_jitter < raw_jitter / 2);
+    TEST_ASSERT_TRUE(one_euro_lag < ema_lag);
+
+    // The median removes the spikes, and half of the sample rate keeps the chain stable
+    TEST_ASSERT_TRUE(get_jitter(median_case, 10) < raw_jitter / 2);
+    TEST_ASSERT_TRUE(get_jitter(median_one_euro_case, 20) < raw_jitter / 2);
+}
+
+TEST_CASE("Benchmark touch filter jitter against lag on the replayed traces", "[utils][touch_filter][benchmark]")
+{
+    const filter_case_t *cases[] = {&raw_case, &median_case, &ema_case, &one_euro_case, &median_one_euro_case};
+    const uint32_t periods_ms[] = {10, 20};
+
+    printf("Hold and swipe (%d px/s) traces, noise %d px RMS with %d/1000 spikes of %d px\n", TEST_SWIPE_SPEED,
+           TEST_NOISE_PX, TEST_SPIKE_PERMILLE, TEST_SPIKE_PX);
+    printf("| filter                            | rate (Hz) | jitter holding (px RMS) | lag swiping (ms) |\n");
+    printf("|-----------------------------------|-----------|-------------------------|------------------|\n");
+    for (const auto *filter_case : cases) {
+        for (auto period_ms : periods_ms) {
+            printf("| %-33s | %9d | %23.2f | %16.1f |\n", filter_case->name, (int)(1000 / period_ms),
+                   get_jitter(*filter_case, period_ms), get_lag(*filter_case, period_ms));
+        }
+    }
+}
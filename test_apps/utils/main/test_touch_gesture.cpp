@@ -0,0 +1,284 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_touch_gesture.h"
+
+using namespace std;
+
+#define TEST_PERIOD_MS          (10)
+#define TEST_EVENTS_MAX         (8)
+
+typedef vector<esp_panel_touch_sample_t> trace_t;
+
+static esp_panel_touch_sample_t make_sample(uint32_t t_ms, const vector<pair<double, double>> &points)
+{
+    esp_panel_touch_sample_t sample = {};
+    sample.timestamp_us = (int64_t)t_ms * 1000;
+    sample.points_num = points.size();
+    for (size_t i = 0; i < points.size(); i++) {
+        sample.points[i].x = (uint16_t)lround(points[i].first);
+        sample.points[i].y = (uint16_t)lround(points[i].second);
+    }
+
+    return sample;
+}
+
+// A finger moving from a position to another in a line, with a sample every period
+static void add_stroke(trace_t &trace, uint32_t start_ms, uint32_t duration_ms, double x0, double y0, double x1,
+                       double y1, bool is_released = true)
+{
+    for (uint32_t t = 0; t <= duration_ms; t += TEST_PERIOD_MS) {
+        double k = (duration_ms > 0) ? (double)t / duration_ms : 1;
+        trace.push_back(make_sample(start_ms + t, {{x0 + (x1 - x0) * k, y0 + (y1 - y0) * k}}));
+    }
+    if (is_released) {
+        trace.push_back(make_sample(start_ms + duration_ms + TEST_PERIOD_MS, {}));
+    }
+}
+
+// Two fingers around a center, whose distance and angle change in a line
+static void add_pair(trace_t &trace, uint32_t start_ms, uint32_t duration_ms, double distance0, double distance1,
+                     double angle0_deg, double angle1_deg)
+{
+    const double cx = 240;
+    const double cy = 240;
+    for (uint32_t t = 0; t <= duration_ms; t += TEST_PERIOD_MS) {
+        double k = (double)t / duration_ms;
+        double r = (distance0 + (distance1 - distance0) * k) / 2;
+        double a = (angle0_deg + (angle1_deg - angle0_deg) * k) * M_PI / 180;
+        trace.push_back(make_sample(start_ms + t, {
+            {cx - r * cos(a), cy - r * sin(a)}, {cx + r * cos(a), cy + r * sin(a)}
+        }));
+    }
+    trace.push_back(make_sample(start_ms + duration_ms + TEST_PERIOD_MS, {}));
+}
+
+// Feed the trace, then tick at the end
+static vector<esp_panel_touch_gesture_event_t> run_trace(esp_panel_touch_gesture_t &gesture, const trace_t &trace,
+        int64_t end_us = -1)
+{
+    vector<esp_panel_touch_gesture_event_t> result;
+    esp_panel_touch_gesture_event_t events[TEST_EVENTS_MAX];
+
+    for (const auto &sample : trace) {
+        int num = esp_panel_touch_gesture_process(&gesture, &sample, events, TEST_EVENTS_MAX);
+        TEST_ASSERT_TRUE(num >= 0);
+        result.insert(result.end(), events, events + num);
+    }
+    if (end_us >= 0) {
+        int num = esp_panel_touch_gesture_tick(&gesture, end_us, events, TEST_EVENTS_MAX);
+        TEST_ASSERT_TRUE(num >= 0);
+        result.insert(result.end(), events, events + num);
+    }
+
+    return result;
+}
+
+static vector<esp_panel_touch_gesture_event_t> run_trace(const trace_t &trace, int64_t end_us = -1)
+{
+    esp_panel_touch_gesture_t gesture;
+    TEST_ASSERT_TRUE(esp_panel_touch_gesture_init(&gesture, NULL));
+
+    return run_trace(gesture, trace, end_us);
+}
+
+TEST_CASE("Test touch gesture checks the arguments", "[utils][touch_gesture]")
+{
+    esp_panel_touch_gesture_t gesture;
+    esp_panel_touch_sample_t sample = {};
+    esp_panel_touch_gesture_event_t event;
+
+    TEST_ASSERT_FALSE(esp_panel_touch_gesture_init(NULL, NULL));
+    TEST_ASSERT_TRUE(esp_panel_touch_gesture_init(&gesture, NULL));
+    TEST_ASSERT_EQUAL(-1, esp_panel_touch_gesture_process(NULL, &sample, &event, 1));
+    TEST_ASSERT_EQUAL(-1, esp_panel_touch_gesture_process(&gesture, NULL, &event, 1));
+    TEST_ASSERT_EQUAL(-1, esp_panel_touch_gesture_process(&gesture, &sample, NULL, 1));
+    TEST_ASSERT_EQUAL(0, esp_panel_touch_gesture_process(&gesture, &sample, NULL, 0));
+    TEST_ASSERT_EQUAL(-1, esp_panel_touch_gesture_tick(NULL, 0, &event, 1));
+}
+
+TEST_CASE("Test touch gesture reports the taps", "[utils][touch_gesture]")
+{
+    trace_t trace;
+
+    // The tap is reported after the window of the double tap, by the tick
+    add_stroke(trace, 0, 80, 100, 100, 103, 101);
+    auto events = run_trace(trace, 390 * 1000);
+    TEST_ASSERT_EQUAL(0, events.size());
+    events = run_trace(trace, 391 * 1000);
+    TEST_ASSERT_EQUAL(1, events.size());
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_TAP, events[0].type);
+    TEST_ASSERT_TRUE(events[0].timestamp_us == 90 * 1000);
+    TEST_ASSERT_EQUAL(103, events[0].x);
+    TEST_ASSERT_EQUAL(101, events[0].y);
+
+    // The second tap starts in the window and ends after it
+    add_stroke(trace, 350, 100, 110, 105, 110, 105);
+    events = run_trace(trace, 2000 * 1000);
+    TEST_ASSERT_EQUAL(1, events.size());
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_DOUBLE_TAP, events[0].type);
+    TEST_ASSERT_TRUE(events[0].timestamp_us == 460 * 1000);
+
+    // A tap too far from the previous one is not a double tap
+    trace.clear();
+    add_stroke(trace, 0, 50, 100, 100, 100, 100);
+    add_stroke(trace, 150, 50, 300, 100, 300, 100);
+    events = run_trace(trace, 2000 * 1000);
+    TEST_ASSERT_EQUAL(2, events.size());
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_TAP, events[0].type);
+    TEST_ASSERT_EQUAL(100, events[0].x);
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_TAP, events[1].type);
+    TEST_ASSERT_EQUAL(300, events[1].x);
+
+    // Without the double tap, every tap is reported at its release
+    esp_panel_touch_gesture_config_t config = ESP_PANEL_TOUCH_GESTURE_CONFIG_DEFAULT();
+    config.double_tap_ms = 0;
+    esp_panel_touch_gesture_t gesture;
+    TEST_ASSERT_TRUE(esp_panel_touch_gesture_init(&gesture, &config));
+    events = run_trace(gesture, trace);
+    TEST_ASSERT_EQUAL(2, events.size());
+    TEST_ASSERT_TRUE(events[0].timestamp_us == 60 * 1000);
+    TEST_ASSERT_TRUE(events[1].timestamp_us == 210 * 1000);
+
+    // A touch which is too long or moves too far is not a tap
+    trace.clear();
+    add_stroke(trace, 0, 300, 100, 100, 100, 100);
+    add_stroke(trace, 1000, 100, 100, 100, 130, 100);
+    events = run_trace(trace, 3000 * 1000);
+    TEST_ASSERT_EQUAL(0, events.size());
+}
+
+TEST_CASE("Test touch gesture reports the long press", "[utils][touch_gesture]")
+{
+    trace_t trace;
+
+    // Once by the samples, and nothing at the release
+    add_stroke(trace, 0, 800, 200, 200, 204, 202);
+    auto events = run_trace(trace, 2000 * 1000);
+    TEST_ASSERT_EQUAL(1, events.size());
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_LONG_PRESS, events[0].type);
+    TEST_ASSERT_TRUE(events[0].timestamp_us == 500 * 1000);
+
+    // By the tick, when the sampler only reads on the interrupts
+    trace.clear();
+    add_stroke(trace, 0, 0, 200, 200, 200, 200, false);
+    events = run_trace(trace, 499 * 1000);
+    TEST_ASSERT_EQUAL(0, events.size());
+    events = run_trace(trace, 520 * 1000);
+    TEST_ASSERT_EQUAL(1, events.size());
+    TEST_ASSERT_TRUE(events[0].timestamp_us == 520 * 1000);
+
+    // The pending tap is reported before the long press
+    trace.clear();
+    add_stroke(trace, 0, 50, 200, 200, 200, 200);
+    add_stroke(trace, 200, 600, 200, 200, 200, 200);
+    events = run_trace(trace);
+    TEST_ASSERT_EQUAL(2, events.size());
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_TAP, events[0].type);
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_LONG_PRESS, events[1].type);
+}
+
+TEST_CASE("Test touch gesture reports the swipes with the velocity", "[utils][touch_gesture]")
+{
+    trace_t trace;
+
+    add_stroke(trace, 0, 200, 100, 300, 300, 290);
+    add_stroke(trace, 1000, 100, 200, 300, 210, 150);
+    // Too slow at the release
+    add_stroke(trace, 2000, 1000, 100, 100, 200, 100);
+    auto events = run_trace(trace, 5000 * 1000);
+    TEST_ASSERT_EQUAL(2, events.size());
+
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_SWIPE, events[0].type);
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_DIR_RIGHT, events[0].direction);
+    TEST_ASSERT_EQUAL(100, events[0].x);
+    TEST_ASSERT_EQUAL(300, events[0].y);
+    TEST_ASSERT_EQUAL(200, events[0].distance_x);
+    TEST_ASSERT_EQUAL(-10, events[0].distance_y);
+    TEST_ASSERT_INT_WITHIN(20, 1000, events[0].velocity_x);
+    TEST_ASSERT_INT_WITHIN(20, -50, events[0].velocity_y);
+    TEST_ASSERT_TRUE(events[0].timestamp_us == 210 * 1000);
+
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_SWIPE, events[1].type);
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_DIR_UP, events[1].direction);
+    TEST_ASSERT_INT_WITHIN(30, -1500, events[1].velocity_y);
+}
+
+TEST_CASE("Test touch gesture reports the pinch", "[utils][touch_gesture]")
+{
+    trace_t trace;
+
+    add_pair(trace, 0, 300, 100, 200, 30, 30);
+    auto events = run_trace(trace, 2000 * 1000);
+    TEST_ASSERT_TRUE(events.size() >= 3);
+
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_PINCH, events.front().type);
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_PHASE_BEGIN, events.front().phase);
+    TEST_ASSERT_TRUE(events.front().scale_q16 >= (120 << 16) / 100);
+    for (size_t i = 1; i < events.size(); i++) {
+        TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_PINCH, events[i].type);
+        TEST_ASSERT_TRUE(events[i].scale_q16 >= events[i - 1].scale_q16);
+        TEST_ASSERT_EQUAL((i + 1 < events.size()) ? ESP_PANEL_TOUCH_GESTURE_PHASE_UPDATE :
+                          ESP_PANEL_TOUCH_GESTURE_PHASE_END, events[i].phase);
+    }
+    TEST_ASSERT_INT_WITHIN(2 << 10, 2 << 16, events.back().scale_q16);
+    TEST_ASSERT_INT_WITHIN(1, 240, events.back().x);
+    TEST_ASSERT_INT_WITHIN(1, 240, events.back().y);
+}
+
+TEST_CASE("Test touch gesture reports the rotation", "[utils][touch_gesture]")
+{
+    trace_t trace;
+
+    // Clockwise on the screen, across the angle of 180 degrees
+    add_pair(trace, 0, 300, 150, 150, 150, 240);
+    auto events = run_trace(trace, 2000 * 1000);
+    TEST_ASSERT_TRUE(events.size() >= 3);
+
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_ROTATE, events.front().type);
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_PHASE_BEGIN, events.front().phase);
+    for (const auto &event : events) {
+        TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_ROTATE, event.type);
+    }
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_PHASE_END, events.back().phase);
+    TEST_ASSERT_INT_WITHIN(1000, 90000, events.back().angle_mdeg);
+
+    // No single-finger gesture from the fingers of a pair
+    trace.clear();
+    add_pair(trace, 0, 100, 150, 150, 0, 0);
+    events = run_trace(trace, 2000 * 1000);
+    TEST_ASSERT_EQUAL(0, events.size());
+}
+
+TEST_CASE("Test touch gesture is deterministic", "[utils][touch_gesture]")
+{
+    trace_t trace;
+
+    add_stroke(trace, 0, 50, 100, 100, 100, 100);
+    add_stroke(trace, 200, 50, 100, 100, 100, 100);
+    add_stroke(trace, 1000, 150, 50, 50, 300, 60);
+    add_pair(trace, 2000, 400, 80, 240, 0, -60);
+    add_stroke(trace, 3000, 700, 200, 200, 200, 200);
+
+    auto first = run_trace(trace, 5000 * 1000);
+    auto second = run_trace(trace, 5000 * 1000);
+    TEST_ASSERT_TRUE(first.size() >= 5);
+    TEST_ASSERT_EQUAL(first.size(), second.size());
+    TEST_ASSERT_EQUAL_MEMORY(first.data(), second.data(), first.size() * sizeof(first[0]));
+
+    // The events out of the array are dropped
+    esp_panel_touch_gesture_t gesture;
+    esp_panel_touch_gesture_event_t events[1];
+    esp_panel_touch_sample_t sample = make_sample(0, {{100, 100}, {200, 100}});
+    TEST_ASSERT_TRUE(esp_panel_touch_gesture_init(&gesture, NULL));
+    TEST_ASSERT_EQUAL(0, esp_panel_touch_gesture_process(&gesture, &sample, events, 1));
+    sample = make_sample(10, {{50, 50}, {250, 150}});
+    TEST_ASSERT_EQUAL(1, esp_panel_touch_gesture_process(&gesture, &sample, events, 1));
+    TEST_ASSERT_EQUAL(ESP_PANEL_TOUCH_GESTURE_PINCH, events[0].type);
+}
@@ -0,0 +1,241 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_touch_ring.h"
+
+using namespace std;
+
+#define TEST_RING_SIZE          (8)
+#define TEST_STRESS_NUM         (200000)
+
+// Every field of the sample is derived from the index, so a torn copy is detected
+static esp_panel_touch_sample_t make_sample(uint32_t index)
+{
+    esp_panel_touch_sample_t sample = {};
+    sample.timestamp_us = (int64_t)index * 10000;
+    sample.points_num = index % (ESP_PANEL_TOUCH_RING_POINTS_MAX + 1);
+    for (int i = 0; i < ESP_PANEL_TOUCH_RING_POINTS_MAX; i++) {
+        sample.points[i].x = index + i;
+        sample.points[i].y = index * 3 + i;
+        sample.points[i].strength = index ^ i;
+    }
+
+    return sample;
+}
+
+static void check_sample(const esp_panel_touch_sample_t &sample)
+{
+    esp_panel_touch_sample_t expect = make_sample(sample.seq);
+    TEST_ASSERT_TRUE(sample.timestamp_us == expect.timestamp_us);
+    TEST_ASSERT_EQUAL(expect.points_num, sample.points_num);
+    TEST_ASSERT_EQUAL_MEMORY(expect.points, sample.points, sizeof(expect.points));
+}
+
+TEST_CASE("Test touch ring pops the samples in order", "[utils][touch_ring]")
+{
+    vector<esp_panel_touch_ring_slot_t> slots(TEST_RING_SIZE);
+    esp_panel_touch_ring_t ring = {};
+    esp_panel_touch_sample_t sample = {};
+
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_init(&ring, slots.data(), TEST_RING_SIZE,
+                     ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_pop(&ring, &sample));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_get_latest(&ring, &sample));
+
+    for (uint32_t i = 0; i < 3; i++) {
+        esp_panel_touch_sample_t pushed = make_sample(i);
+        pushed.seq = 100;
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_push(&ring, &pushed));
+    }
+    TEST_ASSERT_EQUAL(3, esp_panel_touch_ring_get_count(&ring));
+    // The latest sample is read without consuming it
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_get_latest(&ring, &sample));
+    TEST_ASSERT_EQUAL(2, sample.seq);
+    check_sample(sample);
+    for (uint32_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_pop(&ring, &sample));
+        TEST_ASSERT_EQUAL(i, sample.seq);
+        check_sample(sample);
+    }
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_pop(&ring, &sample));
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_get_latest(&ring, &sample));
+    TEST_ASSERT_EQUAL(2, sample.seq);
+
+    // The flushed samples are never popped
+    esp_panel_touch_sample_t pushed = make_sample(3);
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_push(&ring, &pushed));
+    esp_panel_touch_ring_flush(&ring);
+    TEST_ASSERT_EQUAL(0, esp_panel_touch_ring_get_count(&ring));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_pop(&ring, &sample));
+
+    esp_panel_touch_ring_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_get_stats(&ring, &stats, true));
+    TEST_ASSERT_EQUAL(4, stats.pushed);
+    TEST_ASSERT_EQUAL(3, stats.popped);
+    TEST_ASSERT_EQUAL(0, stats.lost);
+    TEST_ASSERT_EQUAL(0, stats.dropped);
+
+    // Invalid arguments
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_init(&ring, slots.data(), 6, ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_init(&ring, slots.data(), 1, ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_init(&ring, NULL, TEST_RING_SIZE, ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_push(&ring, NULL));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_pop(NULL, &sample));
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_get_stats(&ring, NULL, false));
+}
+
+TEST_CASE("Test touch ring keeps the latest samples on overflow", "[utils][touch_ring]")
+{
+    vector<esp_panel_touch_ring_slot_t> slots(TEST_RING_SIZE);
+    esp_panel_touch_ring_t ring = {};
+    esp_panel_touch_sample_t sample = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_init(&ring, slots.data(), TEST_RING_SIZE,
+                     ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST));
+
+    const uint32_t num = TEST_RING_SIZE * 2 + 3;
+    for (uint32_t i = 0; i < num; i++) {
+        esp_panel_touch_sample_t pushed = make_sample(i);
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_push(&ring, &pushed));
+    }
+    TEST_ASSERT_EQUAL(TEST_RING_SIZE, esp_panel_touch_ring_get_count(&ring));
+    for (uint32_t i = num - TEST_RING_SIZE; i < num; i++) {
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_pop(&ring, &sample));
+        TEST_ASSERT_EQUAL(i, sample.seq);
+        check_sample(sample);
+    }
+    TEST_ASSERT_FALSE(esp_panel_touch_ring_pop(&ring, &sample));
+
+    esp_panel_touch_ring_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_get_stats(&ring, &stats, false));
+    TEST_ASSERT_EQUAL(num, stats.pushed);
+    TEST_ASSERT_EQUAL(TEST_RING_SIZE, stats.popped);
+    TEST_ASSERT_EQUAL(num - TEST_RING_SIZE, stats.lost);
+}
+
+TEST_CASE("Test touch ring drops the newest samples on overflow", "[utils][touch_ring]")
+{
+    vector<esp_panel_touch_ring_slot_t> slots(TEST_RING_SIZE);
+    esp_panel_touch_ring_t ring = {};
+    esp_panel_touch_sample_t sample = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_init(&ring, slots.data(), TEST_RING_SIZE,
+                     ESP_PANEL_TOUCH_RING_DROP_NEWEST));
+
+    const uint32_t num = TEST_RING_SIZE + 5;
+    for (uint32_t i = 0; i < num; i++) {
+        esp_panel_touch_sample_t pushed = make_sample(i);
+        TEST_ASSERT_EQUAL(i < TEST_RING_SIZE, esp_panel_touch_ring_push(&ring, &pushed));
+    }
+    // The history is gapless, and the ring accepts new samples after the consumer catches up
+    for (uint32_t i = 0; i < TEST_RING_SIZE / 2; i++) {
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_pop(&ring, &sample));
+        TEST_ASSERT_EQUAL(i, sample.seq);
+    }
+    esp_panel_touch_sample_t pushed = make_sample(TEST_RING_SIZE);
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_push(&ring, &pushed));
+    for (uint32_t i = TEST_RING_SIZE / 2; i <= TEST_RING_SIZE; i++) {
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_pop(&ring, &sample));
+        TEST_ASSERT_EQUAL(i, sample.seq);
+        check_sample(sample);
+    }
+
+    esp_panel_touch_ring_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_get_stats(&ring, &stats, false));
+    TEST_ASSERT_EQUAL(TEST_RING_SIZE + 1, stats.pushed);
+    TEST_ASSERT_EQUAL(5, stats.dropped);
+    TEST_ASSERT_EQUAL(0, stats.lost);
+}
+
+TEST_CASE("Test touch ring between a producer and a consumer thread", "[utils][touch_ring]")
+{
+    for (int policy = 0; policy < 2; policy++) {
+        vector<esp_panel_touch_ring_slot_t> slots(TEST_RING_SIZE);
+        esp_panel_touch_ring_t ring = {};
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_init(&ring, slots.data(), TEST_RING_SIZE,
+                         (esp_panel_touch_ring_policy_t)policy));
+        atomic<bool> is_done(false);
+
+        thread producer([&] {
+            for (uint32_t i = 0; i < TEST_STRESS_NUM; i++) {
+                // The seq of a pushed sample is the number of the samples pushed before it
+                esp_panel_touch_sample_t pushed = make_sample(ring.stats.pushed);
+                esp_panel_touch_ring_push(&ring, &pushed);
+                // Bursts of different lengths, so the consumer is sometimes behind and sometimes waiting
+                if ((i % (1 + (i >> 12) % 16)) == 0) {
+                    this_thread::yield();
+                }
+            }
+            is_done = true;
+        });
+
+        uint32_t popped = 0;
+        int64_t last_seq = -1;
+        esp_panel_touch_sample_t sample = {};
+        while (true) {
+            bool is_finished = is_done;
+            if ((popped & 0x3) == 0) {
+                if (esp_panel_touch_ring_get_latest(&ring, &sample)) {
+                    check_sample(sample);
+                    TEST_ASSERT_TRUE((int64_t)sample.seq > last_seq - 1);
+                }
+            }
+            if (esp_panel_touch_ring_pop(&ring, &sample)) {
+                check_sample(sample);
+                TEST_ASSERT_TRUE((int64_t)sample.seq > last_seq);
+                if (policy == ESP_PANEL_TOUCH_RING_DROP_NEWEST) {
+                    TEST_ASSERT_EQUAL(last_seq + 1, sample.seq);
+                }
+                last_seq = sample.seq;
+                popped++;
+            } else if (is_finished) {
+                break;
+            }
+        }
+        producer.join();
+
+        esp_panel_touch_ring_stats_t stats = {};
+        TEST_ASSERT_TRUE(esp_panel_touch_ring_get_stats(&ring, &stats, false));
+        TEST_ASSERT_EQUAL(popped, stats.popped);
+        TEST_ASSERT_EQUAL(TEST_STRESS_NUM, stats.pushed + stats.dropped);
+        TEST_ASSERT_EQUAL(stats.pushed, stats.popped + stats.lost);
+        TEST_ASSERT_EQUAL(stats.pushed - 1, last_seq);
+        printf("%s: pushed %d, dropped %d, popped %d, lost %d, retries %d\n",
+               policy ? "drop newest" : "overwrite oldest", (int)stats.pushed, (int)stats.dropped, (int)stats.popped,
+               (int)stats.lost, (int)stats.retries);
+    }
+}
+
+TEST_CASE("Benchmark touch ring reads against the bus reads", "[utils][touch_ring][benchmark]")
+{
+    vector<esp_panel_touch_ring_slot_t> slots(TEST_RING_SIZE);
+    esp_panel_touch_ring_t ring = {};
+    TEST_ASSERT_TRUE(esp_panel_touch_ring_init(&ring, slots.data(), TEST_RING_SIZE,
+                     ESP_PANEL_TOUCH_RING_OVERWRITE_OLDEST));
+    esp_panel_touch_sample_t sample = make_sample(0);
+    esp_panel_touch_ring_push(&ring, &sample);
+
+    const int loops = 100000;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++) {
+        esp_panel_touch_ring_get_latest(&ring, &sample);
+    }
+    double ring_us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / loops;
+
+    /**
+     * A read of GT911 on a 400 kHz I2C: the register address (2 bytes), the status (1 byte), 8 bytes per point and
+     * the write to clear the status (3 bytes), with 9 clocks per byte. It blocks the caller inline without the sampler
+     */
+    printf("| points | I2C read in the render loop (us) | ring read (us) |\n");
+    for (int points = 1; points <= ESP_PANEL_TOUCH_RING_POINTS_MAX; points += 2) {
+        int bytes = 2 + 1 + 8 * points + 3;
+        double i2c_us = bytes * 9 * 1e6 / 400000;
+        printf("| %6d | %32.1f | %14.3f |\n", points, i2c_us, ring_us);
+    }
+}
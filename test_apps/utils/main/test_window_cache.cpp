@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_window_cache.h"
+
+using namespace std;
+
+#define TEST_LCD_WIDTH      (64)
+#define TEST_LCD_HEIGHT     (48)
+#define TEST_GAP_X          (4)
+#define TEST_GAP_Y          (2)
+#define TEST_MEMORY_WIDTH   (TEST_LCD_WIDTH + TEST_GAP_X)
+#define TEST_MEMORY_HEIGHT  (TEST_LCD_HEIGHT + TEST_GAP_Y)
+#define TEST_DRAW_NUM       (2000)
+#define TEST_CMD_CASET      (0x2A)
+#define TEST_CMD_RASET      (0x2B)
+#define TEST_CMD_RAMWR      (0x2C)
+
+/**
+ * Mock MIPI-DCS panel: it keeps the column and row ranges until they are written again, and RAMWR writes the pixels
+ * from the start of the window. A command can be set to fail to check the cache is invalidated
+ */
+typedef struct {
+    vector<uint16_t> memory;
+    int column[2];
+    int row[2];
+    int fail_cmd;
+} test_panel_t;
+
+static void panel_power_on(test_panel_t &panel)
+{
+    panel.column[0] = 0;
+    panel.column[1] = TEST_MEMORY_WIDTH - 1;
+    panel.row[0] = 0;
+    panel.row[1] = TEST_MEMORY_HEIGHT - 1;
+}
+
+static bool panel_tx_param(test_panel_t &panel, int cmd, int start, int end)
+{
+    if (cmd == panel.fail_cmd) {
+        panel.fail_cmd = -1;
+        // The panel may receive a part of the parameters
+        (cmd == TEST_CMD_CASET ? panel.column : panel.row)[1] = 0;
+        return false;
+    }
+    int *range = (cmd == TEST_CMD_CASET) ? panel.column : panel.row;
+    range[0] = start;
+    range[1] = end;
+
+    return true;
+}
+
+static void panel_tx_color(test_panel_t &panel, const uint16_t *data, size_t len)
+{
+    int x = panel.column[0];
+    int y = panel.row[0];
+    for (size_t i = 0; i < len; i++) {
+        panel.memory[y * TEST_MEMORY_WIDTH + x] = data[i];
+        if (++x > panel.column[1]) {
+            x = panel.column[0];
+            y++;
+        }
+    }
+}
+
+// Same flow as `panel_*_draw_bitmap()` of the drivers
+static bool test_draw_bitmap(test_panel_t &panel, esp_panel_window_cache_t *cache, int x_start, int y_start, int x_end,
+                             int y_end, const uint16_t *data)
+{
+    x_start += TEST_GAP_X;
+    x_end += TEST_GAP_X;
+    y_start += TEST_GAP_Y;
+    y_end += TEST_GAP_Y;
+
+    if (esp_panel_window_cache_check_column(cache, x_start, x_end - 1)) {
+        if (!panel_tx_param(panel, TEST_CMD_CASET, x_start, x_end - 1)) {
+            esp_panel_window_cache_invalidate(cache);
+            return false;
+        }
+    }
+    if (esp_panel_window_cache_check_row(cache, y_start, y_end - 1)) {
+        if (!panel_tx_param(panel, TEST_CMD_RASET, y_start, y_end - 1)) {
+            esp_panel_window_cache_invalidate(cache);
+            return false;
+        }
+    }
+    panel_tx_color(panel, data, (x_end - x_start) * (y_end - y_start));
+
+    return true;
+}
+
+TEST_CASE("Test window cache keeps the frame memory identical", "[utils][window_cache]")
+{
+    test_panel_t panel = {};
+    panel.memory.assign(TEST_MEMORY_WIDTH * TEST_MEMORY_HEIGHT, 0);
+    panel.fail_cmd = -1;
+    panel_power_on(panel);
+    vector<uint16_t> expect(panel.memory);
+    esp_panel_window_cache_t cache = {};
+    vector<uint16_t> data;
+    int x = 0, y = 0, w = 1, h = 1;
+    int failed = 0;
+
+    srand(16);
+    for (int i = 0; i < TEST_DRAW_NUM; i++) {
+        int action = rand() % 16;
+        if (action == 0) {
+            // Reset the panel, the driver invalidates the cache
+            panel_power_on(panel);
+            esp_panel_window_cache_invalidate(&cache);
+        } else if (action == 1) {
+            // The window is changed through the panel IO directly, then the cache is invalidated by the user
+            panel_tx_param(panel, TEST_CMD_CASET, 0, rand() % TEST_MEMORY_WIDTH);
+            esp_panel_window_cache_invalidate(&cache);
+        } else if (action == 2) {
+            panel.fail_cmd = (rand() & 1) ? TEST_CMD_CASET : TEST_CMD_RASET;
+        }
+
+        // Repeat the window, draw the next band with the same columns, or draw a new window
+        int kind = rand() % 3;
+        if (kind == 1) {
+            y = (y + h) % TEST_LCD_HEIGHT;
+            h = 1 + rand() % (TEST_LCD_HEIGHT - y);
+        } else if (kind == 2) {
+            x = rand() % TEST_LCD_WIDTH;
+            y = rand() % TEST_LCD_HEIGHT;
+            w = 1 + rand() % (TEST_LCD_WIDTH - x);
+            h = 1 + rand() % (TEST_LCD_HEIGHT - y);
+        }
+        data.resize(w * h);
+        for (auto &pixel : data) {
+            pixel = rand();
+        }
+        if (!test_draw_bitmap(panel, &cache, x, y, x + w, y + h, data.data())) {
+            // The caller retries the drawing
+            failed++;
+            TEST_ASSERT_TRUE(test_draw_bitmap(panel, &cache, x, y, x + w, y + h, data.data()));
+        }
+        for (int r = 0; r < h; r++) {
+            for (int c = 0; c < w; c++) {
+                expect[(y + r + TEST_GAP_Y) * TEST_MEMORY_WIDTH + x + c + TEST_GAP_X] = data[r * w + c];
+            }
+        }
+        TEST_ASSERT_EQUAL_MEMORY(expect.data(), panel.memory.data(), expect.size() * sizeof(uint16_t));
+    }
+
+    esp_panel_window_cache_stats_t stats = {};
+    TEST_ASSERT_TRUE(esp_panel_window_cache_get_stats(&cache, &stats, false));
+    TEST_ASSERT_NOT_EQUAL(0, failed);
+    TEST_ASSERT_NOT_EQUAL(0, stats.elided);
+    TEST_ASSERT_TRUE(stats.sent < 2 * TEST_DRAW_NUM);
+    printf("window commands: sent %d, elided %d, invalidations %d\n", (int)stats.sent, (int)stats.elided,
+           (int)stats.invalidations);
+}
+
+TEST_CASE("Test window cache counts the elided commands", "[utils][window_cache]")
+{
+    esp_panel_window_cache_t cache = {};
+    esp_panel_window_cache_stats_t stats = {};
+
+    // The same window is sent once
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_column(&cache, 0, 239));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_row(&cache, 0, 9));
+    TEST_ASSERT_FALSE(esp_panel_window_cache_check_column(&cache, 0, 239));
+    TEST_ASSERT_FALSE(esp_panel_window_cache_check_row(&cache, 0, 9));
+    // The next band only changes the rows
+    TEST_ASSERT_FALSE(esp_panel_window_cache_check_column(&cache, 0, 239));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_row(&cache, 10, 19));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_column(&cache, 0, 238));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_get_stats(&cache, &stats, true));
+    TEST_ASSERT_EQUAL(4, stats.sent);
+    TEST_ASSERT_EQUAL(3, stats.elided);
+    TEST_ASSERT_EQUAL(0, stats.invalidations);
+
+    // Everything is sent after the invalidation
+    esp_panel_window_cache_invalidate(&cache);
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_column(&cache, 0, 238));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_row(&cache, 10, 19));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_get_stats(&cache, &stats, false));
+    TEST_ASSERT_EQUAL(2, stats.sent);
+    TEST_ASSERT_EQUAL(0, stats.elided);
+    TEST_ASSERT_EQUAL(1, stats.invalidations);
+
+    // Without a cache, the commands are always sent
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_column(NULL, 0, 239));
+    TEST_ASSERT_TRUE(esp_panel_window_cache_check_column(NULL, 0, 239));
+    esp_panel_window_cache_invalidate(NULL);
+    TEST_ASSERT_FALSE(esp_panel_window_cache_get_stats(NULL, &stats, false));
+    TEST_ASSERT_FALSE(esp_panel_window_cache_get_stats(&cache, NULL, false));
+}
+
+TEST_CASE("Benchmark window commands with and without the cache", "[utils][window_cache][benchmark]")
+{
+    // Every window command takes 1 command byte and 4 parameter bytes, and a separate SPI transaction
+    const int band_lines[] = {10, 20, 40};
+    const int width = 320;
+    const int height = 240;
+    const int frame_num = 60;
+
+    printf("| workload | transactions (no cache) | transactions (cache) | bytes saved |\n");
+    for (auto lines : band_lines) {
+        esp_panel_window_cache_t cache = {};
+        int naive = 0;
+        for (int f = 0; f < frame_num; f++) {
+            for (int y = 0; y < height; y += lines) {
+                esp_panel_window_cache_check_column(&cache, 0, width - 1);
+                esp_panel_window_cache_check_row(&cache, y, y + lines - 1);
+                naive += 2;
+            }
+        }
+        esp_panel_window_cache_stats_t stats = {};
+        esp_panel_window_cache_get_stats(&cache, &stats, false);
+        TEST_ASSERT_EQUAL(naive, stats.sent + stats.elided);
+        printf("| full frame in %2d-line bands | %23d | %20d | %11d |\n", lines, naive, (int)stats.sent,
+               (int)stats.elided * 5);
+    }
+
+    // A widget (like a clock) redrawn at the same place
+    esp_panel_window_cache_t cache = {};
+    for (int f = 0; f < frame_num; f++) {
+        esp_panel_window_cache_check_column(&cache, 100, 219);
+        esp_panel_window_cache_check_row(&cache, 50, 89);
+    }
+    esp_panel_window_cache_stats_t stats = {};
+    esp_panel_window_cache_get_stats(&cache, &stats, false);
+    TEST_ASSERT_EQUAL(2, stats.sent);
+    printf("| same widget window | %23d | %20d | %11d |\n", frame_num * 2, (int)stats.sent, (int)stats.elided * 5);
+}
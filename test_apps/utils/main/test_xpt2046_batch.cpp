@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "unity.h"
+#include "utils/esp_panel_xpt2046_batch.h"
+
+using namespace std;
+
+#define TEST_ROUND_NUM          (500)
+#define TEST_CHANNEL_Z1         (3)
+#define TEST_CHANNEL_Z2         (4)
+#define TEST_CHANNEL_X          (5)
+#define TEST_CHANNEL_Y          (1)
+
+/**
+ * Bit-level model of the XPT2046 serial interface: a control byte starts with the first high DIN bit, the result
+ * follows it after one busy clock, MSB first, and the next control byte is accepted 16 clocks after the start
+ */
+typedef struct {
+    vector<int> channels;           // Channel of every conversion, in order
+    vector<uint16_t> values;        // Value returned by every conversion, in order
+    bool is_overlapped;             // A control bit collided with the result of the previous conversion
+} test_chip_t;
+
+static vector<uint8_t> test_chip_transfer(test_chip_t &chip, const vector<uint8_t> &tx)
+{
+    size_t clocks = tx.size() * 8;
+    vector<uint8_t> rx(tx.size(), 0);
+    vector<size_t> starts;
+
+    chip.channels.clear();
+    chip.is_overlapped = false;
+    for (size_t clock = 0; clock < clocks; clock++) {
+        int din = (tx[clock / 8] >> (7 - clock % 8)) & 1;
+        size_t since_start = starts.empty() ? 16 : (clock - starts.back());
+        if ((since_start >= 8) && (since_start < 16) && din) {
+            chip.is_overlapped = true;
+        }
+        if ((since_start >= 16) && din) {
+            starts.push_back(clock);
+            uint8_t control = 0;
+            for (size_t i = 0; (i < 8) && (clock + i < clocks); i++) {
+                control = (control << 1) | ((tx[(clock + i) / 8] >> (7 - (clock + i) % 8)) & 1);
+            }
+            chip.channels.push_back((control >> 4) & 0x7);
+        }
+        // One busy clock after the control byte, then 12 bits, which may overlap the next control byte
+        for (size_t i = (starts.size() > 2) ? (starts.size() - 2) : 0; i < starts.size(); i++) {
+            size_t bit_index = clock - starts[i];
+            if ((bit_index >= 9) && (bit_index < 21) && (i < chip.values.size())) {
+                int bit = (chip.values[i] >> (11 - (bit_index - 9))) & 1;
+                rx[clock / 8] |= bit << (7 - clock % 8);
+            }
+        }
+    }
+
+    return rx;
+}
+
+static uint16_t test_get_median(vector<uint16_t> values)
+{
+    sort(values.begin(), values.end());
+    size_t num = values.size();
+
+    return (num & 1) ? values[num / 2] : (uint16_t)((values[num / 2 - 1] + values[num / 2] + 1) / 2);
+}
+
+TEST_CASE("Test XPT2046 batch builds one control byte per conversion", "[utils][xpt2046_batch]")
+{
+    uint8_t tx[ESP_PANEL_XPT2046_BATCH_SIZE(ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX)];
+
+    TEST_ASSERT_EQUAL(0, esp_panel_xpt2046_batch_build(0, 0, tx, sizeof(tx)));
+    TEST_ASSERT_EQUAL(0, esp_panel_xpt2046_batch_build(ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX + 1, 0, tx, sizeof(tx)));
+    TEST_ASSERT_EQUAL(0, esp_panel_xpt2046_batch_build(4, 0, tx, ESP_PANEL_XPT2046_BATCH_SIZE(4) - 1));
+    TEST_ASSERT_EQUAL(0, esp_panel_xpt2046_batch_build(4, 0, NULL, sizeof(tx)));
+
+    const uint8_t expect[] = {
+        0xB1, 0, 0xC1, 0, 0xD1, 0, 0xD1, 0, 0x91, 0, 0xD1, 0, 0x91, 0, 0,
+    };
+    memset(tx, 0xFF, sizeof(tx));
+    TEST_ASSERT_EQUAL(sizeof(expect), esp_panel_xpt2046_batch_build(2, 0x01, tx, sizeof(tx)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expect, tx, sizeof(expect));
+
+    // Only the power-down bits are taken
+    TEST_ASSERT_EQUAL(sizeof(expect), esp_panel_xpt2046_batch_build(2, 0xFD, tx, sizeof(tx)));
+    TEST_ASSERT_EQUAL_HEX8(0xB1, tx[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x91, tx[8]);
+
+    for (uint8_t samples = 1; samples <= ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX; samples++) {
+        size_t size = esp_panel_xpt2046_batch_build(samples, 0, tx, sizeof(tx));
+        TEST_ASSERT_EQUAL(ESP_PANEL_XPT2046_BATCH_SIZE(samples), size);
+
+        test_chip_t chip = {};
+        test_chip_transfer(chip, vector<uint8_t>(tx, tx + size));
+        TEST_ASSERT_FALSE(chip.is_overlapped);
+        TEST_ASSERT_EQUAL(3 + 2 * samples, chip.channels.size());
+        TEST_ASSERT_EQUAL(TEST_CHANNEL_Z1, chip.channels[0]);
+        TEST_ASSERT_EQUAL(TEST_CHANNEL_Z2, chip.channels[1]);
+        TEST_ASSERT_EQUAL(TEST_CHANNEL_X, chip.channels[2]);
+        for (int i = 0; i < samples; i++) {
+            TEST_ASSERT_EQUAL(TEST_CHANNEL_X, chip.channels[3 + i * 2]);
+            TEST_ASSERT_EQUAL(TEST_CHANNEL_Y, chip.channels[4 + i * 2]);
+        }
+    }
+}
+
+TEST_CASE("Test XPT2046 batch decodes a fixed stream", "[utils][xpt2046_batch]")
+{
+    // Z1 420, Z2 3600, discarded X 2000, then X/Y pairs (1000, 2000), (1010, 2020), (3000, 1990)
+    const uint8_t rx[] = {
+        0x00, 0x0D, 0x20, 0x70, 0x80, 0x3E, 0x80, 0x1F, 0x40, 0x3E,
+        0x80, 0x1F, 0x90, 0x3F, 0x20, 0x5D, 0xC0, 0x3E, 0x30,
+    };
+    esp_panel_xpt2046_batch_result_t result = {};
+
+    TEST_ASSERT_FALSE(esp_panel_xpt2046_batch_decode(3, rx, sizeof(rx) - 1, &result));
+    TEST_ASSERT_FALSE(esp_panel_xpt2046_batch_decode(0, rx, sizeof(rx), &result));
+    TEST_ASSERT_FALSE(esp_panel_xpt2046_batch_decode(3, rx, sizeof(rx), NULL));
+
+    TEST_ASSERT_TRUE(esp_panel_xpt2046_batch_decode(3, rx, sizeof(rx), &result));
+    TEST_ASSERT_EQUAL(420 + 4096 - 3600, result.z);
+    TEST_ASSERT_EQUAL(3, result.valid_num);
+    // The spike of X doesn't move the median, while the mean would be 1670
+    TEST_ASSERT_EQUAL(1010, result.x);
+    TEST_ASSERT_EQUAL(2000, result.y);
+}
+
+TEST_CASE("Test XPT2046 batch drops the pairs out of the range", "[utils][xpt2046_batch]")
+{
+    test_chip_t chip = {};
+    uint8_t tx[ESP_PANEL_XPT2046_BATCH_SIZE(4)];
+    size_t size = esp_panel_xpt2046_batch_build(4, 0, tx, sizeof(tx));
+    esp_panel_xpt2046_batch_result_t result = {};
+
+    // Pairs (49, 2000), (1000, 4047), (1200, 1500), (1300, 1600)
+    chip.values = {300, 3800, 0, 49, 2000, 1000, 4047, 1200, 1500, 1300, 1600};
+    vector<uint8_t> rx = test_chip_transfer(chip, vector<uint8_t>(tx, tx + size));
+    TEST_ASSERT_TRUE(esp_panel_xpt2046_batch_decode(4, rx.data(), rx.size(), &result));
+    TEST_ASSERT_EQUAL(300 + 4096 - 3800, result.z);
+    TEST_ASSERT_EQUAL(2, result.valid_num);
+    TEST_ASSERT_EQUAL(1250, result.x);
+    TEST_ASSERT_EQUAL(1550, result.y);
+
+    // No touch: the X/Y conversions float to the edges
+    chip.values = {0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 0};
+    rx = test_chip_transfer(chip, vector<uint8_t>(tx, tx + size));
+    TEST_ASSERT_TRUE(esp_panel_xpt2046_batch_decode(4, rx.data(), rx.size(), &result));
+    TEST_ASSERT_EQUAL(1, result.z);
+    TEST_ASSERT_EQUAL(0, result.valid_num);
+    TEST_ASSERT_EQUAL(0, result.x);
+    TEST_ASSERT_EQUAL(0, result.y);
+}
+
+TEST_CASE("Test XPT2046 batch decodes the modeled chip with random values", "[utils][xpt2046_batch]")
+{
+    srand(24);
+    uint8_t tx[ESP_PANEL_XPT2046_BATCH_SIZE(ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX)];
+
+    for (int round = 0; round < TEST_ROUND_NUM; round++) {
+        uint8_t samples = 1 + rand() % ESP_PANEL_XPT2046_BATCH_SAMPLES_MAX;
+        size_t size = esp_panel_xpt2046_batch_build(samples, rand() & 0x3, tx, sizeof(tx));
+        test_chip_t chip = {};
+        for (int i = 0; i < 3 + 2 * samples; i++) {
+            chip.values.push_back(rand() % ESP_PANEL_XPT2046_BATCH_ADC_LIMIT);
+        }
+        vector<uint8_t> rx = test_chip_transfer(chip, vector<uint8_t>(tx, tx + size));
+
+        vector<uint16_t> x;
+        vector<uint16_t> y;
+        for (int i = 0; i < samples; i++) {
+            uint16_t x_adc = chip.values[3 + i * 2];
+            uint16_t y_adc = chip.values[4 + i * 2];
+            if ((x_adc >= 50) && (x_adc <= 4046) && (y_adc >= 50) && (y_adc <= 4046)) {
+                x.push_back(x_adc);
+                y.push_back(y_adc);
+            }
+        }
+        esp_panel_xpt2046_batch_result_t result = {};
+        TEST_ASSERT_TRUE(esp_panel_xpt2046_batch_decode(samples, rx.data(), rx.size(), &result));
+        TEST_ASSERT_EQUAL(chip.values[0] + 4096 - chip.values[1], result.z);
+        TEST_ASSERT_EQUAL(x.size(), result.valid_num);
+        TEST_ASSERT_EQUAL(x.empty() ? 0 : test_get_median(x), result.x);
+        TEST_ASSERT_EQUAL(y.empty() ? 0 : test_get_median(y), result.y);
+    }
+}
+
+TEST_CASE("Benchmark XPT2046 batch reads against separate reads", "[utils][xpt2046_batch][benchmark]")
+{
+    const uint8_t samples_list[] = {1, 3, 5, 8};
+    const uint32_t clock_hz = 1000000;
+
+    // The separate reads take a 24-clock transaction per conversion
+    printf("Bus use of a touched poll at %d MHz, without the setup time of every transaction\n",
+           (int)(clock_hz / 1000000));
+    printf("| samples | transactions (separate / batch) | clocks (separate / batch) "
+           "| bus time (us) (separate / batch) |\n");
+    printf("|---------|---------------------------------|---------------------------"
+           "|----------------------------------|\n");
+    for (auto samples : samples_list) {
+        int reads = 3 + 2 * samples;
+        uint32_t separate_clocks = reads * 24;
+        uint32_t batch_clocks = ESP_PANEL_XPT2046_BATCH_SIZE(samples) * 8;
+        printf("| %7d | %15d / %-13d | %11d / %-11d | %15.0f / %-14.0f |\n", samples, reads, 1,
+               (int)separate_clocks, (int)batch_clocks, separate_clocks * 1e6 / clock_hz,
+               batch_clocks * 1e6 / clock_hz);
+        TEST_ASSERT_LESS_THAN(separate_clocks, batch_clocks);
+    }
+}